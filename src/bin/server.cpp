@@ -78,6 +78,8 @@ cxxopts::Options get_server_cli_options() {
                        "at server start (e.g., \"TPC-C:5\", \"TPC-DS:5\", or \"TPC-H:10\"). Supported are TPC-C, "
                        "TPC-DS, and TPC-H. The sizing factor determines the scale factor in TPC-DS and TPC-H, and the "
                        "warehouse count in TPC-C.", cxxopts::value<std::string>())
+    ("io_threads", "Number of threads that wait for connections and requests. Queries are executed by the scheduler",
+                   cxxopts::value<uint32_t>()->default_value(std::to_string(hyrise::Server::DEFAULT_IO_THREAD_COUNT)))
     ("execution_info", "Send execution information after statement execution", cxxopts::value<bool>()->default_value("false"));  // NOLINT(whitespace/line_length)
   // clang-format on
 
@@ -108,13 +110,15 @@ int main(int argc, char* argv[]) {
 
   const auto execution_info = parsed_options["execution_info"].as<bool>();
   const auto port = parsed_options["port"].as<uint16_t>();
+  const auto io_thread_count = parsed_options["io_threads"].as<uint32_t>();
 
   auto error = boost::system::error_code{};
   const auto address = boost::asio::ip::make_address(parsed_options["address"].as<std::string>(), error);
 
   Assert(!error, "Not a valid IPv4 address: " + parsed_options["address"].as<std::string>() + ", terminating...");
 
-  auto server = hyrise::Server{address, port, static_cast<hyrise::SendExecutionInfo>(execution_info)};
+  auto server =
+      hyrise::Server{address, port, static_cast<hyrise::SendExecutionInfo>(execution_info), io_thread_count};
   server.run();
 
   return 0;
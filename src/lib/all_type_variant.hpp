@@ -48,7 +48,11 @@ namespace detail {
 #define DATA_TYPE_ENUM_VALUES BOOST_PP_SEQ_TRANSFORM(GET_ELEM, 1, DATA_TYPE_INFO)
 #define DATA_TYPE_STRINGS BOOST_PP_SEQ_TRANSFORM(GET_ELEM, 2, DATA_TYPE_INFO)
 
-enum class DataType : uint8_t { Null, BOOST_PP_SEQ_ENUM(DATA_TYPE_ENUM_VALUES) };
+// Date is a logical data type that is not part of DATA_TYPE_INFO. Its values are stored as int32_t, namely as the
+// number of days since 1970-01-01 (see storage_data_type()). Thus, no templates are instantiated for it, and range
+// predicates on dates are evaluated as integer comparisons. As a DATE value is an int32_t in an AllTypeVariant, Date
+// has to remain the last enum value so that the enum values of the other data types match the variant's indices.
+enum class DataType : uint8_t { Null, BOOST_PP_SEQ_ENUM(DATA_TYPE_ENUM_VALUES), Date };
 
 static constexpr auto data_types = hana::to_tuple(hana::tuple_t<BOOST_PP_SEQ_ENUM(DATA_TYPES)>);
 static constexpr auto data_type_enum_values =
@@ -88,11 +92,21 @@ inline bool variant_is_null(const AllTypeVariant& variant) {
   return (variant.which() == 0);
 }
 
-const auto data_type_to_string =
-    hana::fold(data_type_enum_string_pairs, boost::bimap<DataType, std::string>{}, [](auto map, auto pair) {
-      map.insert({hana::first(pair), std::string{hana::second(pair)}});
-      return map;
-    });
+const auto data_type_to_string = [] {
+  auto data_type_strings =
+      hana::fold(data_type_enum_string_pairs, boost::bimap<DataType, std::string>{}, [](auto map, auto pair) {
+        map.insert({hana::first(pair), std::string{hana::second(pair)}});
+        return map;
+      });
+  data_type_strings.insert({DataType::Date, std::string{"date"}});
+  return data_type_strings;
+}();
+
+// Returns the data type that segments and AllTypeVariants use to store values of the given data type, i.e., Int for
+// Date and the data type itself for all other data types.
+constexpr DataType storage_data_type(const DataType data_type) {
+  return data_type == DataType::Date ? DataType::Int : data_type;
+}
 
 std::ostream& operator<<(std::ostream& stream, const DataType data_type);
 
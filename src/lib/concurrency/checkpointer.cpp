@@ -0,0 +1,548 @@
+#include "checkpointer.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "concurrency/write_ahead_log.hpp"
+#include "hyrise.hpp"
+#include "import_export/binary/binary_parser.hpp"
+#include "import_export/binary/binary_writer.hpp"
+#include "resolve_type.hpp"
+#include "statistics/generate_pruning_statistics.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/chunk.hpp"
+#include "storage/mvcc_data.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+#include "utils/atomic_max.hpp"
+#include "utils/pausable_loop_thread.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT(build/namespaces)
+
+constexpr auto MANIFEST_VERSION = uint32_t{1};
+constexpr auto MANIFEST_FILE = "manifest";
+constexpr auto TABLES_DIRECTORY = "tables";
+constexpr auto DEFINITION_FILE = "definition.bin";
+
+template <typename T>
+void write_value(std::ofstream& stream, const T& value) {
+  stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+void write_string(std::ofstream& stream, const std::string& value) {
+  write_value(stream, static_cast<uint32_t>(value.size()));
+  stream.write(value.data(), static_cast<std::streamsize>(value.size()));
+}
+
+template <typename T>
+T read_value(std::ifstream& stream) {
+  auto value = T{};
+  stream.read(reinterpret_cast<char*>(&value), sizeof(T));
+  return value;
+}
+
+std::string read_string(std::ifstream& stream) {
+  auto value = std::string(read_value<uint32_t>(stream), '\0');
+  stream.read(value.data(), static_cast<std::streamsize>(value.size()));
+  return value;
+}
+
+std::ofstream open_for_writing(const std::filesystem::path& path) {
+  auto stream = std::ofstream{};
+  stream.exceptions(std::ofstream::failbit | std::ofstream::badbit);
+  stream.open(path, std::ios::binary | std::ios::trunc);
+  return stream;
+}
+
+std::ifstream open_for_reading(const std::filesystem::path& path) {
+  auto stream = std::ifstream{};
+  stream.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+  stream.open(path, std::ios::binary);
+  return stream;
+}
+
+// Persists the content of a file or the entries of a directory. The streams of the BinaryWriter do not offer a way to
+// do so.
+void sync(const std::filesystem::path& path) {
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg,hicpp-vararg)
+  const auto file_descriptor = open(path.c_str(), O_RDONLY);
+  Assert(file_descriptor >= 0, "Failed to open '" + path.string() + "': " + std::strerror(errno));
+  const auto sync_result = fsync(file_descriptor);
+  close(file_descriptor);
+  Assert(sync_result == 0, "Failed to sync '" + path.string() + "': " + std::strerror(errno));
+}
+
+// Writes a table that consists of a single chunk with the given segments. The segments are shared, not copied.
+void write_chunk_data(const Table& table, const Segments& segments,
+                      const std::vector<SortColumnDefinition>& sorted_by, const std::filesystem::path& path) {
+  auto chunk_table = Table{table.column_definitions(), TableType::Data, table.target_chunk_size(), UseMvcc::No};
+  chunk_table.append_chunk(segments);
+  if (!sorted_by.empty()) {
+    const auto chunk = chunk_table.last_chunk();
+    chunk->set_immutable();
+    chunk->set_individually_sorted_by(sorted_by);
+  }
+
+  BinaryWriter::write(chunk_table, path.string());
+  sync(path);
+}
+
+// Copies the values of committed rows of a mutable chunk. Rows that are not visible as of the checkpoint commit ID
+// might still be written concurrently. They are replaced by default values and replayed from the log if necessary.
+Segments snapshot_segments(const Table& table, const Chunk& chunk, const std::vector<CommitID>& begin_cids,
+                           const CommitID commit_id) {
+  const auto chunk_size = static_cast<ChunkOffset>(begin_cids.size());
+  const auto column_count = table.column_count();
+
+  auto segments = Segments{};
+  segments.reserve(column_count);
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    resolve_data_type(table.column_data_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      const auto value_segment =
+          std::dynamic_pointer_cast<const ValueSegment<ColumnDataType>>(chunk.get_segment(column_id));
+      Assert(value_segment, "Mutable chunks are expected to consist of ValueSegments.");
+
+      const auto is_nullable = table.column_is_nullable(column_id);
+      auto values = pmr_vector<ColumnDataType>(chunk_size);
+      auto null_values = pmr_vector<bool>(is_nullable ? chunk_size : 0);
+      const auto& source_values = value_segment->values();
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+        if (begin_cids[chunk_offset] > commit_id) {
+          continue;
+        }
+
+        values[chunk_offset] = source_values[chunk_offset];
+        if (is_nullable) {
+          null_values[chunk_offset] = value_segment->is_null(chunk_offset);
+        }
+      }
+
+      if (is_nullable) {
+        segments.emplace_back(
+            std::make_shared<ValueSegment<ColumnDataType>>(std::move(values), std::move(null_values)));
+      } else {
+        segments.emplace_back(std::make_shared<ValueSegment<ColumnDataType>>(std::move(values)));
+      }
+    });
+  }
+
+  return segments;
+}
+
+}  // namespace
+
+namespace hyrise {
+
+Checkpointer::Checkpointer(const std::filesystem::path& directory) : _directory{directory} {
+  std::filesystem::create_directories(_directory / TABLES_DIRECTORY);
+}
+
+Checkpointer::~Checkpointer() {
+  stop();
+}
+
+CommitID Checkpointer::load() {
+  const auto lock = std::lock_guard<std::mutex>{_checkpoint_mutex};
+  auto& transaction_manager = Hyrise::get().transaction_manager;
+  auto& storage_manager = Hyrise::get().storage_manager;
+
+  const auto manifest_path = _directory / MANIFEST_FILE;
+  if (!std::filesystem::exists(manifest_path)) {
+    return transaction_manager.last_commit_id();
+  }
+
+  auto manifest = open_for_reading(manifest_path);
+  Assert(read_value<uint32_t>(manifest) == MANIFEST_VERSION, "Unsupported checkpoint version.");
+  const auto commit_id = read_value<CommitID>(manifest);
+  _checkpoint_number = read_value<uint64_t>(manifest);
+  _next_table_directory_id = read_value<uint64_t>(manifest);
+
+  const auto table_count = read_value<uint32_t>(manifest);
+  for (auto table_index = uint32_t{0}; table_index < table_count; ++table_index) {
+    const auto table_name = read_string(manifest);
+    auto checkpointed_table = CheckpointedTable{};
+    checkpointed_table.directory = read_string(manifest);
+    const auto table_directory = _directory / TABLES_DIRECTORY / checkpointed_table.directory;
+
+    // The StorageManager requires all chunks to exist when a table is added, which is not the case for removed chunks.
+    // Thus, the empty table is added first and its statistics are generated after the chunks have been loaded.
+    const auto table = BinaryParser::parse((table_directory / DEFINITION_FILE).string());
+    storage_manager.add_table(table_name, table);
+    checkpointed_table.table = table;
+
+    const auto chunk_count = read_value<uint32_t>(manifest);
+    checkpointed_table.chunks.reserve(chunk_count);
+    for (auto chunk_id = uint32_t{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto state = read_value<ChunkState>(manifest);
+      const auto data_file = read_string(manifest);
+      const auto mvcc_file = read_string(manifest);
+      checkpointed_table.chunks.emplace_back(
+          _load_chunk(*table, state, data_file, mvcc_file, table_directory, chunk_id + 1 == chunk_count));
+    }
+
+    table->set_table_statistics(TableStatistics::from_table(*table));
+    generate_chunk_pruning_statistics(table);
+
+    _tables.emplace(table_name, std::move(checkpointed_table));
+  }
+
+  _checkpoint_commit_id = commit_id;
+  transaction_manager._set_last_commit_id(commit_id);
+
+  // Remove the files of a checkpoint that has not been completed.
+  _remove_unreferenced_files(_tables);
+
+  return commit_id;
+}
+
+CommitID Checkpointer::checkpoint() {
+  const auto lock = std::lock_guard<std::mutex>{_checkpoint_mutex};
+
+  // Entries that are persisted from now on are written to a new segment of the log. The previous segments can be
+  // removed once this checkpoint is complete unless they hold entries that the checkpoint does not cover.
+  const auto& write_ahead_log = Hyrise::get().write_ahead_log;
+  if (write_ahead_log) {
+    write_ahead_log->rotate();
+  }
+
+  // All transactions up to the last commit ID have written their commit IDs. The commit ID has to be retrieved before
+  // the tables are listed: tables that are created or dropped afterwards are recreated or dropped again when the log
+  // is replayed.
+  const auto commit_id = Hyrise::get().transaction_manager.last_commit_id();
+  ++_checkpoint_number;
+
+  auto checkpointed_tables = std::unordered_map<std::string, CheckpointedTable>{};
+  for (const auto& [table_name, table] : Hyrise::get().storage_manager.tables()) {
+    const auto previous_iter = _tables.find(table_name);
+    const auto is_same_table = previous_iter != _tables.end() && previous_iter->second.table.lock() == table;
+    const auto* const previous_table = is_same_table ? &previous_iter->second : nullptr;
+
+    auto checkpointed_table = CheckpointedTable{};
+    checkpointed_table.table = table;
+    checkpointed_table.directory =
+        previous_table ? previous_table->directory : std::to_string(_next_table_directory_id++);
+    const auto table_directory = _directory / TABLES_DIRECTORY / checkpointed_table.directory;
+
+    if (!previous_table) {
+      std::filesystem::create_directories(table_directory);
+      const auto definition =
+          Table{table->column_definitions(), TableType::Data, table->target_chunk_size(), UseMvcc::No};
+      BinaryWriter::write(definition, (table_directory / DEFINITION_FILE).string());
+      sync(table_directory / DEFINITION_FILE);
+    }
+
+    const auto chunk_count = table->chunk_count();
+    checkpointed_table.chunks.reserve(chunk_count);
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto* const previous_chunk =
+          previous_table && chunk_id < previous_table->chunks.size() ? &previous_table->chunks[chunk_id] : nullptr;
+      checkpointed_table.chunks.emplace_back(
+          _write_chunk(*table, chunk_id, previous_chunk, table_directory, commit_id));
+    }
+
+    sync(table_directory);
+    checkpointed_tables.emplace(table_name, std::move(checkpointed_table));
+  }
+
+  _write_manifest(checkpointed_tables, commit_id);
+  _tables = std::move(checkpointed_tables);
+  _checkpoint_commit_id = commit_id;
+
+  _remove_unreferenced_files(_tables);
+  if (write_ahead_log) {
+    write_ahead_log->remove_segments(commit_id);
+  }
+
+  return commit_id;
+}
+
+void Checkpointer::start(const std::chrono::milliseconds interval) {
+  stop();
+  _loop_thread = std::make_unique<PausableLoopThread>(interval, [&](size_t /*count*/) {
+    checkpoint();
+  });
+}
+
+void Checkpointer::stop() {
+  _loop_thread = nullptr;
+}
+
+CommitID Checkpointer::checkpoint_commit_id() const {
+  return _checkpoint_commit_id.load();
+}
+
+const std::filesystem::path& Checkpointer::directory() const {
+  return _directory;
+}
+
+Checkpointer::CheckpointedChunk Checkpointer::_load_chunk(Table& table, const ChunkState state,
+                                                          const std::string& data_file, const std::string& mvcc_file,
+                                                          const std::filesystem::path& table_directory,
+                                                          const bool is_last_chunk) {
+  auto checkpointed_chunk = CheckpointedChunk{};
+  checkpointed_chunk.state = state;
+  checkpointed_chunk.data_file = data_file;
+  checkpointed_chunk.mvcc_file = mvcc_file;
+
+  // Removed chunks and empty mutable chunks are not persisted. The latter are kept if they are the last chunk of the
+  // table, as they are going to receive the next Inserts.
+  if (data_file.empty()) {
+    table.append_mutable_chunk();
+    if (state == ChunkState::Removed || !is_last_chunk) {
+      table.remove_chunk(ChunkID{table.chunk_count() - 1});
+    }
+    return checkpointed_chunk;
+  }
+
+  const auto data = BinaryParser::parse((table_directory / data_file).string());
+  Assert(data->chunk_count() == 1, "Expected a single chunk in '" + data_file + "'.");
+  const auto data_chunk = data->get_chunk(ChunkID{0});
+  const auto chunk_size = data_chunk->size();
+
+  auto mvcc_stream = open_for_reading(table_directory / mvcc_file);
+  Assert(read_value<ChunkOffset>(mvcc_stream) == chunk_size, "MvccData does not match chunk '" + data_file + "'.");
+  const auto mvcc_bytes = static_cast<std::streamsize>(chunk_size * sizeof(CommitID));
+  auto begin_cids = std::vector<CommitID>(chunk_size);
+  auto end_cids = std::vector<CommitID>(chunk_size);
+  mvcc_stream.read(reinterpret_cast<char*>(begin_cids.data()), mvcc_bytes);
+  mvcc_stream.read(reinterpret_cast<char*>(end_cids.data()), mvcc_bytes);
+
+  if (state == ChunkState::Immutable) {
+    const auto column_count = table.column_count();
+    auto segments = Segments{};
+    segments.reserve(column_count);
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      segments.emplace_back(data_chunk->get_segment(column_id));
+      checkpointed_chunk.segments.emplace_back(segments.back());
+    }
+
+    table.append_chunk(segments, std::make_shared<MvccData>(chunk_size, CommitID{0}));
+  } else {
+    table.append_mutable_chunk();
+    const auto chunk = table.last_chunk();
+    const auto column_count = table.column_count();
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      resolve_data_type(table.column_data_type(column_id), [&](const auto data_type_t) {
+        using ColumnDataType = typename decltype(data_type_t)::type;
+
+        const auto& source_segment =
+            static_cast<const ValueSegment<ColumnDataType>&>(*data_chunk->get_segment(column_id));
+        auto& target_segment = static_cast<ValueSegment<ColumnDataType>&>(*chunk->get_segment(column_id));
+        target_segment.resize(chunk_size);
+        std::copy(source_segment.values().begin(), source_segment.values().end(), target_segment.values().begin());
+        if (source_segment.is_nullable()) {
+          for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+            if (source_segment.is_null(chunk_offset)) {
+              target_segment.set_null_value(chunk_offset);
+            }
+          }
+        }
+      });
+    }
+  }
+
+  // Rows of transactions that had not committed as of the checkpoint commit ID keep MAX_COMMIT_ID as their begin
+  // commit ID. They are either replayed from the log or invalidated by LogRecovery.
+  const auto chunk = table.last_chunk();
+  const auto& mvcc_data = chunk->mvcc_data();
+  auto max_begin_cid = CommitID{0};
+  auto invalid_row_count = ChunkOffset{0};
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+    mvcc_data->set_begin_cid(chunk_offset, begin_cids[chunk_offset]);
+    mvcc_data->set_end_cid(chunk_offset, end_cids[chunk_offset]);
+
+    if (begin_cids[chunk_offset] == MvccData::MAX_COMMIT_ID) {
+      checkpointed_chunk.has_masked_rows = true;
+    } else {
+      max_begin_cid = std::max(max_begin_cid, begin_cids[chunk_offset]);
+    }
+
+    if (end_cids[chunk_offset] != MvccData::MAX_COMMIT_ID) {
+      set_atomic_max(mvcc_data->max_end_cid, end_cids[chunk_offset]);
+      ++invalid_row_count;
+    }
+  }
+
+  // Setting max_begin_cid before the chunk is marked as immutable avoids that set_immutable() considers masked rows.
+  set_atomic_max(mvcc_data->max_begin_cid, max_begin_cid);
+  if (invalid_row_count > 0) {
+    chunk->increase_invalid_row_count(invalid_row_count);
+  }
+
+  if (state == ChunkState::Immutable) {
+    chunk->set_immutable();
+    if (!data_chunk->individually_sorted_by().empty()) {
+      chunk->set_individually_sorted_by(data_chunk->individually_sorted_by());
+    }
+  }
+
+  checkpointed_chunk.max_end_cid = mvcc_data->max_end_cid.load();
+  return checkpointed_chunk;
+}
+
+Checkpointer::CheckpointedChunk Checkpointer::_write_chunk(const Table& table, const ChunkID chunk_id,
+                                                           const CheckpointedChunk* previous,
+                                                           const std::filesystem::path& table_directory,
+                                                           const CommitID commit_id) {
+  auto checkpointed_chunk = CheckpointedChunk{};
+  const auto chunk = table.get_chunk(chunk_id);
+  if (!chunk) {
+    return checkpointed_chunk;
+  }
+
+  const auto is_mutable = chunk->is_mutable();
+  const auto chunk_size = chunk->size();
+  checkpointed_chunk.state = is_mutable ? ChunkState::Mutable : ChunkState::Immutable;
+  if (chunk_size == 0) {
+    return checkpointed_chunk;
+  }
+
+  const auto file_prefix = std::to_string(chunk_id) + "_" + std::to_string(_checkpoint_number);
+  const auto was_immutable = previous && previous->state == ChunkState::Immutable;
+
+  // The MvccData is captured first: rows whose begin commit ID is not greater than the checkpoint commit ID have been
+  // written completely. Commit IDs of later transactions are masked, and the rows are considered as not yet committed.
+  const auto& mvcc_data = chunk->mvcc_data();
+  checkpointed_chunk.max_end_cid = mvcc_data->max_end_cid.load();
+  auto begin_cids = std::vector<CommitID>(chunk_size);
+  if (!is_mutable && was_immutable && !previous->has_masked_rows &&
+      previous->max_end_cid == checkpointed_chunk.max_end_cid) {
+    checkpointed_chunk.mvcc_file = previous->mvcc_file;
+  } else {
+    auto end_cids = std::vector<CommitID>(chunk_size);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      begin_cids[chunk_offset] = mvcc_data->get_begin_cid(chunk_offset);
+      end_cids[chunk_offset] = mvcc_data->get_end_cid(chunk_offset);
+
+      if (begin_cids[chunk_offset] > commit_id) {
+        begin_cids[chunk_offset] = MvccData::MAX_COMMIT_ID;
+        checkpointed_chunk.has_masked_rows = true;
+      }
+
+      if (end_cids[chunk_offset] > commit_id && end_cids[chunk_offset] != MvccData::MAX_COMMIT_ID) {
+        end_cids[chunk_offset] = MvccData::MAX_COMMIT_ID;
+        checkpointed_chunk.has_masked_rows = true;
+      }
+    }
+
+    checkpointed_chunk.mvcc_file = file_prefix + ".mvcc";
+    {
+      const auto mvcc_bytes = static_cast<std::streamsize>(chunk_size * sizeof(CommitID));
+      auto mvcc_stream = open_for_writing(table_directory / checkpointed_chunk.mvcc_file);
+      write_value(mvcc_stream, chunk_size);
+      mvcc_stream.write(reinterpret_cast<const char*>(begin_cids.data()), mvcc_bytes);
+      mvcc_stream.write(reinterpret_cast<const char*>(end_cids.data()), mvcc_bytes);
+    }
+    sync(table_directory / checkpointed_chunk.mvcc_file);
+  }
+
+  if (is_mutable) {
+    checkpointed_chunk.data_file = file_prefix + ".bin";
+    write_chunk_data(table, snapshot_segments(table, *chunk, begin_cids, commit_id), {},
+                     table_directory / checkpointed_chunk.data_file);
+    return checkpointed_chunk;
+  }
+
+  // Immutable chunks are only rewritten if their segments have been replaced, e.g., by the ChunkEncoder.
+  const auto column_count = table.column_count();
+  auto segments = Segments{};
+  segments.reserve(column_count);
+  auto segments_unchanged = was_immutable && previous->segments.size() == column_count;
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    segments.emplace_back(chunk->get_segment(column_id));
+    checkpointed_chunk.segments.emplace_back(segments.back());
+    segments_unchanged = segments_unchanged && previous->segments[column_id].lock() == segments.back();
+  }
+
+  if (segments_unchanged) {
+    checkpointed_chunk.data_file = previous->data_file;
+  } else {
+    checkpointed_chunk.data_file = file_prefix + ".bin";
+    write_chunk_data(table, segments, chunk->individually_sorted_by(), table_directory / checkpointed_chunk.data_file);
+  }
+
+  return checkpointed_chunk;
+}
+
+void Checkpointer::_write_manifest(const std::unordered_map<std::string, CheckpointedTable>& tables,
+                                   const CommitID commit_id) {
+  const auto manifest_path = _directory / MANIFEST_FILE;
+  auto temporary_path = manifest_path;
+  temporary_path += ".tmp";
+
+  {
+    auto manifest = open_for_writing(temporary_path);
+    write_value(manifest, MANIFEST_VERSION);
+    write_value(manifest, commit_id);
+    write_value(manifest, _checkpoint_number);
+    write_value(manifest, _next_table_directory_id);
+
+    write_value(manifest, static_cast<uint32_t>(tables.size()));
+    for (const auto& [table_name, checkpointed_table] : tables) {
+      write_string(manifest, table_name);
+      write_string(manifest, checkpointed_table.directory);
+      write_value(manifest, static_cast<uint32_t>(checkpointed_table.chunks.size()));
+      for (const auto& checkpointed_chunk : checkpointed_table.chunks) {
+        write_value(manifest, checkpointed_chunk.state);
+        write_string(manifest, checkpointed_chunk.data_file);
+        write_string(manifest, checkpointed_chunk.mvcc_file);
+      }
+    }
+  }
+
+  // Renaming is atomic. Once the directory has been synced, the new checkpoint replaces the previous one.
+  sync(temporary_path);
+  std::filesystem::rename(temporary_path, manifest_path);
+  sync(_directory);
+}
+
+void Checkpointer::_remove_unreferenced_files(const std::unordered_map<std::string, CheckpointedTable>& tables) {
+  auto referenced_files = std::unordered_map<std::string, std::unordered_set<std::string>>{};
+  for (const auto& [_, checkpointed_table] : tables) {
+    auto& files = referenced_files[checkpointed_table.directory];
+    files.emplace(DEFINITION_FILE);
+    for (const auto& checkpointed_chunk : checkpointed_table.chunks) {
+      files.emplace(checkpointed_chunk.data_file);
+      files.emplace(checkpointed_chunk.mvcc_file);
+    }
+  }
+
+  for (const auto& table_directory : std::filesystem::directory_iterator{_directory / TABLES_DIRECTORY}) {
+    const auto files_iter = referenced_files.find(table_directory.path().filename().string());
+    if (files_iter == referenced_files.end()) {
+      std::filesystem::remove_all(table_directory.path());
+      continue;
+    }
+
+    for (const auto& file : std::filesystem::directory_iterator{table_directory.path()}) {
+      if (!files_iter->second.contains(file.path().filename().string())) {
+        std::filesystem::remove(file.path());
+      }
+    }
+  }
+}
+
+}  // namespace hyrise
@@ -0,0 +1,123 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "types.hpp"
+
+namespace hyrise {
+
+class AbstractSegment;
+class Table;
+struct PausableLoopThread;
+
+/**
+ * The Checkpointer persists the tables of the StorageManager so that recovery does not have to replay the entire
+ * WriteAheadLog. A checkpoint captures the state of all tables as of a checkpoint commit ID C, which is the last
+ * commit ID when the checkpoint started. Transactions are not blocked while a checkpoint is taken. Rows inserted or
+ * deleted by transactions with a commit ID greater than C are persisted as if these transactions had not committed
+ * yet. After loading the checkpoint, LogRecovery skips all entries up to C and only replays the tail of the log.
+ *
+ * Checkpoints are incremental. Each chunk is written to its own file using the BinaryWriter, i.e., in its current
+ * encoding. Immutable chunks are written once and only rewritten if their segments have been replaced (e.g., when the
+ * chunk has been encoded after the previous checkpoint). The MvccData of a chunk is stored separately and only
+ * rewritten if rows have been deleted since the previous checkpoint or if the chunk contained rows of transactions
+ * that had not committed up to C. Mutable chunks are still being appended to and are rewritten with every checkpoint.
+ *
+ * The checkpoint directory contains a manifest that lists the files of the latest checkpoint. The manifest is
+ * replaced atomically after all files of a checkpoint have been persisted. Files that are not referenced by the
+ * manifest anymore are removed afterwards. A crash during a checkpoint thus leaves the previous checkpoint intact.
+ *
+ * On startup, the checkpoint is loaded before the log is replayed:
+ *
+ *   auto checkpointer = std::make_shared<Checkpointer>(checkpoint_directory);
+ *   checkpointer->load();
+ *   LogRecovery::recover(log_path);
+ *   Hyrise::get().write_ahead_log = std::make_shared<WriteAheadLog>(log_path);
+ *   Hyrise::get().checkpointer = checkpointer;
+ *   checkpointer->start(interval);
+ *
+ * When the WriteAheadLog is enabled, each checkpoint rotates it to a new segment. Once the manifest has been
+ * persisted, the segments that only hold entries covered by the checkpoint are removed. Only tables that are part of
+ * the StorageManager are checkpointed. Chunk indexes, table indexes, and key constraints are not persisted.
+ */
+class Checkpointer : public Noncopyable {
+ public:
+  explicit Checkpointer(const std::filesystem::path& directory);
+
+  // Stops periodic checkpointing. A checkpoint that is currently being taken is completed.
+  ~Checkpointer();
+
+  // Adds the tables of the latest checkpoint to the StorageManager and lets the TransactionManager continue with the
+  // checkpoint commit ID. Must be called on startup before any transaction is started. Returns the checkpoint commit
+  // ID (or the last commit ID if no checkpoint exists).
+  CommitID load();
+
+  // Takes a checkpoint and returns its commit ID. Concurrent calls are serialized.
+  CommitID checkpoint();
+
+  // Starts or stops taking checkpoints in the background in the given interval.
+  void start(const std::chrono::milliseconds interval);
+  void stop();
+
+  // Commit ID of the latest checkpoint that has been taken or loaded.
+  CommitID checkpoint_commit_id() const;
+
+  const std::filesystem::path& directory() const;
+
+ private:
+  enum class ChunkState : uint8_t { Removed, Immutable, Mutable };
+
+  struct CheckpointedChunk {
+    ChunkState state{ChunkState::Removed};
+    // File names relative to the table's directory. Empty for removed and empty mutable chunks.
+    std::string data_file;
+    std::string mvcc_file;
+
+    // The segments that have been written for immutable chunks. If the chunk's segments are replaced, it is
+    // rewritten.
+    std::vector<std::weak_ptr<const AbstractSegment>> segments;
+    // The MvccData is rewritten if rows have been deleted or if it has been written with masked commit IDs.
+    CommitID max_end_cid{0};
+    bool has_masked_rows{false};
+  };
+
+  struct CheckpointedTable {
+    // Detects tables that have been dropped and recreated with the same name.
+    std::weak_ptr<const Table> table;
+    std::string directory;
+    std::vector<CheckpointedChunk> chunks;
+  };
+
+  CheckpointedChunk _load_chunk(Table& table, const ChunkState state, const std::string& data_file,
+                                const std::string& mvcc_file, const std::filesystem::path& table_directory,
+                                const bool is_last_chunk);
+
+  CheckpointedChunk _write_chunk(const Table& table, const ChunkID chunk_id, const CheckpointedChunk* previous,
+                                 const std::filesystem::path& table_directory, const CommitID commit_id);
+
+  void _write_manifest(const std::unordered_map<std::string, CheckpointedTable>& tables, const CommitID commit_id);
+
+  // Removes all files that are not referenced by the given tables.
+  void _remove_unreferenced_files(const std::unordered_map<std::string, CheckpointedTable>& tables);
+
+  const std::filesystem::path _directory;
+
+  std::mutex _checkpoint_mutex;
+  std::atomic<CommitID> _checkpoint_commit_id{CommitID{0}};
+  uint64_t _checkpoint_number{0};
+  uint64_t _next_table_directory_id{0};
+  std::unordered_map<std::string, CheckpointedTable> _tables;
+
+  // Declared last so that the background thread is stopped before the other members are destructed.
+  std::unique_ptr<PausableLoopThread> _loop_thread;
+};
+
+}  // namespace hyrise
@@ -0,0 +1,168 @@
+#include "log_entry.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/pos_lists/abstract_pos_list.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace hyrise {
+
+LogEntryWriter::LogEntryWriter(const LogEntryType type, const CommitID commit_id) : _type{type} {
+  _buffer.resize(HEADER_BYTES);
+  write(type);
+  write(commit_id);
+
+  if (type == LogEntryType::Commit) {
+    // Placeholder for the record count, which is filled in by finish().
+    write(uint32_t{0});
+  }
+}
+
+void LogEntryWriter::add_insert(const std::string& table_name, const Table& table, const ChunkID chunk_id,
+                                const ChunkOffset begin_chunk_offset, const ChunkOffset end_chunk_offset) {
+  const auto record_bytes_offset = _begin_record(LogRecordType::Insert, table_name);
+  write(chunk_id);
+  write(begin_chunk_offset);
+  write(end_chunk_offset);
+
+  const auto chunk = table.get_chunk(chunk_id);
+  Assert(chunk, "Chunk of logged Insert has been removed.");
+
+  const auto column_count = table.column_count();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    resolve_data_type(table.column_data_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      const auto value_segment =
+          std::dynamic_pointer_cast<const ValueSegment<ColumnDataType>>(chunk->get_segment(column_id));
+      Assert(value_segment, "Inserted rows can only be logged for ValueSegments.");
+
+      const auto& values = value_segment->values();
+      for (auto chunk_offset = begin_chunk_offset; chunk_offset < end_chunk_offset; ++chunk_offset) {
+        const auto is_null = value_segment->is_null(chunk_offset);
+        write(is_null);
+        if (is_null) {
+          continue;
+        }
+
+        if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+          write_string(values[chunk_offset]);
+        } else {
+          write(values[chunk_offset]);
+        }
+      }
+    });
+  }
+
+  _finish_record(record_bytes_offset);
+}
+
+void LogEntryWriter::add_delete(const std::string& table_name, const AbstractPosList& pos_list) {
+  const auto record_bytes_offset = _begin_record(LogRecordType::Delete, table_name);
+  write(static_cast<uint32_t>(pos_list.size()));
+  for (const auto row_id : pos_list) {
+    write(row_id.chunk_id);
+    write(row_id.chunk_offset);
+  }
+
+  _finish_record(record_bytes_offset);
+}
+
+void LogEntryWriter::add_create_table(const std::string& table_name, const Table& table) {
+  const auto record_bytes_offset = _begin_record(LogRecordType::CreateTable, table_name);
+  write(table.target_chunk_size());
+  write(table.uses_mvcc());
+
+  const auto& column_definitions = table.column_definitions();
+  write(static_cast<uint16_t>(column_definitions.size()));
+  for (const auto& column_definition : column_definitions) {
+    write_string(column_definition.name);
+    write(column_definition.data_type);
+    write(column_definition.nullable);
+  }
+
+  _finish_record(record_bytes_offset);
+}
+
+void LogEntryWriter::write_string(const std::string_view value) {
+  write(static_cast<uint32_t>(value.size()));
+  _buffer.insert(_buffer.end(), value.begin(), value.end());
+}
+
+uint32_t LogEntryWriter::record_count() const {
+  return _record_count;
+}
+
+std::vector<char> LogEntryWriter::finish() {
+  constexpr auto RECORD_COUNT_OFFSET = HEADER_BYTES + sizeof(LogEntryType) + sizeof(CommitID);
+  if (_type == LogEntryType::Commit) {
+    std::memcpy(_buffer.data() + RECORD_COUNT_OFFSET, &_record_count, sizeof(_record_count));
+  }
+
+  const auto payload_bytes = static_cast<uint32_t>(_buffer.size() - HEADER_BYTES);
+  const auto checksum = log_entry_checksum(_buffer.data() + HEADER_BYTES, payload_bytes);
+  std::memcpy(_buffer.data(), &payload_bytes, sizeof(payload_bytes));
+  std::memcpy(_buffer.data() + sizeof(payload_bytes), &checksum, sizeof(checksum));
+
+  return std::move(_buffer);
+}
+
+size_t LogEntryWriter::_begin_record(const LogRecordType type, const std::string& table_name) {
+  DebugAssert(_type == LogEntryType::Commit, "Records can only be added to commit entries.");
+  write(type);
+  const auto record_bytes_offset = _buffer.size();
+  write(uint32_t{0});
+  write_string(table_name);
+  return record_bytes_offset;
+}
+
+void LogEntryWriter::_finish_record(const size_t record_bytes_offset) {
+  const auto record_bytes = static_cast<uint32_t>(_buffer.size() - record_bytes_offset - sizeof(uint32_t));
+  std::memcpy(_buffer.data() + record_bytes_offset, &record_bytes, sizeof(record_bytes));
+  ++_record_count;
+}
+
+LogEntryReader::LogEntryReader(const char* data, const size_t bytes) : _data{data}, _bytes{bytes} {}
+
+std::string LogEntryReader::read_string() {
+  const auto length = read<uint32_t>();
+  Assert(_position + length <= _bytes, "Read beyond the end of the log entry.");
+  auto value = std::string{_data + _position, length};
+  _position += length;
+  return value;
+}
+
+void LogEntryReader::skip(const size_t bytes) {
+  Assert(_position + bytes <= _bytes, "Read beyond the end of the log entry.");
+  _position += bytes;
+}
+
+size_t LogEntryReader::position() const {
+  return _position;
+}
+
+bool LogEntryReader::exhausted() const {
+  return _position == _bytes;
+}
+
+uint32_t log_entry_checksum(const char* data, const size_t bytes) {
+  auto checksum = uint32_t{2166136261};
+  for (auto index = size_t{0}; index < bytes; ++index) {
+    checksum ^= static_cast<uint8_t>(data[index]);
+    checksum *= uint32_t{16777619};
+  }
+  return checksum;
+}
+
+}  // namespace hyrise
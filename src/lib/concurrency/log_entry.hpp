@@ -0,0 +1,120 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace hyrise {
+
+class AbstractPosList;
+class Table;
+
+enum class LogEntryType : uint8_t { Commit, DropTable };
+
+enum class LogRecordType : uint8_t { CreateTable, Insert, Delete };
+
+/**
+ * Binary format of the entries in the WriteAheadLog. Each entry is framed by a header holding the number of payload
+ * bytes and a checksum of the payload. Recovery stops at the first entry that is incomplete or whose checksum does not
+ * match, i.e., at a tail that was torn by a crash during a flush.
+ *
+ *   Entry:        [uint32 payload bytes][uint32 checksum][LogEntryType][CommitID][content]
+ *   Commit:       [uint32 record count][records]
+ *     Record:     [LogRecordType][uint32 record bytes][table name][record content]
+ *     CreateTable: [target chunk size][UseMvcc][uint16 column count][name, DataType, nullable per column]
+ *     Insert:     [ChunkID][begin ChunkOffset][end ChunkOffset][values column by column]
+ *     Delete:     [uint32 row count][RowIDs]
+ *   DropTable:    [table name]
+ *
+ * Values are stored as [bool is_null][value], strings as [uint32 length][characters]. The size of each record allows
+ * recovery to skip records of tables that do not exist (anymore). For commits, the CommitID is the commit ID of the
+ * transaction. Tables are created by the CreateTable operator within a transaction, so they are logged as part of its
+ * commit. DropTable is not executed within a transaction. Thus, the CommitID of DropTable entries is the last commit ID
+ * at the time they are logged, and they are replayed after the transaction with the same commit ID. As dropping a
+ * table that does not exist is a no-op during recovery, replaying such an entry a second time is harmless.
+ */
+class LogEntryWriter {
+ public:
+  static constexpr auto HEADER_BYTES = 2 * sizeof(uint32_t);
+
+  LogEntryWriter(const LogEntryType type, const CommitID commit_id);
+
+  // Records the rows [begin_chunk_offset, end_chunk_offset) of the given chunk. All segments of the chunk have to be
+  // ValueSegments, which is the case for the rows of Insert operators that did not commit yet.
+  void add_insert(const std::string& table_name, const Table& table, const ChunkID chunk_id,
+                  const ChunkOffset begin_chunk_offset, const ChunkOffset end_chunk_offset);
+
+  // Records that the rows of the given PosList, which reference the given table, were deleted.
+  void add_delete(const std::string& table_name, const AbstractPosList& pos_list);
+
+  // Records that the given (empty) table has been created.
+  void add_create_table(const std::string& table_name, const Table& table);
+
+  template <typename T>
+  void write(const T& value) {
+    static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable types can be written directly.");
+    const auto offset = _buffer.size();
+    _buffer.resize(offset + sizeof(T));
+    std::memcpy(_buffer.data() + offset, &value, sizeof(T));
+  }
+
+  void write_string(const std::string_view value);
+
+  uint32_t record_count() const;
+
+  // Fills in the header (and record count) and returns the serialized entry. The writer must not be used afterwards.
+  std::vector<char> finish();
+
+ private:
+  // Writes the header of a record and returns the offset of its size, which is filled in by _finish_record.
+  size_t _begin_record(const LogRecordType type, const std::string& table_name);
+  void _finish_record(const size_t record_bytes_offset);
+
+  const LogEntryType _type;
+  uint32_t _record_count{0};
+  std::vector<char> _buffer;
+};
+
+/**
+ * Reads the content of a single entry that has been written by a LogEntryWriter. Reading beyond the end of the entry
+ * fails.
+ */
+class LogEntryReader {
+ public:
+  LogEntryReader(const char* data, const size_t bytes);
+
+  template <typename T>
+  T read() {
+    static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable types can be read directly.");
+    Assert(_position + sizeof(T) <= _bytes, "Read beyond the end of the log entry.");
+    auto value = T{};
+    std::memcpy(&value, _data + _position, sizeof(T));
+    _position += sizeof(T);
+    return value;
+  }
+
+  std::string read_string();
+
+  void skip(const size_t bytes);
+
+  size_t position() const;
+
+  bool exhausted() const;
+
+ private:
+  const char* const _data;
+  const size_t _bytes;
+  size_t _position{0};
+};
+
+// FNV-1a checksum of the given bytes, used to detect torn log entries.
+uint32_t log_entry_checksum(const char* data, const size_t bytes);
+
+}  // namespace hyrise
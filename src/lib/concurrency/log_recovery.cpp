@@ -0,0 +1,318 @@
+#include "log_recovery.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include "concurrency/log_entry.hpp"
+#include "concurrency/write_ahead_log.hpp"
+#include "hyrise.hpp"
+#include "resolve_type.hpp"
+#include "storage/mvcc_data.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+#include "utils/atomic_max.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT(build/namespaces)
+
+struct ParsedEntry {
+  LogEntryType type;
+  CommitID commit_id;
+  const char* content;
+  size_t bytes;
+};
+
+// Splits the log into its entries. Parsing stops at the first incomplete or corrupted entry.
+std::vector<ParsedEntry> parse_entries(const std::vector<char>& log) {
+  constexpr auto PREFIX_BYTES = sizeof(LogEntryType) + sizeof(CommitID);
+
+  auto entries = std::vector<ParsedEntry>{};
+  auto position = size_t{0};
+  while (position + LogEntryWriter::HEADER_BYTES <= log.size()) {
+    auto payload_bytes = uint32_t{0};
+    auto checksum = uint32_t{0};
+    std::memcpy(&payload_bytes, log.data() + position, sizeof(payload_bytes));
+    std::memcpy(&checksum, log.data() + position + sizeof(payload_bytes), sizeof(checksum));
+
+    const auto* const payload = log.data() + position + LogEntryWriter::HEADER_BYTES;
+    if (payload_bytes < PREFIX_BYTES || position + LogEntryWriter::HEADER_BYTES + payload_bytes > log.size() ||
+        log_entry_checksum(payload, payload_bytes) != checksum) {
+      break;
+    }
+
+    auto reader = LogEntryReader{payload, payload_bytes};
+    const auto type = reader.read<LogEntryType>();
+    const auto commit_id = reader.read<CommitID>();
+    entries.emplace_back(ParsedEntry{type, commit_id, payload + PREFIX_BYTES, payload_bytes - PREFIX_BYTES});
+
+    position += LogEntryWriter::HEADER_BYTES + payload_bytes;
+  }
+
+  return entries;
+}
+
+void replay_insert(LogEntryReader& reader, const size_t record_end, Table& table, const CommitID commit_id) {
+  const auto chunk_id = reader.read<ChunkID>();
+  const auto begin_chunk_offset = reader.read<ChunkOffset>();
+  const auto end_chunk_offset = reader.read<ChunkOffset>();
+
+  while (table.chunk_count() <= chunk_id) {
+    table.append_mutable_chunk();
+  }
+  const auto chunk = table.get_chunk(chunk_id);
+  Assert(chunk, "Cannot replay Insert into a removed chunk.");
+
+  const auto& mvcc_data = chunk->mvcc_data();
+  if (!chunk->is_mutable()) {
+    // The chunk has been restored from a checkpoint that was taken after the rows were inserted, but before the
+    // transaction committed. Its values are already in place, only the commit is missing.
+    Assert(end_chunk_offset <= chunk->size(), "Checkpointed chunk does not contain the logged rows.");
+    reader.skip(record_end - reader.position());
+    for (auto chunk_offset = begin_chunk_offset; chunk_offset < end_chunk_offset; ++chunk_offset) {
+      mvcc_data->set_begin_cid(chunk_offset, commit_id);
+    }
+    set_atomic_max(mvcc_data->max_begin_cid, commit_id);
+    return;
+  }
+
+  const auto column_count = table.column_count();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    resolve_data_type(table.column_data_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      const auto value_segment = std::dynamic_pointer_cast<ValueSegment<ColumnDataType>>(chunk->get_segment(column_id));
+      Assert(value_segment, "Cannot replay Insert into non-ValueSegments.");
+
+      // Rows of Inserts that were not logged (i.e., that were rolled back or did not commit before the crash) are
+      // allocated here as well. They are invalidated after all entries have been replayed.
+      if (value_segment->size() < end_chunk_offset) {
+        value_segment->resize(end_chunk_offset);
+      }
+
+      auto& values = value_segment->values();
+      for (auto chunk_offset = begin_chunk_offset; chunk_offset < end_chunk_offset; ++chunk_offset) {
+        if (reader.read<bool>()) {
+          value_segment->set_null_value(chunk_offset);
+          continue;
+        }
+
+        if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+          values[chunk_offset] = pmr_string{reader.read_string()};
+        } else {
+          values[chunk_offset] = reader.read<ColumnDataType>();
+        }
+      }
+    });
+  }
+
+  for (auto chunk_offset = begin_chunk_offset; chunk_offset < end_chunk_offset; ++chunk_offset) {
+    mvcc_data->set_begin_cid(chunk_offset, commit_id);
+    mvcc_data->set_tid(chunk_offset, TransactionID{0});
+  }
+  set_atomic_max(mvcc_data->max_begin_cid, commit_id);
+}
+
+void replay_delete(LogEntryReader& reader, Table& table, const CommitID commit_id) {
+  const auto row_count = reader.read<uint32_t>();
+  for (auto row_index = uint32_t{0}; row_index < row_count; ++row_index) {
+    const auto chunk_id = reader.read<ChunkID>();
+    const auto chunk_offset = reader.read<ChunkOffset>();
+
+    const auto chunk = chunk_id < table.chunk_count() ? table.get_chunk(chunk_id) : nullptr;
+    Assert(chunk && chunk_offset < chunk->size(), "Logged Delete references a row that has not been recovered.");
+
+    const auto& mvcc_data = chunk->mvcc_data();
+    mvcc_data->set_end_cid(chunk_offset, commit_id);
+    chunk->increase_invalid_row_count(ChunkOffset{1});
+    set_atomic_max(mvcc_data->max_end_cid, commit_id);
+  }
+}
+
+void replay_create_table(LogEntryReader& reader, const std::string& table_name) {
+  const auto target_chunk_size = reader.read<ChunkOffset>();
+  const auto use_mvcc = reader.read<UseMvcc>();
+
+  const auto column_count = reader.read<uint16_t>();
+  auto column_definitions = TableColumnDefinitions{};
+  column_definitions.reserve(column_count);
+  for (auto column_id = uint16_t{0}; column_id < column_count; ++column_id) {
+    auto name = reader.read_string();
+    const auto data_type = reader.read<DataType>();
+    const auto nullable = reader.read<bool>();
+    column_definitions.emplace_back(name, data_type, nullable);
+  }
+
+  auto& storage_manager = Hyrise::get().storage_manager;
+  if (storage_manager.has_table(table_name)) {
+    storage_manager.drop_table(table_name);
+  }
+  storage_manager.add_table(table_name,
+                            std::make_shared<Table>(column_definitions, TableType::Data, target_chunk_size, use_mvcc));
+}
+
+void replay_commit(LogEntryReader& reader, const CommitID commit_id) {
+  auto& storage_manager = Hyrise::get().storage_manager;
+
+  const auto record_count = reader.read<uint32_t>();
+  for (auto record_index = uint32_t{0}; record_index < record_count; ++record_index) {
+    const auto record_type = reader.read<LogRecordType>();
+    const auto record_bytes = reader.read<uint32_t>();
+    const auto record_end = reader.position() + record_bytes;
+    const auto table_name = reader.read_string();
+
+    if (record_type == LogRecordType::CreateTable) {
+      replay_create_table(reader, table_name);
+      continue;
+    }
+
+    if (!storage_manager.has_table(table_name)) {
+      reader.skip(record_end - reader.position());
+      continue;
+    }
+
+    const auto table = storage_manager.get_table(table_name);
+
+    switch (record_type) {
+      case LogRecordType::Insert:
+        replay_insert(reader, record_end, *table, commit_id);
+        break;
+      case LogRecordType::Delete:
+        replay_delete(reader, *table, commit_id);
+        break;
+      case LogRecordType::CreateTable:
+        Fail("CreateTable records have been handled before.");
+    }
+  }
+}
+
+void replay_drop_table(LogEntryReader& reader) {
+  const auto table_name = reader.read_string();
+
+  auto& storage_manager = Hyrise::get().storage_manager;
+  if (storage_manager.has_table(table_name)) {
+    storage_manager.drop_table(table_name);
+  }
+}
+
+// Invalidates rows that were allocated but never committed and marks chunks that cannot receive Inserts anymore as
+// immutable, just as committing and rolling back Inserts would have done. Chunks restored from a checkpoint are
+// already immutable, but they may still contain rows of transactions that were in flight when the checkpoint was
+// taken.
+void finalize_table(Table& table) {
+  const auto chunk_count = table.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (!chunk || !chunk->has_mvcc_data()) {
+      continue;
+    }
+
+    const auto& mvcc_data = chunk->mvcc_data();
+    const auto chunk_size = chunk->size();
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      if (mvcc_data->get_begin_cid(chunk_offset) != MvccData::MAX_COMMIT_ID) {
+        continue;
+      }
+
+      mvcc_data->set_end_cid(chunk_offset, CommitID{0});
+      mvcc_data->set_begin_cid(chunk_offset, CommitID{0});
+      mvcc_data->set_tid(chunk_offset, TransactionID{0});
+      chunk->increase_invalid_row_count(ChunkOffset{1});
+    }
+
+    const auto is_last_chunk = chunk_id + 1 == chunk_count;
+    if (chunk->is_mutable() && chunk_size > 0 && (!is_last_chunk || chunk_size == table.target_chunk_size())) {
+      chunk->set_immutable();
+    }
+  }
+}
+
+}  // namespace
+
+namespace hyrise {
+
+CommitID LogRecovery::recover(const std::filesystem::path& log_path) {
+  auto& transaction_manager = Hyrise::get().transaction_manager;
+  auto last_commit_id = transaction_manager.last_commit_id();
+
+  // The parsed entries point into the segments, which are thus kept until all entries have been replayed. A torn tail
+  // only ends the segment it belongs to.
+  const auto segment_paths = WriteAheadLog::segments(log_path);
+  auto segments = std::vector<std::vector<char>>{};
+  segments.reserve(segment_paths.size());
+  auto entries = std::vector<ParsedEntry>{};
+  for (const auto& segment_path : segment_paths) {
+    auto& segment = segments.emplace_back(std::filesystem::file_size(segment_path));
+    {
+      auto file = std::ifstream{segment_path, std::ios::binary};
+      Assert(file.is_open(), "Failed to open '" + segment_path.string() + "'.");
+      file.read(segment.data(), static_cast<std::streamsize>(segment.size()));
+    }
+
+    const auto segment_entries = parse_entries(segment);
+    entries.insert(entries.end(), segment_entries.begin(), segment_entries.end());
+  }
+
+  // Group commit persists entries in the order in which they arrive at the log, which is not necessarily the order of
+  // their commit IDs. DDL entries are ordered after the transaction whose commit ID they carry.
+  std::stable_sort(entries.begin(), entries.end(), [](const auto& lhs, const auto& rhs) {
+    const auto lhs_is_ddl = lhs.type != LogEntryType::Commit;
+    const auto rhs_is_ddl = rhs.type != LogEntryType::Commit;
+    return std::tie(lhs.commit_id, lhs_is_ddl) < std::tie(rhs.commit_id, rhs_is_ddl);
+  });
+
+  for (const auto& entry : entries) {
+    auto reader = LogEntryReader{entry.content, entry.bytes};
+
+    if (entry.type == LogEntryType::Commit) {
+      if (entry.commit_id <= last_commit_id) {
+        continue;
+      }
+
+      if (entry.commit_id != last_commit_id + 1) {
+        break;
+      }
+
+      replay_commit(reader, entry.commit_id);
+      last_commit_id = entry.commit_id;
+      continue;
+    }
+
+    if (entry.commit_id < last_commit_id) {
+      continue;
+    }
+
+    if (entry.commit_id > last_commit_id) {
+      break;
+    }
+
+    switch (entry.type) {
+      case LogEntryType::DropTable:
+        replay_drop_table(reader);
+        break;
+      case LogEntryType::Commit:
+        Fail("Commit entries have been handled before.");
+    }
+  }
+
+  // Tables loaded from a checkpoint may contain uncommitted rows even if the log holds no records for them.
+  for (const auto& [_, table] : Hyrise::get().storage_manager.tables()) {
+    finalize_table(*table);
+  }
+
+  transaction_manager._set_last_commit_id(last_commit_id);
+  return last_commit_id;
+}
+
+}  // namespace hyrise
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <filesystem>
+
+#include "types.hpp"
+
+namespace hyrise {
+
+/**
+ * Replays a log that has been written by the WriteAheadLog into the StorageManager. This is meant to be called on
+ * startup, before any transaction is started and before the WriteAheadLog is enabled for the same file.
+ *
+ * Entries are replayed in the order of their commit IDs. Tables are recreated from their CreateTable entries, and
+ * inserted rows are written to the same RowIDs as before so that logged Deletes can refer to them. Rows that were
+ * allocated by Inserts that never committed are invalidated. The MvccData of the recovered rows holds the original
+ * commit IDs. Replaying stops at the first missing commit ID: the entry of a later transaction may have been persisted
+ * before the crash, but the transaction was not visible as long as its predecessor was not persisted either.
+ * Afterwards, the TransactionManager continues with the last replayed commit ID.
+ *
+ * Records for tables that do not exist (anymore) are skipped. Returns the last replayed commit ID.
+ *
+ * If a Checkpointer is used, its checkpoint has to be loaded first. Entries with commit IDs up to the checkpoint's
+ * commit ID are then skipped, and only the tail of the log is replayed. All segments of the log are read (see
+ * WriteAheadLog::segments).
+ */
+class LogRecovery {
+ public:
+  static CommitID recover(const std::filesystem::path& log_path);
+};
+
+}  // namespace hyrise
@@ -4,9 +4,11 @@
 #include <future>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <ostream>
 
 #include "commit_context.hpp"  // IWYU pragma: keep
+#include "concurrency/log_entry.hpp"
 #include "hyrise.hpp"
 #include "operators/abstract_read_write_operator.hpp"
 #include "types.hpp"
@@ -103,11 +105,31 @@ void TransactionContext::rollback(RollbackReason rollback_reason) {
 void TransactionContext::commit_async(const std::function<void(TransactionID)>& callback) {
   _prepare_commit();
 
+  // The modifications are serialized before commit_records is called, as committing the Inserts allows their chunks to
+  // become immutable (and to be encoded).
+  const auto& write_ahead_log = Hyrise::get().write_ahead_log;
+  auto log_entry = std::optional<LogEntryWriter>{};
+  if (write_ahead_log) {
+    log_entry.emplace(LogEntryType::Commit, commit_id());
+    for (const auto& op : _read_write_operators) {
+      op->write_log_records(*log_entry);
+    }
+  }
+
   for (const auto& op : _read_write_operators) {
     op->commit_records(commit_id());
   }
 
-  _mark_as_pending_and_try_commit(callback);
+  if (!write_ahead_log) {
+    _mark_as_pending_and_try_commit(callback);
+    return;
+  }
+
+  // The transaction becomes visible only after its log entry has been persisted. The flusher thread of the log invokes
+  // the continuation, so that the committing thread does not wait for the fsync.
+  write_ahead_log->append(log_entry->finish(), [context = shared_from_this(), callback]() {
+    context->_mark_as_pending_and_try_commit(callback);
+  });
 }
 
 void TransactionContext::commit() {
@@ -107,7 +107,8 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
   void rollback(RollbackReason rollback_reason);
 
   /**
-   * Commits the transaction.
+   * Commits the transaction. If write-ahead logging is enabled, the transaction is committed only after its log entry
+   * has been persisted. In this case, the callback is invoked by the flusher thread of the WriteAheadLog.
    *
    * @param callback called when transaction is actually committed
    */
@@ -133,4 +133,12 @@ void TransactionManager::_try_increment_last_commit_id(const std::shared_ptr<Com
   }
 }
 
+void TransactionManager::_set_last_commit_id(const CommitID commit_id) {
+  Assert(_active_snapshot_commit_ids.empty(), "The last commit ID cannot be set while transactions are active.");
+  Assert(!std::atomic_load(&_last_commit_context)->has_next(), "The last commit ID cannot be set during commits.");
+
+  _last_commit_id = commit_id;
+  std::atomic_store(&_last_commit_context, std::make_shared<CommitContext>(commit_id));
+}
+
 }  // namespace hyrise
@@ -71,7 +71,9 @@ class TransactionManager : public Noncopyable {
   TransactionManager();
   ~TransactionManager();
 
+  friend class Checkpointer;
   friend class Hyrise;
+  friend class LogRecovery;
   friend class TransactionContext;
 
   TransactionManager& operator=(TransactionManager&& transaction_manager) noexcept;
@@ -79,6 +81,10 @@ class TransactionManager : public Noncopyable {
   std::shared_ptr<CommitContext> _new_commit_context();
   void _try_increment_last_commit_id(const std::shared_ptr<CommitContext>& context);
 
+  // Continues with the given commit ID after transactions have been recovered. Must not be called while transactions
+  // are active.
+  void _set_last_commit_id(const CommitID commit_id);
+
   /**
    * The TransactionManager keeps track of issued snapshot-commit-ids,
    * which are in use by unfinished transactions.
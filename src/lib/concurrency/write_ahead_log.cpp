@@ -0,0 +1,322 @@
+#include "write_ahead_log.hpp"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <functional>
+#include <future>
+#include <iterator>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "concurrency/log_entry.hpp"
+#include "hyrise.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT(build/namespaces)
+
+struct RotatedSegment {
+  std::filesystem::path path;
+  uint64_t segment_number;
+  CommitID covering_commit_id;
+};
+
+// Lists the segments named `<path>.<segment number>.<commit ID>`, ordered by their segment numbers.
+std::vector<RotatedSegment> rotated_segments(const std::filesystem::path& path) {
+  auto segments = std::vector<RotatedSegment>{};
+  const auto directory = path.has_parent_path() ? path.parent_path() : std::filesystem::path{"."};
+  if (!std::filesystem::exists(directory)) {
+    return segments;
+  }
+
+  const auto is_number = [](const std::string& value) {
+    return !value.empty() && std::all_of(value.begin(), value.end(), [](const char character) {
+      return character >= '0' && character <= '9';
+    });
+  };
+
+  const auto prefix = path.filename().string() + ".";
+  for (const auto& directory_entry : std::filesystem::directory_iterator{directory}) {
+    const auto file_name = directory_entry.path().filename().string();
+    if (!file_name.starts_with(prefix)) {
+      continue;
+    }
+
+    const auto suffix = file_name.substr(prefix.size());
+    const auto separator = suffix.find('.');
+    if (separator == std::string::npos || !is_number(suffix.substr(0, separator)) ||
+        !is_number(suffix.substr(separator + 1))) {
+      continue;
+    }
+
+    segments.emplace_back(RotatedSegment{directory_entry.path(), std::stoull(suffix.substr(0, separator)),
+                                         CommitID{static_cast<uint32_t>(std::stoull(suffix.substr(separator + 1)))}});
+  }
+
+  std::sort(segments.begin(), segments.end(), [](const auto& lhs, const auto& rhs) {
+    return lhs.segment_number < rhs.segment_number;
+  });
+  return segments;
+}
+
+// Persists the entries of the directory that holds the given file, i.e., the creation and renaming of segments.
+void sync_parent_directory(const std::filesystem::path& path) {
+  const auto directory = path.has_parent_path() ? path.parent_path() : std::filesystem::path{"."};
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg,hicpp-vararg)
+  const auto file_descriptor = open(directory.c_str(), O_RDONLY);
+  Assert(file_descriptor >= 0, "Failed to open '" + directory.string() + "': " + std::strerror(errno));
+  const auto sync_result = fsync(file_descriptor);
+  close(file_descriptor);
+  Assert(sync_result == 0, "Failed to sync '" + directory.string() + "': " + std::strerror(errno));
+}
+
+}  // namespace
+
+namespace hyrise {
+
+WriteAheadLog::WriteAheadLog(const std::filesystem::path& path, const std::chrono::microseconds group_commit_window,
+                             const size_t buffer_count)
+    : _path{path}, _group_commit_window{group_commit_window}, _buffers(std::max(buffer_count, size_t{1})) {
+  if (_path.has_parent_path()) {
+    std::filesystem::create_directories(_path.parent_path());
+  }
+
+  const auto existing_segments = rotated_segments(_path);
+  if (!existing_segments.empty()) {
+    _next_segment_number = existing_segments.back().segment_number + 1;
+  }
+
+  // Entries of the existing segment have been replayed up to the last commit ID. Entries after a gap in the commit IDs
+  // or after a torn tail were not, so new entries must not be appended to the same segment.
+  _open_active_segment();
+  if (std::filesystem::file_size(_path) > 0) {
+    _segment_bytes = std::filesystem::file_size(_path);
+    _segment_covering_commit_id = CommitID{Hyrise::get().transaction_manager.last_commit_id() + 1};
+    rotate();
+  }
+
+  _flusher_thread = std::thread{&WriteAheadLog::_flush_loop, this};
+}
+
+WriteAheadLog::~WriteAheadLog() {
+  {
+    const auto lock = std::lock_guard<std::mutex>{_flush_mutex};
+    _shutdown_requested = true;
+  }
+  _flush_condition_variable.notify_one();
+  _flusher_thread.join();
+
+  close(_file_descriptor);
+}
+
+void WriteAheadLog::append(std::vector<char>&& entry, std::function<void()>&& on_persisted) {
+  const auto buffer_id = std::hash<std::thread::id>{}(std::this_thread::get_id()) % _buffers.size();
+  auto& buffer = _buffers[buffer_id];
+
+  auto previous_pending_entry_count = uint64_t{0};
+  {
+    const auto lock = std::lock_guard<std::mutex>{buffer.mutex};
+    buffer.entries.insert(buffer.entries.end(), entry.begin(), entry.end());
+    buffer.continuations.emplace_back(std::move(on_persisted));
+    buffer.covering_commit_id = std::max(buffer.covering_commit_id, _covering_commit_id(entry));
+    // The counter is incremented while holding the buffer's mutex so that the flusher, which decrements it under the
+    // same mutex, never observes an entry without it being counted.
+    previous_pending_entry_count = _pending_entry_count++;
+  }
+
+  // Only the first entry of a group has to wake up the flusher. Subsequent entries are picked up by the same flush or,
+  // if they arrive while the flush is in progress, by the next one.
+  if (previous_pending_entry_count == 0) {
+    {
+      const auto lock = std::lock_guard<std::mutex>{_flush_mutex};
+    }
+    _flush_condition_variable.notify_one();
+  }
+}
+
+void WriteAheadLog::log_drop_table(const std::string& table_name) {
+  auto entry = LogEntryWriter{LogEntryType::DropTable, Hyrise::get().transaction_manager.last_commit_id()};
+  entry.write_string(table_name);
+  _append_and_wait(entry.finish());
+}
+
+void WriteAheadLog::rotate() {
+  const auto lock = std::lock_guard<std::mutex>{_segment_mutex};
+  if (_segment_bytes == 0) {
+    return;
+  }
+
+  // A crash after the rename leaves the entries in the rotated segment, where recovery finds them as well.
+  const auto rotated_path = std::filesystem::path{_path.string() + "." + std::to_string(_next_segment_number) + "." +
+                                                  std::to_string(_segment_covering_commit_id)};
+  std::filesystem::rename(_path, rotated_path);
+  close(_file_descriptor);
+  _open_active_segment();
+  sync_parent_directory(_path);
+
+  ++_next_segment_number;
+  _segment_bytes = 0;
+  _segment_covering_commit_id = CommitID{0};
+}
+
+void WriteAheadLog::remove_segments(const CommitID checkpoint_commit_id) {
+  const auto lock = std::lock_guard<std::mutex>{_segment_mutex};
+  for (const auto& segment : rotated_segments(_path)) {
+    if (segment.covering_commit_id <= checkpoint_commit_id) {
+      std::filesystem::remove(segment.path);
+    }
+  }
+}
+
+const std::filesystem::path& WriteAheadLog::path() const {
+  return _path;
+}
+
+std::vector<std::filesystem::path> WriteAheadLog::segments(const std::filesystem::path& path) {
+  auto segment_paths = std::vector<std::filesystem::path>{};
+  for (const auto& segment : rotated_segments(path)) {
+    segment_paths.emplace_back(segment.path);
+  }
+
+  if (std::filesystem::exists(path)) {
+    segment_paths.emplace_back(path);
+  }
+
+  return segment_paths;
+}
+
+uint64_t WriteAheadLog::flush_count() const {
+  return _flush_count.load();
+}
+
+uint64_t WriteAheadLog::persisted_entry_count() const {
+  return _persisted_entry_count.load();
+}
+
+uint64_t WriteAheadLog::persisted_bytes() const {
+  return _persisted_bytes.load();
+}
+
+CommitID WriteAheadLog::_covering_commit_id(const std::vector<char>& entry) {
+  auto reader = LogEntryReader{entry.data(), entry.size()};
+  reader.skip(LogEntryWriter::HEADER_BYTES);
+  const auto type = reader.read<LogEntryType>();
+  const auto commit_id = reader.read<CommitID>();
+  return type == LogEntryType::Commit ? commit_id : CommitID{commit_id + 1};
+}
+
+void WriteAheadLog::_open_active_segment() {
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg,hicpp-vararg)
+  _file_descriptor = open(_path.c_str(), O_WRONLY | O_CREAT | O_APPEND, S_IRUSR | S_IWUSR);
+  Assert(_file_descriptor >= 0, "Failed to open '" + _path.string() + "': " + std::strerror(errno));
+}
+
+void WriteAheadLog::_append_and_wait(std::vector<char>&& entry) {
+  auto persisted = std::promise<void>{};
+  const auto persisted_future = persisted.get_future();
+  append(std::move(entry), [&persisted]() {
+    persisted.set_value();
+  });
+  persisted_future.wait();
+}
+
+void WriteAheadLog::_flush_loop() {
+  while (true) {
+    {
+      auto lock = std::unique_lock<std::mutex>{_flush_mutex};
+      _flush_condition_variable.wait(lock, [&]() {
+        return _pending_entry_count > 0 || _shutdown_requested;
+      });
+
+      if (_shutdown_requested && _pending_entry_count == 0) {
+        return;
+      }
+
+      // Give concurrent transactions the chance to join this group.
+      if (_group_commit_window.count() > 0 && !_shutdown_requested) {
+        _flush_condition_variable.wait_for(lock, _group_commit_window, [&]() {
+          return _shutdown_requested;
+        });
+      }
+    }
+
+    _flush();
+  }
+}
+
+void WriteAheadLog::_flush() {
+  _write_buffer.clear();
+  _persisted_continuations.clear();
+  auto covering_commit_id = CommitID{0};
+
+  for (auto& buffer : _buffers) {
+    const auto lock = std::lock_guard<std::mutex>{buffer.mutex};
+    if (buffer.continuations.empty()) {
+      continue;
+    }
+
+    _write_buffer.insert(_write_buffer.end(), buffer.entries.begin(), buffer.entries.end());
+    std::move(buffer.continuations.begin(), buffer.continuations.end(), std::back_inserter(_persisted_continuations));
+    _pending_entry_count -= buffer.continuations.size();
+    covering_commit_id = std::max(covering_commit_id, buffer.covering_commit_id);
+
+    buffer.entries.clear();
+    buffer.continuations.clear();
+    buffer.covering_commit_id = CommitID{0};
+  }
+
+  if (_persisted_continuations.empty()) {
+    return;
+  }
+
+  auto segment_lock = std::unique_lock<std::mutex>{_segment_mutex};
+  auto written_bytes = size_t{0};
+  while (written_bytes < _write_buffer.size()) {
+    const auto result =
+        write(_file_descriptor, _write_buffer.data() + written_bytes, _write_buffer.size() - written_bytes);
+    if (result < 0 && errno == EINTR) {
+      continue;
+    }
+    Assert(result > 0, "Failed to write to '" + _path.string() + "': " + std::strerror(errno));
+    written_bytes += static_cast<size_t>(result);
+  }
+
+#ifdef __APPLE__
+  const auto sync_result = fsync(_file_descriptor);
+#else
+  const auto sync_result = fdatasync(_file_descriptor);
+#endif
+  Assert(sync_result == 0, "Failed to sync '" + _path.string() + "': " + std::strerror(errno));
+
+  _segment_bytes += _write_buffer.size();
+  _segment_covering_commit_id = std::max(_segment_covering_commit_id, covering_commit_id);
+  segment_lock.unlock();
+
+  ++_flush_count;
+  _persisted_entry_count += _persisted_continuations.size();
+  _persisted_bytes += _write_buffer.size();
+
+  for (const auto& continuation : _persisted_continuations) {
+    continuation();
+  }
+
+  // Continuations might hold resources (e.g., TransactionContexts). Release them right away instead of with the next
+  // flush.
+  _persisted_continuations.clear();
+}
+
+}  // namespace hyrise
@@ -0,0 +1,137 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "types.hpp"
+
+namespace hyrise {
+
+/**
+ * The WriteAheadLog makes committed transactions durable. It is enabled by setting Hyrise::get().write_ahead_log.
+ * When a transaction commits, TransactionContext serializes the modifications of its read-write operators (see
+ * log_entry.hpp) and appends them to the log. The transaction becomes visible and is acknowledged only after its entry
+ * has been persisted.
+ *
+ * To keep fsync out of the commit path, appending does not write to the log file. Instead, entries are collected in
+ * a fixed number of buffers, and each committing thread appends to the buffer that its thread ID maps to. This keeps
+ * contention low as long as there are about as many buffers as workers. A single flusher thread drains all buffers,
+ * writes them to the file, and issues one fdatasync for all of them (group commit). Afterwards, it invokes the
+ * continuations of the persisted entries, which make the transactions visible. Entries that arrive while a flush is in
+ * progress are persisted by the next flush. Optionally, the flusher waits for the group commit window after the first
+ * entry arrived to collect more entries per fdatasync at the cost of commit latency.
+ *
+ * Only modifications of Insert and Delete operators (and thus of Update operators) are logged, as well as tables that
+ * are created or dropped by the CreateTable and DropTable operators. Tables that are added to the StorageManager
+ * directly (e.g., by benchmark table generators or the Import operator) are not logged. See LogRecovery for replaying
+ * the log on startup and Checkpointer for bounding the part of the log that has to be replayed.
+ *
+ * The log consists of segments. Entries are appended to the active segment at the given path. When a checkpoint is
+ * taken, the Checkpointer rotates the log: the active segment is renamed to `<path>.<segment number>.<commit ID>` and
+ * a new active segment is started. The commit ID in the name is the smallest checkpoint commit ID that covers all
+ * entries of the segment. Once a checkpoint with at least this commit ID has been persisted, the segment is not
+ * needed for recovery anymore and is removed.
+ */
+class WriteAheadLog : public Noncopyable {
+ public:
+  static constexpr auto DEFAULT_GROUP_COMMIT_WINDOW = std::chrono::microseconds{0};
+
+  // Opens the log at the given path. Existing entries (e.g., those that have been replayed by LogRecovery) are kept in
+  // a rotated segment so that new entries are not appended after a torn tail.
+  explicit WriteAheadLog(const std::filesystem::path& path,
+                         const std::chrono::microseconds group_commit_window = DEFAULT_GROUP_COMMIT_WINDOW,
+                         const size_t buffer_count = std::thread::hardware_concurrency());
+
+  // Persists all pending entries before the file is closed.
+  ~WriteAheadLog();
+
+  // Appends a serialized entry (see LogEntryWriter). The continuation is invoked by the flusher thread as soon as the
+  // entry has been persisted.
+  void append(std::vector<char>&& entry, std::function<void()>&& on_persisted);
+
+  // Logs the removal of a table and blocks until the entry has been persisted. Tables are not dropped within a
+  // transaction. Their creation, in contrast, is logged as part of the transaction's commit (see CreateTable).
+  void log_drop_table(const std::string& table_name);
+
+  // Renames the active segment and continues with a new one. Entries that are persisted afterwards are written to the
+  // new segment. Does nothing if no entry has been written to the active segment.
+  void rotate();
+
+  // Removes the rotated segments that hold no entries required for recovering from a checkpoint with the given commit
+  // ID.
+  void remove_segments(const CommitID checkpoint_commit_id);
+
+  const std::filesystem::path& path() const;
+
+  // Returns the existing segments of the log at the given path in the order in which they have been written, i.e., the
+  // rotated segments followed by the active segment.
+  static std::vector<std::filesystem::path> segments(const std::filesystem::path& path);
+
+  // Number of fdatasync calls, i.e., of groups of entries that have been persisted together.
+  uint64_t flush_count() const;
+
+  // Number of entries and bytes that have been persisted.
+  uint64_t persisted_entry_count() const;
+  uint64_t persisted_bytes() const;
+
+ private:
+  struct alignas(64) Buffer {
+    std::mutex mutex;
+    std::vector<char> entries;
+    std::vector<std::function<void()>> continuations;
+    // Smallest checkpoint commit ID that covers the buffered entries (see _covering_commit_id).
+    CommitID covering_commit_id{0};
+  };
+
+  // Commit entries are covered by checkpoints with at least their commit ID. DDL entries are replayed after the
+  // transaction whose commit ID they carry, so a checkpoint with the same commit ID might not include them.
+  static CommitID _covering_commit_id(const std::vector<char>& entry);
+
+  void _open_active_segment();
+
+  void _append_and_wait(std::vector<char>&& entry);
+
+  void _flush_loop();
+
+  // Writes all buffered entries to the file, persists them, and invokes their continuations.
+  void _flush();
+
+  const std::filesystem::path _path;
+  const std::chrono::microseconds _group_commit_window;
+
+  // Protects the active segment, which is written by the flusher thread and rotated by the Checkpointer.
+  std::mutex _segment_mutex;
+  int _file_descriptor{-1};
+  uint64_t _next_segment_number{0};
+  uint64_t _segment_bytes{0};
+  CommitID _segment_covering_commit_id{0};
+
+  std::vector<Buffer> _buffers;
+  std::atomic<uint64_t> _pending_entry_count{0};
+
+  // Reused by the flusher thread to collect the entries of all buffers.
+  std::vector<char> _write_buffer;
+  std::vector<std::function<void()>> _persisted_continuations;
+
+  std::mutex _flush_mutex;
+  std::condition_variable _flush_condition_variable;
+  bool _shutdown_requested{false};
+
+  std::atomic<uint64_t> _flush_count{0};
+  std::atomic<uint64_t> _persisted_entry_count{0};
+  std::atomic<uint64_t> _persisted_bytes{0};
+
+  // Started last so that all other members are initialized when the flusher thread runs.
+  std::thread _flusher_thread;
+};
+
+}  // namespace hyrise
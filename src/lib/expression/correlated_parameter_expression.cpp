@@ -59,8 +59,8 @@ const std::optional<AllTypeVariant>& CorrelatedParameterExpression::value() cons
 }
 
 void CorrelatedParameterExpression::set_value(const std::optional<AllTypeVariant>& value) {
-  Assert(!value || data_type_from_all_type_variant(*value) == _referenced_expression_info.data_type ||
-             variant_is_null(*value),
+  Assert(!value || variant_is_null(*value) ||
+             data_type_from_all_type_variant(*value) == storage_data_type(_referenced_expression_info.data_type),
          "Invalid value assigned to CorrelatedParameterExpression");
   _value = value;
 }
@@ -8,6 +8,7 @@
 #include <memory>
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <type_traits>
 #include <unordered_map>
 #include <utility>
@@ -775,6 +776,17 @@ std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::_evaluate_cast_ex
       for (auto chunk_offset = ChunkOffset{0}; chunk_offset < static_cast<ChunkOffset>(result_size); ++chunk_offset) {
         if (!argument_result_view.is_null(chunk_offset)) {
           const auto& argument_value = argument_result_view.value(chunk_offset);
+          // Values of DataType::Date are stored as the number of days since 1970-01-01.
+          if constexpr (std::is_same_v<Result, int32_t> &&
+                        std::is_same_v<std::decay_t<decltype(argument_value)>, pmr_string>) {
+            if (cast_expression.data_type() == DataType::Date) {
+              const auto days = date_string_to_days(argument_value);
+              Assert(days, "Cannot cast '" + std::string{argument_value} + "' as Date");
+              values[chunk_offset] = *days;
+              continue;
+            }
+          }
+
           try {
             values[chunk_offset] = *lossy_variant_cast<Result>(argument_value);
           } catch (boost::bad_lexical_cast& /* exception */) {
@@ -884,65 +896,77 @@ template <typename Result>
 std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::_evaluate_extract_expression(
     const ExtractExpression& extract_expression) {
   const auto datetime_component = extract_expression.datetime_component;
-  const auto& from_result = *evaluate_expression_to_result<pmr_string>(*extract_expression.from());
 
-  if constexpr (std::is_same_v<Result, int32_t>) {
-    switch (datetime_component) {
-      case DatetimeComponent::Year:
-        return _evaluate_extract_component<int32_t>(from_result, [](const auto& timestamp) {
-          return timestamp.date().year();
-        });
-      case DatetimeComponent::Month:
-        return _evaluate_extract_component<int32_t>(from_result, [](const auto& timestamp) {
-          return timestamp.date().month();
-        });
-      case DatetimeComponent::Day:
-        return _evaluate_extract_component<int32_t>(from_result, [](const auto& timestamp) {
-          return timestamp.date().day();
-        });
-      case DatetimeComponent::Hour:
-        return _evaluate_extract_component<int32_t>(from_result, [](const auto& timestamp) {
-          return timestamp.time_of_day().hours();
-        });
-      case DatetimeComponent::Minute:
-        return _evaluate_extract_component<int32_t>(from_result, [](const auto& timestamp) {
-          return timestamp.time_of_day().minutes();
-        });
-      case DatetimeComponent::Second:
-        Fail("SECOND must be extracted as Double.");
+  const auto evaluate_component = [&](const auto& from_result) -> std::shared_ptr<ExpressionResult<Result>> {
+    if constexpr (std::is_same_v<Result, int32_t>) {
+      switch (datetime_component) {
+        case DatetimeComponent::Year:
+          return _evaluate_extract_component<int32_t>(from_result, [](const auto& timestamp) {
+            return timestamp.date().year();
+          });
+        case DatetimeComponent::Month:
+          return _evaluate_extract_component<int32_t>(from_result, [](const auto& timestamp) {
+            return timestamp.date().month();
+          });
+        case DatetimeComponent::Day:
+          return _evaluate_extract_component<int32_t>(from_result, [](const auto& timestamp) {
+            return timestamp.date().day();
+          });
+        case DatetimeComponent::Hour:
+          return _evaluate_extract_component<int32_t>(from_result, [](const auto& timestamp) {
+            return timestamp.time_of_day().hours();
+          });
+        case DatetimeComponent::Minute:
+          return _evaluate_extract_component<int32_t>(from_result, [](const auto& timestamp) {
+            return timestamp.time_of_day().minutes();
+          });
+        case DatetimeComponent::Second:
+          Fail("SECOND must be extracted as Double.");
+      }
     }
-  }
 
-  if constexpr (std::is_same_v<Result, double>) {
-    Assert(datetime_component == DatetimeComponent::Second, "Only SECOND is extracted as Double.");
-    return _evaluate_extract_component<double>(from_result, [](const auto& timestamp) {
-      const auto& time_of_day = timestamp.time_of_day();
-      return static_cast<double>(time_of_day.seconds()) + static_cast<double>(time_of_day.fractional_seconds()) /
-                                                              static_cast<double>(time_of_day.ticks_per_second());
-    });
+    if constexpr (std::is_same_v<Result, double>) {
+      Assert(datetime_component == DatetimeComponent::Second, "Only SECOND is extracted as Double.");
+      return _evaluate_extract_component<double>(from_result, [](const auto& timestamp) {
+        const auto& time_of_day = timestamp.time_of_day();
+        return static_cast<double>(time_of_day.seconds()) + static_cast<double>(time_of_day.fractional_seconds()) /
+                                                                static_cast<double>(time_of_day.ticks_per_second());
+      });
+    }
+
+    Fail("Invalid Result type: ExtractExpression result either has to be Int or Dobule.");
+  };
+
+  // Values of DataType::Date are stored as the number of days since 1970-01-01, other dates and timestamps as strings.
+  if (extract_expression.from()->data_type() == DataType::Date) {
+    return evaluate_component(*evaluate_expression_to_result<int32_t>(*extract_expression.from()));
   }
 
-  Fail("Invalid Result type: ExtractExpression result either has to be Int or Dobule.");
+  return evaluate_component(*evaluate_expression_to_result<pmr_string>(*extract_expression.from()));
 }
 
-template <typename Result, typename Functor>
+template <typename Result, typename FromType, typename Functor>
 std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::_evaluate_extract_component(
-    const ExpressionResult<pmr_string>& from_result, const Functor extract_component) {
+    const ExpressionResult<FromType>& from_result, const Functor extract_component) {
   auto values = pmr_vector<Result>(from_result.size());
 
   from_result.as_view([&](const auto& from_view) {
     const auto from_view_size = static_cast<ChunkOffset>(from_view.size());
     for (auto chunk_offset = ChunkOffset{0}; chunk_offset < from_view_size; ++chunk_offset) {
-      if (!from_view.is_null(chunk_offset)) {
-        const auto& value = std::string{from_view.value(chunk_offset)};
+      if (from_view.is_null(chunk_offset)) {
+        continue;
+      }
+
+      if constexpr (std::is_same_v<FromType, int32_t>) {
+        values[chunk_offset] = extract_component(boost::posix_time::ptime{days_to_date(from_view.value(chunk_offset))});
+      } else {
+        const auto value = std::string_view{from_view.value(chunk_offset)};
         // Usually, checking whether the stored values are correct dates/timestamps should be checked on tuple
-        // insertion or when values are loaded from files. However, we do not have proper date/timestamp data types and
-        // do lazy checks only whenever required. Though parsing the string values leads to degraded performance
-        // compared to, e.g., accessing substrings or accessing member variables, we ensure correct results.
-        // TODO(anyone): Revisit for performance if we use this in actual benchmarks.
-        Assert(value.size() >= 10, "Invalid ISO 8601 extended timestamp '" + value + "'.");
-        const auto& timestamp = string_to_timestamp(value);
-        Assert(timestamp, "Invalid ISO 8601 extended timestamp '" + value + "'.");
+        // insertion or when values are loaded from files. However, timestamps (and dates in string columns) are stored
+        // as strings, so we do lazy checks only whenever required. Dates and timestamps in the common fixed-width
+        // formats are parsed without Boost (see string_to_timestamp()), which keeps these checks cheap.
+        const auto timestamp = value.size() >= 10 ? string_to_timestamp(value) : std::nullopt;
+        Assert(timestamp, "Invalid ISO 8601 extended timestamp '" + std::string{value} + "'.");
         values[chunk_offset] = extract_component(*timestamp);
       }
     }
@@ -1736,7 +1760,7 @@ std::vector<std::shared_ptr<ExpressionResult<Result>>> ExpressionEvaluator::_pru
     const auto& table = tables[table_idx];
 
     Assert(table->column_count() == 1, "Expected precisely one column from subquery.");
-    Assert(table->column_data_type(ColumnID{0}) == data_type_from_type<Result>(),
+    Assert(storage_data_type(table->column_data_type(ColumnID{0})) == data_type_from_type<Result>(),
            "Expected different DataType from subquery.");
 
     const auto row_count = table->row_count();
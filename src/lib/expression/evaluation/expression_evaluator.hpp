@@ -119,8 +119,8 @@ class ExpressionEvaluator final {
   std::shared_ptr<ExpressionResult<Result>> _evaluate_unary_minus_expression(
       const UnaryMinusExpression& unary_minus_expression);
 
-  template <typename Result, typename Functor>
-  std::shared_ptr<ExpressionResult<Result>> _evaluate_extract_component(const ExpressionResult<pmr_string>& from_result,
+  template <typename Result, typename FromType, typename Functor>
+  std::shared_ptr<ExpressionResult<Result>> _evaluate_extract_component(const ExpressionResult<FromType>& from_result,
                                                                         const Functor extract_component);
 
   template <typename Result>
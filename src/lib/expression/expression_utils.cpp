@@ -31,6 +31,7 @@
 #include "resolve_type.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
+#include "utils/date_time_utils.hpp"
 #include "value_expression.hpp"
 
 namespace hyrise {
@@ -377,6 +378,16 @@ std::optional<AllTypeVariant> expression_get_value_or_parameter(const AbstractEx
     if (variant_is_null(value_expression.value)) {
       return NULL_VALUE;
     }
+
+    // Values of DataType::Date are the number of days since 1970-01-01, e.g., for string parameters of prepared
+    // statements that are compared with Date columns.
+    if (expression.data_type() == DataType::Date && value_expression.value.type() == typeid(pmr_string)) {
+      const auto& date_string = boost::get<pmr_string>(value_expression.value);
+      const auto days = date_string_to_days(date_string);
+      Assert(days, "Cannot cast '" + std::string{date_string} + "' as Date.");
+      return AllTypeVariant{*days};
+    }
+
     std::optional<AllTypeVariant> result;
     resolve_data_type(expression.data_type(), [&](auto type) {
       using TargetDataType = typename decltype(type)::type;
@@ -36,6 +36,9 @@ Hyrise::Hyrise() {
 
 void Hyrise::reset() {
   Hyrise::get().scheduler()->finish();
+  Hyrise::get().checkpointer = nullptr;
+  // Complete pending commits while the current TransactionManager is still in place.
+  Hyrise::get().write_ahead_log = nullptr;
   get() = Hyrise{};
 }
 
@@ -2,7 +2,9 @@
 
 #include <memory>
 
+#include "concurrency/checkpointer.hpp"
 #include "concurrency/transaction_manager.hpp"
+#include "concurrency/write_ahead_log.hpp"
 #include "scheduler/abstract_scheduler.hpp"
 #include "scheduler/topology.hpp"
 #include "sql/sql_plan_cache.hpp"
@@ -52,6 +54,20 @@ class Hyrise : public Singleton<Hyrise> {
   std::shared_ptr<SQLPhysicalPlanCache> default_pqp_cache;
   std::shared_ptr<SQLLogicalPlanCache> default_lqp_cache;
 
+  // Caches of prepared statements and their parameterized physical plans, used by the server's QueryHandler if set.
+  // Shared by all sessions so that preparing and binding a statement that any session prepared before skips parsing,
+  // optimization, and translation. Both are cleared when tables or views are added or dropped.
+  std::shared_ptr<SQLPreparedPlanCache> prepared_plan_cache;
+  std::shared_ptr<SQLPhysicalPlanCache> prepared_pqp_cache;
+
+  // Makes committed transactions durable if set. By default, nullptr, i.e., nothing is logged. Declared after the
+  // TransactionManager, as pending commits are completed when the log is destructed.
+  std::shared_ptr<WriteAheadLog> write_ahead_log;
+
+  // Periodically checkpoints the tables so that recovery only has to replay the tail of the log if set. Declared after
+  // the WriteAheadLog so that checkpoints are stopped first.
+  std::shared_ptr<Checkpointer> checkpointer;
+
   // The BenchmarkRunner is available here so that non-benchmark components can add information to the benchmark
   // result JSON.
   std::weak_ptr<BenchmarkRunner> benchmark_runner;
@@ -2,8 +2,7 @@
 
 #include <cstddef>
 #include <cstdint>
-#include <fstream>
-#include <ios>
+#include <cstring>
 #include <memory>
 #include <numeric>
 #include <optional>
@@ -13,16 +12,21 @@
 #include <vector>
 
 #include "all_type_variant.hpp"
+#include "import_export/binary/mapped_binary_file.hpp"
 #include "resolve_type.hpp"
+#include "storage/abstract_encoded_segment.hpp"
+#include "storage/alp_segment.hpp"
 #include "storage/chunk.hpp"
 #include "storage/dictionary_segment.hpp"
 #include "storage/encoding_type.hpp"
 #include "storage/fixed_string_dictionary_segment.hpp"
 #include "storage/fixed_string_dictionary_segment/fixed_string_vector.hpp"
 #include "storage/frame_of_reference_segment.hpp"
+#include "storage/fsst_segment.hpp"
 #include "storage/lz4_segment.hpp"
 #include "storage/mvcc_data.hpp"
 #include "storage/run_length_segment.hpp"
+#include "storage/segment_zone_map.hpp"
 #include "storage/table.hpp"
 #include "storage/table_column_definition.hpp"
 #include "storage/value_segment.hpp"
@@ -37,9 +41,7 @@
 namespace hyrise {
 
 std::shared_ptr<Table> BinaryParser::parse(const std::string& filename) {
-  std::ifstream file;
-  file.open(filename, std::ios::binary);
-  file.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+  auto file = MappedBinaryFile{filename};
 
   auto [table, chunk_count] = _read_header(file);
   for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
@@ -50,58 +52,50 @@ std::shared_ptr<Table> BinaryParser::parse(const std::string& filename) {
 }
 
 template <typename T>
-pmr_compact_vector BinaryParser::_read_values_compact_vector(std::ifstream& file, const size_t count) {
+pmr_compact_vector BinaryParser::_read_values_compact_vector(MappedBinaryFile& file, const size_t count) {
   const auto bit_width = _read_value<uint8_t>(file);
-  auto values = pmr_compact_vector(bit_width, count);
-  file.read(reinterpret_cast<char*>(values.get()), static_cast<int64_t>(values.bytes()));
-  return values;
+  return file.read_compact_vector(bit_width, count);
 }
 
 template <typename T>
-pmr_vector<T> BinaryParser::_read_values(std::ifstream& file, const size_t count) {
-  pmr_vector<T> values(count);
-  file.read(reinterpret_cast<char*>(values.data()), values.size() * sizeof(T));
-  return values;
+pmr_vector<T> BinaryParser::_read_values(MappedBinaryFile& file, const size_t count) {
+  return file.read_values<T>(count);
 }
 
 // specialized implementation for string values
 template <>
-pmr_vector<pmr_string> BinaryParser::_read_values(std::ifstream& file, const size_t count) {
+pmr_vector<pmr_string> BinaryParser::_read_values(MappedBinaryFile& file, const size_t count) {
   return _read_string_values(file, count);
 }
 
 // specialized implementation for bool values
 template <>
-pmr_vector<bool> BinaryParser::_read_values(std::ifstream& file, const size_t count) {
-  pmr_vector<BoolAsByteType> readable_bools(count);
-  file.read(reinterpret_cast<char*>(readable_bools.data()),
-            static_cast<int64_t>(readable_bools.size() * sizeof(BoolAsByteType)));
-  return {readable_bools.begin(), readable_bools.end()};
+pmr_vector<bool> BinaryParser::_read_values(MappedBinaryFile& file, const size_t count) {
+  static_assert(sizeof(BoolAsByteType) == 1, "Bools are expected to be stored as single bytes.");
+  const auto* const bools = reinterpret_cast<const BoolAsByteType*>(file.read_bytes(count));
+  return {bools, bools + count};
 }
 
-pmr_vector<pmr_string> BinaryParser::_read_string_values(std::ifstream& file, const size_t count) {
-  const auto string_lengths = _read_values<size_t>(file, count);
-  const auto total_length = std::accumulate(string_lengths.cbegin(), string_lengths.cend(), static_cast<size_t>(0));
-  const auto buffer = _read_values<char>(file, total_length);
+pmr_vector<pmr_string> BinaryParser::_read_string_values(MappedBinaryFile& file, const size_t count) {
+  // All lengths are stored before the characters of all strings.
+  const auto* const string_lengths = file.read_bytes(count * sizeof(size_t));
 
   auto values = pmr_vector<pmr_string>{count};
-  auto start = size_t{0};
   for (auto index = size_t{0}; index < count; ++index) {
-    values[index] = pmr_string{buffer.data() + start, buffer.data() + start + string_lengths[index]};
-    start += string_lengths[index];
+    auto string_length = size_t{0};
+    std::memcpy(&string_length, string_lengths + index * sizeof(size_t), sizeof(size_t));
+    values[index] = pmr_string{file.read_bytes(string_length), string_length};
   }
 
   return values;
 }
 
 template <typename T>
-T BinaryParser::_read_value(std::ifstream& file) {
-  T result;
-  file.read(reinterpret_cast<char*>(&result), sizeof(T));
-  return result;
+T BinaryParser::_read_value(MappedBinaryFile& file) {
+  return file.read_value<T>();
 }
 
-std::pair<std::shared_ptr<Table>, ChunkID> BinaryParser::_read_header(std::ifstream& file) {
+std::pair<std::shared_ptr<Table>, ChunkID> BinaryParser::_read_header(MappedBinaryFile& file) {
   const auto chunk_size = _read_value<ChunkOffset>(file);
   const auto chunk_count = _read_value<ChunkID>(file);
   const auto column_count = _read_value<ColumnID>(file);
@@ -121,7 +115,7 @@ std::pair<std::shared_ptr<Table>, ChunkID> BinaryParser::_read_header(std::ifstr
   return std::make_pair(table, chunk_count);
 }
 
-void BinaryParser::_import_chunk(std::ifstream& file, std::shared_ptr<Table>& table) {
+void BinaryParser::_import_chunk(MappedBinaryFile& file, std::shared_ptr<Table>& table) {
   const auto row_count = _read_value<ChunkOffset>(file);
 
   // Import sort column definitions
@@ -147,7 +141,7 @@ void BinaryParser::_import_chunk(std::ifstream& file, std::shared_ptr<Table>& ta
   }
 }
 
-std::shared_ptr<AbstractSegment> BinaryParser::_import_segment(std::ifstream& file, ChunkOffset row_count,
+std::shared_ptr<AbstractSegment> BinaryParser::_import_segment(MappedBinaryFile& file, ChunkOffset row_count,
                                                                DataType data_type, bool column_is_nullable) {
   std::shared_ptr<AbstractSegment> result;
   resolve_data_type(data_type, [&](auto type) {
@@ -155,11 +149,16 @@ std::shared_ptr<AbstractSegment> BinaryParser::_import_segment(std::ifstream& fi
     result = _import_segment<ColumnDataType>(file, row_count, column_is_nullable);
   });
 
+  // Encoded segments are imported without their encoders, so that their zone maps have to be built here.
+  if (const auto encoded_segment = std::dynamic_pointer_cast<AbstractEncodedSegment>(result)) {
+    encoded_segment->set_zone_map(build_segment_zone_map(*encoded_segment));
+  }
+
   return result;
 }
 
 template <typename ColumnDataType>
-std::shared_ptr<AbstractSegment> BinaryParser::_import_segment(std::ifstream& file, ChunkOffset row_count,
+std::shared_ptr<AbstractSegment> BinaryParser::_import_segment(MappedBinaryFile& file, ChunkOffset row_count,
                                                                bool column_is_nullable) {
   const auto column_type = _read_value<EncodingType>(file);
 
@@ -186,13 +185,27 @@ std::shared_ptr<AbstractSegment> BinaryParser::_import_segment(std::ifstream& fi
       }
     case EncodingType::LZ4:
       return _import_lz4_segment<ColumnDataType>(file, row_count);
+    case EncodingType::ALP:
+      if constexpr (encoding_supports_data_type(enum_c<EncodingType, EncodingType::ALP>,
+                                                hana::type_c<ColumnDataType>)) {
+        return _import_alp_segment<ColumnDataType>(file, row_count);
+      } else {
+        Fail("Unsupported data type for ALP encoding");
+      }
+    case EncodingType::FSST:
+      if constexpr (encoding_supports_data_type(enum_c<EncodingType, EncodingType::FSST>,
+                                                hana::type_c<ColumnDataType>)) {
+        return _import_fsst_segment<ColumnDataType>(file, row_count);
+      } else {
+        Fail("Unsupported data type for FSST encoding");
+      }
   }
 
   Fail("Invalid EncodingType");
 }
 
 template <typename T>
-std::shared_ptr<ValueSegment<T>> BinaryParser::_import_value_segment(std::ifstream& file, ChunkOffset row_count,
+std::shared_ptr<ValueSegment<T>> BinaryParser::_import_value_segment(MappedBinaryFile& file, ChunkOffset row_count,
                                                                      bool column_is_nullable) {
   if (column_is_nullable) {
     const auto segment_is_nullable = _read_value<bool>(file);
@@ -208,7 +221,7 @@ std::shared_ptr<ValueSegment<T>> BinaryParser::_import_value_segment(std::ifstre
 }
 
 template <typename T>
-std::shared_ptr<DictionarySegment<T>> BinaryParser::_import_dictionary_segment(std::ifstream& file,
+std::shared_ptr<DictionarySegment<T>> BinaryParser::_import_dictionary_segment(MappedBinaryFile& file,
                                                                                ChunkOffset row_count) {
   const auto compressed_vector_type_id = _read_value<CompressedVectorTypeID>(file);
   const auto dictionary_size = _read_value<ValueID>(file);
@@ -220,7 +233,7 @@ std::shared_ptr<DictionarySegment<T>> BinaryParser::_import_dictionary_segment(s
 }
 
 std::shared_ptr<FixedStringDictionarySegment<pmr_string>> BinaryParser::_import_fixed_string_dictionary_segment(
-    std::ifstream& file, ChunkOffset row_count) {
+    MappedBinaryFile& file, ChunkOffset row_count) {
   const auto compressed_vector_type_id = _read_value<CompressedVectorTypeID>(file);
   const auto dictionary_size = _read_value<ValueID>(file);
   auto dictionary = _import_fixed_string_vector(file, dictionary_size);
@@ -230,7 +243,7 @@ std::shared_ptr<FixedStringDictionarySegment<pmr_string>> BinaryParser::_import_
 }
 
 template <typename T>
-std::shared_ptr<RunLengthSegment<T>> BinaryParser::_import_run_length_segment(std::ifstream& file,
+std::shared_ptr<RunLengthSegment<T>> BinaryParser::_import_run_length_segment(MappedBinaryFile& file,
                                                                               ChunkOffset /*row_count*/) {
   const auto size = _read_value<uint32_t>(file);
   const auto values = std::make_shared<pmr_vector<T>>(_read_values<T>(file, size));
@@ -241,7 +254,7 @@ std::shared_ptr<RunLengthSegment<T>> BinaryParser::_import_run_length_segment(st
 }
 
 template <typename T>
-std::shared_ptr<FrameOfReferenceSegment<T>> BinaryParser::_import_frame_of_reference_segment(std::ifstream& file,
+std::shared_ptr<FrameOfReferenceSegment<T>> BinaryParser::_import_frame_of_reference_segment(MappedBinaryFile& file,
                                                                                              ChunkOffset row_count) {
   const auto compressed_vector_type_id = _read_value<CompressedVectorTypeID>(file);
   const auto block_count = _read_value<uint32_t>(file);
@@ -259,7 +272,7 @@ std::shared_ptr<FrameOfReferenceSegment<T>> BinaryParser::_import_frame_of_refer
 }
 
 template <typename T>
-std::shared_ptr<LZ4Segment<T>> BinaryParser::_import_lz4_segment(std::ifstream& file, ChunkOffset row_count) {
+std::shared_ptr<LZ4Segment<T>> BinaryParser::_import_lz4_segment(MappedBinaryFile& file, ChunkOffset row_count) {
   const auto num_elements = _read_value<uint32_t>(file);
   const auto block_count = _read_value<uint32_t>(file);
   const auto block_size = _read_value<uint32_t>(file);
@@ -303,8 +316,56 @@ std::shared_ptr<LZ4Segment<T>> BinaryParser::_import_lz4_segment(std::ifstream&
                                          block_size, last_block_size, compressed_size, num_elements);
 }
 
+template <typename T>
+std::shared_ptr<ALPSegment<T>> BinaryParser::_import_alp_segment(MappedBinaryFile& file, ChunkOffset row_count) {
+  const auto compressed_vector_type_id = _read_value<CompressedVectorTypeID>(file);
+  const auto block_count = _read_value<uint32_t>(file);
+  auto exponents = _read_values<uint8_t>(file, block_count);
+  auto factors = _read_values<uint8_t>(file, block_count);
+  auto block_minima = _read_values<int64_t>(file, block_count);
+
+  const auto exception_count = _read_value<uint32_t>(file);
+  auto exception_positions = _read_values<ChunkOffset>(file, exception_count);
+  auto exception_values = _read_values<T>(file, exception_count);
+
+  const auto null_values_stored = _read_value<BoolAsByteType>(file);
+  std::optional<pmr_vector<bool>> null_values;
+  if (null_values_stored) {
+    null_values = _read_values<bool>(file, row_count);
+  }
+
+  auto offset_values = _import_offset_value_vector(file, row_count, compressed_vector_type_id);
+
+  return std::make_shared<ALPSegment<T>>(std::move(exponents), std::move(factors), std::move(block_minima),
+                                         std::move(offset_values), std::move(exception_positions),
+                                         std::move(exception_values), std::move(null_values));
+}
+
+template <typename T>
+std::shared_ptr<FSSTSegment<T>> BinaryParser::_import_fsst_segment(MappedBinaryFile& file, ChunkOffset row_count) {
+  const auto compressed_vector_type_id = _read_value<CompressedVectorTypeID>(file);
+  const auto symbol_count = _read_value<uint32_t>(file);
+  auto symbols = _read_values<uint64_t>(file, symbol_count);
+  auto symbol_lengths = _read_values<uint8_t>(file, symbol_count);
+
+  const auto compressed_values_size = _read_value<uint32_t>(file);
+  auto compressed_values = _read_values<char>(file, compressed_values_size);
+
+  const auto null_values_stored = _read_value<BoolAsByteType>(file);
+  std::optional<pmr_vector<bool>> null_values;
+  if (null_values_stored) {
+    null_values = _read_values<bool>(file, row_count);
+  }
+
+  // The offsets vector holds one more entry than the segment has rows, see fsst_segment.hpp.
+  auto offsets = _import_offset_value_vector(file, ChunkOffset{row_count + 1}, compressed_vector_type_id);
+
+  return std::make_shared<FSSTSegment<T>>(FSSTSymbolTable{std::move(symbols), std::move(symbol_lengths)},
+                                          std::move(compressed_values), std::move(offsets), std::move(null_values));
+}
+
 std::shared_ptr<BaseCompressedVector> BinaryParser::_import_attribute_vector(
-    std::ifstream& file, const ChunkOffset row_count, const CompressedVectorTypeID compressed_vector_type_id) {
+    MappedBinaryFile& file, const ChunkOffset row_count, const CompressedVectorTypeID compressed_vector_type_id) {
   const auto compressed_vector_type = static_cast<CompressedVectorType>(compressed_vector_type_id);
   switch (compressed_vector_type) {
     case CompressedVectorType::BitPacking:
@@ -322,7 +383,7 @@ std::shared_ptr<BaseCompressedVector> BinaryParser::_import_attribute_vector(
 }
 
 std::unique_ptr<const BaseCompressedVector> BinaryParser::_import_offset_value_vector(
-    std::ifstream& file, const ChunkOffset row_count, const CompressedVectorTypeID compressed_vector_type_id) {
+    MappedBinaryFile& file, const ChunkOffset row_count, const CompressedVectorTypeID compressed_vector_type_id) {
   const auto compressed_vector_type = static_cast<CompressedVectorType>(compressed_vector_type_id);
   switch (compressed_vector_type) {
     case CompressedVectorType::BitPacking:
@@ -339,10 +400,10 @@ std::unique_ptr<const BaseCompressedVector> BinaryParser::_import_offset_value_v
   }
 }
 
-std::shared_ptr<FixedStringVector> BinaryParser::_import_fixed_string_vector(std::ifstream& file, const size_t count) {
+std::shared_ptr<FixedStringVector> BinaryParser::_import_fixed_string_vector(MappedBinaryFile& file, const size_t count) {
   const auto string_length = _read_value<uint32_t>(file);
-  pmr_vector<char> values(string_length * count);
-  file.read(values.data(), static_cast<int64_t>(values.size()));
+  const auto* const characters = file.read_bytes(string_length * count);
+  auto values = pmr_vector<char>(characters, characters + string_length * count);
   return std::make_shared<FixedStringVector>(std::move(values), string_length);
 }
 
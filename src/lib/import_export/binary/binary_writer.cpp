@@ -3,6 +3,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <filesystem>
 #include <fstream>
 #include <ios>
 #include <string>
@@ -11,12 +12,14 @@
 #include "all_type_variant.hpp"
 #include "resolve_type.hpp"
 #include "storage/abstract_encoded_segment.hpp"
+#include "storage/alp_segment.hpp"
 #include "storage/chunk.hpp"
 #include "storage/dictionary_segment.hpp"
 #include "storage/encoding_type.hpp"
 #include "storage/fixed_string_dictionary_segment.hpp"
 #include "storage/fixed_string_dictionary_segment/fixed_string_vector.hpp"
 #include "storage/frame_of_reference_segment.hpp"
+#include "storage/fsst_segment.hpp"
 #include "storage/lz4_segment.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/run_length_segment.hpp"
@@ -113,16 +116,23 @@ void export_compact_vector(std::ofstream& ofstream, const pmr_compact_vector& va
 namespace hyrise {
 
 void BinaryWriter::write(const Table& table, const std::string& filename) {
-  std::ofstream ofstream;
-  ofstream.exceptions(std::ofstream::failbit | std::ofstream::badbit);
-  ofstream.open(filename, std::ios::binary);
-
-  _write_header(table, ofstream);
-
-  const auto chunk_count = table.chunk_count();
-  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
-    _write_chunk(table, ofstream, chunk_id);
+  // Tables loaded from an existing file may still alias its mapping (see MappedBinaryFile). Overwriting the file in
+  // place would change or truncate their data. Instead, we write a new file and rename it over the existing one.
+  const auto temporary_filename = filename + ".tmp";
+  {
+    std::ofstream ofstream;
+    ofstream.exceptions(std::ofstream::failbit | std::ofstream::badbit);
+    ofstream.open(temporary_filename, std::ios::binary);
+
+    _write_header(table, ofstream);
+
+    const auto chunk_count = table.chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      _write_chunk(table, ofstream, chunk_id);
+    }
+    ofstream.close();
   }
+  std::filesystem::rename(temporary_filename, filename);
 }
 
 void BinaryWriter::_write_header(const Table& table, std::ofstream& ofstream) {
@@ -350,6 +360,67 @@ void BinaryWriter::_write_segment(const LZ4Segment<T>& lz4_segment, bool /*colum
   }
 }
 
+template <typename T>
+void BinaryWriter::_write_segment(const ALPSegment<T>& alp_segment, bool /*column_is_nullable*/,
+                                  std::ofstream& ofstream) {
+  export_value(ofstream, EncodingType::ALP);
+
+  // Write attribute vector compression id
+  const auto compressed_vector_type_id = _compressed_vector_type_id<T>(alp_segment);
+  export_value(ofstream, compressed_vector_type_id);
+
+  // Write number of blocks and the parameters of each block
+  export_value(ofstream, static_cast<uint32_t>(alp_segment.block_minima().size()));
+  export_values(ofstream, alp_segment.exponents());
+  export_values(ofstream, alp_segment.factors());
+  export_values(ofstream, alp_segment.block_minima());
+
+  // Write exceptions
+  export_value(ofstream, static_cast<uint32_t>(alp_segment.exception_positions().size()));
+  export_values(ofstream, alp_segment.exception_positions());
+  export_values(ofstream, alp_segment.exception_values());
+
+  // Write flag if optional NULL value vector is written
+  export_value(ofstream, static_cast<BoolAsByteType>(alp_segment.null_values().has_value()));
+  if (alp_segment.null_values()) {
+    // Write NULL values
+    export_values(ofstream, *alp_segment.null_values());
+  }
+
+  // Write offset values
+  _export_compressed_vector(ofstream, *alp_segment.compressed_vector_type(), alp_segment.offset_values());
+}
+
+template <typename T>
+void BinaryWriter::_write_segment(const FSSTSegment<T>& fsst_segment, bool /*column_is_nullable*/,
+                                  std::ofstream& ofstream) {
+  export_value(ofstream, EncodingType::FSST);
+
+  // Write attribute vector compression id
+  const auto compressed_vector_type_id = _compressed_vector_type_id<T>(fsst_segment);
+  export_value(ofstream, compressed_vector_type_id);
+
+  // Write symbol table
+  const auto& symbol_table = fsst_segment.symbol_table();
+  export_value(ofstream, static_cast<uint32_t>(symbol_table.symbols().size()));
+  export_values(ofstream, symbol_table.symbols());
+  export_values(ofstream, symbol_table.symbol_lengths());
+
+  // Write compressed values
+  export_value(ofstream, static_cast<uint32_t>(fsst_segment.compressed_values().size()));
+  export_values(ofstream, fsst_segment.compressed_values());
+
+  // Write flag if optional NULL value vector is written
+  export_value(ofstream, static_cast<BoolAsByteType>(fsst_segment.null_values().has_value()));
+  if (fsst_segment.null_values()) {
+    // Write NULL values
+    export_values(ofstream, *fsst_segment.null_values());
+  }
+
+  // Write offsets
+  _export_compressed_vector(ofstream, *fsst_segment.compressed_vector_type(), fsst_segment.offsets());
+}
+
 template <typename T>
 CompressedVectorTypeID BinaryWriter::_compressed_vector_type_id(
     const AbstractEncodedSegment& abstract_encoded_segment) {
@@ -4,9 +4,11 @@
 #include <string>
 #include <vector>
 
+#include "storage/alp_segment.hpp"
 #include "storage/dictionary_segment.hpp"
 #include "storage/fixed_string_dictionary_segment.hpp"
 #include "storage/frame_of_reference_segment.hpp"
+#include "storage/fsst_segment.hpp"
 #include "storage/lz4_segment.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/run_length_segment.hpp"
@@ -222,6 +224,66 @@ class BinaryWriter {
   template <typename T>
   static void _write_segment(const LZ4Segment<T>& lz4_segment, bool /*column_is_nullable*/, std::ofstream& ofstream);
 
+  /**
+   * ALPSegments are dumped with the following layout:
+   *
+   * Description                 | Type                                | Size in bytes
+   * --------------------------------------------------------------------------------------------------------
+   * Encoding Type               | EncodingType                        | 1
+   * Attribute vector compr. ID. | CompressedVectorTypeID              | 1
+   * Number of Blocks            | uint32_t                            | 4
+   * Exponents                   | uint8_t                             | Number of blocks * 1
+   * Factors                     | uint8_t                             | Number of blocks * 1
+   * Block minima                | int64_t                             | Number of blocks * 8
+   * Number of Exceptions        | uint32_t                            | 4
+   * Exception positions         | ChunkOffset                         | Number of exceptions * 4
+   * Exception values            | T (float, double)                   | Number of exceptions * sizeof(T)
+   * Stores NULL values          | bool (stored as BoolAsByteType)     | 1
+   * NULL values¹                | vector<bool> (BoolAsByteType)       | size * 1
+   * Vector compress. bit width² | uint8_t                             | 1
+   * Offset values²              | uint8_t                             | Rows * (vector compr. bit width) / 8
+   *                                                                     rounded up to next multiple of word (8 byte)
+   * Offset values³              | uint(8|16|32)_t                     | Rows * width of offset vector
+   *
+   * Please note that the number of rows are written in the header of the chunk.
+   * The type of the column can be found in the global header of the file.
+   *
+   * ¹: This field is only written when the optional NULL values are stored
+   * ²: This field is only written if the vector compression is BitPacking
+   * ³: This field is only written if the vector compression is FixedWidthInteger
+   */
+  template <typename T>
+  static void _write_segment(const ALPSegment<T>& alp_segment, bool /*column_is_nullable*/, std::ofstream& ofstream);
+
+  /**
+   * FSSTSegments are dumped with the following layout:
+   *
+   * Description                 | Type                                | Size in bytes
+   * --------------------------------------------------------------------------------------------------------
+   * Encoding Type               | EncodingType                        | 1
+   * Attribute vector compr. ID. | CompressedVectorTypeID              | 1
+   * Number of Symbols           | uint32_t                            | 4
+   * Symbols                     | uint64_t                            | Number of symbols * 8
+   * Symbol lengths              | uint8_t                             | Number of symbols * 1
+   * Size of compressed values   | uint32_t                            | 4
+   * Compressed values           | char                                | Size of compressed values
+   * Stores NULL values          | bool (stored as BoolAsByteType)     | 1
+   * NULL values¹                | vector<bool> (BoolAsByteType)       | size * 1
+   * Vector compress. bit width² | uint8_t                             | 1
+   * Offsets²                    | uint8_t                             | (Rows + 1) * (vector compr. bit width) / 8
+   *                                                                     rounded up to next multiple of word (8 byte)
+   * Offsets³                    | uint(8|16|32)_t                     | (Rows + 1) * width of offset vector
+   *
+   * Please note that the number of rows are written in the header of the chunk.
+   * The type of the column can be found in the global header of the file.
+   *
+   * ¹: This field is only written when the optional NULL values are stored
+   * ²: This field is only written if the vector compression is BitPacking
+   * ³: This field is only written if the vector compression is FixedWidthInteger
+   */
+  template <typename T>
+  static void _write_segment(const FSSTSegment<T>& fsst_segment, bool /*column_is_nullable*/, std::ofstream& ofstream);
+
   template <typename T>
   static CompressedVectorTypeID _compressed_vector_type_id(const AbstractEncodedSegment& abstract_encoded_segment);
 
@@ -0,0 +1,233 @@
+#include "mapped_binary_file.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <string>
+
+#include <boost/container/pmr/global_resource.hpp>
+#include <boost/container/pmr/memory_resource.hpp>
+
+#include "storage/vector_compression/bitpacking/bitpacking_vector_type.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT(build/namespaces)
+
+/**
+ * Memory resource that hands out addresses within mapped files. Before a vector aliasing the file is constructed, the
+ * expected allocation is announced for the current thread. Only an allocation with exactly the announced size is served
+ * from the mapping; all other allocations are forwarded to the default memory resource. A mapping is unmapped once its
+ * file has been parsed and all buffers aliasing it have been deallocated.
+ *
+ * A single, never-destroyed instance serves all files. Vectors keep a pointer to the resource even after their buffer
+ * has been deallocated, so that the resource must outlive every vector that has ever been allocated from it.
+ */
+class MappedFileMemoryResource : public boost::container::pmr::memory_resource {
+ public:
+  static MappedFileMemoryResource& get() {
+    // Intentionally leaked, see above.
+    static auto* const resource = new MappedFileMemoryResource{};  // NOLINT(cppcoreguidelines-owning-memory)
+    return *resource;
+  }
+
+  void register_mapping(char* data, const size_t size) {
+    const auto lock = std::lock_guard<std::mutex>{_mutex};
+    _mappings.emplace(data, Mapping{size, 0, false});
+  }
+
+  // Called when the file has been parsed. Unmaps the mapping if no buffer aliases it.
+  void release_mapping(char* data) {
+    const auto lock = std::lock_guard<std::mutex>{_mutex};
+    const auto mapping_iter = _mappings.find(data);
+    DebugAssert(mapping_iter != _mappings.end(), "Mapping was not registered.");
+    mapping_iter->second.file_closed = true;
+    _unmap_if_unused(mapping_iter);
+  }
+
+  void announce(const char* address, const size_t bytes) {
+    _announced_address = address;
+    _announced_bytes = bytes;
+  }
+
+  void clear_announcement() {
+    _announced_address = nullptr;
+    _announced_bytes = 0;
+  }
+
+ protected:
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+    if (!_announced_address || bytes != _announced_bytes ||
+        reinterpret_cast<uintptr_t>(_announced_address) % alignment != 0) {
+      return boost::container::pmr::get_default_resource()->allocate(bytes, alignment);
+    }
+
+    auto* const address = const_cast<char*>(_announced_address);  // NOLINT(cppcoreguidelines-pro-type-const-cast)
+    clear_announcement();
+
+    const auto lock = std::lock_guard<std::mutex>{_mutex};
+    const auto mapping_iter = _find_mapping(address);
+    Assert(mapping_iter != _mappings.end(), "Announced address is not mapped.");
+    ++mapping_iter->second.allocation_count;
+    return address;
+  }
+
+  void do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) override {
+    {
+      const auto lock = std::lock_guard<std::mutex>{_mutex};
+      const auto mapping_iter = _find_mapping(static_cast<char*>(pointer));
+      if (mapping_iter != _mappings.end()) {
+        --mapping_iter->second.allocation_count;
+        _unmap_if_unused(mapping_iter);
+        return;
+      }
+    }
+
+    boost::container::pmr::get_default_resource()->deallocate(pointer, bytes, alignment);
+  }
+
+  bool do_is_equal(const boost::container::pmr::memory_resource& other) const noexcept override {
+    return &other == this;
+  }
+
+ private:
+  struct Mapping {
+    size_t size;
+    size_t allocation_count;
+    bool file_closed;
+  };
+
+  using Mappings = std::map<char*, Mapping>;
+
+  MappedFileMemoryResource() = default;
+
+  // Returns the mapping that contains the address or _mappings.end(). The caller must hold the mutex.
+  Mappings::iterator _find_mapping(char* address) {
+    auto mapping_iter = _mappings.upper_bound(address);
+    if (mapping_iter == _mappings.begin()) {
+      return _mappings.end();
+    }
+
+    mapping_iter = std::prev(mapping_iter);
+    if (address >= mapping_iter->first + mapping_iter->second.size) {
+      return _mappings.end();
+    }
+    return mapping_iter;
+  }
+
+  void _unmap_if_unused(const Mappings::iterator mapping_iter) {
+    if (!mapping_iter->second.file_closed || mapping_iter->second.allocation_count > 0) {
+      return;
+    }
+
+    munmap(mapping_iter->first, mapping_iter->second.size);
+    _mappings.erase(mapping_iter);
+  }
+
+  std::mutex _mutex;
+  Mappings _mappings;
+
+  // Files are parsed by a single thread each, but multiple files may be parsed concurrently.
+  inline static thread_local const char* _announced_address{nullptr};
+  inline static thread_local size_t _announced_bytes{0};
+};
+
+}  // namespace
+
+namespace hyrise {
+
+MappedBinaryFile::MappedBinaryFile(const std::string& filename) : _filename{filename} {
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg,hicpp-vararg)
+  const auto file_descriptor = open(_filename.c_str(), O_RDONLY);
+  Assert(file_descriptor >= 0, "Failed to open '" + _filename + "': " + std::strerror(errno));
+
+  struct stat file_status{};
+  const auto stat_result = fstat(file_descriptor, &file_status);
+  if (stat_result != 0) {
+    close(file_descriptor);
+    Fail("Failed to stat '" + _filename + "': " + std::strerror(errno));
+  }
+
+  _size = static_cast<size_t>(file_status.st_size);
+  if (_size > 0) {
+    auto* const data = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+    if (data == MAP_FAILED) {
+      close(file_descriptor);
+      Fail("Failed to map '" + _filename + "': " + std::strerror(errno));
+    }
+
+    _data = static_cast<char*>(data);
+    madvise(_data, _size, MADV_SEQUENTIAL);
+    MappedFileMemoryResource::get().register_mapping(_data, _size);
+  }
+
+  // The mapping stays valid after the file descriptor has been closed.
+  close(file_descriptor);
+}
+
+MappedBinaryFile::~MappedBinaryFile() {
+  if (_data) {
+    MappedFileMemoryResource::get().release_mapping(_data);
+  }
+}
+
+const char* MappedBinaryFile::read_bytes(const size_t bytes) {
+  Assert(_position + bytes <= _size, "Unexpected end of file '" + _filename + "'.");
+
+  const auto* const data = _data + _position;
+  _position += bytes;
+  return data;
+}
+
+pmr_compact_vector MappedBinaryFile::read_compact_vector(const uint8_t bit_width, const size_t count) {
+  // The data is stored as 64-bit words, see export_compact_vector in binary_writer.cpp.
+  const auto expected_bytes = (size_t{bit_width} * count + 63) / 64 * sizeof(uint64_t);
+  const auto* const source = _data + _position;
+  auto values = pmr_compact_vector(bit_width, count, _allocator_for(source, expected_bytes, alignof(uint64_t)));
+
+  const auto bytes = values.bytes();
+  const auto aliased = _finish_aliasing(reinterpret_cast<const char*>(values.get()), source, bytes);
+  read_bytes(bytes);
+  if (!aliased && bytes > 0) {
+    std::memcpy(values.get(), source, bytes);
+  }
+  return values;
+}
+
+size_t MappedBinaryFile::size() const {
+  return _size;
+}
+
+size_t MappedBinaryFile::position() const {
+  return _position;
+}
+
+PolymorphicAllocator<size_t> MappedBinaryFile::_allocator_for(const char* source, const size_t bytes,
+                                                              const size_t alignment) const {
+  if (bytes < MIN_ALIASED_BYTES || reinterpret_cast<uintptr_t>(source) % alignment != 0 ||
+      source + bytes > _data + _size) {
+    return PolymorphicAllocator<size_t>{};
+  }
+
+  auto& resource = MappedFileMemoryResource::get();
+  resource.announce(source, bytes);
+  return PolymorphicAllocator<size_t>{&resource};
+}
+
+bool MappedBinaryFile::_finish_aliasing(const char* buffer, const char* source, const size_t bytes) const {
+  MappedFileMemoryResource::get().clear_announcement();
+  return buffer == source && bytes > 0;
+}
+
+}  // namespace hyrise
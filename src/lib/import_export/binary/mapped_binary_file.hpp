@@ -0,0 +1,103 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+#include "storage/vector_compression/bitpacking/bitpacking_vector_type.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+/**
+ * Read-only, memory-mapped view of a binary table file, which the BinaryParser consumes front to back.
+ *
+ * Large arrays of fixed-width values (e.g., the values of ValueSegments, dictionaries, and attribute vectors) are not
+ * copied. Instead, the buffers of the returned vectors alias the mapped file: they are allocated from a memory resource
+ * that hands out the addresses of the file's content. The vectors' elements are default-initialized, i.e., left
+ * untouched, so that the file can be mapped read-only and its pages stay shared with the page cache. Writing to an
+ * aliasing vector raises a segmentation fault. Since segments are immutable once they have been loaded, this does not
+ * happen. The mapping outlives the MappedBinaryFile and is unmapped once the last aliasing vector has been deallocated.
+ *
+ * Small arrays, strings, bools (which are stored as bytes but held in bit-packed std::vector<bool>s), arrays of types
+ * that are not trivially default-constructible (e.g., strong typedefs), and arrays that are not sufficiently aligned in
+ * the file are copied.
+ *
+ * The file must not be truncated or modified in place while tables loaded from it are in use. Accessing a truncated
+ * page raises SIGBUS, and modified pages silently change the loaded data. BinaryWriter therefore replaces files by
+ * renaming a new file over them, which leaves existing mappings of the old file intact.
+ */
+class MappedBinaryFile : public Noncopyable {
+ public:
+  // Arrays smaller than this are copied, as aliasing them would not save any memory.
+  static constexpr auto MIN_ALIASED_BYTES = size_t{4096};
+
+  explicit MappedBinaryFile(const std::string& filename);
+
+  ~MappedBinaryFile();
+
+  // Returns a pointer to the next `bytes` bytes and advances the read position. The pointer is not necessarily aligned.
+  const char* read_bytes(const size_t bytes);
+
+  template <typename T>
+  T read_value() {
+    T value;
+    std::memcpy(&value, read_bytes(sizeof(T)), sizeof(T));
+    return value;
+  }
+
+  // Reads `count` values of type T. If possible, the returned vector aliases the mapped file (see above).
+  template <typename T>
+  pmr_vector<T> read_values(const size_t count) {
+    const auto bytes = count * sizeof(T);
+    const auto* const source = read_bytes(bytes);
+    if constexpr (std::is_trivially_default_constructible_v<T>) {
+      const auto default_initialization = DefaultInitializationScope{};
+      auto values = pmr_vector<T>(count, _allocator_for(source, bytes, alignof(T)));
+      if (!_finish_aliasing(reinterpret_cast<const char*>(values.data()), source, bytes) && bytes > 0) {
+        std::memcpy(values.data(), source, bytes);
+      }
+      return values;
+    } else {
+      auto values = pmr_vector<T>(count);
+      if (bytes > 0) {
+        std::memcpy(static_cast<void*>(values.data()), source, bytes);
+      }
+      return values;
+    }
+  }
+
+  // Reads `count` values that are bit-packed with the given bit width. If possible, the returned vector aliases the
+  // mapped file.
+  pmr_compact_vector read_compact_vector(const uint8_t bit_width, const size_t count);
+
+  size_t size() const;
+  size_t position() const;
+
+ private:
+  // While an instance exists, vectors allocated by PolymorphicAllocator leave trivial elements uninitialized.
+  struct DefaultInitializationScope : public Noncopyable {
+    DefaultInitializationScope() {
+      detail::default_initialize_pmr_elements = true;
+    }
+
+    ~DefaultInitializationScope() {
+      detail::default_initialize_pmr_elements = false;
+    }
+  };
+
+  // Returns an allocator whose next allocation of `bytes` bytes aliases `source`, if that is possible. Otherwise, the
+  // default allocator is returned.
+  PolymorphicAllocator<size_t> _allocator_for(const char* source, const size_t bytes, const size_t alignment) const;
+
+  // Returns true if `buffer` aliases `source`. Otherwise, the caller has to copy the data.
+  bool _finish_aliasing(const char* buffer, const char* source, const size_t bytes) const;
+
+  const std::string _filename;
+  char* _data{nullptr};
+  size_t _size{0};
+  size_t _position{0};
+};
+
+}  // namespace hyrise
@@ -14,6 +14,7 @@
 #include "storage/value_segment.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
+#include "utils/date_time_utils.hpp"
 
 namespace hyrise {
 
@@ -92,14 +93,16 @@ class CsvConverter : public BaseCsvConverter {
     }
   }
 
- private:
+ protected:
   /*
    * Returns a conversion function that converts from a string to type T.
    * This function is defined for each type that can be stored in a ValueSegment.
    * The assumption is that only csv fields of type string must be unescaped because other types cannot contain special
    * csv characters.
    */
-  std::function<T(const std::string&)> _get_conversion_function();
+  virtual std::function<T(const std::string&)> _get_conversion_function();
+
+ private:
   pmr_vector<T> _parsed_values;
   pmr_vector<bool> _null_values;
   const bool _is_nullable;
@@ -153,4 +156,20 @@ inline std::function<pmr_string(const std::string&)> CsvConverter<pmr_string>::_
   };
 }
 
+// Converts dates in ISO 8601 format (YYYY-MM-DD) to the number of days since 1970-01-01, which is how DataType::Date
+// is stored.
+class DateCsvConverter final : public CsvConverter<int32_t> {
+ public:
+  using CsvConverter<int32_t>::CsvConverter;
+
+ protected:
+  std::function<int32_t(const std::string&)> _get_conversion_function() final {
+    return [](const std::string& str) {
+      const auto days = date_string_to_days(str);
+      Assert(days, "Invalid date found while converting to date: " + str);
+      return *days;
+    };
+  }
+};
+
 }  // namespace hyrise
@@ -199,6 +199,10 @@ size_t CsvParser::_parse_into_chunk(std::string_view csv_chunk, const std::vecto
   for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
     const auto is_nullable = table.column_is_nullable(column_id);
     const auto column_type = table.column_data_type(column_id);
+    if (column_type == DataType::Date) {
+      converters.emplace_back(std::make_unique<DateCsvConverter>(row_count, meta.config, is_nullable));
+      continue;
+    }
 
     resolve_data_type(column_type, [&](const auto type) {
       using ColumnDataType = typename decltype(type)::type;
@@ -15,6 +15,7 @@
 #include "storage/table.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
+#include "utils/date_time_utils.hpp"
 
 namespace hyrise {
 
@@ -68,6 +69,11 @@ void CsvWriter::_generate_content_file(const Table& table, const std::string& fi
    */
   const auto chunk_count = table.chunk_count();
   const auto column_count = table.column_count();
+  auto is_date_column = std::vector<bool>(column_count);
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    is_date_column[column_id] = table.column_data_type(column_id) == DataType::Date;
+  }
+
   for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
     const auto chunk = table.get_chunk(chunk_id);
     Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
@@ -83,6 +89,10 @@ void CsvWriter::_generate_content_file(const Table& table, const std::string& fi
         if (column_id != ColumnID{0}) {
           ofstream << config.separator;
         }
+        if (is_date_column[column_id] && !variant_is_null(value)) {
+          ofstream << days_to_date_string(boost::get<int32_t>(value));
+          continue;
+        }
         _write(value, ofstream, config);
       }
 
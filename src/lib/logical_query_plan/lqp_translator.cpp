@@ -27,6 +27,7 @@
 #include "expression/pqp_column_expression.hpp"
 #include "expression/pqp_subquery_expression.hpp"
 #include "expression/value_expression.hpp"
+#include "expression/window_expression.hpp"
 #include "expression/window_function_expression.hpp"
 #include "hyrise.hpp"
 #include "import_node.hpp"
@@ -59,14 +60,17 @@
 #include "operators/sort.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "operators/top_k.hpp"
 #include "operators/union_all.hpp"
 #include "operators/union_positions.hpp"
 #include "operators/update.hpp"
 #include "operators/validate.hpp"
+#include "operators/window.hpp"
 #include "predicate_node.hpp"
 #include "projection_node.hpp"
 #include "sort_node.hpp"
 #include "static_table_node.hpp"
+#include "statistics/cardinality_estimator.hpp"
 #include "storage/chunk.hpp"
 #include "stored_table_node.hpp"
 #include "types.hpp"
@@ -345,6 +349,10 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_sort_node(
 
     column_definitions.emplace_back(pqp_column_expression->column_id, *sort_mode_iter);
   }
+
+  if (sort_node->top_k) {
+    return std::make_shared<TopK>(current_pqp, column_definitions, *sort_node->top_k);
+  }
   current_pqp = std::make_shared<Sort>(current_pqp, column_definitions);
 
   return current_pqp;
@@ -408,6 +416,14 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_join_node(
   });
   Assert(join_operator, "No operator implementation available for join '" + join_node->description() + "'.");
 
+  // Inner hash joins publish their smaller input as a runtime join filter (see JoinHash).
+  if (join_operator->type() == OperatorType::JoinHash && join_node->join_mode == JoinMode::Inner) {
+    const auto cardinality_estimator = CardinalityEstimator{};
+    static_cast<JoinHash&>(*join_operator)
+        .set_runtime_join_filter_from_left_input(cardinality_estimator.estimate_cardinality(node->left_input()) <
+                                                 cardinality_estimator.estimate_cardinality(node->right_input()));
+  }
+
   return join_operator;
 }
 
@@ -518,10 +534,45 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_validate_node(
   return std::make_shared<Validate>(input_operator);
 }
 
-// NOLINTNEXTLINE(readability-convert-member-functions-to-static): Align methods, even though some can be static.
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_window_node(
-    const std::shared_ptr<AbstractLQPNode>& /* node */) const {
-  FailInput("Hyrise does not yet support window functions.");
+    const std::shared_ptr<AbstractLQPNode>& node) const {
+  const auto input_operator = _translate_node_recursively(node->left_input());
+  const auto& input_expressions = node->left_input()->output_expressions();
+  const auto& window_function_expression =
+      static_cast<const WindowFunctionExpression&>(*node->node_expressions.front());
+  const auto window_function = window_function_expression.window_function;
+  AssertInput(window_function != WindowFunction::CountDistinct &&
+                  window_function != WindowFunction::StandardDeviationSample && window_function != WindowFunction::Any,
+              "Hyrise does not yet support " + window_function_to_string.left.at(window_function) +
+                  " as window function.");
+
+  const auto& window = window_function_expression.window();
+  const auto& frame_description = static_cast<const WindowExpression&>(*window).frame_description;
+  const auto is_peer_bound = [](const auto& bound) {
+    return bound.unbounded || bound.type == FrameBoundType::CurrentRow;
+  };
+  AssertInput(frame_description.type != FrameType::Range ||
+                  (is_peer_bound(frame_description.start) && is_peer_bound(frame_description.end)),
+              "Hyrise does not yet support RANGE frames with offsets.");
+
+  // As for AggregateNodes, we expect the argument as well as the PARTITION BY and ORDER BY expressions to be already
+  // present. The SQLTranslator adds a ProjectionNode below the WindowNode if needed.
+  for (const auto& expression : window->arguments) {
+    Assert(find_expression_idx(*expression, input_expressions),
+           "Window expression '" + expression->as_column_name() + "' not available as column.");
+  }
+
+  // The window function is translated piecewise, as translating COUNT(*) would drop its window.
+  auto pqp_argument = std::shared_ptr<AbstractExpression>{};
+  if (WindowFunctionExpression::is_count_star(window_function_expression)) {
+    pqp_argument = std::make_shared<PQPColumnExpression>(INVALID_COLUMN_ID, DataType::Long, false, "*");
+  } else if (const auto& argument = window_function_expression.argument()) {
+    pqp_argument = _translate_expression(argument, node->left_input(), input_expressions);
+  }
+  const auto pqp_window = _translate_expression(window, node->left_input(), input_expressions);
+
+  return std::make_shared<Window>(
+      input_operator, std::make_shared<WindowFunctionExpression>(window_function, pqp_argument, pqp_window));
 }
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_change_meta_table_node(
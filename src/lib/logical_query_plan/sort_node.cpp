@@ -1,7 +1,9 @@
 #include "sort_node.hpp"
 
 #include <cstddef>
+#include <functional>
 #include <memory>
+#include <optional>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -19,8 +21,8 @@
 namespace hyrise {
 
 SortNode::SortNode(const std::vector<std::shared_ptr<AbstractExpression>>& expressions,
-                   const std::vector<SortMode>& init_sort_modes)
-    : AbstractLQPNode(LQPNodeType::Sort, expressions), sort_modes(init_sort_modes) {
+                   const std::vector<SortMode>& init_sort_modes, const std::optional<size_t>& init_top_k)
+    : AbstractLQPNode(LQPNodeType::Sort, expressions), sort_modes(init_sort_modes), top_k(init_top_k) {
   Assert(expressions.size() == sort_modes.size(), "Expected as many Expressions as SortModes");
 }
 
@@ -39,6 +41,10 @@ std::string SortNode::description(const DescriptionMode mode) const {
       stream << ", ";
     }
   }
+
+  if (top_k) {
+    stream << " (top " << *top_k << ")";
+  }
   return stream.str();
 }
 
@@ -55,11 +61,13 @@ size_t SortNode::_on_shallow_hash() const {
   for (const auto& sort_mode : sort_modes) {
     boost::hash_combine(hash, sort_mode);
   }
+  boost::hash_combine(hash, std::hash<std::optional<size_t>>{}(top_k));
   return hash;
 }
 
 std::shared_ptr<AbstractLQPNode> SortNode::_on_shallow_copy(LQPNodeMapping& node_mapping) const {
-  return SortNode::make(expressions_copy_and_adapt_to_different_lqp(node_expressions, node_mapping), sort_modes);
+  return SortNode::make(expressions_copy_and_adapt_to_different_lqp(node_expressions, node_mapping), sort_modes,
+                        top_k);
 }
 
 bool SortNode::_on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const {
@@ -67,7 +75,7 @@ bool SortNode::_on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMappi
 
   return expressions_equal_to_expressions_in_different_lqp(node_expressions, sort_node.node_expressions,
                                                            node_mapping) &&
-         sort_modes == sort_node.sort_modes;
+         sort_modes == sort_node.sort_modes && top_k == sort_node.top_k;
 }
 
 }  // namespace hyrise
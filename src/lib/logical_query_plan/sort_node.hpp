@@ -1,6 +1,8 @@
 #pragma once
 
+#include <cstddef>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -14,7 +16,8 @@ namespace hyrise {
 class SortNode : public EnableMakeForLQPNode<SortNode>, public AbstractLQPNode {
  public:
   explicit SortNode(const std::vector<std::shared_ptr<AbstractExpression>>& expressions,
-                    const std::vector<SortMode>& init_sort_modes);
+                    const std::vector<SortMode>& init_sort_modes,
+                    const std::optional<size_t>& init_top_k = std::nullopt);
 
   std::string description(const DescriptionMode mode = DescriptionMode::Short) const override;
 
@@ -25,6 +28,10 @@ class SortNode : public EnableMakeForLQPNode<SortNode>, public AbstractLQPNode {
 
   const std::vector<SortMode> sort_modes;
 
+  // Set by the TopKRule if the SortNode is directly followed by a LimitNode with a constant row count. The
+  // LQPTranslator then creates a TopK operator that only outputs the first `top_k` rows.
+  const std::optional<size_t> top_k;
+
  protected:
   size_t _on_shallow_hash() const override;
   std::shared_ptr<AbstractLQPNode> _on_shallow_copy(LQPNodeMapping& node_mapping) const override;
@@ -46,10 +46,12 @@ enum class OperatorType {
   Sort,
   TableScan,
   TableWrapper,
+  TopK,
   UnionAll,
   UnionPositions,
   Update,
   Validate,
+  Window,
   Mock  // for Tests that need to Mock operators
 };
 
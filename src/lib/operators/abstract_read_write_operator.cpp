@@ -3,6 +3,7 @@
 #include <memory>
 #include <ostream>
 
+#include "concurrency/log_entry.hpp"
 #include "concurrency/transaction_context.hpp"
 #include "operators/abstract_operator.hpp"
 #include "types.hpp"
@@ -49,6 +50,12 @@ void AbstractReadWriteOperator::commit_records(const CommitID commit_id) {
   _rw_state = ReadWriteOperatorState::Committed;
 }
 
+void AbstractReadWriteOperator::write_log_records(LogEntryWriter& log_entry) const {
+  Assert(_rw_state == ReadWriteOperatorState::Executed, "Operator needs to have state Executed in order to be logged.");
+
+  _on_write_log_records(log_entry);
+}
+
 void AbstractReadWriteOperator::rollback_records() {
   Assert(_rw_state == ReadWriteOperatorState::Conflicted || _rw_state == ReadWriteOperatorState::Executed,
          "Operator needs to have state Failed or Executed in order to be rolled back.");
@@ -66,6 +73,8 @@ ReadWriteOperatorState AbstractReadWriteOperator::state() const {
   return _rw_state;
 }
 
+void AbstractReadWriteOperator::_on_write_log_records(LogEntryWriter& /*log_entry*/) const {}
+
 void AbstractReadWriteOperator::_mark_as_failed() {
   Assert(_rw_state == ReadWriteOperatorState::Pending, "Operator can only be marked as failed if pending.");
 
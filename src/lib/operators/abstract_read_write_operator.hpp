@@ -11,6 +11,8 @@
 
 namespace hyrise {
 
+class LogEntryWriter;
+
 enum class ReadWriteOperatorState {
   Pending,     // The operator has been instantiated.
   Executed,    // Execution succeeded.
@@ -39,6 +41,12 @@ class AbstractReadWriteOperator : public AbstractOperator {
    */
   void commit_records(const CommitID commit_id);
 
+  /**
+   * Adds the modifications of the operator to the log entry of the committing transaction if write-ahead logging is
+   * enabled. Called by the TransactionContext after the commit ID has been assigned and before commit_records.
+   */
+  void write_log_records(LogEntryWriter& log_entry) const;
+
   /**
    * Rolls back the operator by unlocking all modified rows. No other action is necessary since commit_records should
    * have never been called and the modifications were not made visible in the first place.
@@ -73,6 +81,12 @@ class AbstractReadWriteOperator : public AbstractOperator {
    */
   virtual void _on_commit_records(const CommitID commit_id) = 0;
 
+  /**
+   * Called by write_log_records. Operators that modify tables serialize their modifications here. Does nothing by
+   * default.
+   */
+  virtual void _on_write_log_records(LogEntryWriter& log_entry) const;
+
   /**
    * Called by rollback_records.
    */
@@ -3,11 +3,13 @@
 #include <algorithm>
 #include <array>
 #include <atomic>
+#include <bit>
 #include <chrono>
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <iterator>
 #include <limits>
 #include <memory>
 #include <numeric>
@@ -33,6 +35,7 @@
 #include "scheduler/job_task.hpp"
 #include "storage/abstract_segment.hpp"
 #include "storage/chunk.hpp"
+#include "storage/global_dictionary_utils.hpp"
 #include "storage/pos_lists/abstract_pos_list.hpp"
 #include "storage/pos_lists/entire_chunk_pos_list.hpp"
 #include "storage/pos_lists/row_id_pos_list.hpp"
@@ -237,6 +240,59 @@ AggregateKey& get_aggregate_key([[maybe_unused]] KeysPerChunk<AggregateKey>& key
   }
 }
 
+// Merges the partial result `source` of a group into `target`. Used by the parallel aggregation, where each job
+// aggregates a range of chunks before the partial results of all jobs are combined.
+template <typename ColumnDataType, WindowFunction aggregate_function>
+void merge_aggregate_result(AggregateResult<ColumnDataType, aggregate_function>& target,
+                            AggregateResult<ColumnDataType, aggregate_function>& source) {
+  if (target.row_id.is_null()) {
+    target.row_id = source.row_id;
+  }
+
+  if (source.aggregate_count == 0) {
+    return;
+  }
+
+  if constexpr (aggregate_function == WindowFunction::Min) {
+    if (target.aggregate_count == 0 || value_smaller(source.accumulator, target.accumulator)) {
+      target.accumulator = std::move(source.accumulator);
+    }
+  } else if constexpr (aggregate_function == WindowFunction::Max) {
+    if (target.aggregate_count == 0 || value_greater(source.accumulator, target.accumulator)) {
+      target.accumulator = std::move(source.accumulator);
+    }
+  } else if constexpr (aggregate_function == WindowFunction::Sum || aggregate_function == WindowFunction::Avg) {
+    if constexpr (std::is_arithmetic_v<ColumnDataType>) {
+      target.accumulator += source.accumulator;
+    } else {
+      Fail("SUM and AVG are not available for non-arithmetic types.");
+    }
+  } else if constexpr (aggregate_function == WindowFunction::CountDistinct) {
+    target.accumulator.insert(source.accumulator.cbegin(), source.accumulator.cend());
+  } else if constexpr (aggregate_function == WindowFunction::StandardDeviationSample) {
+    // Combine the partial states of Welford's algorithm, see
+    // https://en.wikipedia.org/wiki/Algorithms_for_calculating_variance#Parallel_algorithm
+    auto& count = target.accumulator[0];
+    auto& mean = target.accumulator[1];
+    auto& squared_distance_from_mean = target.accumulator[2];
+    auto& result = target.accumulator[3];
+
+    const auto source_count = source.accumulator[0];
+    const auto combined_count = count + source_count;
+    const auto delta = source.accumulator[1] - mean;
+    mean += delta * source_count / combined_count;
+    squared_distance_from_mean += source.accumulator[2] + delta * delta * count * source_count / combined_count;
+    count = combined_count;
+
+    if (count > 1) {
+      result = std::sqrt(squared_distance_from_mean / (count - 1));
+    }
+  }
+
+  // COUNT only requires the number of values.
+  target.aggregate_count += source.aggregate_count;
+}
+
 template <typename Results>
 void write_groupby_output(const std::shared_ptr<const Table>& input_table,
                           const std::vector<std::shared_ptr<WindowFunctionExpression>>& aggregates,
@@ -421,15 +477,15 @@ struct AggregateContext : public AggregateResultContext<ColumnDataType, aggregat
 };
 
 template <typename ColumnDataType, WindowFunction aggregate_function, typename AggregateKey>
-__attribute__((hot)) void AggregateHash::_aggregate_segment(ChunkID chunk_id, ColumnID column_index,
-                                                            const AbstractSegment& abstract_segment,
-                                                            KeysPerChunk<AggregateKey>& keys_per_chunk) {
+__attribute__((hot)) void AggregateHash::_aggregate_segment(
+    ChunkID chunk_id, ColumnID column_index, const AbstractSegment& abstract_segment,
+    KeysPerChunk<AggregateKey>& keys_per_chunk, std::vector<std::shared_ptr<SegmentVisitorContext>>& contexts) {
   using AggregateType = typename WindowFunctionTraits<ColumnDataType, aggregate_function>::ReturnType;
 
   auto aggregator = WindowFunctionBuilder<ColumnDataType, AggregateType, aggregate_function>().get_aggregate_function();
 
   auto& context = *std::static_pointer_cast<AggregateContext<ColumnDataType, aggregate_function, AggregateKey>>(
-      _contexts_per_column[column_index]);
+      contexts[column_index]);
 
   auto& result_ids = *context.result_ids;
   auto& results = context.results;
@@ -462,7 +518,7 @@ __attribute__((hot)) void AggregateHash::_aggregate_segment(ChunkID chunk_id, Co
   // (and thus more than one context), it makes sense to cache the results indexes, see get_or_add_result for details.
   // Furthermore, if we use the immediate key shortcut (which uses the same code path as caching), we need to pass
   // true_type so that the aggregate keys are checked for immediate access values.
-  if (_contexts_per_column.size() > 1 || _use_immediate_key_shortcut) {
+  if (contexts.size() > 1 || _use_immediate_key_shortcut) {
     segment_iterate<ColumnDataType>(abstract_segment, [&](const auto& position) {
       process_position(std::true_type{}, position);
     });
@@ -534,6 +590,46 @@ KeysPerChunk<AggregateKey> AggregateHash::_partition_by_groupby_keys() {
         const auto groupby_column_id = _groupby_column_ids.at(group_column_index);
         const auto data_type = input_table->column_data_type(groupby_column_id);
 
+        const auto use_immediate_keys_if_dense = [&](const AggregateKeyEntry min_key, const AggregateKeyEntry max_key) {
+          if constexpr (std::is_same_v<AggregateKey, AggregateKeyEntry>) {
+            // In some cases (e.g., TPC-H Q18), we aggregate with consecutive int32_t values being used as a GROUP BY
+            // key. Notably, this is the case when aggregating on the serial primary key of a table without filtering
+            // the table before. In these cases, we do not need to perform a full hash-based aggregation, but can use
+            // the values as immediate indexes into the list of results. To handle smaller gaps, we include cases up
+            // to a certain threshold, but at some point these gaps make the approach less beneficial than a proper
+            // hash-based approach. Both min_key and max_key do not correspond to the original value, but are the
+            // result of the int_to_uint transformation or the shifted value ID of a global dictionary. As such, they
+            // are guaranteed to be positive. This shortcut only works if we are aggregating with a single GROUP BY
+            // column (i.e., when we use AggregateKeyEntry) - otherwise, we cannot establish a 1:1 mapping from
+            // keys_per_chunk to the result id.
+            // TODO(anyone): Find a reasonable threshold.
+            if (max_key > 0 &&
+                static_cast<double>(max_key - min_key) < static_cast<double>(input_table->row_count()) * 1.2) {
+              // Include space for min, max, and NULL
+              _expected_result_size = static_cast<size_t>(max_key - min_key) + 2;
+              _use_immediate_key_shortcut = true;
+
+              // Rewrite the keys and (1) subtract min so that we can also handle consecutive keys that do not start
+              // at 1* and (2) set the first bit which indicates that the key is an immediate index into the result
+              // vector (see get_or_add_result).
+              // *) Note: Because of int_to_uint below, int32_t values do not start at 1, anyway.
+
+              for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+                const auto chunk_size = input_table->get_chunk(chunk_id)->size();
+                for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+                  auto& key = keys_per_chunk[chunk_id][chunk_offset];
+                  if (key == 0) {
+                    // Key that denotes NULL, do not rewrite but set the cached flag
+                    key = key | CACHE_MASK;
+                  } else {
+                    key = (key - min_key + 1) | CACHE_MASK;
+                  }
+                }
+              }
+            }
+          }
+        };
+
         resolve_data_type(data_type, [&](auto type) {
           using ColumnDataType = typename decltype(type)::type;
 
@@ -542,8 +638,7 @@ KeysPerChunk<AggregateKey> AggregateHash::_partition_by_groupby_keys() {
             // AggregateKeyEntry. We cannot do this for types with the same size as AggregateKeyEntry as we need to have
             // a special NULL value. By using the value itself, we can save us the effort of building the id_map.
 
-            // Track the minimum and maximum key for the immediate key optimization. Search this cpp file for the last
-            // use of `min_key` for a longer explanation.
+            // Track the minimum and maximum key for the immediate key optimization (see use_immediate_keys_if_dense).
             auto min_key = std::numeric_limits<AggregateKeyEntry>::max();
             auto max_key = uint64_t{0};
 
@@ -587,42 +682,46 @@ KeysPerChunk<AggregateKey> AggregateHash::_partition_by_groupby_keys() {
             }
 
             if constexpr (std::is_same_v<AggregateKey, AggregateKeyEntry>) {
-              // In some cases (e.g., TPC-H Q18), we aggregate with consecutive int32_t values being used as a GROUP BY
-              // key. Notably, this is the case when aggregating on the serial primary key of a table without filtering
-              // the table before. In these cases, we do not need to perform a full hash-based aggregation, but can use
-              // the values as immediate indexes into the list of results. To handle smaller gaps, we include cases up
-              // to a certain threshold, but at some point these gaps make the approach less beneficial than a proper
-              // hash-based approach. Both min_key and max_key do not correspond to the original int32_t value, but are
-              // the result of the int_to_uint transformation. As such, they are guaranteed to be positive. This
-              // shortcut only works if we are aggregating with a single GROUP BY column (i.e., when we use
-              // AggregateKeyEntry) - otherwise, we cannot establish a 1:1 mapping from keys_per_chunk to the result id.
-              // TODO(anyone): Find a reasonable threshold.
-              if (max_key > 0 &&
-                  static_cast<double>(max_key - min_key) < static_cast<double>(input_table->row_count()) * 1.2) {
-                // Include space for min, max, and NULL
-                _expected_result_size = static_cast<size_t>(max_key - min_key) + 2;
-                _use_immediate_key_shortcut = true;
-
-                // Rewrite the keys and (1) subtract min so that we can also handle consecutive keys that do not start
-                // at 1* and (2) set the first bit which indicates that the key is an immediate index into the result
-                // vector (see get_or_add_result).
-                // *) Note: Because of int_to_uint above, the values do not start at 1, anyway.
+              use_immediate_keys_if_dense(min_key, max_key);
+            }
+          } else {
+            if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+              // If all segments of the column share a global dictionary, the value IDs already identify the groups and
+              // neither the id_map nor any string comparisons are required (see global_dictionary_utils.hpp). The
+              // value IDs are shifted by one so that 0 represents NULL.
+              if (global_dictionary<pmr_string>(*input_table, groupby_column_id)) {
+                auto min_key = std::numeric_limits<AggregateKeyEntry>::max();
+                auto max_key = AggregateKeyEntry{0};
 
                 for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
-                  const auto chunk_size = input_table->get_chunk(chunk_id)->size();
-                  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
-                    auto& key = keys_per_chunk[chunk_id][chunk_offset];
-                    if (key == 0) {
-                      // Key that denotes NULL, do not rewrite but set the cached flag
-                      key = key | CACHE_MASK;
+                  const auto chunk_in = input_table->get_chunk(chunk_id);
+                  if (!chunk_in) {
+                    continue;
+                  }
+
+                  auto& keys = keys_per_chunk[chunk_id];
+                  for_each_global_value_id(*chunk_in->get_segment(groupby_column_id), [&](const auto& position) {
+                    const auto key = position.is_null() ? AggregateKeyEntry{0}
+                                                        : static_cast<AggregateKeyEntry>(position.value()) + 1;
+                    if constexpr (std::is_same_v<AggregateKey, AggregateKeyEntry>) {
+                      keys[position.chunk_offset()] = key;
+                      if (key != 0) {
+                        min_key = std::min(min_key, key);
+                        max_key = std::max(max_key, key);
+                      }
                     } else {
-                      key = (key - min_key + 1) | CACHE_MASK;
+                      keys[position.chunk_offset()][group_column_index] = key;
                     }
-                  }
+                  });
+                }
+
+                if constexpr (std::is_same_v<AggregateKey, AggregateKeyEntry>) {
+                  use_immediate_keys_if_dense(min_key, max_key);
                 }
+                return;
               }
             }
-          } else {
+
             /*
             Store unique IDs for equal values in the groupby column (similar to dictionary encoding).
             The ID 0 is reserved for NULL values. The combined IDs build an AggregateKey for each row.
@@ -791,24 +890,53 @@ void AggregateHash::_aggregate() {
   /**
    * AGGREGATION STEP
    */
-  _contexts_per_column = std::vector<std::shared_ptr<SegmentVisitorContext>>(_aggregates.size());
+  _contexts_per_column = _create_aggregate_contexts<AggregateKey>(_expected_result_size);
+
+  const auto chunk_count = input_table->chunk_count();
+  if constexpr (!std::is_same_v<AggregateKey, EmptyAggregateKey>) {
+    // Immediate keys are already direct indexes into the results and do not require any hash lookups. Thus, we only
+    // aggregate in parallel for proper hash-based aggregations of large inputs.
+    if (!_use_immediate_key_shortcut && Hyrise::get().is_multi_threaded() && chunk_count > 1 &&
+        input_table->row_count() >= PARALLEL_AGGREGATION_ROW_THRESHOLD) {
+      _aggregate_parallel<AggregateKey>(keys_per_chunk);
+      step_performance_data.set_step_runtime(OperatorSteps::Aggregating, timer.lap());
+      return;
+    }
+  }
+
+  // Process chunks and perform aggregations.
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk_in = input_table->get_chunk(chunk_id);
+    if (!chunk_in) {
+      continue;
+    }
+
+    _aggregate_chunk<AggregateKey>(chunk_id, *chunk_in, keys_per_chunk, _contexts_per_column);
+  }
+  step_performance_data.set_step_runtime(OperatorSteps::Aggregating, timer.lap());
+}
+
+template <typename AggregateKey>
+std::vector<std::shared_ptr<SegmentVisitorContext>> AggregateHash::_create_aggregate_contexts(
+    const size_t preallocated_size) const {
+  const auto& input_table = left_input_table();
+  auto contexts = std::vector<std::shared_ptr<SegmentVisitorContext>>(_aggregates.size());
 
   if (!_has_aggregate_functions) {
     /*
-    Insert a dummy context for the DISTINCT implementation. That way, `_contexts_per_column` will always have at least
-    one context with results. This is important later on when we write the group keys into the table. The template
-    parameters (int32_t, WindowFunction::Min) do not matter, as we do not calculate an aggregate anyway.
+    Insert a dummy context for the DISTINCT implementation. That way, there will always be at least one context with
+    results. This is important later on when we write the group keys into the table. The template parameters (int32_t,
+    WindowFunction::Min) do not matter, as we do not calculate an aggregate anyway.
     */
-    auto context =
-        std::make_shared<AggregateContext<int32_t, WindowFunction::Min, AggregateKey>>(_expected_result_size);
+    auto context = std::make_shared<AggregateContext<int32_t, WindowFunction::Min, AggregateKey>>(preallocated_size);
 
-    _contexts_per_column.push_back(context);
+    contexts.push_back(context);
   }
 
   /**
    * Create an AggregateContext for each column in the input table that a normal (i.e. non-DISTINCT) aggregate is
-   * created on. We do this here, and not in the per-chunk-loop below, because there might be no Chunks in the input
-   * and _write_aggregate_output() needs these contexts anyway.
+   * created on. We do this here, and not in _aggregate_chunk(), because there might be no Chunks in the input and
+   * _write_aggregate_output() needs these contexts anyway.
    */
   const auto aggregate_count = _aggregates.size();
   for (auto aggregate_idx = ColumnID{0}; aggregate_idx < aggregate_count; ++aggregate_idx) {
@@ -821,180 +949,380 @@ void AggregateHash::_aggregate() {
       Assert(aggregate->window_function == WindowFunction::Count, "Only COUNT may have an invalid ColumnID.");
       // SELECT COUNT(*) - we know the template arguments, so we do not need a visitor.
       auto context = std::make_shared<AggregateContext<CountColumnType, WindowFunction::Count, AggregateKey>>(
-          _expected_result_size);
+          preallocated_size);
 
-      _contexts_per_column[aggregate_idx] = context;
+      contexts[aggregate_idx] = context;
       continue;
     }
     const auto data_type = input_table->column_data_type(input_column_id);
-    _contexts_per_column[aggregate_idx] =
-        _create_aggregate_context<AggregateKey>(data_type, aggregate->window_function);
+    contexts[aggregate_idx] =
+        _create_aggregate_context<AggregateKey>(data_type, aggregate->window_function, preallocated_size);
   }
 
-  // Process chunks and perform aggregations.
-  const auto chunk_count = input_table->chunk_count();
-  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
-    const auto chunk_in = input_table->get_chunk(chunk_id);
-    if (!chunk_in) {
-      continue;
-    }
+  return contexts;
+}
 
-    const auto input_chunk_size = chunk_in->size();
-    if (!_has_aggregate_functions) {
+template <typename AggregateKey>
+void AggregateHash::_aggregate_chunk(const ChunkID chunk_id, const Chunk& chunk,
+                                     KeysPerChunk<AggregateKey>& keys_per_chunk,
+                                     std::vector<std::shared_ptr<SegmentVisitorContext>>& contexts) {
+  const auto& input_table = left_input_table();
+  const auto input_chunk_size = chunk.size();
+
+  if (!_has_aggregate_functions) {
+    /**
+     * DISTINCT implementation
+     *
+     * In Hyrise we handle the SQL keyword DISTINCT by using an aggregate operator with grouping but without 
+     * aggregate functions. All input columns (either explicitly specified as `SELECT DISTINCT a, b, c` OR implicitly
+     * as `SELECT DISTINCT *` are passed as `groupby_column_ids`).
+     *
+     * As the grouping happens as part of the aggregation but no aggregate function exists, we use
+     * `WindowFunction::Min` as a fake aggregate function whose result will be discarded. From here on, the steps
+     * are the same as they are for a regular grouped aggregate.
+     */
+
+    auto context = std::static_pointer_cast<AggregateContext<DistinctColumnType, WindowFunction::Min, AggregateKey>>(
+        contexts[0]);
+
+    auto& result_ids = *context->result_ids;
+    auto& results = context->results;
+
+    // Add value or combination of values is added to the list of distinct value(s). This is done by calling
+    // get_or_add_result, which adds the corresponding entry in the list of GROUP BY values.
+    if (_use_immediate_key_shortcut) {
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < input_chunk_size; ++chunk_offset) {
+        // We are able to use immediate keys, so pass true_type so that the combined caching/immediate key code path
+        // is enabled in get_or_add_result.
+        get_or_add_result(std::true_type{}, result_ids, results,
+                          get_aggregate_key<AggregateKey>(keys_per_chunk, chunk_id, chunk_offset),
+                          RowID{chunk_id, chunk_offset});
+      }
+    } else {
+      // Same as above, but we do not have immediate keys, so we disable that code path to reduce the complexity of
+      // get_aggregate_key.
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < input_chunk_size; ++chunk_offset) {
+        get_or_add_result(std::false_type{}, result_ids, results,
+                          get_aggregate_key<AggregateKey>(keys_per_chunk, chunk_id, chunk_offset),
+                          RowID{chunk_id, chunk_offset});
+      }
+    }
+  } else {
+    auto aggregate_idx = ColumnID{0};
+    for (const auto& aggregate : _aggregates) {
       /**
-       * DISTINCT implementation
-       *
-       * In Hyrise we handle the SQL keyword DISTINCT by using an aggregate operator with grouping but without 
-       * aggregate functions. All input columns (either explicitly specified as `SELECT DISTINCT a, b, c` OR implicitly
-       * as `SELECT DISTINCT *` are passed as `groupby_column_ids`).
-       *
-       * As the grouping happens as part of the aggregation but no aggregate function exists, we use
-       * `WindowFunction::Min` as a fake aggregate function whose result will be discarded. From here on, the steps
-       * are the same as they are for a regular grouped aggregate.
+       * Special COUNT(*) implementation.
+       * Because COUNT(*) does not have a specific target column, we use the maximum ColumnID. We then go through the
+       * `keys_per_chunk` map and count the occurrences of each group key. The results are saved in the regular
+       * `aggregate_count` variable so that we do not need a specific output logic for COUNT(*).
        */
 
-      auto context = std::static_pointer_cast<AggregateContext<DistinctColumnType, WindowFunction::Min, AggregateKey>>(
-          _contexts_per_column[0]);
-
-      auto& result_ids = *context->result_ids;
-      auto& results = context->results;
-
-      // Add value or combination of values is added to the list of distinct value(s). This is done by calling
-      // get_or_add_result, which adds the corresponding entry in the list of GROUP BY values.
-      if (_use_immediate_key_shortcut) {
-        for (auto chunk_offset = ChunkOffset{0}; chunk_offset < input_chunk_size; ++chunk_offset) {
-          // We are able to use immediate keys, so pass true_type so that the combined caching/immediate key code path
-          // is enabled in get_or_add_result.
-          get_or_add_result(std::true_type{}, result_ids, results,
-                            get_aggregate_key<AggregateKey>(keys_per_chunk, chunk_id, chunk_offset),
-                            RowID{chunk_id, chunk_offset});
-        }
-      } else {
-        // Same as above, but we do not have immediate keys, so we disable that code path to reduce the complexity of
-        // get_aggregate_key.
-        for (auto chunk_offset = ChunkOffset{0}; chunk_offset < input_chunk_size; ++chunk_offset) {
-          get_or_add_result(std::false_type{}, result_ids, results,
-                            get_aggregate_key<AggregateKey>(keys_per_chunk, chunk_id, chunk_offset),
-                            RowID{chunk_id, chunk_offset});
+      const auto& pqp_column = static_cast<const PQPColumnExpression&>(*aggregate->argument());
+      const auto input_column_id = pqp_column.column_id;
+
+      if (input_column_id == INVALID_COLUMN_ID) {
+        Assert(aggregate->window_function == WindowFunction::Count, "Only COUNT may have an invalid ColumnID.");
+        auto context =
+            std::static_pointer_cast<AggregateContext<CountColumnType, WindowFunction::Count, AggregateKey>>(
+                contexts[aggregate_idx]);
+
+        auto& result_ids = *context->result_ids;
+        auto& results = context->results;
+
+        if constexpr (std::is_same_v<AggregateKey, EmptyAggregateKey>) {
+          // Not grouped by anything, simply count the number of rows.
+          results.resize(1);
+          results[0].aggregate_count += input_chunk_size;
+
+          // We need to set any RowID because the default value (NULL_ROW_ID) would later be skipped. As we are not
+          // reconstructing the GROUP BY values later, the exact value of this row_id does not matter, as long as it
+          // not NULL_ROW_ID.
+          results[0].row_id = RowID{ChunkID{0}, ChunkOffset{0}};
+        } else {
+          // Count occurrences for each group key -  If we have more than one aggregate function (and thus more than
+          // one context), it makes sense to cache the results indexes, see get_or_add_result for details.
+          if (contexts.size() > 1 || _use_immediate_key_shortcut) {
+            for (auto chunk_offset = ChunkOffset{0}; chunk_offset < input_chunk_size; ++chunk_offset) {
+              // Use CacheResultIds==true_type if we have more than one group by column or if the cached result ids
+              // have been written by the immediate key shortcut
+              auto& result =
+                  get_or_add_result(std::true_type{}, result_ids, results,
+                                    get_aggregate_key<AggregateKey>(keys_per_chunk, chunk_id, chunk_offset),
+                                    RowID{chunk_id, chunk_offset});
+              ++result.aggregate_count;
+            }
+          } else {
+            for (auto chunk_offset = ChunkOffset{0}; chunk_offset < input_chunk_size; ++chunk_offset) {
+              auto& result =
+                  get_or_add_result(std::false_type{}, result_ids, results,
+                                    get_aggregate_key<AggregateKey>(keys_per_chunk, chunk_id, chunk_offset),
+                                    RowID{chunk_id, chunk_offset});
+              ++result.aggregate_count;
+            }
+          }
         }
+
+        ++aggregate_idx;
+        continue;
       }
-    } else {
-      auto aggregate_idx = ColumnID{0};
-      for (const auto& aggregate : _aggregates) {
-        /**
-         * Special COUNT(*) implementation.
-         * Because COUNT(*) does not have a specific target column, we use the maximum ColumnID. We then go through the
-         * `keys_per_chunk` map and count the occurrences of each group key. The results are saved in the regular
-         * `aggregate_count` variable so that we do not need a specific output logic for COUNT(*).
-         */
 
-        const auto& pqp_column = static_cast<const PQPColumnExpression&>(*aggregate->argument());
-        const auto input_column_id = pqp_column.column_id;
+      const auto abstract_segment = chunk.get_segment(input_column_id);
+      const auto data_type = input_table->column_data_type(input_column_id);
+
+      /*
+      Invoke correct aggregator for each segment
+      */
+
+      resolve_data_type(data_type, [&, aggregate](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+
+        switch (aggregate->window_function) {
+          case WindowFunction::Min:
+            _aggregate_segment<ColumnDataType, WindowFunction::Min, AggregateKey>(
+                chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk, contexts);
+            break;
+          case WindowFunction::Max:
+            _aggregate_segment<ColumnDataType, WindowFunction::Max, AggregateKey>(
+                chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk, contexts);
+            break;
+          case WindowFunction::Sum:
+            _aggregate_segment<ColumnDataType, WindowFunction::Sum, AggregateKey>(
+                chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk, contexts);
+            break;
+          case WindowFunction::Avg:
+            _aggregate_segment<ColumnDataType, WindowFunction::Avg, AggregateKey>(
+                chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk, contexts);
+            break;
+          case WindowFunction::Count:
+            _aggregate_segment<ColumnDataType, WindowFunction::Count, AggregateKey>(
+                chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk, contexts);
+            break;
+          case WindowFunction::CountDistinct:
+            _aggregate_segment<ColumnDataType, WindowFunction::CountDistinct, AggregateKey>(
+                chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk, contexts);
+            break;
+          case WindowFunction::StandardDeviationSample:
+            _aggregate_segment<ColumnDataType, WindowFunction::StandardDeviationSample, AggregateKey>(
+                chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk, contexts);
+            break;
+          case WindowFunction::Any:
+            // ANY is a pseudo-function and is handled by `write_groupby_output`.
+            break;
+          case WindowFunction::CumeDist:
+          case WindowFunction::DenseRank:
+          case WindowFunction::PercentRank:
+          case WindowFunction::Rank:
+          case WindowFunction::RowNumber:
+            Fail("Unsupported aggregate function " + window_function_to_string.left.at(aggregate->window_function) +
+                 ".");
+        }
+      });
 
-        if (input_column_id == INVALID_COLUMN_ID) {
-          Assert(aggregate->window_function == WindowFunction::Count, "Only COUNT may have an invalid ColumnID.");
-          auto context =
-              std::static_pointer_cast<AggregateContext<CountColumnType, WindowFunction::Count, AggregateKey>>(
-                  _contexts_per_column[aggregate_idx]);
+      ++aggregate_idx;
+    }
+  }
+}  // NOLINT(readability/fn_size)
 
-          auto& result_ids = *context->result_ids;
-          auto& results = context->results;
+template <typename AggregateKey>
+void AggregateHash::_aggregate_parallel(KeysPerChunk<AggregateKey>& keys_per_chunk) {
+  const auto& input_table = left_input_table();
+  const auto chunk_count = input_table->chunk_count();
 
-          if constexpr (std::is_same_v<AggregateKey, EmptyAggregateKey>) {
-            // Not grouped by anything, simply count the number of rows.
-            results.resize(1);
-            results[0].aggregate_count += input_chunk_size;
+  // The contexts that hold results. The first of them is the one that first processes each row (see
+  // _aggregate_chunk()). Thus, its result_ids map holds all groups of a job, and the other contexts use the same result
+  // ids (cached in the AggregateKeys).
+  auto result_context_ids = std::vector<ColumnID>{};
+  if (!_has_aggregate_functions) {
+    result_context_ids.emplace_back(0);
+  } else {
+    const auto aggregate_count = _aggregates.size();
+    for (auto aggregate_idx = ColumnID{0}; aggregate_idx < aggregate_count; ++aggregate_idx) {
+      if (_aggregates[aggregate_idx]->window_function != WindowFunction::Any) {
+        result_context_ids.emplace_back(aggregate_idx);
+      }
+    }
+  }
+  const auto group_context_id = result_context_ids.front();
 
-            // We need to set any RowID because the default value (NULL_ROW_ID) would later be skipped. As we are not
-            // reconstructing the GROUP BY values later, the exact value of this row_id does not matter, as long as it
-            // not NULL_ROW_ID.
-            results[0].row_id = RowID{ChunkID{0}, ChunkOffset{0}};
-          } else {
-            // Count occurrences for each group key -  If we have more than one aggregate function (and thus more than
-            // one context), it makes sense to cache the results indexes, see get_or_add_result for details.
-            if (_contexts_per_column.size() > 1 || _use_immediate_key_shortcut) {
-              for (auto chunk_offset = ChunkOffset{0}; chunk_offset < input_chunk_size; ++chunk_offset) {
-                // Use CacheResultIds==true_type if we have more than one group by column or if the cached result ids
-                // have been written by the immediate key shortcut
-                auto& result =
-                    get_or_add_result(std::true_type{}, result_ids, results,
-                                      get_aggregate_key<AggregateKey>(keys_per_chunk, chunk_id, chunk_offset),
-                                      RowID{chunk_id, chunk_offset});
-                ++result.aggregate_count;
-              }
-            } else {
-              for (auto chunk_offset = ChunkOffset{0}; chunk_offset < input_chunk_size; ++chunk_offset) {
-                auto& result =
-                    get_or_add_result(std::false_type{}, result_ids, results,
-                                      get_aggregate_key<AggregateKey>(keys_per_chunk, chunk_id, chunk_offset),
-                                      RowID{chunk_id, chunk_offset});
-                ++result.aggregate_count;
-              }
-            }
-          }
+  /**
+   * PHASE 1: Each job aggregates a range of consecutive chunks into its own contexts.
+   */
+  const auto max_job_count = std::max(Hyrise::get().topology.num_cpus(), size_t{1});
+  const auto chunks_per_job = (static_cast<size_t>(chunk_count) + max_job_count - 1) / max_job_count;
+  const auto job_count = (static_cast<size_t>(chunk_count) + chunks_per_job - 1) / chunks_per_job;
 
-          ++aggregate_idx;
-          continue;
+  auto job_contexts = std::vector<std::vector<std::shared_ptr<SegmentVisitorContext>>>(job_count);
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(job_count);
+  for (auto job_id = size_t{0}; job_id < job_count; ++job_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, job_id]() {
+      auto& contexts = job_contexts[job_id];
+      contexts = _create_aggregate_contexts<AggregateKey>(0);
+
+      const auto end_chunk_id = std::min(static_cast<size_t>(chunk_count), (job_id + 1) * chunks_per_job);
+      for (auto chunk_id = ChunkID{static_cast<ChunkID::base_type>(job_id * chunks_per_job)}; chunk_id < end_chunk_id;
+           ++chunk_id) {
+        const auto chunk = input_table->get_chunk(chunk_id);
+        if (chunk) {
+          _aggregate_chunk<AggregateKey>(chunk_id, *chunk, keys_per_chunk, contexts);
         }
+      }
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
 
-        const auto abstract_segment = chunk_in->get_segment(input_column_id);
-        const auto data_type = input_table->column_data_type(input_column_id);
-
-        /*
-        Invoke correct aggregator for each segment
-        */
+  /**
+   * PHASE 2: Spill the groups of each job into radix partitions. We choose the number of partitions based on the
+   * (upper bound of the) number of groups, but use at least as many partitions as jobs to merge them in parallel.
+   */
+  auto spilled_group_count = size_t{0};
+  for (const auto& contexts : job_contexts) {
+    _visit_aggregate_context<AggregateKey>(contexts, group_context_id, [&](const auto& context) {
+      spilled_group_count += context.result_ids->size();
+    });
+  }
+  const auto partition_count = std::max(
+      std::bit_ceil(job_count), std::min(std::bit_ceil(spilled_group_count / PARALLEL_AGGREGATION_GROUPS_PER_PARTITION),
+                                         PARALLEL_AGGREGATION_MAX_PARTITION_COUNT));
+  const auto partition_mask = partition_count - 1;
+
+  // Fibonacci hashing, as std::hash is the identity for AggregateKeyEntry.
+  const auto partition_of = [&](const AggregateKey& key) {
+    return ((std::hash<AggregateKey>{}(key) * size_t{0x9E3779B97F4A7C15}) >> 32) & partition_mask;
+  };
 
-        resolve_data_type(data_type, [&, aggregate](auto type) {
-          using ColumnDataType = typename decltype(type)::type;
+  // spilled_groups[job_id][partition_id] holds the AggregateKeys of the partition's groups and the job's result ids.
+  auto spilled_groups = std::vector<std::vector<std::vector<std::pair<AggregateKey, AggregateResultId>>>>(
+      job_count, std::vector<std::vector<std::pair<AggregateKey, AggregateResultId>>>(partition_count));
+  jobs.clear();
+  for (auto job_id = size_t{0}; job_id < job_count; ++job_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, job_id]() {
+      _visit_aggregate_context<AggregateKey>(job_contexts[job_id], group_context_id, [&](const auto& context) {
+        for (const auto& [key, result_id] : *context.result_ids) {
+          spilled_groups[job_id][partition_of(key)].emplace_back(key, result_id);
+        }
+      });
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
 
-          switch (aggregate->window_function) {
-            case WindowFunction::Min:
-              _aggregate_segment<ColumnDataType, WindowFunction::Min, AggregateKey>(chunk_id, aggregate_idx,
-                                                                                    *abstract_segment, keys_per_chunk);
-              break;
-            case WindowFunction::Max:
-              _aggregate_segment<ColumnDataType, WindowFunction::Max, AggregateKey>(chunk_id, aggregate_idx,
-                                                                                    *abstract_segment, keys_per_chunk);
-              break;
-            case WindowFunction::Sum:
-              _aggregate_segment<ColumnDataType, WindowFunction::Sum, AggregateKey>(chunk_id, aggregate_idx,
-                                                                                    *abstract_segment, keys_per_chunk);
-              break;
-            case WindowFunction::Avg:
-              _aggregate_segment<ColumnDataType, WindowFunction::Avg, AggregateKey>(chunk_id, aggregate_idx,
-                                                                                    *abstract_segment, keys_per_chunk);
-              break;
-            case WindowFunction::Count:
-              _aggregate_segment<ColumnDataType, WindowFunction::Count, AggregateKey>(
-                  chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk);
-              break;
-            case WindowFunction::CountDistinct:
-              _aggregate_segment<ColumnDataType, WindowFunction::CountDistinct, AggregateKey>(
-                  chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk);
-              break;
-            case WindowFunction::StandardDeviationSample:
-              _aggregate_segment<ColumnDataType, WindowFunction::StandardDeviationSample, AggregateKey>(
-                  chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk);
-              break;
-            case WindowFunction::Any:
-              // ANY is a pseudo-function and is handled by `write_groupby_output`.
-              break;
-            case WindowFunction::CumeDist:
-            case WindowFunction::DenseRank:
-            case WindowFunction::PercentRank:
-            case WindowFunction::Rank:
-            case WindowFunction::RowNumber:
-              Fail("Unsupported aggregate function " + window_function_to_string.left.at(aggregate->window_function) +
-                   ".");
+  /**
+   * PHASE 3: Merge the partial results of each partition. A partition's groups are disjoint from all other partitions'
+   * groups, so each partition is merged into its own contexts.
+   */
+  auto partition_contexts = std::vector<std::vector<std::shared_ptr<SegmentVisitorContext>>>(partition_count);
+  jobs.clear();
+  for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, partition_id]() {
+      auto& contexts = partition_contexts[partition_id];
+      contexts = _create_aggregate_contexts<AggregateKey>(0);
+
+      auto group_count = size_t{0};
+      auto result_ids = std::vector<AggregateResultId>{};
+      for (auto job_id = size_t{0}; job_id < job_count; ++job_id) {
+        const auto& groups = spilled_groups[job_id][partition_id];
+        const auto spilled_count = groups.size();
+
+        // Map the job's groups to the partition's result ids.
+        result_ids.resize(spilled_count);
+        _visit_aggregate_context<AggregateKey>(contexts, group_context_id, [&](auto& context) {
+          auto& result_id_map = *context.result_ids;
+          for (auto group_idx = size_t{0}; group_idx < spilled_count; ++group_idx) {
+            const auto emplace_result = result_id_map.try_emplace(groups[group_idx].first, result_id_map.size());
+            result_ids[group_idx] = emplace_result.first->second;
           }
+          group_count = result_id_map.size();
         });
 
-        ++aggregate_idx;
+        for (const auto context_id : result_context_ids) {
+          _visit_aggregate_context<AggregateKey>(contexts, context_id, [&](auto& context) {
+            auto& job_context = static_cast<std::decay_t<decltype(context)>&>(*job_contexts[job_id][context_id]);
+            auto& results = context.results;
+            results.resize(group_count);
+            for (auto group_idx = size_t{0}; group_idx < spilled_count; ++group_idx) {
+              merge_aggregate_result(results[result_ids[group_idx]], job_context.results[groups[group_idx].second]);
+            }
+          });
+        }
       }
-    }
+    }));
   }
-  step_performance_data.set_step_runtime(OperatorSteps::Aggregating, timer.lap());
-}  // NOLINT(readability/fn_size)
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  /**
+   * PHASE 4: Concatenate the partitions' results. As all contexts of a partition hold the same groups in the same
+   * order, the results of the different aggregates remain aligned.
+   */
+  for (const auto context_id : result_context_ids) {
+    _visit_aggregate_context<AggregateKey>(_contexts_per_column, context_id, [&](auto& context) {
+      using Context = std::decay_t<decltype(context)>;
+      auto& results = context.results;
+      results.clear();
+      for (const auto& contexts : partition_contexts) {
+        auto& partition_results = static_cast<Context&>(*contexts[context_id]).results;
+        std::move(partition_results.begin(), partition_results.end(), std::back_inserter(results));
+      }
+    });
+  }
+}
+
+template <typename AggregateKey, typename Functor>
+void AggregateHash::_visit_aggregate_context(const std::vector<std::shared_ptr<SegmentVisitorContext>>& contexts,
+                                             const ColumnID aggregate_index, const Functor& functor) const {
+  if (!_has_aggregate_functions) {
+    // See the DISTINCT implementation in _aggregate_chunk().
+    functor(static_cast<AggregateContext<DistinctColumnType, WindowFunction::Min, AggregateKey>&>(
+        *contexts[aggregate_index]));
+    return;
+  }
+
+  const auto& aggregate = _aggregates[aggregate_index];
+  const auto input_column_id = static_cast<const PQPColumnExpression&>(*aggregate->argument()).column_id;
+  if (input_column_id == INVALID_COLUMN_ID) {
+    functor(static_cast<AggregateContext<CountColumnType, WindowFunction::Count, AggregateKey>&>(
+        *contexts[aggregate_index]));
+    return;
+  }
+
+  resolve_data_type(left_input_table()->column_data_type(input_column_id), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    auto& context = *contexts[aggregate_index];
+
+    switch (aggregate->window_function) {
+      case WindowFunction::Min:
+        functor(static_cast<AggregateContext<ColumnDataType, WindowFunction::Min, AggregateKey>&>(context));
+        break;
+      case WindowFunction::Max:
+        functor(static_cast<AggregateContext<ColumnDataType, WindowFunction::Max, AggregateKey>&>(context));
+        break;
+      case WindowFunction::Sum:
+        functor(static_cast<AggregateContext<ColumnDataType, WindowFunction::Sum, AggregateKey>&>(context));
+        break;
+      case WindowFunction::Avg:
+        functor(static_cast<AggregateContext<ColumnDataType, WindowFunction::Avg, AggregateKey>&>(context));
+        break;
+      case WindowFunction::Count:
+        functor(static_cast<AggregateContext<ColumnDataType, WindowFunction::Count, AggregateKey>&>(context));
+        break;
+      case WindowFunction::CountDistinct:
+        functor(static_cast<AggregateContext<ColumnDataType, WindowFunction::CountDistinct, AggregateKey>&>(context));
+        break;
+      case WindowFunction::StandardDeviationSample:
+        functor(static_cast<AggregateContext<ColumnDataType, WindowFunction::StandardDeviationSample, AggregateKey>&>(
+            context));
+        break;
+      case WindowFunction::Any:
+        // ANY is a pseudo-function without results (see write_groupby_output).
+        break;
+      case WindowFunction::CumeDist:
+      case WindowFunction::DenseRank:
+      case WindowFunction::PercentRank:
+      case WindowFunction::Rank:
+      case WindowFunction::RowNumber:
+        Fail("Unsupported aggregate function " + window_function_to_string.left.at(aggregate->window_function) + ".");
+    }
+  });
+}
 
 std::shared_ptr<const Table> AggregateHash::_on_execute() {
   // We do not want the overhead of a vector with heap storage when we have a limited number of aggregate columns.
@@ -1450,10 +1778,9 @@ void AggregateHash::_write_aggregate_output(ColumnID aggregate_index) {
 
 template <typename AggregateKey>
 std::shared_ptr<SegmentVisitorContext> AggregateHash::_create_aggregate_context(
-    const DataType data_type, const WindowFunction aggregate_function) const {
+    const DataType data_type, const WindowFunction aggregate_function, const size_t size) const {
   std::shared_ptr<SegmentVisitorContext> context;
   resolve_data_type(data_type, [&](auto type) {
-    const auto size = _expected_result_size.load();
     using ColumnDataType = typename decltype(type)::type;
     switch (aggregate_function) {
       case WindowFunction::Min:
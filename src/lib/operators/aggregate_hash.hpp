@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <functional>
 #include <limits>
 #include <memory>
@@ -24,6 +25,7 @@
 #include "aggregate/window_function_traits.hpp"
 #include "expression/window_function_expression.hpp"
 #include "resolve_type.hpp"
+#include "storage/chunk.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/value_segment.hpp"
 #include "types.hpp"
@@ -151,6 +153,15 @@ class AggregateHash : public AbstractAggregateOperator {
     OutputWriting
   };
 
+  // Inputs with at least this many rows are aggregated in parallel if a multi-threaded scheduler is used (see
+  // _aggregate_parallel()).
+  static constexpr auto PARALLEL_AGGREGATION_ROW_THRESHOLD = size_t{100'000};
+
+  // The parallel aggregation merges the partial results of its jobs in radix partitions. We aim for partitions whose
+  // hash maps and results fit into the L2 cache.
+  static constexpr auto PARALLEL_AGGREGATION_GROUPS_PER_PARTITION = size_t{16'384};
+  static constexpr auto PARALLEL_AGGREGATION_MAX_PARTITION_COUNT = size_t{1'024};
+
  protected:
   std::shared_ptr<const Table> _on_execute() override;
 
@@ -160,6 +171,23 @@ class AggregateHash : public AbstractAggregateOperator {
   template <typename AggregateKey>
   void _aggregate();
 
+  // Two-phase aggregation for large inputs: Each job aggregates a range of chunks into its own contexts. The groups of
+  // all jobs are then spilled into radix partitions (by the hash of their AggregateKey), which are merged in parallel
+  // and finally concatenated into _contexts_per_column. As every group belongs to exactly one partition, the merge
+  // does not require any synchronization.
+  template <typename AggregateKey>
+  void _aggregate_parallel(KeysPerChunk<AggregateKey>& keys_per_chunk);
+
+  template <typename AggregateKey>
+  void _aggregate_chunk(const ChunkID chunk_id, const Chunk& chunk, KeysPerChunk<AggregateKey>& keys_per_chunk,
+                        std::vector<std::shared_ptr<SegmentVisitorContext>>& contexts);
+
+  // Calls the functor with the typed AggregateContext of the given aggregate. The contexts of ANY pseudo-aggregates,
+  // which do not hold any results, are skipped.
+  template <typename AggregateKey, typename Functor>
+  void _visit_aggregate_context(const std::vector<std::shared_ptr<SegmentVisitorContext>>& contexts,
+                                const ColumnID aggregate_index, const Functor& functor) const;
+
   std::shared_ptr<AbstractOperator> _on_deep_copy(
       const std::shared_ptr<AbstractOperator>& copied_left_input,
       const std::shared_ptr<AbstractOperator>& copied_right_input,
@@ -176,11 +204,17 @@ class AggregateHash : public AbstractAggregateOperator {
 
   template <typename ColumnDataType, WindowFunction aggregate_function, typename AggregateKey>
   void _aggregate_segment(ChunkID chunk_id, ColumnID column_index, const AbstractSegment& abstract_segment,
-                          KeysPerChunk<AggregateKey>& keys_per_chunk);
+                          KeysPerChunk<AggregateKey>& keys_per_chunk,
+                          std::vector<std::shared_ptr<SegmentVisitorContext>>& contexts);
+
+  // Creates one context per aggregate (plus a dummy context for DISTINCT), each with `preallocated_size` results.
+  template <typename AggregateKey>
+  std::vector<std::shared_ptr<SegmentVisitorContext>> _create_aggregate_contexts(const size_t preallocated_size) const;
 
   template <typename AggregateKey>
   std::shared_ptr<SegmentVisitorContext> _create_aggregate_context(const DataType data_type,
-                                                                   const WindowFunction aggregate_function) const;
+                                                                   const WindowFunction aggregate_function,
+                                                                   const size_t size) const;
 
   // Data structure used to gather intermediate results of grouping and aggregation. This data structure stores both
   // the PosLists for group-by columns as well as the materialized aggregate results that are later returned as
@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <optional>
 #include <set>
@@ -17,10 +18,13 @@
 #include "expression/abstract_expression.hpp"
 #include "expression/pqp_column_expression.hpp"
 #include "expression/window_function_expression.hpp"
+#include "hyrise.hpp"
 #include "operators/abstract_aggregate_operator.hpp"
 #include "operators/abstract_operator.hpp"
 #include "operators/sort.hpp"
 #include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
 #include "storage/chunk.hpp"
 #include "storage/pos_lists/entire_chunk_pos_list.hpp"
 #include "storage/reference_segment.hpp"
@@ -53,6 +57,44 @@ std::shared_ptr<const Table> sort_table_by_column_ids(const std::shared_ptr<cons
   return sort->get_output();
 }
 
+// Calls job_function for each job ID. Multiple jobs are executed in parallel.
+void run_jobs(const size_t job_count, const std::function<void(size_t)>& job_function) {
+  if (job_count == 1) {
+    job_function(0);
+    return;
+  }
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(job_count);
+  for (auto job_id = size_t{0}; job_id < job_count; ++job_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, job_id]() {
+      job_function(job_id);
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+}
+
+// Returns the chunk unless it was physically deleted (see get_chunk / #1686) or is empty. If the input is already
+// sorted, it is aggregated as is and can contain such chunks, which hold no rows and are skipped.
+std::shared_ptr<const Chunk> get_non_empty_chunk(const std::shared_ptr<const Table>& table, const ChunkID chunk_id) {
+  const auto chunk = table->get_chunk(chunk_id);
+  if (!chunk || chunk->size() == 0) {
+    return nullptr;
+  }
+  return chunk;
+}
+
+// Returns the first row of a non-empty table.
+RowID first_row(const std::shared_ptr<const Table>& table) {
+  const auto chunk_count = table->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    if (get_non_empty_chunk(table, chunk_id)) {
+      return RowID{chunk_id, ChunkOffset{0}};
+    }
+  }
+  Fail("Table has no rows.");
+}
+
 }  // namespace
 
 namespace hyrise {
@@ -73,144 +115,193 @@ const std::string& AggregateSort::name() const {
  * The aggregate values (one per group-by-combination) are built incrementally.
  * Every time we reach the beginning of a new group-by-combination,
  * we store the aggregate value for the current (now previous) group.
+ * Each job aggregates a consecutive range of groups, the groups of all jobs are concatenated afterwards.
  *
  * @tparam ColumnType the type of the input column to aggregate on
  * @tparam AggregateType the type of the aggregate (=output column)
  * @tparam aggregate_function as type parameter - e.g. WindowFunction::MIN, AVG, COUNT, ...
  * @param group_boundaries the row ids where a new combination in the sorted table begins
+ * @param job_group_offsets the index of the first group of each job, followed by the number of groups
  * @param aggregate_index determines which aggregate to calculate (from _aggregates)
  * @param aggregate_function the aggregate function - as callable object. This should always be the same as aggregate_function
  * @param sorted_table the input table, sorted by the group by columns
  */
 template <typename ColumnType, typename AggregateType, WindowFunction aggregate_function>
-void AggregateSort::_aggregate_values(const std::set<RowID>& group_boundaries, const uint64_t aggregate_index,
+void AggregateSort::_aggregate_values(const std::vector<RowID>& group_boundaries,
+                                      const std::vector<size_t>& job_group_offsets, const uint64_t aggregate_index,
                                       const std::shared_ptr<const Table>& sorted_table) {
   const auto& pqp_column = static_cast<const PQPColumnExpression&>(*_aggregates[aggregate_index]->argument());
   const auto input_column_id = pqp_column.column_id;
 
-  auto aggregator = WindowFunctionBuilder<ColumnType, AggregateType, aggregate_function>().get_aggregate_function();
-
   // We already know beforehand how many aggregate values (=group-by-combinations) we have to calculate
   const auto num_groups = group_boundaries.size() + 1;
+  const auto chunk_count = sorted_table->chunk_count();
+  const auto table_begin = first_row(sorted_table);
 
-  // Vectors to store aggregate values (and if they are NULL) for later usage in value segments
-  auto aggregate_results = pmr_vector<AggregateType>(num_groups);
-  auto aggregate_null_values = pmr_vector<bool>(num_groups);
+  // Returns the first row of the given group. For num_groups, the (exclusive) end of the table is returned.
+  const auto group_begin = [&](const size_t group_index) {
+    if (group_index == 0) {
+      return table_begin;
+    }
+    if (group_index == num_groups) {
+      return RowID{chunk_count, ChunkOffset{0}};
+    }
+    return group_boundaries[group_index - 1];
+  };
 
-  // Variables needed for the aggregates. Not all variables are needed for all aggregates
+  // Vectors to store aggregate values (and if they are NULL) for later usage in value segments. Each job writes to its
+  // own vectors, as concurrent writes to a pmr_vector<bool> are not safe.
+  const auto job_count = job_group_offsets.size() - 1;
+  auto job_aggregate_results = std::vector<pmr_vector<AggregateType>>(job_count);
+  auto job_aggregate_null_values = std::vector<pmr_vector<bool>>(job_count);
+
+  const auto aggregate_groups = [&](const size_t job_id) {
+    const auto begin_group_index = job_group_offsets[job_id];
+    const auto end_group_index = job_group_offsets[job_id + 1];
+    if (begin_group_index == end_group_index) {
+      // All groups in the job's chunk range begin in a previous range and are aggregated by a previous job.
+      return;
+    }
 
-  // Row counts per group, ex- and including null values. Needed for count (<column>/*) and average
-  auto value_count = uint64_t{0};
-  auto value_count_with_null = uint64_t{0};
+    auto& aggregate_results = job_aggregate_results[job_id];
+    auto& aggregate_null_values = job_aggregate_null_values[job_id];
+    aggregate_results.resize(end_group_index - begin_group_index);
+    aggregate_null_values.resize(end_group_index - begin_group_index);
 
-  // All unique values found. Needed for count distinct
-  auto unique_values = std::unordered_set<ColumnType>{};
+    auto aggregator = WindowFunctionBuilder<ColumnType, AggregateType, aggregate_function>().get_aggregate_function();
 
-  // The number of the current group-by-combination. Used as offset when storing values
-  auto aggregate_group_index = uint64_t{0};
+    // Variables needed for the aggregates. Not all variables are needed for all aggregates
 
-  const auto chunk_count = sorted_table->chunk_count();
+    // Row counts per group, ex- and including null values. Needed for count (<column>/*) and average
+    auto value_count = uint64_t{0};
+    auto value_count_with_null = uint64_t{0};
 
-  auto accumulator = AggregateAccumulator<aggregate_function, AggregateType>{};
-  auto current_chunk_id = ChunkID{0};
-  if (aggregate_function == WindowFunction::Count && input_column_id == INVALID_COLUMN_ID) {
-    /*
-     * Special COUNT(*) implementation.
-     * We do not need to care about null values for COUNT(*).
-     * Because of this, we can simply calculate the number of elements per group (=COUNT(*))
-     * by calculating the distance between the first and the last corresponding row (+1) in the table.
-     * This results in a runtime of O(output rows) rather than O(input rows), which can be quite significant.
-     */
-    auto current_group_begin_pointer = RowID{ChunkID{0u}, ChunkOffset{0}};
-    for (const auto& group_boundary : group_boundaries) {
-      if (current_group_begin_pointer.chunk_id == group_boundary.chunk_id) {
-        // Group is located within a single chunk
-        value_count_with_null = group_boundary.chunk_offset - current_group_begin_pointer.chunk_offset;
-      } else {
-        // Group is spread over multiple chunks
-        auto count = uint64_t{0};
-        count += sorted_table->get_chunk(current_group_begin_pointer.chunk_id)->size() -
-                 current_group_begin_pointer.chunk_offset;
-        for (auto chunk_id = ChunkID{current_group_begin_pointer.chunk_id + 1}; chunk_id < group_boundary.chunk_id;
-             chunk_id++) {
-          count += sorted_table->get_chunk(chunk_id)->size();
+    // All unique values found. Needed for count distinct
+    auto unique_values = std::unordered_set<ColumnType>{};
+
+    // The number of the current group-by-combination (relative to the job's first group). Used as offset when storing
+    // values
+    auto aggregate_group_index = uint64_t{0};
+
+    auto accumulator = AggregateAccumulator<aggregate_function, AggregateType>{};
+    if (aggregate_function == WindowFunction::Count && input_column_id == INVALID_COLUMN_ID) {
+      /*
+       * Special COUNT(*) implementation.
+       * We do not need to care about null values for COUNT(*).
+       * Because of this, we can simply calculate the number of elements per group (=COUNT(*))
+       * by calculating the distance between the first row of the group and the first row of the next group.
+       * This results in a runtime of O(output rows) rather than O(input rows), which can be quite significant.
+       */
+      for (auto group_index = begin_group_index; group_index < end_group_index; ++group_index) {
+        const auto current_group_begin = group_begin(group_index);
+        const auto next_group_begin = group_begin(group_index + 1);
+        if (current_group_begin.chunk_id == next_group_begin.chunk_id) {
+          // Group is located within a single chunk
+          value_count_with_null = next_group_begin.chunk_offset - current_group_begin.chunk_offset;
+        } else {
+          // Group is spread over multiple chunks
+          value_count_with_null =
+              sorted_table->get_chunk(current_group_begin.chunk_id)->size() - current_group_begin.chunk_offset;
+          for (auto chunk_id = ChunkID{current_group_begin.chunk_id + 1}; chunk_id < next_group_begin.chunk_id;
+               ++chunk_id) {
+            if (const auto chunk = sorted_table->get_chunk(chunk_id)) {
+              value_count_with_null += chunk->size();
+            }
+          }
+          value_count_with_null += next_group_begin.chunk_offset;
         }
-        count += group_boundary.chunk_offset + 1;
-        value_count_with_null = count;
-      }
-      _set_and_write_aggregate_value<AggregateType, aggregate_function>(
-          aggregate_results, aggregate_null_values, aggregate_group_index, aggregate_index, accumulator, value_count,
-          value_count_with_null, unique_values.size());
-      current_group_begin_pointer = group_boundary;
-      aggregate_group_index++;
-    }
-    // Compute value count with null values for the last iteration
-    value_count_with_null = sorted_table->get_chunk(current_group_begin_pointer.chunk_id)->size() -
-                            current_group_begin_pointer.chunk_offset;
-    for (auto chunk_id = ChunkID{current_group_begin_pointer.chunk_id + 1}; chunk_id < chunk_count; ++chunk_id) {
-      value_count_with_null += sorted_table->get_chunk(chunk_id)->size();
-    }
 
-  } else {
-    /*
-     * High-level overview of the algorithm:
-     *
-     * We already know at which RowIDs a new group (=group-by-combination) begins,
-     * it is stored in group_boundaries.
-     * The base idea is:
-     *
-     * Iterate over every value in the aggregate column, and keep track of the current RowID
-     *   if (current row id == start of next group)
-     *     write aggregate value of the just finished group
-     *     reset helper variables
-     *
-     *   update helper variables
-     *
-     */
-    auto group_boundary_iter = group_boundaries.cbegin();
-    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
-      auto segment = sorted_table->get_chunk(chunk_id)->get_segment(input_column_id);
-      segment_iterate<ColumnType>(*segment, [&](const auto& position) {
-        const auto row_id = RowID{current_chunk_id, position.chunk_offset()};
-        const auto is_new_group = group_boundary_iter != group_boundaries.cend() && row_id == *group_boundary_iter;
-        const auto& new_value = position.value();
-        if (is_new_group) {
-          // New group is starting. Store the aggregate value of the just finished group
+        if (group_index + 1 < end_group_index) {
           _set_and_write_aggregate_value<AggregateType, aggregate_function>(
               aggregate_results, aggregate_null_values, aggregate_group_index, aggregate_index, accumulator,
               value_count, value_count_with_null, unique_values.size());
-
-          // Reset helper variables
-          accumulator = {};
-          unique_values.clear();
-          value_count = 0;
-          value_count_with_null = 0;
-
-          // Update indexing variables
           ++aggregate_group_index;
-          ++group_boundary_iter;
+        }
+      }
+    } else {
+      /*
+       * High-level overview of the algorithm:
+       *
+       * We already know at which RowIDs a new group (=group-by-combination) begins,
+       * it is stored in group_boundaries.
+       * The base idea is:
+       *
+       * Iterate over every value of the job's groups in the aggregate column, and keep track of the current RowID
+       *   if (current row id == start of next group)
+       *     write aggregate value of the just finished group
+       *     reset helper variables
+       *
+       *   update helper variables
+       *
+       * The job's last group might continue in the chunk range of the next job(s). We continue iterating until it ends.
+       */
+      const auto range_begin = group_begin(begin_group_index);
+      const auto range_end = group_begin(end_group_index);
+      auto next_group_begin = group_begin(begin_group_index + 1);
+      for (auto chunk_id = range_begin.chunk_id; RowID{chunk_id, ChunkOffset{0}} < range_end; ++chunk_id) {
+        const auto chunk = get_non_empty_chunk(sorted_table, chunk_id);
+        if (!chunk) {
+          continue;
         }
 
-        // Update helper variables
-        if (!position.is_null()) {
-          aggregator(new_value, value_count, accumulator);
-          ++value_count;
-          if constexpr (aggregate_function == WindowFunction::CountDistinct) {
-            unique_values.insert(new_value);
-          } else if constexpr (aggregate_function == WindowFunction::Any) {
-            // Gathering the group's first value for ANY() is sufficient
+        const auto& segment = chunk->get_segment(input_column_id);
+        segment_iterate<ColumnType>(*segment, [&](const auto& position) {
+          const auto row_id = RowID{chunk_id, position.chunk_offset()};
+          if (row_id < range_begin || !(row_id < range_end)) {
             return;
           }
-        }
-        ++value_count_with_null;
-      });
-      ++current_chunk_id;
+
+          const auto& new_value = position.value();
+          if (row_id == next_group_begin) {
+            // New group is starting. Store the aggregate value of the just finished group
+            _set_and_write_aggregate_value<AggregateType, aggregate_function>(
+                aggregate_results, aggregate_null_values, aggregate_group_index, aggregate_index, accumulator,
+                value_count, value_count_with_null, unique_values.size());
+
+            // Reset helper variables
+            accumulator = {};
+            unique_values.clear();
+            value_count = 0;
+            value_count_with_null = 0;
+
+            // Update indexing variables
+            ++aggregate_group_index;
+            next_group_begin = group_begin(begin_group_index + aggregate_group_index + 1);
+          }
+
+          // Update helper variables
+          if (!position.is_null()) {
+            aggregator(new_value, value_count, accumulator);
+            ++value_count;
+            if constexpr (aggregate_function == WindowFunction::CountDistinct) {
+              unique_values.insert(new_value);
+            } else if constexpr (aggregate_function == WindowFunction::Any) {
+              // Gathering the group's first value for ANY() is sufficient
+              return;
+            }
+          }
+          ++value_count_with_null;
+        });
+      }
     }
+    // Aggregate value for the last group was not written yet
+    _set_and_write_aggregate_value<AggregateType, aggregate_function>(
+        aggregate_results, aggregate_null_values, aggregate_group_index, aggregate_index, accumulator, value_count,
+        value_count_with_null, unique_values.size());
+  };
+
+  run_jobs(job_count, aggregate_groups);
+
+  auto aggregate_results = std::move(job_aggregate_results[0]);
+  auto aggregate_null_values = std::move(job_aggregate_null_values[0]);
+  aggregate_results.reserve(num_groups);
+  aggregate_null_values.reserve(num_groups);
+  for (auto job_id = size_t{1}; job_id < job_count; ++job_id) {
+    aggregate_results.insert(aggregate_results.end(), job_aggregate_results[job_id].begin(),
+                             job_aggregate_results[job_id].end());
+    aggregate_null_values.insert(aggregate_null_values.end(), job_aggregate_null_values[job_id].begin(),
+                                 job_aggregate_null_values[job_id].end());
   }
-  // Aggregate value for the last group was not written yet
-  _set_and_write_aggregate_value<AggregateType, aggregate_function>(
-      aggregate_results, aggregate_null_values, aggregate_group_index, aggregate_index, accumulator, value_count,
-      value_count_with_null, unique_values.size());
 
   // Store the aggregate values in a value segment
   if (_output_column_definitions.at(aggregate_index + _groupby_column_ids.size()).nullable) {
@@ -320,6 +411,73 @@ Segments AggregateSort::_get_segments_of_chunk(const std::shared_ptr<const Table
   return segments;
 }
 
+bool AggregateSort::_is_sorted_across_chunks(const std::shared_ptr<const Table>& input_table,
+                                             const ColumnID column_id) {
+  const auto chunk_count = input_table->chunk_count();
+  auto sort_mode = std::optional<SortMode>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = get_non_empty_chunk(input_table, chunk_id);
+    if (!chunk) {
+      continue;
+    }
+
+    const auto& chunk_sorted_by = chunk->individually_sorted_by();
+    const auto sort_definition =
+        std::find_if(chunk_sorted_by.cbegin(), chunk_sorted_by.cend(), [&](const auto& chunk_sort_definition) {
+          return chunk_sort_definition.column == column_id;
+        });
+    if (sort_definition == chunk_sorted_by.cend() || (sort_mode && sort_definition->sort_mode != *sort_mode)) {
+      return false;
+    }
+    sort_mode = sort_definition->sort_mode;
+  }
+
+  if (!sort_mode) {
+    return false;
+  }
+
+  // The chunks are sorted in the same direction. The table is sorted if the last value of each non-empty chunk does
+  // not exceed the first value of the next non-empty chunk (with regard to the sort mode). Sorted chunks store their
+  // NULL values at the beginning or the end. If a NULL value were located at the border between two chunks, the NULL
+  // values might not be consecutive.
+  auto is_sorted = true;
+  resolve_data_type(input_table->column_data_type(column_id), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    auto previous_chunk = std::shared_ptr<const Chunk>{};
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto next_chunk = get_non_empty_chunk(input_table, chunk_id);
+      if (!next_chunk) {
+        continue;
+      }
+
+      if (!previous_chunk) {
+        previous_chunk = next_chunk;
+        continue;
+      }
+
+      const auto previous_value =
+          (*previous_chunk->get_segment(column_id))[ChunkOffset{previous_chunk->size() - 1}];
+      const auto next_value = (*next_chunk->get_segment(column_id))[ChunkOffset{0}];
+      previous_chunk = next_chunk;
+      if (variant_is_null(previous_value) || variant_is_null(next_value)) {
+        is_sorted = false;
+        return;
+      }
+
+      const auto& previous = boost::get<ColumnDataType>(previous_value);
+      const auto& next = boost::get<ColumnDataType>(next_value);
+      if ((*sort_mode == SortMode::Ascending && next < previous) ||
+          (*sort_mode == SortMode::Descending && previous < next)) {
+        is_sorted = false;
+        return;
+      }
+    }
+  });
+
+  return is_sorted;
+}
+
 std::shared_ptr<Table> AggregateSort::_sort_table_chunk_wise(const std::shared_ptr<const Table>& input_table,
                                                              const std::vector<ColumnID>& groupby_column_ids) {
   auto output_table = std::make_shared<Table>(input_table->column_definitions(), TableType::References);
@@ -396,13 +554,14 @@ std::shared_ptr<Table> AggregateSort::_sort_table_chunk_wise(const std::shared_p
  *    - Thus, we can find all group boundaries (specifically their first element) by iterating over the group by
  *      columns and storing RowIDs of rows where the value of any group by column changes.
  *    - The result is a (sorted) vector of RowIDs, its entries marking the beginning of a new group-by-combination.
+ *    - Large inputs are split into chunk ranges, which are searched for group boundaries in parallel.
  * 5. Write the values of group by columns for each group into a ValueSegment.
  *    - For each group by column, iterate over the group boundaries (RowIDs) and output the value.
  *    - Note: This cannot be merged with the first iteration (finding group boundaries). This is because we have to
  *            output values for all RowIDs where ANY group by column changes, not only the one we currently iterate
  *            over.
  * 6. Call _aggregate_values for each aggregate, which performs the aggregation and writes the output into
- *    ValueSegments.
+ *    ValueSegments. The groups that begin in the chunk ranges of step 4 are aggregated in parallel.
  */
 std::shared_ptr<const Table> AggregateSort::_on_execute() {
   const auto input_table = left_input_table();
@@ -470,8 +629,14 @@ std::shared_ptr<const Table> AggregateSort::_on_execute() {
     return result_table;
   }
 
+  // If we group by a single column and the whole table is already sorted by it, all rows of a group are consecutive
+  // and neither the table nor its chunks need to be sorted. This is the case, e.g., for a GROUP BY on the sort key of
+  // a sorted table.
+  const auto input_is_sorted =
+      _groupby_column_ids.size() == 1 && _is_sorted_across_chunks(input_table, _groupby_column_ids.front());
+
   auto sorted_table = input_table;
-  if (!_groupby_column_ids.empty()) {
+  if (!_groupby_column_ids.empty() && !input_is_sorted) {
     /**
     * If there is a value clustering for a column, it means that all tuples with the same value in that column are in
     * the same chunk. Therefore, if one of the value clustering columns is part of the group by vector, we can skip
@@ -504,10 +669,24 @@ std::shared_ptr<const Table> AggregateSort::_on_execute() {
 
   _output_segments.resize(_aggregates.size() + _groupby_column_ids.size());
 
+  /*
+   * Large inputs are split into chunk ranges, which are processed by separate jobs. Each job first finds the group
+   * boundaries within its range and later aggregates the groups that begin in its range.
+   */
+  const auto chunk_count = sorted_table->chunk_count();
+  auto chunks_per_job = static_cast<size_t>(chunk_count);
+  if (Hyrise::get().is_multi_threaded() && chunk_count > 1 &&
+      sorted_table->row_count() >= PARALLEL_AGGREGATION_ROW_THRESHOLD) {
+    const auto max_job_count = std::max(Hyrise::get().topology.num_cpus(), size_t{1});
+    chunks_per_job = (static_cast<size_t>(chunk_count) + max_job_count - 1) / max_job_count;
+  }
+  const auto job_count = (static_cast<size_t>(chunk_count) + chunks_per_job - 1) / chunks_per_job;
+
   /*
    * Find all RowIDs where a value in any group by column changes compared to the previous row,
    * as those are exactly the boundaries of the different groups.
-   * Everytime a value changes in any of the group by columns, we add the current position to the set.
+   * Everytime a value changes in any of the group by columns, we add the current position to the set of the job that
+   * handles the chunk. As the chunk ranges of the jobs are ordered, the sets are concatenated afterwards.
    * We are aware that std::set is known to be not the most efficient,
    * but our profiling revealed that the current implementation is not a bottleneck.
    * Currently, the vast majority of execution time is spent with sorting.
@@ -530,46 +709,74 @@ std::shared_ptr<const Table> AggregateSort::_on_execute() {
    *               This is because no new group starts after it.
    *               So in total, group_boundaries will contain one element less than there are groups.
    */
-  auto group_boundaries = std::set<RowID>{};
-  const auto chunk_count = sorted_table->chunk_count();
-  for (const auto& column_id : _groupby_column_ids) {
-    auto data_type = input_table->column_data_type(column_id);
-    resolve_data_type(data_type, [&](auto type) {
-      using ColumnDataType = typename decltype(type)::type;
-      auto previous_value = std::optional<ColumnDataType>{};
+  auto job_group_boundaries = std::vector<std::set<RowID>>(job_count);
+  run_jobs(job_count, [&](const size_t job_id) {
+    const auto begin_chunk_id = ChunkID{static_cast<ChunkID::base_type>(job_id * chunks_per_job)};
+    const auto end_chunk_id = std::min(static_cast<size_t>(chunk_count), (job_id + 1) * chunks_per_job);
+    auto& group_boundaries = job_group_boundaries[job_id];
+
+    for (const auto& column_id : _groupby_column_ids) {
+      auto data_type = input_table->column_data_type(column_id);
+      resolve_data_type(data_type, [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+        auto previous_value = std::optional<ColumnDataType>{};
 
-      /*
-       * Initialize previous_value to the first value in the table, so we avoid considering it a value change.
-       * We do not want to consider it as a value change, because we the first row should not be part of the boundaries.
-       * For the reasoning behind it see above.
-       * We are aware that operator[] is slow, however, for one value it should be faster than segment_iterate_filtered.
-       */
-      const auto& first_segment = sorted_table->get_chunk(ChunkID{0})->get_segment(column_id);
-      const auto& first_value = (*first_segment)[ChunkOffset{0}];
-      if (variant_is_null(first_value)) {
-        previous_value.reset();
-      } else {
-        previous_value = boost::get<ColumnDataType>(first_value);
-      }
+        /*
+         * Initialize previous_value to the row preceding the job's first row, i.e., the last row of the closest
+         * preceding non-empty chunk. If there is no such row (e.g., for the first job), this is the first value in the
+         * table, so we avoid considering it a value change.
+         * We do not want to consider it as a value change, because we the first row should not be part of the
+         * boundaries. For the reasoning behind it see above.
+         * We are aware that operator[] is slow, however, for one value it should be faster than
+         * segment_iterate_filtered.
+         */
+        auto first_value = std::optional<AllTypeVariant>{};
+        for (auto chunk_id = begin_chunk_id; chunk_id > 0 && !first_value; --chunk_id) {
+          if (const auto previous_chunk = get_non_empty_chunk(sorted_table, ChunkID{chunk_id - 1})) {
+            first_value = (*previous_chunk->get_segment(column_id))[ChunkOffset{previous_chunk->size() - 1}];
+          }
+        }
+        if (!first_value) {
+          const auto table_begin = first_row(sorted_table);
+          first_value = (*sorted_table->get_chunk(table_begin.chunk_id)->get_segment(column_id))[ChunkOffset{0}];
+        }
+        if (variant_is_null(*first_value)) {
+          previous_value.reset();
+        } else {
+          previous_value = boost::get<ColumnDataType>(*first_value);
+        }
 
-      // Iterate over all chunks and insert RowIDs when values change
-      for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
-        const auto chunk = sorted_table->get_chunk(chunk_id);
-        Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
-        const auto& segment = chunk->get_segment(column_id);
-        segment_iterate<ColumnDataType>(*segment, [&](const auto& position) {
-          if (previous_value.has_value() == position.is_null() ||
-              (previous_value && !position.is_null() && position.value() != *previous_value)) {
-            group_boundaries.insert(RowID{chunk_id, position.chunk_offset()});
-            if (position.is_null()) {
-              previous_value.reset();
-            } else {
-              previous_value.emplace(position.value());
-            }
+        // Iterate over all chunks and insert RowIDs when values change
+        for (auto chunk_id = begin_chunk_id; chunk_id < end_chunk_id; ++chunk_id) {
+          const auto chunk = get_non_empty_chunk(sorted_table, chunk_id);
+          if (!chunk) {
+            continue;
           }
-        });
-      }
-    });
+
+          const auto& segment = chunk->get_segment(column_id);
+          segment_iterate<ColumnDataType>(*segment, [&](const auto& position) {
+            if (previous_value.has_value() == position.is_null() ||
+                (previous_value && !position.is_null() && position.value() != *previous_value)) {
+              group_boundaries.insert(RowID{chunk_id, position.chunk_offset()});
+              if (position.is_null()) {
+                previous_value.reset();
+              } else {
+                previous_value.emplace(position.value());
+              }
+            }
+          });
+        }
+      });
+    }
+  });
+
+  // The groups of a job are those that begin in its chunk range. The first group, which begins in the first row, is
+  // not represented in the group boundaries (see above).
+  auto group_boundaries = std::vector<RowID>{};
+  auto job_group_offsets = std::vector<size_t>{0};
+  for (const auto& boundaries : job_group_boundaries) {
+    group_boundaries.insert(group_boundaries.end(), boundaries.begin(), boundaries.end());
+    job_group_offsets.emplace_back(group_boundaries.size() + 1);
   }
 
   /*
@@ -592,7 +799,7 @@ std::shared_ptr<const Table> AggregateSort::_on_execute() {
         RowID group_start;
         if (value_index == 0) {
           // First group starts in the first row, but there is no corresponding entry in the set. See above for reasons.
-          group_start = RowID{ChunkID{0}, ChunkOffset{0}};
+          group_start = first_row(sorted_table);
         } else {
           group_start = *group_boundary_iter;
           group_boundary_iter++;
@@ -664,33 +871,33 @@ std::shared_ptr<const Table> AggregateSort::_on_execute() {
       switch (aggregate->window_function) {
         case WindowFunction::Min: {
           using AggregateType = typename WindowFunctionTraits<ColumnDataType, WindowFunction::Min>::ReturnType;
-          _aggregate_values<ColumnDataType, AggregateType, WindowFunction::Min>(group_boundaries, aggregate_index,
-                                                                                sorted_table);
+          _aggregate_values<ColumnDataType, AggregateType, WindowFunction::Min>(group_boundaries, job_group_offsets,
+                                                                                aggregate_index, sorted_table);
           break;
         }
         case WindowFunction::Max: {
           using AggregateType = typename WindowFunctionTraits<ColumnDataType, WindowFunction::Max>::ReturnType;
-          _aggregate_values<ColumnDataType, AggregateType, WindowFunction::Max>(group_boundaries, aggregate_index,
-                                                                                sorted_table);
+          _aggregate_values<ColumnDataType, AggregateType, WindowFunction::Max>(group_boundaries, job_group_offsets,
+                                                                                aggregate_index, sorted_table);
           break;
         }
         case WindowFunction::Sum: {
           using AggregateType = typename WindowFunctionTraits<ColumnDataType, WindowFunction::Sum>::ReturnType;
-          _aggregate_values<ColumnDataType, AggregateType, WindowFunction::Sum>(group_boundaries, aggregate_index,
-                                                                                sorted_table);
+          _aggregate_values<ColumnDataType, AggregateType, WindowFunction::Sum>(group_boundaries, job_group_offsets,
+                                                                                aggregate_index, sorted_table);
           break;
         }
 
         case WindowFunction::Avg: {
           using AggregateType = typename WindowFunctionTraits<ColumnDataType, WindowFunction::Avg>::ReturnType;
-          _aggregate_values<ColumnDataType, AggregateType, WindowFunction::Avg>(group_boundaries, aggregate_index,
-                                                                                sorted_table);
+          _aggregate_values<ColumnDataType, AggregateType, WindowFunction::Avg>(group_boundaries, job_group_offsets,
+                                                                                aggregate_index, sorted_table);
           break;
         }
         case WindowFunction::Count: {
           using AggregateType = typename WindowFunctionTraits<ColumnDataType, WindowFunction::Count>::ReturnType;
-          _aggregate_values<ColumnDataType, AggregateType, WindowFunction::Count>(group_boundaries, aggregate_index,
-                                                                                  sorted_table);
+          _aggregate_values<ColumnDataType, AggregateType, WindowFunction::Count>(group_boundaries, job_group_offsets,
+                                                                                  aggregate_index, sorted_table);
           break;
         }
         case WindowFunction::CountDistinct: {
@@ -698,14 +905,14 @@ std::shared_ptr<const Table> AggregateSort::_on_execute() {
               ColumnDataType,
               WindowFunction::CountDistinct>::ReturnType;  // NOLINT(whitespace/line_length)
           _aggregate_values<ColumnDataType, AggregateType, WindowFunction::CountDistinct>(
-              group_boundaries, aggregate_index, sorted_table);
+              group_boundaries, job_group_offsets, aggregate_index, sorted_table);
           break;
         }
         case WindowFunction::StandardDeviationSample: {
           using AggregateType =
               typename WindowFunctionTraits<ColumnDataType, WindowFunction::StandardDeviationSample>::ReturnType;
           _aggregate_values<ColumnDataType, AggregateType, WindowFunction::StandardDeviationSample>(
-              group_boundaries, aggregate_index, sorted_table);
+              group_boundaries, job_group_offsets, aggregate_index, sorted_table);
           break;
         }
         case WindowFunction::Any: {
@@ -1,10 +1,10 @@
 #pragma once
 
+#include <cstddef>
 #include <functional>
 #include <limits>
 #include <memory>
 #include <optional>
-#include <set>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -43,8 +43,9 @@ namespace hyrise {
  * While most of this page refers to the hash-based aggregate, it also explains common features like aggregate traits.
  *
  * Some notes regarding future optimization:
- * Currently, we always sort the input table by the group by columns.
- * In some cases this might be unnecessary, as the table could already be sorted.
+ * Currently, we sort the input table by the group by columns unless we group by a single column and the chunks are
+ * sorted by it in a way that the whole table is sorted (see _is_sorted_across_chunks()).
+ * In other cases this might be unnecessary as well, as the table could already be sorted.
  * There is an issue that discusses how such information as sortedness should be propagated:
  *  https://github.com/hyrise/hyrise/issues/1519
  * As soon as this issue is decided, the sort aggregate operator should be adapted to benefit from sortedness.
@@ -67,6 +68,10 @@ class AggregateSort : public AbstractAggregateOperator {
 
   const std::string& name() const override;
 
+  // Inputs with at least this many rows are split into chunk ranges that are processed in parallel if a multi-threaded
+  // scheduler is used. Groups that straddle the end of a range are completed by the job in whose range they begin.
+  static constexpr auto PARALLEL_AGGREGATION_ROW_THRESHOLD = size_t{100'000};
+
   /**
    * Creates the aggregate column definitions and appends it to `_output_column_definitions`
    * We need the input column data type because the aggregate type can depend on it.
@@ -99,8 +104,8 @@ class AggregateSort : public AbstractAggregateOperator {
   using AggregateFunctor = std::function<void(const ColumnType&, std::optional<AggregateType>&)>;
 
   template <typename ColumnType, typename AggregateType, WindowFunction aggregate_function>
-  void _aggregate_values(const std::set<RowID>& group_boundaries, const uint64_t aggregate_index,
-                         const std::shared_ptr<const Table>& sorted_table);
+  void _aggregate_values(const std::vector<RowID>& group_boundaries, const std::vector<size_t>& job_group_offsets,
+                         const uint64_t aggregate_index, const std::shared_ptr<const Table>& sorted_table);
 
   template <typename ColumnType>
   void _create_aggregate_column_definitions(boost::hana::basic_type<ColumnType> /*type*/, ColumnID column_index,
@@ -126,6 +131,13 @@ class AggregateSort : public AbstractAggregateOperator {
   static std::shared_ptr<Table> _sort_table_chunk_wise(const std::shared_ptr<const Table>& input_table,
                                                        const std::vector<ColumnID>& groupby_column_ids);
 
+  /**
+   * Returns true if all chunks are individually sorted by the given column in the same sort mode and the values of
+   * consecutive chunks do not overlap. In this case, the whole table is sorted by the column and does not need to be
+   * sorted again.
+   */
+  static bool _is_sorted_across_chunks(const std::shared_ptr<const Table>& input_table, const ColumnID column_id);
+
   static Segments _get_segments_of_chunk(const std::shared_ptr<const Table>& input_table, ChunkID chunk_id);
 };
 
@@ -1,11 +1,14 @@
 #include "delete.hpp"
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
 
 #include "all_type_variant.hpp"
+#include "concurrency/log_entry.hpp"
 #include "concurrency/transaction_context.hpp"
+#include "hyrise.hpp"
 #include "operators/abstract_operator.hpp"
 #include "operators/validate.hpp"
 #include "statistics/table_statistics.hpp"
@@ -151,6 +154,37 @@ void Delete::_on_commit_records(const CommitID commit_id) {
   }
 }
 
+void Delete::_on_write_log_records(LogEntryWriter& log_entry) const {
+  // The Delete only knows the referenced table, not its name. We look the name up in the StorageManager whenever the
+  // referenced table changes. Usually, all chunks reference the same table.
+  const auto tables = Hyrise::get().storage_manager.tables();
+  auto referenced_table = std::shared_ptr<const Table>{};
+  auto referenced_table_name = std::optional<std::string>{};
+
+  const auto chunk_count = _referencing_table->chunk_count();
+  for (auto referencing_chunk_id = ChunkID{0}; referencing_chunk_id < chunk_count; ++referencing_chunk_id) {
+    const auto& referencing_chunk = _referencing_table->get_chunk(referencing_chunk_id);
+    const auto& referencing_segment =
+        static_cast<const ReferenceSegment&>(*referencing_chunk->get_segment(ColumnID{0}));
+
+    if (referencing_segment.referenced_table() != referenced_table) {
+      referenced_table = referencing_segment.referenced_table();
+      referenced_table_name = std::nullopt;
+      for (const auto& [table_name, table] : tables) {
+        if (table == referenced_table) {
+          referenced_table_name = table_name;
+          break;
+        }
+      }
+    }
+
+    // Tables that are not managed by the StorageManager are not recovered. Thus, deletes from them are not logged.
+    if (referenced_table_name) {
+      log_entry.add_delete(*referenced_table_name, *referencing_segment.pos_list());
+    }
+  }
+}
+
 void Delete::_on_rollback_records() {
   const auto chunk_count = _referencing_table->chunk_count();
   for (auto referencing_chunk_id = ChunkID{0}; referencing_chunk_id < chunk_count; ++referencing_chunk_id) {
@@ -29,6 +29,7 @@ class Delete : public AbstractReadWriteOperator {
       std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& /*copied_ops*/) const override;
   void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
   void _on_commit_records(const CommitID commit_id) override;
+  void _on_write_log_records(LogEntryWriter& log_entry) const override;
   void _on_rollback_records() override;
 
  private:
@@ -23,6 +23,7 @@
 #include "logical_query_plan/predicate_node.hpp"
 #include "logical_query_plan/stored_table_node.hpp"
 #include "operators/abstract_operator.hpp"
+#include "operators/join_hash/join_runtime_filter.hpp"
 #include "operators/pqp_utils.hpp"
 #include "operators/table_scan.hpp"
 #include "storage/chunk.hpp"
@@ -121,13 +122,36 @@ std::vector<std::shared_ptr<const AbstractOperator>> GetTable::prunable_subquery
   return subquery_scans;
 }
 
+void GetTable::set_runtime_join_filter(const std::shared_ptr<const AbstractOperator>& build_input,
+                                       const ColumnID build_column_id, const ColumnID column_id) {
+  Assert(build_input, "Runtime join filter requires a build input.");
+
+  // Map the output column to the column of the stored table.
+  auto stored_column_id = column_id;
+  for (const auto pruned_column_id : _pruned_column_ids) {
+    if (pruned_column_id > stored_column_id) {
+      break;
+    }
+    ++stored_column_id;
+  }
+
+  _runtime_join_filter_input = build_input;
+  _runtime_join_filter_build_column_id = build_column_id;
+  _runtime_join_filter_column_id = stored_column_id;
+}
+
+std::shared_ptr<const AbstractOperator> GetTable::runtime_join_filter_input() const {
+  return _runtime_join_filter_input.lock();
+}
+
 std::shared_ptr<AbstractOperator> GetTable::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& /*copied_left_input*/,
     const std::shared_ptr<AbstractOperator>& /*copied_right_input*/,
     std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& /*copied_ops*/) const {
   // We cannot copy _prunable_subquery_scans here since deep_copy() recurses into the input operators and the GetTable
   // operators are the first ones to be copied. Instead, AbstractOperator::deep_copy() sets the copied TableScans after
-  // the whole PQP has been copied.
+  // the whole PQP has been copied. Runtime join filters are not copied either: they are set when the operator tasks are
+  // created (see operator_task.cpp).
   return std::make_shared<GetTable>(_name, _pruned_chunk_ids, _pruned_column_ids);
 }
 
@@ -159,6 +183,11 @@ std::shared_ptr<const Table> GetTable::_on_execute() {
   // flag, too, it needs to be forwarded here; otherwise it would be completely invisible in the PQP.
   DebugAssert(stored_table->value_clustered_by().empty(), "GetTable does not forward value_clustered_by");
   auto overall_pruned_chunk_ids = _prune_chunks_dynamically();
+  const auto runtime_join_filter_pruned_chunk_ids = _prune_chunks_with_runtime_join_filter(*stored_table, chunk_count);
+  overall_pruned_chunk_ids.insert(runtime_join_filter_pruned_chunk_ids.cbegin(),
+                                  runtime_join_filter_pruned_chunk_ids.cend());
+  _dynamically_pruned_chunk_ids.insert(runtime_join_filter_pruned_chunk_ids.cbegin(),
+                                       runtime_join_filter_pruned_chunk_ids.cend());
   overall_pruned_chunk_ids.insert(_pruned_chunk_ids.cbegin(), _pruned_chunk_ids.cend());
   auto pruned_chunk_ids_iter = overall_pruned_chunk_ids.begin();
   auto excluded_chunk_ids = std::vector<ChunkID>{};
@@ -417,4 +446,35 @@ std::set<ChunkID> GetTable::_prune_chunks_dynamically() {
   return _dynamically_pruned_chunk_ids;
 }
 
+std::set<ChunkID> GetTable::_prune_chunks_with_runtime_join_filter(const Table& stored_table,
+                                                                  const ChunkID chunk_count) const {
+  if (_runtime_join_filter_column_id == INVALID_COLUMN_ID) {
+    return {};
+  }
+
+  const auto build_input = _runtime_join_filter_input.lock();
+  Assert(build_input, "Build input of runtime join filter expired. PQP is invalid.");
+  Assert(build_input->executed(), "Build input of runtime join filter has not been executed.");
+  const auto build_table = build_input->get_output();
+
+  // Summarizing the build column only pays off if it is smaller than the table we prune. Joins on columns of different
+  // data types hash the values differently and are left to the join.
+  if (build_table->row_count() >= stored_table.row_count() ||
+      build_table->column_data_type(_runtime_join_filter_build_column_id) !=
+          stored_table.column_data_type(_runtime_join_filter_column_id)) {
+    return {};
+  }
+
+  auto runtime_join_filter = JoinRuntimeFilter{*build_table, _runtime_join_filter_build_column_id};
+  auto pruned_chunk_ids = std::set<ChunkID>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = stored_table.get_chunk(chunk_id);
+    if (chunk && !runtime_join_filter.may_match(*chunk, _runtime_join_filter_column_id)) {
+      pruned_chunk_ids.emplace(chunk_id);
+    }
+  }
+
+  return pruned_chunk_ids;
+}
+
 }  // namespace hyrise
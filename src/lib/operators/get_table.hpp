@@ -44,6 +44,14 @@ class GetTable : public AbstractReadOnlyOperator {
   void set_prunable_subquery_predicates(const std::vector<std::weak_ptr<const AbstractOperator>>& subquery_scans) const;
   std::vector<std::shared_ptr<const AbstractOperator>> prunable_subquery_predicates() const;
 
+  // A hash join can publish the join column of its build input to the GetTable operator at the bottom of its probe
+  // input ("sideways information passing", see operator_task.cpp). Before emitting any chunk, GetTable summarizes the
+  // build column in a JoinRuntimeFilter and prunes chunks that cannot contain a join partner. `column_id` is the join
+  // column in the output of this operator. The build input has to be executed before this operator.
+  void set_runtime_join_filter(const std::shared_ptr<const AbstractOperator>& build_input,
+                               const ColumnID build_column_id, const ColumnID column_id);
+  std::shared_ptr<const AbstractOperator> runtime_join_filter_input() const;
+
  protected:
   std::shared_ptr<AbstractOperator> _on_deep_copy(
       const std::shared_ptr<AbstractOperator>& /*copied_left_input*/,
@@ -57,6 +65,9 @@ class GetTable : public AbstractReadOnlyOperator {
   // pruning with the predicates and return the pruned ChunkIDs.
   std::set<ChunkID> _prune_chunks_dynamically();
 
+  // Prune chunks using the runtime join filter, if one was set and the filter is built from a smaller input.
+  std::set<ChunkID> _prune_chunks_with_runtime_join_filter(const Table& stored_table, const ChunkID chunk_count) const;
+
   // Name of the table to retrieve.
   const std::string _name;
   const std::vector<ChunkID> _pruned_chunk_ids;
@@ -64,6 +75,10 @@ class GetTable : public AbstractReadOnlyOperator {
 
   mutable std::vector<std::weak_ptr<const AbstractOperator>> _prunable_subquery_scans{};
   std::set<ChunkID> _dynamically_pruned_chunk_ids{};
+
+  std::weak_ptr<const AbstractOperator> _runtime_join_filter_input{};
+  ColumnID _runtime_join_filter_build_column_id{INVALID_COLUMN_ID};
+  ColumnID _runtime_join_filter_column_id{INVALID_COLUMN_ID};
 };
 
 }  // namespace hyrise
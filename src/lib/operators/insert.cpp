@@ -8,6 +8,7 @@
 #include <unordered_map>
 
 #include "all_type_variant.hpp"
+#include "concurrency/log_entry.hpp"
 #include "concurrency/transaction_context.hpp"
 #include "hyrise.hpp"
 #include "operators/abstract_operator.hpp"
@@ -264,6 +265,15 @@ void Insert::_on_commit_records(const CommitID cid) {
   }
 }
 
+void Insert::_on_write_log_records(LogEntryWriter& log_entry) const {
+  // The inserted rows are still held by ValueSegments, as chunks become immutable (and thus encodable) only after all
+  // pending Inserts committed.
+  for (const auto& target_chunk_range : _target_chunk_ranges) {
+    log_entry.add_insert(_target_table_name, *_target_table, target_chunk_range.chunk_id,
+                         target_chunk_range.begin_chunk_offset, target_chunk_range.end_chunk_offset);
+  }
+}
+
 void Insert::_on_rollback_records() {
   for (const auto& target_chunk_range : _target_chunk_ranges) {
     const auto target_chunk = _target_table->get_chunk(target_chunk_range.chunk_id);
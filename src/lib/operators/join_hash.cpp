@@ -1,5 +1,7 @@
 #include "join_hash.hpp"
 
+#include <unistd.h>
+
 #include <algorithm>
 #include <cmath>
 #include <cstddef>
@@ -26,6 +28,7 @@
 #include "resolve_type.hpp"
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/job_task.hpp"
+#include "storage/global_dictionary_utils.hpp"
 #include "storage/pos_lists/row_id_pos_list.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
@@ -33,6 +36,28 @@
 #include "utils/performance_warning.hpp"
 #include "utils/timer.hpp"
 
+namespace {
+
+size_t l2_cache_size() {
+  // We assume a cache of 1024 KB for an Intel Xeon Platinum 8180 if the cache size cannot be determined (e.g., on
+  // macOS). For other CPUs, this size might be different (e.g., an AMD EPYC 7F72 CPU has an L2 cache size of 512 KB and
+  // Apple's M1 has 128 KB).
+  static const auto cache_size = []() {
+    auto size = size_t{1'024'000};
+#ifdef _SC_LEVEL2_CACHE_SIZE
+    const auto detected_size = sysconf(_SC_LEVEL2_CACHE_SIZE);
+    if (detected_size > 0) {
+      size = static_cast<size_t>(detected_size);
+    }
+#endif
+    return size;
+  }();
+
+  return cache_size;
+}
+
+}  // namespace
+
 namespace hyrise {
 
 bool JoinHash::supports(const JoinConfiguration config) {
@@ -61,8 +86,19 @@ std::shared_ptr<AbstractOperator> JoinHash::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_left_input,
     const std::shared_ptr<AbstractOperator>& copied_right_input,
     std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& /*copied_ops*/) const {
-  return std::make_shared<JoinHash>(copied_left_input, copied_right_input, _mode, _primary_predicate,
-                                    _secondary_predicates);
+  const auto copy = std::make_shared<JoinHash>(copied_left_input, copied_right_input, _mode, _primary_predicate,
+                                               _secondary_predicates);
+  copy->set_runtime_join_filter_from_left_input(_runtime_join_filter_from_left_input);
+  return copy;
+}
+
+void JoinHash::set_runtime_join_filter_from_left_input(const bool from_left_input) {
+  Assert(!from_left_input || _mode == JoinMode::Inner, "Only inner joins can publish their left input.");
+  _runtime_join_filter_from_left_input = from_left_input;
+}
+
+bool JoinHash::runtime_join_filter_from_left_input() const {
+  return _runtime_join_filter_from_left_input;
 }
 
 void JoinHash::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
@@ -71,8 +107,7 @@ size_t JoinHash::calculate_radix_bits(const size_t build_side_size, const size_t
   /*
     The number of radix bits is used to determine the number of build partitions. The idea is to size the partitions in
     a way that keeps the whole hash map cache resident. We aim for the largest unshared cache (for most Intel systems
-    that's the L2 cache, for Apple's M1 the L1 cache). This calculation should include hardware knowledge, once
-    available in Hyrise. As of now, we assume a cache size of 1024 KB, of which we use 75 %.
+    that's the L2 cache, for Apple's M1 the L1 cache), of which we use 75 %.
 
     We estimate the size the following way:
       - we assume each key appears once (that is an overestimation space-wise, but we
@@ -90,10 +125,7 @@ size_t JoinHash::calculate_radix_bits(const size_t build_side_size, const size_t
     PerformanceWarning("Build side larger than probe side in hash join");
   }
 
-  // We assume a cache of 1024 KB for an Intel Xeon Platinum 8180. For local deployments or other CPUs, this size might
-  // be different (e.g., an AMD EPYC 7F72 CPU has an L2 cache size of 512 KB and Apple's M1 has 128 KB).
-  constexpr auto L2_CACHE_SIZE = 1'024'000;                   // bytes
-  constexpr auto L2_CACHE_MAX_USABLE = L2_CACHE_SIZE * 0.75;  // use 75% of the L2 cache size
+  const auto l2_cache_max_usable = static_cast<double>(l2_cache_size()) * 0.75;  // use 75% of the L2 cache size
 
   // Since it is hard to estimate the number of distinct values in a radix partition (and, thus, the size of each hash
   // table), we accomodate a little bit extra space for slightly skewed data distributions and aim for a fill level of
@@ -104,13 +136,11 @@ size_t JoinHash::calculate_radix_bits(const size_t build_side_size, const size_t
       // key + value (and one byte overhead, see link above)
       static_cast<double>(sizeof(uint32_t)) / 0.8;
 
-  const auto cluster_count = std::max(1.0, complete_hash_map_size / L2_CACHE_MAX_USABLE);
+  const auto cluster_count = std::max(1.0, complete_hash_map_size / l2_cache_max_usable);
 
-  // We limit the max fan out for radix partitioning to 8 bits (i.e., 256 partitions). "An Experimental Comparison of
-  // Thirteen Relational Equi-Joins in Main Memory" by Schuh et al. analyzed the number of radix bits and how much
-  // large fan outs hurt performance due to TLB misses. As we do not use software-managed buffers, a smaller number of
-  // bits has shown the best results.
-  return std::min(size_t{8}, static_cast<size_t>(std::ceil(std::log2(cluster_count))));
+  // Up to MAX_RADIX_BITS_PER_PASS bits (i.e., 256 partitions), the data is partitioned in a single pass. Larger fan
+  // outs are partitioned in two passes so that neither pass writes to more partitions than the TLB can cover.
+  return std::min(MAX_RADIX_BITS, static_cast<size_t>(std::ceil(std::log2(cluster_count))));
 }
 
 std::shared_ptr<const Table> JoinHash::_on_execute() {
@@ -207,6 +237,19 @@ std::shared_ptr<const Table> JoinHash::_on_execute() {
                    max_partition_size,
                "Partition count too small (potential overflows in hash map offsetting).");
 
+        // String columns that share a global dictionary are joined on their value IDs, which avoids hashing and
+        // comparing the strings (see global_dictionary_utils.hpp). The values are not needed for the output.
+        if constexpr (BOTH_ARE_STRING) {
+          const auto dictionary = global_dictionary<pmr_string>(*build_input_table, build_column_id);
+          if (dictionary && dictionary == global_dictionary<pmr_string>(*probe_input_table, probe_column_id)) {
+            _impl = std::make_unique<JoinHashImpl<ValueID, ValueID>>(
+                *this, build_input_table, probe_input_table, _mode, adjusted_column_ids,
+                _primary_predicate.predicate_condition, output_column_order, *_radix_bits, join_hash_performance_data,
+                adjusted_secondary_predicates);
+            return;
+          }
+        }
+
         _impl = std::make_unique<JoinHashImpl<BuildColumnDataType, ProbeColumnDataType>>(
             *this, build_input_table, probe_input_table, _mode, adjusted_column_ids,
             _primary_predicate.predicate_condition, output_column_order, *_radix_bits, join_hash_performance_data,
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <memory>
 #include <optional>
 #include <string>
@@ -30,6 +31,12 @@ class JoinHash : public AbstractJoinOperator {
   // directly. This threshold needs to be re-evaluated over time to find the value which gives the best performance.
   static constexpr auto JOB_SPAWN_THRESHOLD = 500;
 
+  // Writing to more than 2^8 partitions at once causes TLB misses, as every output partition is written on a different
+  // page (see "An Experimental Comparison of Thirteen Relational Equi-Joins in Main Memory" by Schuh et al.). Larger
+  // fan-outs are radix partitioned in two passes (see partition_by_radix() in join_hash_steps.hpp).
+  static constexpr auto MAX_RADIX_BITS_PER_PASS = size_t{8};
+  static constexpr auto MAX_RADIX_BITS = 2 * MAX_RADIX_BITS_PER_PASS;
+
   JoinHash(const std::shared_ptr<const AbstractOperator>& left, const std::shared_ptr<const AbstractOperator>& right,
            const JoinMode mode, const OperatorJoinPredicate& primary_predicate,
            const std::vector<OperatorJoinPredicate>& secondary_predicates = {},
@@ -39,6 +46,13 @@ class JoinHash : public AbstractJoinOperator {
 
   static size_t calculate_radix_bits(const size_t build_side_size, const size_t probe_side_size);
 
+  // Inner joins publish one of their inputs as a runtime join filter to the GetTable operator on the other side (see
+  // operator_task.cpp). The LQPTranslator chooses the input with the smaller estimated cardinality once, so that no
+  // cardinalities have to be estimated when the tasks of a (cached) PQP are created. Semi joins always publish their
+  // right input.
+  void set_runtime_join_filter_from_left_input(const bool from_left_input);
+  bool runtime_join_filter_from_left_input() const;
+
   enum class OperatorSteps : uint8_t {
     BuildSideMaterializing,
     ProbeSideMaterializing,
@@ -80,6 +94,7 @@ class JoinHash : public AbstractJoinOperator {
 
   std::unique_ptr<AbstractReadOnlyOperatorImpl> _impl;
   std::optional<size_t> _radix_bits;
+  bool _runtime_join_filter_from_left_input{false};
 
   template <typename LeftType, typename RightType>
   class JoinHashImpl;
@@ -5,6 +5,7 @@
 #include <limits>
 #include <memory>
 #include <mutex>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -24,6 +25,7 @@
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/job_task.hpp"
 #include "storage/create_iterable_from_segment.hpp"
+#include "storage/global_dictionary_utils.hpp"
 #include "storage/segment_iterate.hpp"
 #include "type_comparison.hpp"
 #include "types.hpp"
@@ -262,7 +264,7 @@ static const auto ALL_TRUE_BLOOM_FILTER = ~BloomFilter(BLOOM_FILTER_SIZE);
 // @param in_table             Table to materialize
 // @param column_id            Column within that table to materialize
 // @param histograms           Out: If radix_bits > 0, contains one histogram per chunk where each histogram contains
-//                             1 << radix_bits slots
+//                             one slot per partition of the first radix partitioning pass
 // @param radix_bits           Number of radix_bits, needed only for histogram calculation
 // @param output_bloom_filter  Out: A filled BloomFilter where `value & BLOOM_FILTER_MASK == true` for each value
 //                             encountered in the input column
@@ -281,12 +283,10 @@ RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table
   auto radix_container = RadixContainer<T>{};
   radix_container.resize(chunk_count);
 
-  // Fan-out
-  const size_t num_radix_partitions = 1ull << radix_bits;
-
-  // Currently, we just do one pass
-  const auto pass = size_t{0};
-  const auto radix_mask = static_cast<size_t>(std::pow(2, radix_bits * (pass + 1)) - 1);
+  // Fan-out of the first radix partitioning pass (see partition_by_radix())
+  const auto histogram_radix_bits = std::min(radix_bits, JoinHash::MAX_RADIX_BITS_PER_PASS);
+  const size_t num_radix_partitions = 1ull << histogram_radix_bits;
+  const auto radix_mask = num_radix_partitions - 1;
 
   Assert(output_bloom_filter.empty(), "Unexpected non-empty output_bloom_filter.");
   output_bloom_filter.resize(BLOOM_FILTER_SIZE);
@@ -335,76 +335,77 @@ RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table
       // prepare histogram
       auto histogram = std::vector<size_t>(num_radix_partitions);
 
-      auto reference_chunk_offset = ChunkOffset{0};
-
-      const auto segment = chunk_in->get_segment(column_id);
-      segment_with_iterators<T>(*segment, [&](auto iter, auto end) {
-        using IterableType = typename decltype(iter)::IterableType;
-
-        if (dynamic_cast<ValueSegment<T>*>(&*segment)) {
-          // The last chunk might have changed its size since we allocated elements. This would be due to concurrent
-          // inserts into that chunk. In any case, those inserts will not be visible to our current transaction, so we
-          // can ignore them.
-          const auto inserted_rows = (end - iter) - num_rows;
-          end -= inserted_rows;
-        } else {
-          Assert(end - iter == num_rows, "Non-ValueSegment changed size while being accessed.");
-        }
+      // For ReferenceSegments we do not use the RowIDs from the referenced tables. Instead, we use the index in the
+      // ReferenceSegment itself. This way we can later correctly dereference values from different inputs (important
+      // for Multi Joins).
+      const auto materialize_position = [&](const auto& value, const ChunkOffset chunk_offset) {
+        if (!value.is_null() || keep_null_values) {
+          // TODO(anyone): static_cast is almost always safe, since HashType is big enough. Only for double-vs-long
+          // joins an information loss is possible when joining with longs that cannot be losslessly converted to
+          // double. See #1550 for details.
+          const Hash hashed_value = hash_function(static_cast<HashedType>(value.value()));
+
+          if (!value.is_null() && !input_bloom_filter[hashed_value & BLOOM_FILTER_MASK] && !keep_null_values) {
+            // Value in not present in input bloom filter and can be skipped
+            return;
+          }
 
-        while (iter != end) {
-          const auto& value = *iter;
+          // Fill the corresponding slot in the bloom filter
+          used_output_bloom_filter.get()[hashed_value & BLOOM_FILTER_MASK] = true;
 
-          if (!value.is_null() || keep_null_values) {
-            // TODO(anyone): static_cast is almost always safe, since HashType is big enough. Only for double-vs-long
-            // joins an information loss is possible when joining with longs that cannot be losslessly converted to
-            // double. See #1550 for details.
-            const Hash hashed_value = hash_function(static_cast<HashedType>(value.value()));
+          *elements_iter = PartitionedElement<T>{RowID{chunk_id, chunk_offset}, value.value()};
+          ++elements_iter;
 
-            auto skip = false;
-            if (!value.is_null() && !input_bloom_filter[hashed_value & BLOOM_FILTER_MASK] && !keep_null_values) {
-              // Value in not present in input bloom filter and can be skipped
-              skip = true;
+          // In case we care about NULL values, store the NULL flag
+          if constexpr (keep_null_values) {
+            if (value.is_null()) {
+              *null_values_iter = true;
             }
+            ++null_values_iter;
+          }
 
-            if (!skip) {
-              // Fill the corresponding slot in the bloom filter
-              used_output_bloom_filter.get()[hashed_value & BLOOM_FILTER_MASK] = true;
-
-              /*
-              For ReferenceSegments we do not use the RowIDs from the referenced tables.
-              Instead, we use the index in the ReferenceSegment itself. This way we can later correctly dereference
-              values from different inputs (important for Multi Joins).
-              */
-              if constexpr (is_reference_segment_iterable_v<IterableType>) {
-                *elements_iter = PartitionedElement<T>{RowID{chunk_id, reference_chunk_offset}, value.value()};
-              } else {
-                *elements_iter = PartitionedElement<T>{RowID{chunk_id, value.chunk_offset()}, value.value()};
-              }
-              ++elements_iter;
-
-              // In case we care about NULL values, store the NULL flag
-              if constexpr (keep_null_values) {
-                if (value.is_null()) {
-                  *null_values_iter = true;
-                }
-                ++null_values_iter;
-              }
-
-              if (radix_bits > 0) {
-                const Hash radix = hashed_value & radix_mask;
-                ++histogram[radix];
-              }
-            }
+          if (radix_bits > 0) {
+            const Hash radix = hashed_value & radix_mask;
+            ++histogram[radix];
           }
+        }
+      };
 
-          // reference_chunk_offset is only used for ReferenceSegments
-          if constexpr (is_reference_segment_iterable_v<IterableType>) {
-            ++reference_chunk_offset;
+      const auto segment = chunk_in->get_segment(column_id);
+      if constexpr (std::is_same_v<T, ValueID>) {
+        // The column has a global dictionary (see JoinHash::_on_execute) and is materialized as value IDs.
+        Assert(segment->size() == num_rows, "Segment changed size while being accessed.");
+        for_each_global_value_id(*segment, [&](const auto& value) {
+          materialize_position(value, value.chunk_offset());
+        });
+      } else {
+        auto reference_chunk_offset = ChunkOffset{0};
+        segment_with_iterators<T>(*segment, [&](auto iter, auto end) {
+          using IterableType = typename decltype(iter)::IterableType;
+
+          if (dynamic_cast<ValueSegment<T>*>(&*segment)) {
+            // The last chunk might have changed its size since we allocated elements. This would be due to concurrent
+            // inserts into that chunk. In any case, those inserts will not be visible to our current transaction, so
+            // we can ignore them.
+            const auto inserted_rows = (end - iter) - num_rows;
+            end -= inserted_rows;
+          } else {
+            Assert(end - iter == num_rows, "Non-ValueSegment changed size while being accessed.");
           }
 
-          ++iter;
-        }
-      });
+          while (iter != end) {
+            const auto& value = *iter;
+            if constexpr (is_reference_segment_iterable_v<IterableType>) {
+              materialize_position(value, reference_chunk_offset);
+              // reference_chunk_offset is only used for ReferenceSegments
+              ++reference_chunk_offset;
+            } else {
+              materialize_position(value, value.chunk_offset());
+            }
+            ++iter;
+          }
+        });
+      }
 
       // elements was allocated with the size of the chunk. As we might have skipped NULL values, we need to resize the
       // vector to the number of values actually written.
@@ -517,6 +518,89 @@ std::vector<std::optional<PosHashTable<HashedType>>> build(const RadixContainer<
   return hash_tables;
 }
 
+// Second pass of partition_by_radix() for fan-outs above MAX_RADIX_BITS_PER_PASS bits. Each partition of the first
+// pass is split by the remaining radix bits independently, so that every job only writes to a limited number of
+// partitions. Partition p of the first pass is split into the partitions `(remaining_bits << first_pass_bits) | p`.
+// Thus, the final partition of each value is given by the lowest `radix_bits` bits of its hash, the same as for
+// single-pass partitioning.
+template <typename T, typename HashedType, bool keep_null_values>
+RadixContainer<T> partition_by_radix_second_pass(RadixContainer<T>& first_pass_partitions, const size_t radix_bits) {
+  const std::hash<HashedType> hash_function;
+
+  const auto first_pass_partition_count = first_pass_partitions.size();
+  const auto first_pass_radix_bits = JoinHash::MAX_RADIX_BITS_PER_PASS;
+  DebugAssert(first_pass_partition_count == size_t{1} << first_pass_radix_bits, "Unexpected number of partitions.");
+  const auto second_pass_partition_count = size_t{1} << (radix_bits - first_pass_radix_bits);
+  const auto second_pass_radix_mask = second_pass_partition_count - 1;
+
+  auto output = RadixContainer<T>(size_t{1} << radix_bits);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(first_pass_partition_count);
+
+  for (auto input_partition_idx = size_t{0}; input_partition_idx < first_pass_partition_count; ++input_partition_idx) {
+    const auto elements_count = first_pass_partitions[input_partition_idx].elements.size();
+    if (elements_count == 0) {
+      continue;
+    }
+
+    const auto perform_partition = [&, input_partition_idx, elements_count]() {
+      auto& input_partition = first_pass_partitions[input_partition_idx];
+      const auto& elements = input_partition.elements;
+
+      // The partition is cache resident after the first pass. Hashing its values twice is cheaper than storing the
+      // hashes.
+      auto radixes = std::vector<size_t>(elements_count);
+      auto histogram = std::vector<size_t>(second_pass_partition_count);
+      for (auto input_idx = size_t{0}; input_idx < elements_count; ++input_idx) {
+        const auto radix =
+            (hash_function(static_cast<HashedType>(elements[input_idx].value)) >> first_pass_radix_bits) &
+            second_pass_radix_mask;
+        radixes[input_idx] = radix;
+        ++histogram[radix];
+      }
+
+      // Different from the first pass, each output partition is written by a single job. Thus, we can write the NULL
+      // flags directly.
+      const auto output_partition_idx = [&](const size_t radix) {
+        return (radix << first_pass_radix_bits) | input_partition_idx;
+      };
+
+      for (auto radix = size_t{0}; radix < second_pass_partition_count; ++radix) {
+        auto& output_partition = output[output_partition_idx(radix)];
+        output_partition.elements.resize(histogram[radix]);
+        if constexpr (keep_null_values) {
+          output_partition.null_values.resize(histogram[radix]);
+        }
+      }
+
+      auto output_offsets = std::vector<size_t>(second_pass_partition_count);
+      for (auto input_idx = size_t{0}; input_idx < elements_count; ++input_idx) {
+        const auto radix = radixes[input_idx];
+        auto& output_partition = output[output_partition_idx(radix)];
+        auto& output_idx = output_offsets[radix];
+        output_partition.elements[output_idx] = elements[input_idx];
+        if constexpr (keep_null_values) {
+          output_partition.null_values[output_idx] = input_partition.null_values[input_idx];
+        }
+        ++output_idx;
+      }
+
+      // The first pass result is not needed anymore.
+      input_partition = Partition<T>{};
+    };
+
+    if (JoinHash::JOB_SPAWN_THRESHOLD > elements_count) {
+      perform_partition();
+    } else {
+      jobs.emplace_back(std::make_shared<JobTask>(perform_partition));
+    }
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  return output;
+}
+
 template <typename T, typename HashedType, bool keep_null_values>
 RadixContainer<T> partition_by_radix(const RadixContainer<T>& radix_container,
                                      std::vector<std::vector<size_t>>& histograms, const size_t radix_bits,
@@ -533,12 +617,12 @@ RadixContainer<T> partition_by_radix(const RadixContainer<T>& radix_container,
 
   const std::hash<HashedType> hash_function;
 
+  // The first pass partitions the data by the lowest bits of the hash values. If more than MAX_RADIX_BITS_PER_PASS bits
+  // are requested, a second pass splits each partition by the remaining bits.
+  const auto first_pass_radix_bits = std::min(radix_bits, JoinHash::MAX_RADIX_BITS_PER_PASS);
   const auto input_partition_count = radix_container.size();
-  const auto output_partition_count = size_t{1} << radix_bits;
-
-  // currently, we just do one pass
-  const size_t pass = 0;
-  const size_t radix_mask = static_cast<uint32_t>(std::pow(2, radix_bits * (pass + 1)) - 1);
+  const auto output_partition_count = size_t{1} << first_pass_radix_bits;
+  const auto radix_mask = output_partition_count - 1;
 
   // allocate new (shared) output
   auto output = RadixContainer<T>(output_partition_count);
@@ -627,6 +711,10 @@ RadixContainer<T> partition_by_radix(const RadixContainer<T>& radix_container,
     Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
   }
 
+  if (radix_bits > first_pass_radix_bits) {
+    return partition_by_radix_second_pass<T, HashedType, keep_null_values>(output, radix_bits);
+  }
+
   return output;
 }
 
@@ -3,6 +3,8 @@
 #include <string>
 #include <type_traits>
 
+#include "types.hpp"
+
 namespace hyrise {
 
 // JoinHashTraits
@@ -38,4 +40,10 @@ struct JoinHashTraits<L, R, std::enable_if_t<std::is_same_v<R, pmr_string> || st
   using HashType = pmr_string;
 };
 
+// Columns that share a global dictionary are joined on their value IDs (see global_dictionary_utils.hpp)
+template <>
+struct JoinHashTraits<ValueID, ValueID> {
+  using HashType = ValueID;
+};
+
 }  // namespace hyrise
@@ -0,0 +1,126 @@
+#include "join_runtime_filter.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+
+#include "all_type_variant.hpp"
+#include "operators/join_hash/join_hash_steps.hpp"
+#include "resolve_type.hpp"
+#include "storage/chunk.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+#include "utils/pruning_utils.hpp"
+
+namespace hyrise {
+
+JoinRuntimeFilter::JoinRuntimeFilter(const Table& build_table, const ColumnID build_column_id)
+    : _data_type{build_table.column_data_type(build_column_id)}, _bloom_filter(BLOOM_FILTER_SIZE) {
+  resolve_data_type(_data_type, [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    const auto hash_function = std::hash<ColumnDataType>{};
+    auto min_value = std::optional<ColumnDataType>{};
+    auto max_value = std::optional<ColumnDataType>{};
+
+    const auto chunk_count = build_table.chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk = build_table.get_chunk(chunk_id);
+      if (!chunk) {
+        continue;
+      }
+
+      segment_iterate<ColumnDataType>(*chunk->get_segment(build_column_id), [&](const auto& position) {
+        if (position.is_null()) {
+          return;
+        }
+
+        const auto& value = position.value();
+        if (!min_value || value < *min_value) {
+          min_value = value;
+        }
+        if (!max_value || value > *max_value) {
+          max_value = value;
+        }
+        _bloom_filter[hash_function(value) & BLOOM_FILTER_MASK] = true;
+      });
+    }
+
+    if (min_value) {
+      _min_value = *min_value;
+      _max_value = *max_value;
+    }
+  });
+}
+
+DataType JoinRuntimeFilter::data_type() const {
+  return _data_type;
+}
+
+const AllTypeVariant& JoinRuntimeFilter::min_value() const {
+  return _min_value;
+}
+
+const AllTypeVariant& JoinRuntimeFilter::max_value() const {
+  return _max_value;
+}
+
+bool JoinRuntimeFilter::may_match(const Chunk& chunk, const ColumnID column_id) {
+  if (variant_is_null(_min_value)) {
+    return false;
+  }
+
+  const auto& pruning_statistics = chunk.pruning_statistics();
+  if (pruning_statistics &&
+      can_prune(*(*pruning_statistics)[column_id], PredicateCondition::BetweenInclusive, _min_value, _max_value)) {
+    return false;
+  }
+
+  // Checking the dictionary is much cheaper than checking every row. Other encodings are left to the join itself.
+  auto may_match = true;
+  resolve_data_type(_data_type, [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    const auto segment = chunk.get_segment(column_id);
+    const auto dictionary_segment = std::dynamic_pointer_cast<const DictionarySegment<ColumnDataType>>(segment);
+    if (!dictionary_segment) {
+      return;
+    }
+
+    DebugAssert(segment->data_type() == storage_data_type(_data_type),
+                "Runtime join filter applied to column of different data type.");
+    const auto shares_dictionary = dictionary_segment->shares_dictionary();
+    if (shares_dictionary) {
+      const auto shared_dictionary_result = _shared_dictionary_may_match.find(dictionary_segment->dictionary());
+      if (shared_dictionary_result != _shared_dictionary_may_match.cend()) {
+        may_match = shared_dictionary_result->second;
+        return;
+      }
+    }
+
+    const auto hash_function = std::hash<ColumnDataType>{};
+    const auto min_value = boost::get<ColumnDataType>(_min_value);
+    const auto max_value = boost::get<ColumnDataType>(_max_value);
+    const auto& dictionary = *dictionary_segment->dictionary();
+
+    // The dictionary is sorted, so only the values within the build side's range have to be checked.
+    const auto range_begin = std::lower_bound(dictionary.cbegin(), dictionary.cend(), min_value);
+    const auto range_end = std::upper_bound(range_begin, dictionary.cend(), max_value);
+    may_match = std::any_of(range_begin, range_end, [&](const auto& value) {
+      return _bloom_filter[hash_function(value) & BLOOM_FILTER_MASK];
+    });
+
+    if (shares_dictionary) {
+      _shared_dictionary_may_match.emplace(dictionary_segment->dictionary(), may_match);
+    }
+  });
+
+  return may_match;
+}
+
+}  // namespace hyrise
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <memory>
+#include <unordered_map>
+
+#include <boost/dynamic_bitset.hpp>
+
+#include "all_type_variant.hpp"
+#include "storage/chunk.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+// Summary of the join column of a hash join's build input that is published to the GetTable operator on the join's
+// probe side (see GetTable::set_runtime_join_filter()). It consists of the smallest and largest non-NULL value and a
+// Bloom filter with the same layout as the one JoinHash creates during materialization. Both are used to prune chunks
+// before they are validated and scanned: a chunk cannot contain a join partner if its pruning statistics do not
+// overlap with the value range or if none of its dictionary entries passes the Bloom filter.
+class JoinRuntimeFilter {
+ public:
+  JoinRuntimeFilter(const Table& build_table, const ColumnID build_column_id);
+
+  DataType data_type() const;
+
+  // NULL if the build column does not contain any non-NULL value. In this case, no row finds a join partner.
+  const AllTypeVariant& min_value() const;
+  const AllTypeVariant& max_value() const;
+
+  // Returns false if no value of the given column of the chunk can find a join partner. The column must be of the same
+  // data type as the build column. Not thread-safe, as the results for shared dictionaries are cached.
+  bool may_match(const Chunk& chunk, const ColumnID column_id);
+
+ private:
+  DataType _data_type;
+  AllTypeVariant _min_value{};
+  AllTypeVariant _max_value{};
+  boost::dynamic_bitset<> _bloom_filter;
+
+  // Segments that share their dictionary (e.g., a global dictionary, see global_dictionary_utils.hpp) would all check
+  // the same dictionary range. It is checked for the first of these segments, the others reuse the result.
+  std::unordered_map<std::shared_ptr<const void>, bool> _shared_dictionary_may_match;
+};
+
+}  // namespace hyrise
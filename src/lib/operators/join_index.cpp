@@ -13,12 +13,16 @@
 #include <utility>
 #include <vector>
 
+#include "hyrise.hpp"
+#include "join_helper/join_output_writing.hpp"
 #include "join_nested_loop.hpp"
 #include "multi_predicate_join/multi_predicate_join_evaluator.hpp"
 #include "operators/abstract_join_operator.hpp"
 #include "operators/abstract_operator.hpp"
 #include "operators/operator_join_predicate.hpp"
 #include "operators/operator_performance_data.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
 #include "storage/chunk.hpp"
 #include "storage/index/abstract_chunk_index.hpp"
 #include "storage/pos_lists/abstract_pos_list.hpp"
@@ -144,6 +148,34 @@ std::shared_ptr<const Table> JoinIndex::_on_execute() {
     }
   }
 
+  auto& join_index_performance_data = static_cast<PerformanceData&>(*performance_data);
+  join_index_performance_data.right_input_is_index_side = _index_side == IndexSide::Right;
+
+  // Data joins (see below) whose index side is fully indexed are probed in parallel. Matches of the index side are
+  // tracked per index chunk and would have to be synchronized between the jobs, so we only use the parallel probing if
+  // they are not required.
+  if (_index_input_table->type() == TableType::Data && !track_index_matches &&
+      _probe_input_table->chunk_count() > 1 && Hyrise::get().is_multi_threaded()) {
+    const auto chunk_count = _index_input_table->chunk_count();
+    auto indexes = std::vector<std::shared_ptr<AbstractChunkIndex>>{};
+    indexes.reserve(chunk_count);
+    for (auto index_chunk_id = ChunkID{0}; index_chunk_id < chunk_count; ++index_chunk_id) {
+      const auto index_chunk = _index_input_table->get_chunk(index_chunk_id);
+      Assert(index_chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+
+      const auto& chunk_indexes =
+          index_chunk->get_indexes(std::vector<ColumnID>{_adjusted_primary_predicate.column_ids.second});
+      if (chunk_indexes.empty()) {
+        break;
+      }
+      indexes.emplace_back(chunk_indexes.front());
+    }
+
+    if (indexes.size() == chunk_count) {
+      return _parallel_data_join_using_indexes(indexes, semi_or_anti_join);
+    }
+  }
+
   _probe_pos_list = std::make_shared<RowIDPosList>();
   _index_pos_list = std::make_shared<RowIDPosList>();
 
@@ -153,9 +185,6 @@ std::shared_ptr<const Table> JoinIndex::_on_execute() {
   _probe_pos_list->reserve(pos_list_size_to_reserve);
   _index_pos_list->reserve(pos_list_size_to_reserve);
 
-  auto& join_index_performance_data = static_cast<PerformanceData&>(*performance_data);
-  join_index_performance_data.right_input_is_index_side = _index_side == IndexSide::Right;
-
   auto secondary_predicate_evaluator = MultiPredicateJoinEvaluator{*_probe_input_table, *_index_input_table, _mode, {}};
 
   auto index_joining_duration = std::chrono::nanoseconds{0};
@@ -235,7 +264,8 @@ std::shared_ptr<const Table> JoinIndex::_on_execute() {
 
           const auto& probe_segment = chunk->get_segment(_adjusted_primary_predicate.column_ids.first);
           segment_with_iterators(*probe_segment, [&](auto probe_iter, const auto probe_end) {
-            _data_join_two_segments_using_index(probe_iter, probe_end, probe_chunk_id, index_chunk_id, index);
+            _data_join_two_segments_using_index(probe_iter, probe_end, probe_chunk_id, index_chunk_id, index,
+                                                *_probe_pos_list, *_index_pos_list);
           });
         }
         index_joining_duration += timer.lap();
@@ -286,6 +316,80 @@ std::shared_ptr<const Table> JoinIndex::_on_execute() {
   return _build_output_table(std::move(chunks));
 }
 
+std::shared_ptr<const Table> JoinIndex::_parallel_data_join_using_indexes(
+    const std::vector<std::shared_ptr<AbstractChunkIndex>>& indexes, const bool is_semi_or_anti_join) {
+  auto& join_index_performance_data = static_cast<PerformanceData&>(*performance_data);
+  auto timer = Timer{};
+
+  // One pair of PosLists per probe chunk. Each job writes only to the PosLists and the _probe_matches entries of its
+  // own chunks, so no synchronization is required.
+  const auto probe_chunk_count = _probe_input_table->chunk_count();
+  const auto index_chunk_count = _index_input_table->chunk_count();
+  auto probe_pos_lists = std::vector<RowIDPosList>(probe_chunk_count);
+  auto index_pos_lists = std::vector<RowIDPosList>(probe_chunk_count);
+
+  const auto probe_chunk_range = [&](const size_t begin_chunk_id, const size_t end_chunk_id) {
+    for (auto probe_chunk_id = ChunkID{static_cast<ChunkID::base_type>(begin_chunk_id)}; probe_chunk_id < end_chunk_id;
+         ++probe_chunk_id) {
+      const auto chunk = _probe_input_table->get_chunk(probe_chunk_id);
+      Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+
+      auto& probe_pos_list = probe_pos_lists[probe_chunk_id];
+      auto& index_pos_list = index_pos_lists[probe_chunk_id];
+
+      const auto& probe_segment = chunk->get_segment(_adjusted_primary_predicate.column_ids.first);
+      segment_with_iterators(*probe_segment, [&](auto probe_iter, const auto probe_end) {
+        for (auto index_chunk_id = ChunkID{0}; index_chunk_id < index_chunk_count; ++index_chunk_id) {
+          _data_join_two_segments_using_index(probe_iter, probe_end, probe_chunk_id, index_chunk_id,
+                                              indexes[index_chunk_id], probe_pos_list, index_pos_list);
+        }
+      });
+
+      if (_mode == JoinMode::Left || _mode == JoinMode::Right) {
+        _append_unmatched_probe_rows(probe_chunk_id, probe_pos_list, index_pos_list);
+      } else if (is_semi_or_anti_join) {
+        _append_semi_or_anti_probe_rows(probe_chunk_id, probe_pos_list);
+      }
+    }
+  };
+
+  // Split the probe side into (at most) one chunk range per CPU.
+  const auto max_job_count = std::max(Hyrise::get().topology.num_cpus(), size_t{1});
+  const auto chunks_per_job = (static_cast<size_t>(probe_chunk_count) + max_job_count - 1) / max_job_count;
+  const auto job_count = (static_cast<size_t>(probe_chunk_count) + chunks_per_job - 1) / chunks_per_job;
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(job_count);
+  for (auto job_id = size_t{0}; job_id < job_count; ++job_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, job_id]() {
+      probe_chunk_range(job_id * chunks_per_job,
+                        std::min(static_cast<size_t>(probe_chunk_count), (job_id + 1) * chunks_per_job));
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  join_index_performance_data.chunks_scanned_with_index += index_chunk_count;
+  join_index_performance_data.set_step_runtime(OperatorSteps::IndexJoining, timer.lap());
+
+  constexpr auto ALLOW_PARTITION_MERGE = true;
+  auto output_chunks = std::vector<std::shared_ptr<Chunk>>{};
+  if (is_semi_or_anti_join) {
+    output_chunks = write_output_chunks(index_pos_lists, probe_pos_lists, _index_input_table, _probe_input_table, false,
+                                        _probe_input_table->type() == TableType::References,
+                                        OutputColumnOrder::RightOnly, ALLOW_PARTITION_MERGE);
+  } else if (_index_side == IndexSide::Left) {
+    output_chunks = write_output_chunks(index_pos_lists, probe_pos_lists, _index_input_table, _probe_input_table, false,
+                                        _probe_input_table->type() == TableType::References,
+                                        OutputColumnOrder::LeftFirstRightSecond, ALLOW_PARTITION_MERGE);
+  } else {
+    output_chunks = write_output_chunks(probe_pos_lists, index_pos_lists, _probe_input_table, _index_input_table,
+                                        _probe_input_table->type() == TableType::References, false,
+                                        OutputColumnOrder::LeftFirstRightSecond, ALLOW_PARTITION_MERGE);
+  }
+  join_index_performance_data.set_step_runtime(OperatorSteps::OutputWriting, timer.lap());
+
+  return _build_output_table(std::move(output_chunks));
+}
+
 void JoinIndex::_fallback_nested_loop(const ChunkID index_chunk_id, const bool track_probe_matches,
                                       const bool track_index_matches, const bool is_semi_or_anti_join,
                                       MultiPredicateJoinEvaluator& secondary_predicate_evaluator) {
@@ -327,12 +431,14 @@ void JoinIndex::_fallback_nested_loop(const ChunkID index_chunk_id, const bool t
 template <typename ProbeIterator>
 void JoinIndex::_data_join_two_segments_using_index(ProbeIterator probe_iter, ProbeIterator probe_end,
                                                     const ChunkID probe_chunk_id, const ChunkID index_chunk_id,
-                                                    const std::shared_ptr<AbstractChunkIndex>& index) {
+                                                    const std::shared_ptr<AbstractChunkIndex>& index,
+                                                    RowIDPosList& probe_pos_list, RowIDPosList& index_pos_list) {
   for (; probe_iter != probe_end; ++probe_iter) {
     const auto probe_side_position = *probe_iter;
     const auto index_ranges = _index_ranges_for_value(probe_side_position, index);
     for (const auto& [index_begin, index_end] : index_ranges) {
-      _append_matches(index_begin, index_end, probe_side_position.chunk_offset(), probe_chunk_id, index_chunk_id);
+      _append_matches(index_begin, index_end, probe_side_position.chunk_offset(), probe_chunk_id, index_chunk_id,
+                      probe_pos_list, index_pos_list);
     }
   }
 }
@@ -435,7 +541,8 @@ std::vector<IndexRange> JoinIndex::_index_ranges_for_value(const SegmentPosition
 
 void JoinIndex::_append_matches(const AbstractChunkIndex::Iterator& range_begin,
                                 const AbstractChunkIndex::Iterator& range_end, const ChunkOffset probe_chunk_offset,
-                                const ChunkID probe_chunk_id, const ChunkID index_chunk_id) {
+                                const ChunkID probe_chunk_id, const ChunkID index_chunk_id,
+                                RowIDPosList& probe_pos_list, RowIDPosList& index_pos_list) {
   const auto num_index_matches = std::distance(range_begin, range_end);
 
   if (num_index_matches == 0) {
@@ -452,9 +559,9 @@ void JoinIndex::_append_matches(const AbstractChunkIndex::Iterator& range_begin,
 
   if (!semi_or_anti_join) {
     // we replicate the probe side value for each index side value
-    std::fill_n(std::back_inserter(*_probe_pos_list), num_index_matches, RowID{probe_chunk_id, probe_chunk_offset});
+    std::fill_n(std::back_inserter(probe_pos_list), num_index_matches, RowID{probe_chunk_id, probe_chunk_offset});
 
-    std::transform(range_begin, range_end, std::back_inserter(*_index_pos_list),
+    std::transform(range_begin, range_end, std::back_inserter(index_pos_list),
                    [index_chunk_id](ChunkOffset index_chunk_offset) {
                      return RowID{index_chunk_id, index_chunk_offset};
                    });
@@ -484,13 +591,7 @@ void JoinIndex::_append_matches_non_inner(const bool is_semi_or_anti_join) {
       (_mode == JoinMode::Right && _index_side == IndexSide::Left) || _mode == JoinMode::FullOuter) {
     const auto chunk_count = _probe_input_table->chunk_count();
     for (ChunkID probe_chunk_id{0}; probe_chunk_id < chunk_count; ++probe_chunk_id) {
-      for (ChunkOffset chunk_offset{0}; chunk_offset < static_cast<ChunkOffset>(_probe_matches[probe_chunk_id].size());
-           ++chunk_offset) {
-        if (!_probe_matches[probe_chunk_id][chunk_offset]) {
-          _probe_pos_list->emplace_back(probe_chunk_id, chunk_offset);
-          _index_pos_list->emplace_back(NULL_ROW_ID);
-        }
-      }
+      _append_unmatched_probe_rows(probe_chunk_id, *_probe_pos_list, *_index_pos_list);
     }
   }
 
@@ -519,15 +620,7 @@ void JoinIndex::_append_matches_non_inner(const bool is_semi_or_anti_join) {
     if (_index_side == IndexSide::Right) {
       const auto chunk_count = _probe_input_table->chunk_count();
       for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
-        const auto chunk = _probe_input_table->get_chunk(chunk_id);
-        Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
-
-        const auto chunk_size = chunk->size();
-        for (ChunkOffset chunk_offset{0}; chunk_offset < chunk_size; ++chunk_offset) {
-          if (_probe_matches[chunk_id][chunk_offset] ^ invert) {
-            _probe_pos_list->emplace_back(chunk_id, chunk_offset);
-          }
-        }
+        _append_semi_or_anti_probe_rows(chunk_id, *_probe_pos_list);
       }
     } else {  // INDEX SIDE LEFT
       const auto chunk_count = _index_input_table->chunk_count();
@@ -546,6 +639,31 @@ void JoinIndex::_append_matches_non_inner(const bool is_semi_or_anti_join) {
   }
 }
 
+void JoinIndex::_append_unmatched_probe_rows(const ChunkID probe_chunk_id, RowIDPosList& probe_pos_list,
+                                             RowIDPosList& index_pos_list) const {
+  const auto& probe_matches = _probe_matches[probe_chunk_id];
+  for (ChunkOffset chunk_offset{0}; chunk_offset < static_cast<ChunkOffset>(probe_matches.size()); ++chunk_offset) {
+    if (!probe_matches[chunk_offset]) {
+      probe_pos_list.emplace_back(probe_chunk_id, chunk_offset);
+      index_pos_list.emplace_back(NULL_ROW_ID);
+    }
+  }
+}
+
+void JoinIndex::_append_semi_or_anti_probe_rows(const ChunkID probe_chunk_id, RowIDPosList& probe_pos_list) const {
+  const auto invert = _mode == JoinMode::AntiNullAsFalse || _mode == JoinMode::AntiNullAsTrue;
+  const auto chunk = _probe_input_table->get_chunk(probe_chunk_id);
+  Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+
+  const auto& probe_matches = _probe_matches[probe_chunk_id];
+  const auto chunk_size = chunk->size();
+  for (ChunkOffset chunk_offset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+    if (probe_matches[chunk_offset] ^ invert) {
+      probe_pos_list.emplace_back(probe_chunk_id, chunk_offset);
+    }
+  }
+}
+
 void JoinIndex::_write_output_segments(Segments& output_segments, const std::shared_ptr<const Table>& input_table,
                                        const std::shared_ptr<RowIDPosList>& pos_list) {
   // Add segments from table to output chunk
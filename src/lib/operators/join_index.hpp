@@ -66,10 +66,17 @@ class JoinIndex : public AbstractJoinOperator {
                              const bool track_index_matches, const bool is_semi_or_anti_join,
                              MultiPredicateJoinEvaluator& secondary_predicate_evaluator);
 
+  // Probes chunk ranges of the probe side in parallel. Each job collects the matches of its probe chunks in separate
+  // PosLists, which are then written using write_output_chunks(). Used for data joins if all chunks of the index side
+  // are indexed and matches of the index side do not need to be tracked.
+  std::shared_ptr<const Table> _parallel_data_join_using_indexes(
+      const std::vector<std::shared_ptr<AbstractChunkIndex>>& indexes, const bool is_semi_or_anti_join);
+
   template <typename ProbeIterator>
   void _data_join_two_segments_using_index(ProbeIterator probe_iter, ProbeIterator probe_end,
                                            const ChunkID probe_chunk_id, const ChunkID index_chunk_id,
-                                           const std::shared_ptr<AbstractChunkIndex>& index);
+                                           const std::shared_ptr<AbstractChunkIndex>& index,
+                                           RowIDPosList& probe_pos_list, RowIDPosList& index_pos_list);
 
   template <typename ProbeIterator>
   void _reference_join_two_segments_using_index(
@@ -83,13 +90,18 @@ class JoinIndex : public AbstractJoinOperator {
 
   void _append_matches(const AbstractChunkIndex::Iterator& range_begin, const AbstractChunkIndex::Iterator& range_end,
                        const ChunkOffset probe_chunk_offset, const ChunkID probe_chunk_id,
-                       const ChunkID index_chunk_id);
+                       const ChunkID index_chunk_id, RowIDPosList& probe_pos_list, RowIDPosList& index_pos_list);
 
   void _append_matches_dereferenced(const ChunkID& probe_chunk_id, const ChunkOffset& probe_chunk_offset,
                                     const RowIDPosList& index_table_matches);
 
   void _append_matches_non_inner(const bool is_semi_or_anti_join);
 
+  // Helpers of _append_matches_non_inner() that handle a single chunk of the probe side.
+  void _append_unmatched_probe_rows(const ChunkID probe_chunk_id, RowIDPosList& probe_pos_list,
+                                    RowIDPosList& index_pos_list) const;
+  void _append_semi_or_anti_probe_rows(const ChunkID probe_chunk_id, RowIDPosList& probe_pos_list) const;
+
   void _write_output_segments(Segments& output_segments, const std::shared_ptr<const Table>& input_table,
                               const std::shared_ptr<RowIDPosList>& pos_list);
 
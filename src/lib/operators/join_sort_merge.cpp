@@ -42,8 +42,9 @@ namespace hyrise {
 
 bool JoinSortMerge::supports(const JoinConfiguration config) {
   return (config.predicate_condition != PredicateCondition::NotEquals || config.join_mode == JoinMode::Inner) &&
-         config.left_data_type == config.right_data_type && config.join_mode != JoinMode::Semi &&
-         config.join_mode != JoinMode::AntiNullAsTrue && config.join_mode != JoinMode::AntiNullAsFalse;
+         storage_data_type(config.left_data_type) == storage_data_type(config.right_data_type) &&
+         config.join_mode != JoinMode::Semi && config.join_mode != JoinMode::AntiNullAsTrue &&
+         config.join_mode != JoinMode::AntiNullAsFalse;
 }
 
 // The sort merge join performs a join on two input tables on specific join columns. For usage notes, see the
@@ -82,7 +83,8 @@ std::shared_ptr<const Table> JoinSortMerge::_on_execute() {
 
   // Check column types
   const auto& left_column_type = left_input_table()->column_data_type(_primary_predicate.column_ids.first);
-  DebugAssert(left_column_type == right_input_table()->column_data_type(_primary_predicate.column_ids.second),
+  DebugAssert(storage_data_type(left_column_type) ==
+                  storage_data_type(right_input_table()->column_data_type(_primary_predicate.column_ids.second)),
               "Left and right column types do not match. The sort merge join requires matching column types.");
 
   // Create implementation to compute the join result
@@ -6,6 +6,7 @@
 #include <unordered_map>
 
 #include "all_type_variant.hpp"
+#include "concurrency/log_entry.hpp"
 #include "hyrise.hpp"
 #include "operators/abstract_operator.hpp"
 #include "operators/abstract_read_write_operator.hpp"
@@ -91,6 +92,14 @@ std::shared_ptr<const Table> CreateTable::_on_execute(std::shared_ptr<Transactio
   return nullptr;
 }
 
+void CreateTable::_on_write_log_records(LogEntryWriter& log_entry) const {
+  // Only log the table if it has been created by this operator (i.e., it did not exist before). As the CreateTable
+  // operator is registered with the transaction before its Insert, the table is recreated before its rows are replayed.
+  if (_insert) {
+    log_entry.add_create_table(table_name, *Hyrise::get().storage_manager.get_table(table_name));
+  }
+}
+
 std::shared_ptr<AbstractOperator> CreateTable::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_left_input,
     const std::shared_ptr<AbstractOperator>& /*copied_right_input*/,
@@ -36,6 +36,8 @@ class CreateTable : public AbstractReadWriteOperator {
   // Commit happens in Insert operator
   void _on_commit_records(const CommitID cid) override {}
 
+  void _on_write_log_records(LogEntryWriter& log_entry) const override;
+
   // Rollback happens in Insert operator
   void _on_rollback_records() override {}
 
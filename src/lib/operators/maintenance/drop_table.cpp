@@ -5,6 +5,7 @@
 #include <unordered_map>
 
 #include "all_type_variant.hpp"
+#include "concurrency/write_ahead_log.hpp"
 #include "hyrise.hpp"
 #include "operators/abstract_operator.hpp"
 #include "operators/abstract_read_only_operator.hpp"
@@ -29,6 +30,10 @@ std::shared_ptr<const Table> DropTable::_on_execute() {
   // If IF EXISTS is not set and the table is not found, StorageManager throws an exception
   if (!if_exists || Hyrise::get().storage_manager.has_table(table_name)) {
     Hyrise::get().storage_manager.drop_table(table_name);
+
+    if (const auto& write_ahead_log = Hyrise::get().write_ahead_log) {
+      write_ahead_log->log_drop_table(table_name);
+    }
   }
 
   return nullptr;
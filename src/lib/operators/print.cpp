@@ -257,6 +257,14 @@ std::string Print::_segment_type(const std::shared_ptr<AbstractSegment>& segment
         segment_type += "LZ4";
         break;
       }
+      case EncodingType::ALP: {
+        segment_type += "ALP";
+        break;
+      }
+      case EncodingType::FSST: {
+        segment_type += "FSST";
+        break;
+      }
     }
     if (encoded_segment->compressed_vector_type()) {
       switch (*encoded_segment->compressed_vector_type()) {
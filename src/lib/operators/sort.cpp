@@ -1,25 +1,32 @@
 #include "sort.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <functional>
 #include <memory>
-#include <optional>
 #include <string>
+#include <type_traits>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "all_type_variant.hpp"
+#include "hyrise.hpp"
 #include "operators/abstract_operator.hpp"
 #include "operators/abstract_read_only_operator.hpp"
 #include "operators/operator_performance_data.hpp"
 #include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
+#include "sort/normalized_key.hpp"
 #include "storage/abstract_segment.hpp"
 #include "storage/base_segment_accessor.hpp"
 #include "storage/chunk.hpp"
+#include "storage/global_dictionary_utils.hpp"
 #include "storage/pos_lists/row_id_pos_list.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/segment_iterate.hpp"
@@ -251,6 +258,282 @@ std::shared_ptr<Table> write_reference_output_table(const std::shared_ptr<const
   return output_table;
 }
 
+// Rows are sorted in runs of this size, which are then merged. Each merge is split into parts of roughly this size.
+constexpr auto ROWS_PER_SORT_JOB = size_t{1} << 16;
+
+/**
+ * Sorts the rows of a table by multiple columns in a single pass. All sort columns of a row are encoded into a
+ * normalized key (see normalized_key.hpp). String columns that contain values that are not fully represented by their
+ * prefix are materialized to break ties. Keys are sorted in parallel: runs of ROWS_PER_SORT_JOB rows are sorted
+ * independently and then merged pairwise, with each merge being split into parts that are merged in parallel. Ties
+ * are broken by the position of the rows in the input table, so the sort is stable even though the runs are not
+ * sorted with a stable algorithm.
+ */
+class NormalizedKeySorter {
+ public:
+  std::chrono::nanoseconds materialization_time{};
+  std::chrono::nanoseconds sort_time{};
+  std::chrono::nanoseconds temporary_result_writing_time{};
+
+  NormalizedKeySorter(const std::shared_ptr<const Table>& table, const std::vector<SortColumnDefinition>& definitions)
+      : _table(table) {
+    _sort_columns.reserve(definitions.size());
+    for (const auto& definition : definitions) {
+      auto& sort_column = _sort_columns.emplace_back();
+      sort_column.column_id = definition.column;
+      sort_column.sort_mode = definition.sort_mode;
+      sort_column.key_offset = _key_bytes;
+
+      // The value IDs of a global dictionary preserve the order of the strings and represent them in full. Sorting
+      // them requires neither string comparisons nor tie-breaks.
+      if (_table->column_data_type(definition.column) == DataType::String &&
+          global_dictionary<pmr_string>(*_table, definition.column)) {
+        sort_column.uses_value_ids = true;
+        _key_bytes += 1 + normalized_value_bytes<ValueID>();
+        continue;
+      }
+
+      resolve_data_type(_table->column_data_type(definition.column), [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+        _key_bytes += 1 + normalized_value_bytes<ColumnDataType>();
+      });
+    }
+  }
+
+  // Sorts the table and returns the sorted positions. The RowIDs point into the (possibly referencing) input table.
+  RowIDPosList sort() {
+    auto timer = Timer{};
+    _materialize_keys();
+    materialization_time = timer.lap();
+
+    _sort_entries();
+    sort_time = timer.lap();
+
+    auto pos_list = RowIDPosList(_entries.size());
+    const auto entry_count = _entries.size();
+    for (auto entry_index = size_t{0}; entry_index < entry_count; ++entry_index) {
+      pos_list[entry_index] = _row_ids[_entries[entry_index].row_index];
+    }
+    temporary_result_writing_time = timer.lap();
+    return pos_list;
+  }
+
+ protected:
+  struct SortColumn {
+    ColumnID column_id{INVALID_COLUMN_ID};
+    SortMode sort_mode{SortMode::Ascending};
+    // Offset of the column's NULL byte in the normalized key.
+    size_t key_offset{0};
+
+    // String columns with a global dictionary are encoded with their value IDs.
+    bool uses_value_ids{false};
+
+    // For string columns that contain values that are not fully represented by their prefix, the values are required
+    // to break ties.
+    bool needs_tie_break{false};
+    std::vector<pmr_string> strings;
+  };
+
+  // One entry per input row. The first bytes of the row's normalized key are stored as an integer, so that most
+  // comparisons can be decided without accessing the key buffer.
+  struct SortEntry {
+    uint64_t key_prefix;
+    size_t row_index;
+  };
+
+  void _materialize_keys() {
+    const auto chunk_count = _table->chunk_count();
+    const auto row_count = _table->row_count();
+
+    _keys.resize(row_count * _key_bytes);
+    _entries.resize(row_count);
+    _row_ids.resize(row_count);
+
+    for (auto& sort_column : _sort_columns) {
+      if (_table->column_data_type(sort_column.column_id) == DataType::String && !sort_column.uses_value_ids) {
+        sort_column.strings.resize(row_count);
+      }
+    }
+    auto needs_tie_break = std::vector<std::atomic_bool>(_sort_columns.size());
+
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    jobs.reserve(chunk_count);
+    auto chunk_row_offset = size_t{0};
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk = _table->get_chunk(chunk_id);
+      Assert(chunk, "Did not expect deleted chunk here.");  // see https://github.com/hyrise/hyrise/issues/1686
+
+      jobs.emplace_back(std::make_shared<JobTask>([&, chunk, chunk_id, chunk_row_offset] {
+        _materialize_chunk(*chunk, chunk_id, chunk_row_offset, needs_tie_break);
+      }));
+      chunk_row_offset += chunk->size();
+    }
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+    const auto sort_column_count = _sort_columns.size();
+    for (auto sort_column_index = size_t{0}; sort_column_index < sort_column_count; ++sort_column_index) {
+      auto& sort_column = _sort_columns[sort_column_index];
+      sort_column.needs_tie_break = needs_tie_break[sort_column_index];
+      if (sort_column.needs_tie_break) {
+        _tie_break_columns.emplace_back(&sort_column);
+      } else {
+        sort_column.strings = {};
+      }
+    }
+  }
+
+  void _materialize_chunk(const Chunk& chunk, const ChunkID chunk_id, const size_t chunk_row_offset,
+                          std::vector<std::atomic_bool>& needs_tie_break) {
+    const auto sort_column_count = _sort_columns.size();
+    for (auto sort_column_index = size_t{0}; sort_column_index < sort_column_count; ++sort_column_index) {
+      auto& sort_column = _sort_columns[sort_column_index];
+      auto chunk_needs_tie_break = false;
+
+      if (sort_column.uses_value_ids) {
+        write_normalized_segment<ValueID>(*chunk.get_segment(sort_column.column_id), sort_column.sort_mode,
+                                          &_keys[chunk_row_offset * _key_bytes + sort_column.key_offset], _key_bytes,
+                                          [](const ChunkOffset /*chunk_offset*/, const ValueID /*value_id*/) {});
+        continue;
+      }
+
+      resolve_data_type(_table->column_data_type(sort_column.column_id), [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+
+        auto* const keys = &_keys[chunk_row_offset * _key_bytes + sort_column.key_offset];
+        write_normalized_segment<ColumnDataType>(
+            *chunk.get_segment(sort_column.column_id), sort_column.sort_mode, keys, _key_bytes,
+            [&](const ChunkOffset chunk_offset, const ColumnDataType& value) {
+              if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+                // Zero bytes in a string cannot be distinguished from the padding of shorter strings.
+                chunk_needs_tie_break = chunk_needs_tie_break || value.size() >= NORMALIZED_KEY_STRING_PREFIX_BYTES ||
+                                        std::memchr(value.data(), 0, value.size()) != nullptr;
+                sort_column.strings[chunk_row_offset + chunk_offset] = value;
+              }
+            });
+      });
+
+      if (chunk_needs_tie_break) {
+        needs_tie_break[sort_column_index] = true;
+      }
+    }
+
+    const auto chunk_size = chunk.size();
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      const auto row_index = chunk_row_offset + chunk_offset;
+      _entries[row_index] = SortEntry{normalized_key_prefix(&_keys[row_index * _key_bytes], _key_bytes), row_index};
+      _row_ids[row_index] = RowID{chunk_id, chunk_offset};
+    }
+  }
+
+  // Compares the normalized keys of two rows. As the integer prefix covers less than the NULL byte and the prefix of a
+  // string column, a difference in the integer prefix is never preceded by two equal string prefixes.
+  bool _less(const SortEntry& lhs, const SortEntry& rhs) const {
+    if (lhs.key_prefix != rhs.key_prefix) {
+      return lhs.key_prefix < rhs.key_prefix;
+    }
+
+    const auto* const lhs_key = &_keys[lhs.row_index * _key_bytes];
+    const auto* const rhs_key = &_keys[rhs.row_index * _key_bytes];
+    auto key_offset = size_t{0};
+    for (const auto* const sort_column : _tie_break_columns) {
+      const auto string_prefix_end = sort_column->key_offset + 1 + NORMALIZED_KEY_STRING_PREFIX_BYTES;
+      const auto result = std::memcmp(lhs_key + key_offset, rhs_key + key_offset, string_prefix_end - key_offset);
+      if (result != 0) {
+        return result < 0;
+      }
+      key_offset = string_prefix_end;
+
+      // Both values are NULL.
+      if (lhs_key[sort_column->key_offset] == 0) {
+        continue;
+      }
+
+      const auto& lhs_value = sort_column->strings[lhs.row_index];
+      const auto& rhs_value = sort_column->strings[rhs.row_index];
+      if (lhs_value != rhs_value) {
+        return (lhs_value < rhs_value) == (sort_column->sort_mode == SortMode::Ascending);
+      }
+    }
+
+    const auto result = std::memcmp(lhs_key + key_offset, rhs_key + key_offset, _key_bytes - key_offset);
+    if (result != 0) {
+      return result < 0;
+    }
+
+    return lhs.row_index < rhs.row_index;
+  }
+
+  void _sort_entries() {
+    const auto entry_count = _entries.size();
+    const auto less = [&](const SortEntry& lhs, const SortEntry& rhs) {
+      return _less(lhs, rhs);
+    };
+
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    for (auto run_begin = size_t{0}; run_begin < entry_count; run_begin += ROWS_PER_SORT_JOB) {
+      const auto run_end = std::min(run_begin + ROWS_PER_SORT_JOB, entry_count);
+      jobs.emplace_back(std::make_shared<JobTask>([&, run_begin, run_end] {
+        std::sort(_entries.begin() + run_begin, _entries.begin() + run_end, less);
+      }));
+    }
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+    // Merge adjacent runs until a single run is left. To merge two runs in parallel, the left run is split into parts
+    // of equal size. For each split point, the corresponding split point in the right run is found by binary search.
+    // As all entries are distinct, the parts can be merged independently into their final position.
+    auto merged_entries = std::vector<SortEntry>(entry_count);
+    for (auto run_size = ROWS_PER_SORT_JOB; run_size < entry_count; run_size *= 2) {
+      jobs.clear();
+      for (auto left_begin = size_t{0}; left_begin < entry_count; left_begin += 2 * run_size) {
+        const auto left_end = std::min(left_begin + run_size, entry_count);
+        const auto right_end = std::min(left_begin + 2 * run_size, entry_count);
+        const auto part_count = (right_end - left_begin + ROWS_PER_SORT_JOB - 1) / ROWS_PER_SORT_JOB;
+
+        auto part_left_begin = left_begin;
+        auto part_right_begin = left_end;
+        for (auto part_index = size_t{1}; part_index <= part_count; ++part_index) {
+          auto part_left_end = left_end;
+          auto part_right_end = right_end;
+          if (part_index < part_count) {
+            part_left_end = left_begin + (left_end - left_begin) * part_index / part_count;
+            if (part_left_end < left_end) {
+              part_right_end = std::lower_bound(_entries.begin() + part_right_begin, _entries.begin() + right_end,
+                                                _entries[part_left_end], less) -
+                               _entries.begin();
+            }
+          }
+
+          const auto output_begin = part_left_begin + (part_right_begin - left_end);
+          jobs.emplace_back(std::make_shared<JobTask>(
+              [&, part_left_begin, part_left_end, part_right_begin, part_right_end, output_begin] {
+                std::merge(_entries.begin() + part_left_begin, _entries.begin() + part_left_end,
+                           _entries.begin() + part_right_begin, _entries.begin() + part_right_end,
+                           merged_entries.begin() + output_begin, less);
+              }));
+
+          part_left_begin = part_left_end;
+          part_right_begin = part_right_end;
+        }
+      }
+      Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+      std::swap(_entries, merged_entries);
+    }
+  }
+
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-const-or-ref-data-members)
+  const std::shared_ptr<const Table> _table;
+
+  std::vector<SortColumn> _sort_columns;
+  std::vector<const SortColumn*> _tie_break_columns;
+
+  size_t _key_bytes{0};
+  std::vector<uint8_t> _keys;
+  std::vector<SortEntry> _entries;
+
+  // Position of each row in the input table, indexed by SortEntry::row_index.
+  RowIDPosList _row_ids;
+};
+
 }  // namespace
 
 namespace hyrise {
@@ -303,35 +586,13 @@ std::shared_ptr<const Table> Sort::_on_execute() {
 
   std::shared_ptr<Table> sorted_table;
 
-  // After the first (least significant) sort operation has been completed, this holds the order of the table as it has
-  // been determined so far. This is not a completely proper PosList on the input table as it might point to
-  // ReferenceSegments.
-  auto previously_sorted_pos_list = std::optional<RowIDPosList>{};
-
-  auto total_materialization_time = std::chrono::nanoseconds{};
-  auto total_temporary_result_writing_time = std::chrono::nanoseconds{};
-  auto total_sort_time = std::chrono::nanoseconds{};
-
-  for (auto sort_step = static_cast<int64_t>(_sort_definitions.size() - 1); sort_step >= 0; --sort_step) {
-    const auto& sort_definition = _sort_definitions[sort_step];
-    const auto data_type = input_table->column_data_type(sort_definition.column);
-
-    resolve_data_type(data_type, [&](auto type) {
-      using ColumnDataType = typename decltype(type)::type;
-
-      auto sort_impl = SortImpl<ColumnDataType>(input_table, sort_definition.column, sort_definition.sort_mode);
-      previously_sorted_pos_list = sort_impl.sort(previously_sorted_pos_list);
-
-      total_materialization_time += sort_impl.materialization_time;
-      total_temporary_result_writing_time += sort_impl.temporary_result_writing_time;
-      total_sort_time += sort_impl.sort_time;
-    });
-  }
+  auto sorter = NormalizedKeySorter{input_table, _sort_definitions};
+  auto sorted_pos_list = sorter.sort();
 
   auto& step_performance_data = dynamic_cast<OperatorPerformanceData<OperatorSteps>&>(*performance_data);
-  step_performance_data.set_step_runtime(OperatorSteps::MaterializeSortColumns, total_materialization_time);
-  step_performance_data.set_step_runtime(OperatorSteps::TemporaryResultWriting, total_temporary_result_writing_time);
-  step_performance_data.set_step_runtime(OperatorSteps::Sort, total_sort_time);
+  step_performance_data.set_step_runtime(OperatorSteps::MaterializeSortColumns, sorter.materialization_time);
+  step_performance_data.set_step_runtime(OperatorSteps::TemporaryResultWriting, sorter.temporary_result_writing_time);
+  step_performance_data.set_step_runtime(OperatorSteps::Sort, sorter.sort_time);
 
   // We have to materialize the output (i.e., write ValueSegments) if
   //  (a) it is requested by the user,
@@ -369,15 +630,14 @@ std::shared_ptr<const Table> Sort::_on_execute() {
 
   if (must_materialize) {
     sorted_table =
-        write_materialized_output_table(input_table, std::move(*previously_sorted_pos_list), _output_chunk_size);
+        write_materialized_output_table(input_table, std::move(sorted_pos_list), _output_chunk_size);
   } else {
     sorted_table =
-        write_reference_output_table(input_table, std::move(*previously_sorted_pos_list), _output_chunk_size);
+        write_reference_output_table(input_table, std::move(sorted_pos_list), _output_chunk_size);
   }
 
   const auto& final_sort_definition = _sort_definitions[0];
-  // Set the sorted_by attribute of the output's chunks according to the most significant sort operation, which is the
-  // column the table was sorted by last.
+  // Set the sorted_by attribute of the output's chunks according to the most significant sort column.
   const auto output_chunk_count = sorted_table->chunk_count();
   for (auto output_chunk_id = ChunkID{0}; output_chunk_id < output_chunk_count; ++output_chunk_id) {
     const auto& output_chunk = sorted_table->get_chunk(output_chunk_id);
@@ -389,127 +649,4 @@ std::shared_ptr<const Table> Sort::_on_execute() {
   return sorted_table;
 }
 
-template <typename SortColumnType>
-class Sort::SortImpl {
- public:
-  using RowIDValuePair = std::pair<RowID, SortColumnType>;
-
-  std::chrono::nanoseconds materialization_time{};
-  std::chrono::nanoseconds temporary_result_writing_time{};
-  std::chrono::nanoseconds sort_time{};
-
-  SortImpl(const std::shared_ptr<const Table>& table_in, const ColumnID column_id,
-           const SortMode sort_mode = SortMode::Ascending)
-      : _table_in(table_in), _column_id(column_id), _sort_mode(sort_mode) {
-    const auto row_count = _table_in->row_count();
-    _row_id_value_vector.reserve(row_count);
-    _null_value_rows.reserve(row_count);
-  }
-
-  // Sorts table_in, potentially taking the pre-existing order of previously_sorted_pos_list into account.
-  // Returns a PosList, which can either be used as an input to the next call of sort or for materializing the
-  // output table.
-  RowIDPosList sort(const std::optional<RowIDPosList>& previously_sorted_pos_list) {
-    auto timer = Timer{};
-    // 1. Prepare Sort: Creating RowID-value-Structure
-    _materialize_sort_column(previously_sorted_pos_list);
-    materialization_time = timer.lap();
-
-    // 2. After we got our ValueRowID Map we sort the map by the value of the pair
-    const auto sort_with_comparator = [&](auto comparator) {
-      std::stable_sort(_row_id_value_vector.begin(), _row_id_value_vector.end(),
-                       [comparator](RowIDValuePair lhs, RowIDValuePair rhs) {
-                         return comparator(lhs.second, rhs.second);
-                       });
-    };
-    if (_sort_mode == SortMode::Ascending) {
-      sort_with_comparator(std::less<>{});
-    } else {
-      sort_with_comparator(std::greater<>{});
-    }
-    sort_time = timer.lap();
-
-    // 2b. Insert null rows in front of all non-NULL rows
-    if (!_null_value_rows.empty()) {
-      // NULLs come before all values. The SQL standard allows for this to be implementation-defined. We used to have
-      // a NULLS LAST mode, but never used it over multiple years. Different databases have different behaviors, and
-      // storing NULLs first even for descending orders is somewhat uncommon:
-      //   https://docs.mendix.com/refguide/ordering-behavior#null-ordering-behavior
-      // For Hyrise, we found that storing NULLs first is the method that requires the least amount of code.
-      _row_id_value_vector.insert(_row_id_value_vector.begin(), _null_value_rows.begin(), _null_value_rows.end());
-    }
-
-    auto pos_list = RowIDPosList{};
-    pos_list.reserve(_row_id_value_vector.size());
-    for (const auto& [row_id, _] : _row_id_value_vector) {
-      pos_list.emplace_back(row_id);
-    }
-    temporary_result_writing_time = timer.lap();
-    return pos_list;
-  }
-
- protected:
-  // completely materializes the sort column to create a vector of RowID-Value pairs
-  void _materialize_sort_column(const std::optional<RowIDPosList>& previously_sorted_pos_list) {
-    // If there was no PosList passed, this is the first sorting run and we simply fill our values and nulls data
-    // structures from our input table. Otherwise we will materialize according to the PosList which is the result of
-    // the last run.
-    if (previously_sorted_pos_list) {
-      _materialize_column_from_pos_list(*previously_sorted_pos_list);
-    } else {
-      const auto chunk_count = _table_in->chunk_count();
-      for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
-        const auto chunk = _table_in->get_chunk(chunk_id);
-        Assert(chunk, "Did not expect deleted chunk here.");  // see https://github.com/hyrise/hyrise/issues/1686
-
-        auto abstract_segment = chunk->get_segment(_column_id);
-
-        segment_iterate<SortColumnType>(*abstract_segment, [&](const auto& position) {
-          if (position.is_null()) {
-            _null_value_rows.emplace_back(RowID{chunk_id, position.chunk_offset()}, SortColumnType{});
-          } else {
-            _row_id_value_vector.emplace_back(RowID{chunk_id, position.chunk_offset()}, position.value());
-          }
-        });
-      }
-    }
-  }
-
-  // When there was a preceding sorting run, we materialize by retaining the order of the values in the passed PosList.
-  void _materialize_column_from_pos_list(const RowIDPosList& pos_list) {
-    const auto input_chunk_count = _table_in->chunk_count();
-    auto accessor_by_chunk_id =
-        std::vector<std::unique_ptr<AbstractSegmentAccessor<SortColumnType>>>(input_chunk_count);
-    for (auto input_chunk_id = ChunkID{0}; input_chunk_id < input_chunk_count; ++input_chunk_id) {
-      const auto& abstract_segment = _table_in->get_chunk(input_chunk_id)->get_segment(_column_id);
-      accessor_by_chunk_id[input_chunk_id] = create_segment_accessor<SortColumnType>(abstract_segment);
-    }
-
-    for (auto row_id : pos_list) {
-      const auto [chunk_id, chunk_offset] = row_id;
-
-      auto& accessor = accessor_by_chunk_id[chunk_id];
-      const auto typed_value = accessor->access(chunk_offset);
-      if (!typed_value) {
-        _null_value_rows.emplace_back(row_id, SortColumnType{});
-      } else {
-        _row_id_value_vector.emplace_back(row_id, typed_value.value());
-      }
-    }
-  }
-
-  // NOLINTBEGIN(cppcoreguidelines-avoid-const-or-ref-data-members)
-  const std::shared_ptr<const Table> _table_in;
-
-  // Column to sort by.
-  const ColumnID _column_id;
-  const SortMode _sort_mode;
-  // NOLINTEND(cppcoreguidelines-avoid-const-or-ref-data-members)
-
-  std::vector<RowIDValuePair> _row_id_value_vector;
-
-  // Stored as RowIDValuePair for better type compatibility even if value is unused.
-  std::vector<RowIDValuePair> _null_value_rows;
-};
-
 }  // namespace hyrise
@@ -18,7 +18,8 @@ namespace hyrise {
 /**
  * Operator to sort a table by one or multiple columns. This implements a stable sort, i.e., rows that share the same
  * value will maintain their relative order.
- * By passing multiple sort column definitions it is possible to sort multiple columns with one operator run.
+ * By passing multiple sort column definitions it is possible to sort multiple columns with one operator run. All sort
+ * columns are encoded into normalized keys, which are sorted in parallel (see NormalizedKeySorter in sort.cpp).
  */
 class Sort : public AbstractReadOnlyOperator {
  public:
@@ -43,12 +44,6 @@ class Sort : public AbstractReadOnlyOperator {
       std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& /*copied_ops*/) const override;
   void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
 
-  template <typename SortColumnType>
-  class SortImpl;
-
-  template <typename SortColumnType>
-  class SortImplMaterializeOutput;
-
   const std::vector<SortColumnDefinition> _sort_definitions;
   const ChunkOffset _output_chunk_size;
   const ForceMaterialization _force_materialization;
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "storage/abstract_segment.hpp"
+#include "storage/global_dictionary_utils.hpp"
+#include "storage/segment_iterate.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+/**
+ * Normalized keys encode the values of one or multiple sort columns of a row into a fixed-width byte sequence, so that
+ * comparing the keys of two rows with memcmp yields the order of the rows. They are used by the Sort and the TopK
+ * operator.
+ *
+ * Per sort column, a key holds a NULL byte (0 for NULL, 1 otherwise) followed by the normalized value. For descending
+ * columns, the value bytes are inverted. The NULL byte is never inverted, so that NULLs come first for both sort
+ * modes. Strings only contribute a prefix of NORMALIZED_KEY_STRING_PREFIX_BYTES bytes to the key. If two strings share
+ * that prefix, they have to be compared in full before the remainder of the key is compared. String columns that
+ * share a global dictionary can instead be encoded with their order-preserving value IDs (see
+ * global_dictionary_utils.hpp), which represent the strings in full.
+ */
+
+constexpr auto NORMALIZED_KEY_STRING_PREFIX_BYTES = size_t{12};
+
+template <typename ColumnDataType>
+constexpr size_t normalized_value_bytes() {
+  if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+    return NORMALIZED_KEY_STRING_PREFIX_BYTES;
+  } else {
+    return sizeof(ColumnDataType);
+  }
+}
+
+// Writes the value as a byte sequence whose lexicographical (i.e., memcmp) order matches the order of the values.
+// Numbers are written big-endian with a flipped sign bit. Negative floating-point numbers additionally have all other
+// bits flipped so that a larger magnitude results in a smaller key. Strings are represented by a zero-padded prefix.
+template <typename ColumnDataType>
+void write_normalized_value(const ColumnDataType& value, uint8_t* key) {
+  if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+    std::memcpy(key, value.data(), std::min(value.size(), NORMALIZED_KEY_STRING_PREFIX_BYTES));
+  } else {
+    static_assert(sizeof(ColumnDataType) == 4 || sizeof(ColumnDataType) == 8, "Unexpected size of sort column type.");
+    using UnsignedType = std::conditional_t<sizeof(ColumnDataType) == 4, uint32_t, uint64_t>;
+    constexpr auto SIGN_BIT = UnsignedType{1} << (sizeof(ColumnDataType) * 8 - 1);
+
+    auto bits = UnsignedType{};
+    if constexpr (std::is_same_v<ColumnDataType, ValueID>) {
+      bits = value;
+    } else if constexpr (std::is_floating_point_v<ColumnDataType>) {
+      // -0.0 and 0.0 are equal and must not be ordered by the normalized key.
+      const auto normalized_value = value == ColumnDataType{0} ? ColumnDataType{0} : value;
+      std::memcpy(&bits, &normalized_value, sizeof(bits));
+      bits = (bits & SIGN_BIT) ? ~bits : bits | SIGN_BIT;
+    } else {
+      bits = static_cast<UnsignedType>(value) ^ SIGN_BIT;
+    }
+
+    for (auto byte_index = size_t{0}; byte_index < sizeof(bits); ++byte_index) {
+      key[byte_index] = static_cast<uint8_t>(bits >> ((sizeof(bits) - 1 - byte_index) * 8));
+    }
+  }
+}
+
+// Writes the NULL byte and the normalized value of every row of the segment to `keys + chunk_offset * key_bytes`,
+// which is expected to be zero-initialized. For all non-NULL values, value_functor(chunk_offset, value) is called.
+// For ColumnDataType ValueID, the segment's column is expected to have a global dictionary.
+template <typename ColumnDataType, typename ValueFunctor>
+void write_normalized_segment(const AbstractSegment& segment, const SortMode sort_mode, uint8_t* keys,
+                              const size_t key_bytes, const ValueFunctor& value_functor) {
+  constexpr auto VALUE_BYTES = normalized_value_bytes<ColumnDataType>();
+  const auto invert = sort_mode == SortMode::Descending;
+
+  const auto write_position = [&](const auto& position) {
+    if (position.is_null()) {
+      return;
+    }
+
+    auto* const key = keys + static_cast<size_t>(position.chunk_offset()) * key_bytes;
+    key[0] = 1;
+    const auto& value = position.value();
+    write_normalized_value(value, key + 1);
+    if (invert) {
+      for (auto byte_index = size_t{1}; byte_index <= VALUE_BYTES; ++byte_index) {
+        key[byte_index] = ~key[byte_index];
+      }
+    }
+
+    value_functor(position.chunk_offset(), value);
+  };
+
+  if constexpr (std::is_same_v<ColumnDataType, ValueID>) {
+    for_each_global_value_id(segment, write_position);
+  } else {
+    segment_iterate<ColumnDataType>(segment, write_position);
+  }
+}
+
+// Returns the first eight bytes of a key as a big-endian integer, padded with zeros for shorter keys. Comparing the
+// prefixes of two keys is equivalent to comparing the first eight bytes with memcmp.
+inline uint64_t normalized_key_prefix(const uint8_t* key, const size_t key_bytes) {
+  auto key_prefix = uint64_t{0};
+  for (auto byte_index = size_t{0}; byte_index < sizeof(uint64_t); ++byte_index) {
+    key_prefix = (key_prefix << 8u) | (byte_index < key_bytes ? key[byte_index] : uint8_t{0});
+  }
+  return key_prefix;
+}
+
+}  // namespace hyrise
@@ -26,10 +26,12 @@
 #include "operators/abstract_read_only_operator.hpp"
 #include "operators/operator_scan_predicate.hpp"
 #include "operators/pqp_utils.hpp"
+#include "resolve_type.hpp"
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/job_task.hpp"
 #include "storage/chunk.hpp"
 #include "storage/pos_lists/abstract_pos_list.hpp"
+#include "storage/pos_lists/compressed_pos_list.hpp"
 #include "storage/pos_lists/entire_chunk_pos_list.hpp"
 #include "storage/pos_lists/row_id_pos_list.hpp"
 #include "storage/reference_segment.hpp"
@@ -45,6 +47,52 @@
 #include "utils/assert.hpp"
 #include "utils/lossless_predicate_cast.hpp"
 
+namespace {
+
+using namespace hyrise;  // NOLINT(build/namespaces)
+
+// Maps the matches of a scan on a ReferenceSegment to the positions they reference. If the referenced positions are
+// in a single chunk and strictly increasing (e.g., because the input PosList is a CompressedPosList), they are stored
+// as a CompressedPosList. Otherwise, a RowIDPosList is created.
+std::shared_ptr<AbstractPosList> dereference_matches(const std::vector<ChunkOffset>& matches,
+                                                     const std::shared_ptr<const AbstractPosList>& pos_list_in) {
+  const auto match_count = matches.size();
+  if (pos_list_in->references_single_chunk()) {
+    auto offsets = std::vector<ChunkOffset>(match_count);
+    auto is_strictly_increasing = true;
+    resolve_pos_list_type(pos_list_in, [&](const auto& typed_pos_list) {
+      for (auto index = size_t{0}; index < match_count; ++index) {
+        offsets[index] = (*typed_pos_list)[matches[index]].chunk_offset;
+        if (index > 0 && offsets[index] <= offsets[index - 1]) {
+          is_strictly_increasing = false;
+        }
+      }
+    });
+
+    if (is_strictly_increasing) {
+      return std::make_shared<CompressedPosList>(pos_list_in->common_chunk_id(), std::move(offsets));
+    }
+
+    auto row_ids = std::make_shared<RowIDPosList>(match_count);
+    row_ids->guarantee_single_chunk();
+    const auto chunk_id = pos_list_in->common_chunk_id();
+    for (auto index = size_t{0}; index < match_count; ++index) {
+      (*row_ids)[index] = RowID{chunk_id, offsets[index]};
+    }
+    return row_ids;
+  }
+
+  auto row_ids = std::make_shared<RowIDPosList>(match_count);
+  resolve_pos_list_type(pos_list_in, [&](const auto& typed_pos_list) {
+    for (auto index = size_t{0}; index < match_count; ++index) {
+      (*row_ids)[index] = (*typed_pos_list)[matches[index]];
+    }
+  });
+  return row_ids;
+}
+
+}  // namespace
+
 namespace hyrise {
 
 using namespace expression_functional;  // NOLINT(build/namespaces)
@@ -133,8 +181,8 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
     // chunk_in – Copy by value since copy by reference is not possible due to the limited scope of the for-iteration.
     auto perform_table_scan = [this, chunk_id, chunk_in, &in_table, &output_mutex, &output_chunks]() {
       // The actual scan happens in the sub classes of BaseTableScanImpl
-      const auto matches_out = _impl->scan_chunk(chunk_id);
-      if (matches_out->empty()) {
+      auto matches_out = _impl->scan_chunk(chunk_id);
+      if (matches_out.empty()) {
         return;
       }
 
@@ -143,24 +191,25 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
       out_segments.reserve(column_count);
 
       /**
-       * matches_out contains a list of row IDs into this chunk. If this is not a reference table, we can directly use
-       * the matches to construct the reference segments of the output. If it is a reference segment, we need to
-       * resolve the row IDs so that they reference the physical data segments (value, dictionary) instead, since we
-       * don’t allow multi-level referencing. To save time and space, we want to share position lists between segments
-       * as much as possible. Position lists can be shared between two segments iff (a) they point to the same table
-       * and (b) the reference segments of the input table point to the same positions in the same order (i.e. they
-       * share their position list).
+       * matches_out contains the offsets of the matching rows in this chunk. If this is not a reference table, we can
+       * directly use the matches to construct the reference segments of the output. If it is a reference segment, we
+       * need to resolve the offsets so that they reference the physical data segments (value, dictionary) instead,
+       * since we don’t allow multi-level referencing. To save time and space, we want to share position lists between
+       * segments as much as possible. Position lists can be shared between two segments iff (a) they point to the same
+       * table and (b) the reference segments of the input table point to the same positions in the same order (i.e.
+       * they share their position list).
        */
       auto keep_chunk_sort_order = true;
       if (in_table->type() == TableType::References) {
-        if (matches_out->size() == chunk_in->size()) {
+        if (matches_out.size() == chunk_in->size()) {
           // Shortcut - the entire input reference segment matches, so we can simply forward that chunk
           for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
             const auto segment_in = chunk_in->get_segment(column_id);
             out_segments.emplace_back(segment_in);
           }
         } else {
-          auto filtered_pos_lists = std::map<std::shared_ptr<const AbstractPosList>, std::shared_ptr<RowIDPosList>>{};
+          auto filtered_pos_lists =
+              std::map<std::shared_ptr<const AbstractPosList>, std::shared_ptr<const AbstractPosList>>{};
 
           for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
             const auto segment_in = chunk_in->get_segment(column_id);
@@ -176,10 +225,7 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
             auto& filtered_pos_list = filtered_pos_lists[pos_list_in];
 
             if (!filtered_pos_list) {
-              filtered_pos_list = std::make_shared<RowIDPosList>(matches_out->size());
-              if (pos_list_in->references_single_chunk()) {
-                filtered_pos_list->guarantee_single_chunk();
-              } else {
+              if (!pos_list_in->references_single_chunk()) {
                 // When segments reference multiple chunks, we do not keep the sort order of the input chunk. The main
                 // reason is that several table scan implementations split the pos lists by chunks (see
                 // AbstractDereferencedColumnTableScanImpl::_scan_reference_segment) and thus shuffle the data. While
@@ -187,12 +233,7 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
                 keep_chunk_sort_order = false;
               }
 
-              auto offset = size_t{0};
-              for (const auto& match : *matches_out) {
-                const auto row_id = (*pos_list_in)[match.chunk_offset];
-                (*filtered_pos_list)[offset] = row_id;
-                ++offset;
-              }
+              filtered_pos_list = dereference_matches(matches_out, pos_list_in);
             }
 
             const auto ref_segment_out =
@@ -201,13 +242,15 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
           }
         }
       } else {
-        matches_out->guarantee_single_chunk();
-
-        // If the entire chunk is matched, create an EntireChunkPosList instead
-        const auto output_pos_list = matches_out->size() == chunk_in->size()
-                                         ? static_cast<std::shared_ptr<AbstractPosList>>(
-                                               std::make_shared<EntireChunkPosList>(chunk_id, chunk_in->size()))
-                                         : static_cast<std::shared_ptr<AbstractPosList>>(matches_out);
+        // Scans on data segments emit their matches in the order of the chunk offsets. They are stored as a
+        // CompressedPosList, which requires at most half the memory of a RowIDPosList. If the entire chunk is matched,
+        // create an EntireChunkPosList instead.
+        const auto output_pos_list =
+            matches_out.size() == chunk_in->size()
+                ? static_cast<std::shared_ptr<AbstractPosList>>(
+                      std::make_shared<EntireChunkPosList>(chunk_id, chunk_in->size()))
+                : static_cast<std::shared_ptr<AbstractPosList>>(
+                      std::make_shared<CompressedPosList>(chunk_id, std::move(matches_out)));
 
         for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
           const auto ref_segment_out = std::make_shared<ReferenceSegment>(in_table, column_id, output_pos_list);
@@ -240,6 +283,7 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
   scan_performance_data.num_chunks_with_early_out = _impl->num_chunks_with_early_out.load();
   scan_performance_data.num_chunks_with_all_rows_matching = _impl->num_chunks_with_all_rows_matching.load();
   scan_performance_data.num_chunks_with_binary_search = _impl->num_chunks_with_binary_search.load();
+  scan_performance_data.num_blocks_skipped = _impl->num_blocks_skipped.load();
 
   return std::make_shared<Table>(in_table->column_definitions(), TableType::References, std::move(output_chunks));
 }
@@ -57,6 +57,7 @@ class TableScan : public AbstractReadOnlyOperator {
     std::atomic_size_t num_chunks_with_early_out{0};
     std::atomic_size_t num_chunks_with_all_rows_matching{0};
     std::atomic_size_t num_chunks_with_binary_search{0};
+    std::atomic_size_t num_blocks_skipped{0};
 
     void output_to_stream(std::ostream& stream, DescriptionMode description_mode) const override {
       OperatorPerformanceData<AbstractOperatorPerformanceData::NoSteps>::output_to_stream(stream, description_mode);
@@ -65,6 +66,7 @@ class TableScan : public AbstractReadOnlyOperator {
       stream << separator << "Chunks: " << num_chunks_with_early_out.load() << " skipped with no results, ";
       stream << separator << num_chunks_with_all_rows_matching.load() << " skipped with all matching, ";
       stream << num_chunks_with_binary_search.load() << " scanned using binary search.";
+      stream << separator << "Blocks: " << num_blocks_skipped.load() << " skipped using zone maps.";
     }
   };
 
@@ -1,8 +1,9 @@
 #include "abstract_dereferenced_column_table_scan_impl.hpp"
 
 #include <memory>
+#include <vector>
 
-#include "storage/pos_lists/row_id_pos_list.hpp"
+#include "storage/chunk.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/split_pos_list_by_chunk_id.hpp"
 #include "storage/table.hpp"
@@ -15,29 +16,37 @@ AbstractDereferencedColumnTableScanImpl::AbstractDereferencedColumnTableScanImpl
     const PredicateCondition init_predicate_condition)
     : predicate_condition(init_predicate_condition), _in_table(in_table), _column_id(column_id) {}
 
-std::shared_ptr<RowIDPosList> AbstractDereferencedColumnTableScanImpl::scan_chunk(const ChunkID chunk_id) {
+std::vector<ChunkOffset> AbstractDereferencedColumnTableScanImpl::scan_chunk(const ChunkID chunk_id) {
   const auto chunk = _in_table->get_chunk(chunk_id);
   const auto& segment = chunk->get_segment(_column_id);
 
-  auto matches = std::make_shared<RowIDPosList>();
+  auto matches = std::vector<ChunkOffset>{};
 
   if (const auto& reference_segment = std::dynamic_pointer_cast<ReferenceSegment>(segment)) {
-    _scan_reference_segment(*reference_segment, chunk_id, *matches);
+    _scan_reference_segment(*reference_segment, chunk_id, matches);
+  } else if (_chunk_can_be_skipped(*chunk, _column_id)) {
+    ++num_chunks_with_early_out;
   } else {
-    _scan_non_reference_segment(*segment, chunk_id, *matches, nullptr);
+    _scan_non_reference_segment(*segment, chunk_id, matches, nullptr);
   }
 
   return matches;
 }
 
 void AbstractDereferencedColumnTableScanImpl::_scan_reference_segment(const ReferenceSegment& segment,
-                                                                      const ChunkID chunk_id, RowIDPosList& matches) {
+                                                                      const ChunkID chunk_id,
+                                                                      std::vector<ChunkOffset>& matches) {
   const auto& pos_list = segment.pos_list();
 
   if (pos_list->references_single_chunk() && !pos_list->empty()) {
     // Fast path :)
 
     const auto chunk = segment.referenced_table()->get_chunk(pos_list->common_chunk_id());
+    if (_chunk_can_be_skipped(*chunk, segment.referenced_column_id())) {
+      ++num_chunks_with_early_out;
+      return;
+    }
+
     auto referenced_segment = chunk->get_segment(segment.referenced_column_id());
 
     _scan_non_reference_segment(*referenced_segment, chunk_id, matches, pos_list);
@@ -58,6 +67,10 @@ void AbstractDereferencedColumnTableScanImpl::_scan_reference_segment(const Refe
     }
 
     const auto chunk = segment.referenced_table()->get_chunk(referenced_chunk_id);
+    if (_chunk_can_be_skipped(*chunk, segment.referenced_column_id())) {
+      continue;
+    }
+
     auto referenced_segment = chunk->get_segment(segment.referenced_column_id());
 
     const auto num_previous_matches = matches.size();
@@ -68,9 +81,14 @@ void AbstractDereferencedColumnTableScanImpl::_scan_reference_segment(const Refe
     // that:
     for (auto match_idx = static_cast<ChunkOffset>(num_previous_matches);
          match_idx < static_cast<ChunkOffset>(matches.size()); ++match_idx) {
-      matches[match_idx].chunk_offset = sub_pos_list.original_positions[matches[match_idx].chunk_offset];
+      matches[match_idx] = sub_pos_list.original_positions[matches[match_idx]];
     }
   }
 }
 
+bool AbstractDereferencedColumnTableScanImpl::_chunk_can_be_skipped(const Chunk& /*chunk*/,
+                                                                    const ColumnID /*column_id*/) const {
+  return false;
+}
+
 }  // namespace hyrise
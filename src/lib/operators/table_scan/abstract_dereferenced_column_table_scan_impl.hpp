@@ -3,12 +3,14 @@
 #include <memory>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "abstract_table_scan_impl.hpp"
 #include "types.hpp"
 
 namespace hyrise {
 
+class Chunk;
 class Table;
 class ReferenceSegment;
 class AbstractSegment;
@@ -26,21 +28,28 @@ class AbstractDereferencedColumnTableScanImpl : public AbstractTableScanImpl {
   AbstractDereferencedColumnTableScanImpl(const std::shared_ptr<const Table>& in_table, const ColumnID column_id,
                                           const PredicateCondition init_predicate_condition);
 
-  std::shared_ptr<RowIDPosList> scan_chunk(const ChunkID chunk_id) override;
+  std::vector<ChunkOffset> scan_chunk(const ChunkID chunk_id) override;
 
   const PredicateCondition predicate_condition;
 
  protected:
-  void _scan_reference_segment(const ReferenceSegment& segment, const ChunkID chunk_id, RowIDPosList& matches);
+  void _scan_reference_segment(const ReferenceSegment& segment, const ChunkID chunk_id,
+                               std::vector<ChunkOffset>& matches);
 
   // Implemented by the separate Impls. They do not need to deal with ReferenceSegments anymore, as this class
   // takes care of that. We take `matches` as an in/out parameter instead of returning it because scans on multiple
-  // referenced segments of a single ReferenceSegment should result in only one PosList. Storing it as a member is
-  // no option because it would break multithreading.
+  // referenced segments of a single ReferenceSegment should result in only one list of matches. Storing it as a member
+  // is no option because it would break multithreading.
   virtual void _scan_non_reference_segment(const AbstractSegment& segment, const ChunkID chunk_id,
-                                           RowIDPosList& matches,
+                                           std::vector<ChunkOffset>& matches,
                                            const std::shared_ptr<const AbstractPosList>& position_filter) = 0;
 
+  // Returns true if the pruning statistics of a (referenced) chunk guarantee that no row of the segment at column_id
+  // matches. Chunks that can be pruned based on the query plan are already excluded by the ChunkPruningRule. This
+  // check targets values that only become known during execution, e.g., correlated parameters of subqueries. By
+  // default, no chunk is skipped.
+  virtual bool _chunk_can_be_skipped(const Chunk& chunk, const ColumnID column_id) const;
+
   const std::shared_ptr<const Table> _in_table;
   const ColumnID _column_id;
 };
@@ -1,7 +1,10 @@
 #pragma once
 
+#include <cstddef>
 #include <memory>
+#include <optional>
 #include <string>
+#include <vector>
 
 #ifdef __AVX512VL__
 #include <x86intrin.h>
@@ -10,10 +13,13 @@
 #include <array>
 #include <atomic>
 
+#include "all_type_variant.hpp"
 #include "operators/operator_performance_data.hpp"
-#include "storage/pos_lists/row_id_pos_list.hpp"
+#include "storage/abstract_encoded_segment.hpp"
+#include "storage/pos_lists/abstract_pos_list.hpp"
 #include "storage/segment_iterables.hpp"
 #include "storage/segment_iterables/any_segment_iterator.hpp"
+#include "storage/segment_zone_map.hpp"
 #include "types.hpp"
 #include "utils/performance_warning.hpp"
 
@@ -28,13 +34,70 @@ class AbstractTableScanImpl {
 
   virtual std::string description() const = 0;
 
-  virtual std::shared_ptr<RowIDPosList> scan_chunk(ChunkID chunk_id) = 0;
+  // Returns the offsets of the matching rows within the chunk. For data segments, the offsets are strictly increasing
+  // so that the TableScan can store them in a CompressedPosList as they are. For ReferenceSegments, the offsets are
+  // positions within the segment's PosList.
+  virtual std::vector<ChunkOffset> scan_chunk(ChunkID chunk_id) = 0;
 
   std::atomic_size_t num_chunks_with_early_out{0};
   std::atomic_size_t num_chunks_with_all_rows_matching{0};
   std::atomic_size_t num_chunks_with_binary_search{0};
+  std::atomic_size_t num_blocks_skipped{0};
 
  protected:
+  /**
+   * @defgroup Block skipping using the zone maps of encoded segments (see segment_zone_map.hpp)
+   * @{
+   */
+
+  // Returns the ranges of chunk offsets that might contain matches or std::nullopt if the entire segment has to be
+  // scanned. The latter is the case if the segment has no zone map, if no block can be skipped, or if a position filter
+  // is given (we do not split position filters by block, as they are usually small compared to the segment).
+  std::optional<std::vector<ChunkOffsetRange>> _qualifying_ranges(
+      const AbstractSegment& segment, const std::shared_ptr<const AbstractPosList>& position_filter,
+      const PredicateCondition predicate_condition, const AllTypeVariant& value,
+      const std::optional<AllTypeVariant>& value2 = std::nullopt) {
+    const auto* encoded_segment = dynamic_cast<const AbstractEncodedSegment*>(&segment);
+    if (position_filter || !encoded_segment || !encoded_segment->zone_map()) {
+      return std::nullopt;
+    }
+
+    const auto& zone_map = *encoded_segment->zone_map();
+    auto ranges = zone_map.qualifying_ranges(predicate_condition, value, value2);
+
+    auto qualifying_row_count = size_t{0};
+    for (const auto& range : ranges) {
+      qualifying_row_count += range.end - range.begin;
+    }
+    if (qualifying_row_count == zone_map.segment_size()) {
+      return std::nullopt;
+    }
+
+    const auto skipped_block_count =
+        zone_map.block_count() - (qualifying_row_count + BaseSegmentZoneMap::BLOCK_SIZE - 1) /
+                                     BaseSegmentZoneMap::BLOCK_SIZE;
+    num_blocks_skipped += skipped_block_count;
+    return ranges;
+  }
+
+  // Calls `functor` with the begin and end iterators of each range. If no ranges are given, `functor` is called once
+  // for the entire segment. The iterators must not be filtered by a position list, so that iterator positions are
+  // chunk offsets.
+  template <typename Iterator, typename Functor>
+  static void _for_each_range(const std::optional<std::vector<ChunkOffsetRange>>& ranges, const Iterator& begin,
+                              const Iterator& end, const Functor& functor) {
+    if (!ranges) {
+      functor(begin, end);
+      return;
+    }
+
+    for (const auto& range : *ranges) {
+      functor(begin + static_cast<std::ptrdiff_t>(range.begin), begin + static_cast<std::ptrdiff_t>(range.end));
+    }
+  }
+
+  /**@}*/
+
   /**
    * @defgroup The hot loop of the table scan
    * @{
@@ -42,10 +105,10 @@ class AbstractTableScanImpl {
 
   template <bool CheckForNull, typename BinaryFunctor, typename LeftIterator>
   static void _scan_with_iterators(const BinaryFunctor func, LeftIterator left_it, const LeftIterator left_end,
-                                   const ChunkID chunk_id, RowIDPosList& matches_out) {
+                                   std::vector<ChunkOffset>& matches_out) {
     // Can't use a default argument for this because default arguments are non-type deduced contexts
     auto false_type = std::false_type{};
-    _scan_with_iterators<CheckForNull>(func, left_it, left_end, chunk_id, matches_out, false_type);
+    _scan_with_iterators<CheckForNull>(func, left_it, left_end, matches_out, false_type);
   }
 
   template <bool CheckForNull, typename BinaryFunctor, typename LeftIterator, typename RightIterator>
@@ -54,14 +117,14 @@ class AbstractTableScanImpl {
   // itself.
   static void __attribute__((hot, flatten, noinline))
   _scan_with_iterators(const BinaryFunctor func, LeftIterator left_it, const LeftIterator left_end,
-                       const ChunkID chunk_id, RowIDPosList& matches_out, [[maybe_unused]] RightIterator right_it) {
+                       std::vector<ChunkOffset>& matches_out, [[maybe_unused]] RightIterator right_it) {
     // The major part of the table is scanned using SIMD. Only the remainder is handled in this method.
     // For a description of the SIMD code, have a look at the comments in that method.
     // To reduce compile time, SIMD scanning is not used for for ColumnVsColumnScans. Also, string comparisons are more
     // expensive than the scan itself, so we disable SIMD for these, too.
     if constexpr (std::is_same_v<RightIterator, std::false_type> &&
                   !std::is_same_v<std::decay_t<decltype(left_it->value())>, pmr_string>) {
-      _simd_scan_with_iterators<CheckForNull>(func, left_it, left_end, chunk_id, matches_out, right_it);
+      _simd_scan_with_iterators<CheckForNull>(func, left_it, left_end, matches_out, right_it);
     }
 
     // Do the remainder the easy way. If we did not use the SIMD optimization above, left_it was not yet touched, so we
@@ -70,12 +133,12 @@ class AbstractTableScanImpl {
       const auto left = *left_it;
       if constexpr (std::is_same_v<RightIterator, std::false_type>) {
         if ((!CheckForNull || !left.is_null()) && func(left)) {
-          matches_out.emplace_back(chunk_id, left.chunk_offset());
+          matches_out.emplace_back(left.chunk_offset());
         }
       } else {
         const auto right = *right_it;
         if ((!CheckForNull || (!left.is_null() && !right.is_null())) && func(left, right)) {
-          matches_out.emplace_back(chunk_id, left.chunk_offset());
+          matches_out.emplace_back(left.chunk_offset());
         }
         ++right_it;
       }
@@ -84,7 +147,7 @@ class AbstractTableScanImpl {
 
   template <bool CheckForNull, typename BinaryFunctor, typename LeftIterator, typename RightIterator>
   static void _simd_scan_with_iterators(const BinaryFunctor func, LeftIterator& left_it, const LeftIterator left_end,
-                                        const ChunkID chunk_id, RowIDPosList& matches_out,
+                                        std::vector<ChunkOffset>& matches_out,
                                         [[maybe_unused]] RightIterator& right_it) {
     // Concept: Partition the vector into blocks of BLOCK_SIZE entries. The remainder is handled by the caller without
     // optimization. We first check if the rows match and set the `mask` to 1 at the appropriate positions.
@@ -112,7 +175,7 @@ class AbstractTableScanImpl {
     auto matches_out_index = matches_out.size();
 
     // Make sure that we have enough space for the first iteration. We might resize later on.
-    matches_out.resize(matches_out.size() + BLOCK_SIZE, RowID{chunk_id, ChunkOffset{0}});
+    matches_out.resize(matches_out.size() + BLOCK_SIZE);
 
     // As we access the offsets after we already moved the iterator, we need a copy of it. Creating this copy outside
     // of the while loop keeps the surprisingly high costs for copying an iterator to a minimum.
@@ -197,7 +260,7 @@ class AbstractTableScanImpl {
       // "Slow" path for non-AVX512VL systems
       for (auto index = size_t{0}; index < BLOCK_SIZE; ++index) {
         if (mask >> index & 1) {
-          matches_out[matches_out_index++].chunk_offset = offsets[index];
+          matches_out[matches_out_index++] = offsets[index];
         }
       }
 
@@ -221,7 +284,7 @@ class AbstractTableScanImpl {
       #pragma omp simd safelen(BLOCK_SIZE)
       // clang-format on
       for (auto index = size_t{0}; index < BLOCK_SIZE; ++index) {
-        matches_out[matches_out_index + index].chunk_offset = (reinterpret_cast<ChunkOffset*>(&offsets_simd))[index];
+        matches_out[matches_out_index + index] = (reinterpret_cast<ChunkOffset*>(&offsets_simd))[index];
       }
 
       // Count the number of matches and increase the index of the next write to matches_out accordingly
@@ -231,7 +294,7 @@ class AbstractTableScanImpl {
       // As we write directly into the matches_out vector, we have to make sure that is big enough. We grow the vector
       // more aggressively than its default behavior as the potentially wasted space is only ephemeral.
       if (matches_out_index + BLOCK_SIZE >= matches_out.size()) {
-        matches_out.resize((BLOCK_SIZE + matches_out.size()) * 3, RowID{chunk_id, ChunkOffset{0}});
+        matches_out.resize((BLOCK_SIZE + matches_out.size()) * 3);
       }
     }
 
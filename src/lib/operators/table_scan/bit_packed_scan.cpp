@@ -0,0 +1,159 @@
+#include "bit_packed_scan.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "storage/vector_compression/bitpacking/bitpacking_vector.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT(build/namespaces)
+
+constexpr auto BLOCK_SIZE = size_t{64};
+
+// The BitPackingCompressor uses between 1 and 32 bits per value ID.
+constexpr auto MAX_BIT_WIDTH = uint32_t{32};
+
+template <uint32_t BIT_WIDTH>
+void scan_blocks(const uint64_t* words, const size_t block_count, const uint32_t lower_bound_value_id,
+                 const uint32_t value_id_range_size, const bool invert, const uint32_t null_value_id,
+                 uint64_t* bitmap) {
+  constexpr auto VALUE_ID_MASK = (uint64_t{1} << BIT_WIDTH) - 1;
+
+  for (auto block_index = size_t{0}; block_index < block_count; ++block_index) {
+    const auto* block_words = words + block_index * BIT_WIDTH;
+    auto block_bitmap = uint64_t{0};
+
+    // We do not use the OpenMP runtime, but only the compiler pragmas (look up -fopenmp-simd). As BIT_WIDTH is known
+    // at compile time, the offsets of all value IDs within the block are constant.
+
+    // This empty block is used to convince clang-format to keep the pragma indented.
+    // NOLINTNEXTLINE
+    {}  // clang-format off
+    #pragma omp simd reduction(|:block_bitmap)
+    // clang-format on
+    for (auto index = uint32_t{0}; index < BLOCK_SIZE; ++index) {
+      const auto bit_offset = index * BIT_WIDTH;
+      const auto word_index = bit_offset / 64;
+      const auto shift = bit_offset % 64;
+
+      // Value IDs that span two words take their upper bits from the next word. For all other value IDs, these bits
+      // are masked out. The next word index is clamped so that we never read past the block, and shifting twice
+      // avoids an undefined shift by 64 bits if `shift` is zero.
+      const auto next_word_index = std::min(word_index + 1, BIT_WIDTH - 1);
+      const auto value_id = static_cast<uint32_t>(
+          ((block_words[word_index] >> shift) | ((block_words[next_word_index] << 1u) << (63 - shift))) &
+          VALUE_ID_MASK);
+
+      // (x >= a && x < b) === ((x - a) < (b - a)), see ColumnBetweenTableScanImpl::_scan_dictionary_segment().
+      const auto in_range = (value_id - lower_bound_value_id) < value_id_range_size;
+      const auto matches = (in_range != invert) & (value_id != null_value_id);
+      block_bitmap |= static_cast<uint64_t>(matches) << index;
+    }
+
+    bitmap[block_index] = block_bitmap;
+  }
+}
+
+// Calls `functor` with an std::integral_constant holding `bit_width`, so that the kernel can be instantiated for it.
+template <typename Functor, uint32_t... BitWidthOffsets>
+void resolve_bit_width(const uint32_t bit_width, const Functor& functor,
+                       std::integer_sequence<uint32_t, BitWidthOffsets...> /*bit_width_offsets*/) {
+  const auto resolved =
+      ((bit_width == BitWidthOffsets + 1 &&
+        (functor(std::integral_constant<uint32_t, BitWidthOffsets + 1>{}), true)) ||
+       ...);
+  Assert(resolved, "Unsupported bit width: " + std::to_string(bit_width));
+}
+
+}  // namespace
+
+namespace hyrise {
+
+std::vector<uint64_t> scan_bit_packed_vector(const BitPackingVector& attribute_vector,
+                                             const ValueID lower_bound_value_id, const ValueID upper_bound_value_id,
+                                             const bool invert, const ValueID null_value_id) {
+  const auto size = static_cast<ChunkOffset::base_type>(attribute_vector.data().size());
+  return scan_bit_packed_vector(attribute_vector, lower_bound_value_id, upper_bound_value_id, invert, null_value_id,
+                                {ChunkOffsetRange{ChunkOffset{0}, ChunkOffset{size}}});
+}
+
+std::vector<uint64_t> scan_bit_packed_vector(const BitPackingVector& attribute_vector,
+                                             const ValueID lower_bound_value_id, const ValueID upper_bound_value_id,
+                                             const bool invert, const ValueID null_value_id,
+                                             const std::vector<ChunkOffsetRange>& ranges) {
+  DebugAssert(lower_bound_value_id <= upper_bound_value_id, "Invalid value ID range.");
+
+  const auto& data = attribute_vector.data();
+  const auto size = data.size();
+  const auto bit_width = static_cast<uint32_t>(data.bits());
+  auto bitmap = std::vector<uint64_t>((size + BLOCK_SIZE - 1) / BLOCK_SIZE);
+
+  const auto lower_bound = static_cast<uint32_t>(lower_bound_value_id);
+  const auto range_size = static_cast<uint32_t>(upper_bound_value_id) - lower_bound;
+  const auto null_value = static_cast<uint32_t>(null_value_id);
+
+  for (const auto& range : ranges) {
+    const auto range_begin = static_cast<size_t>(range.begin);
+    const auto range_end = static_cast<size_t>(range.end);
+    DebugAssert(range_begin % BLOCK_SIZE == 0 && range_end <= size, "Invalid range.");
+
+    // As a block of 64 value IDs occupies exactly bit_width words, the first block of the range starts at word
+    // first_block * bit_width.
+    const auto first_block = range_begin / BLOCK_SIZE;
+    const auto block_count = (range_end - range_begin) / BLOCK_SIZE;
+
+    resolve_bit_width(
+        bit_width,
+        [&](const auto resolved_bit_width) {
+          scan_blocks<decltype(resolved_bit_width)::value>(data.get() + (first_block * bit_width), block_count,
+                                                           lower_bound, range_size, invert, null_value,
+                                                           bitmap.data() + first_block);
+        },
+        std::make_integer_sequence<uint32_t, MAX_BIT_WIDTH>{});
+
+    // Scalar fallback for the value IDs that do not fill an entire block.
+    for (auto offset = range_begin + (block_count * BLOCK_SIZE); offset < range_end; ++offset) {
+      const auto value_id = static_cast<uint32_t>(data[offset]);
+      const auto in_range = (value_id - lower_bound) < range_size;
+      const auto matches = (in_range != invert) && value_id != null_value;
+      bitmap[offset / BLOCK_SIZE] |= static_cast<uint64_t>(matches) << (offset % BLOCK_SIZE);
+    }
+  }
+
+  return bitmap;
+}
+
+void append_bitmap_matches(const std::vector<uint64_t>& bitmap, std::vector<ChunkOffset>& matches) {
+  auto match_count = size_t{0};
+  for (const auto word : bitmap) {
+    match_count += std::popcount(word);
+  }
+
+  // `matches` might already contain entries if it is called multiple times by
+  // AbstractDereferencedColumnTableScanImpl::_scan_reference_segment.
+  auto matches_index = matches.size();
+  matches.resize(matches.size() + match_count);
+
+  const auto word_count = bitmap.size();
+  for (auto word_index = size_t{0}; word_index < word_count; ++word_index) {
+    auto word = bitmap[word_index];
+    while (word != 0) {
+      const auto chunk_offset = word_index * BLOCK_SIZE + std::countr_zero(word);
+      matches[matches_index] = ChunkOffset{static_cast<ChunkOffset::base_type>(chunk_offset)};
+      ++matches_index;
+      // Clear the lowest set bit.
+      word &= word - 1;
+    }
+  }
+}
+
+}  // namespace hyrise
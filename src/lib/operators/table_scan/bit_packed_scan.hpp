@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storage/segment_zone_map.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+class BitPackingVector;
+
+/**
+ * Scan kernel for dictionary segments whose attribute vector is a BitPackingVector. Instead of decompressing the value
+ * IDs one at a time through the iterators of the compact_vector, the kernel extracts and compares the value IDs
+ * directly from the packed 64-bit words.
+ *
+ * The attribute vector is processed in blocks of 64 value IDs. As all value IDs have the same bit width b, a block
+ * always occupies exactly b words and starts at a word boundary. Within a block, the bit offset of each value ID is a
+ * compile-time constant for a given b. Hence, the kernel is instantiated for all possible bit widths, and the compiler
+ * unrolls and vectorizes the extraction and comparison of the 64 value IDs (using AVX2 or AVX-512 if available, see
+ * -march=native and -fopenmp-simd in the top-level CMakeLists.txt). The remaining value IDs that do not fill an entire
+ * block are compared one by one.
+ *
+ * For each block, the result is a 64-bit match bitmap, where bit i is set if the i-th value ID of the block matches.
+ */
+
+// Returns a bitmap with one bit per entry of the attribute vector. An entry matches if its value ID is in
+// [lower_bound_value_id, upper_bound_value_id). If `invert` is set, it matches if the value ID is not in that range.
+// Entries with a value ID of `null_value_id` never match.
+std::vector<uint64_t> scan_bit_packed_vector(const BitPackingVector& attribute_vector, ValueID lower_bound_value_id,
+                                             ValueID upper_bound_value_id, bool invert, ValueID null_value_id);
+
+// Same as above, but only scans the entries within the given ranges (e.g., the qualifying blocks of a zone map). The
+// bits of all other entries are not set. Ranges must begin at a multiple of 64.
+std::vector<uint64_t> scan_bit_packed_vector(const BitPackingVector& attribute_vector, ValueID lower_bound_value_id,
+                                             ValueID upper_bound_value_id, bool invert, ValueID null_value_id,
+                                             const std::vector<ChunkOffsetRange>& ranges);
+
+// Appends the ChunkOffset of each set bit of the bitmap to `matches`. Bit i of bitmap[n] represents
+// ChunkOffset{n * 64 + i}.
+void append_bitmap_matches(const std::vector<uint64_t>& bitmap, std::vector<ChunkOffset>& matches);
+
+}  // namespace hyrise
@@ -1,21 +1,26 @@
 #include "column_between_table_scan_impl.hpp"
 
+#include <cstddef>
 #include <memory>
+#include <optional>
 #include <string>
 #include <type_traits>
+#include <vector>
 
 #include "abstract_dereferenced_column_table_scan_impl.hpp"
 #include "all_type_variant.hpp"
+#include "bit_packed_scan.hpp"
 #include "resolve_type.hpp"
 #include "sorted_segment_search.hpp"
 #include "storage/base_dictionary_segment.hpp"
 #include "storage/chunk.hpp"
 #include "storage/create_iterable_from_segment.hpp"
 #include "storage/pos_lists/abstract_pos_list.hpp"
-#include "storage/pos_lists/row_id_pos_list.hpp"
 #include "storage/segment_iterables/create_iterable_from_attribute_vector.hpp"
 #include "storage/segment_iterate.hpp"
+#include "storage/segment_zone_map.hpp"
 #include "storage/table.hpp"
+#include "storage/vector_compression/bitpacking/bitpacking_vector.hpp"
 #include "type_comparison.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
@@ -30,7 +35,7 @@ ColumnBetweenTableScanImpl::ColumnBetweenTableScanImpl(const std::shared_ptr<con
       left_value{init_left_value},
       right_value{init_right_value},
       _column_is_nullable{in_table->column_is_nullable(column_id)} {
-  const auto column_data_type = in_table->column_data_type(column_id);
+  const auto column_data_type = storage_data_type(in_table->column_data_type(column_id));
   Assert(column_data_type == data_type_from_all_type_variant(left_value), "Type of lower bound has to match column");
   Assert(column_data_type == data_type_from_all_type_variant(right_value), "Type of upper bound has to match column");
 }
@@ -40,8 +45,15 @@ std::string ColumnBetweenTableScanImpl::description() const {
 }
 
 void ColumnBetweenTableScanImpl::_scan_non_reference_segment(
-    const AbstractSegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
+    const AbstractSegment& segment, const ChunkID chunk_id, std::vector<ChunkOffset>& matches,
     const std::shared_ptr<const AbstractPosList>& position_filter) {
+  // Skip the blocks of the segment that cannot contain matches according to its zone map.
+  const auto ranges = _qualifying_ranges(segment, position_filter, predicate_condition, left_value, right_value);
+  if (ranges && ranges->empty()) {
+    ++num_chunks_with_early_out;
+    return;
+  }
+
   const auto& chunk_sorted_by = _in_table->get_chunk(chunk_id)->individually_sorted_by();
 
   // Check if a sorted scan is possible for the current predicate. Do not use the sorted search for predicates on
@@ -53,7 +65,7 @@ void ColumnBetweenTableScanImpl::_scan_non_reference_segment(
       (!dictionary_segment || !position_filter || _in_table->column_data_type(_column_id) != DataType::String)) {
     for (const auto& sorted_by : chunk_sorted_by) {
       if (sorted_by.column == _column_id) {
-        _scan_sorted_segment(segment, chunk_id, matches, position_filter, sorted_by.sort_mode);
+        _scan_sorted_segment(segment, matches, position_filter, sorted_by.sort_mode, ranges);
         return;
       }
     }
@@ -61,15 +73,16 @@ void ColumnBetweenTableScanImpl::_scan_non_reference_segment(
 
   // Select optimized or generic scanning implementation based on segment type
   if (dictionary_segment) {
-    _scan_dictionary_segment(*dictionary_segment, chunk_id, matches, position_filter);
+    _scan_dictionary_segment(*dictionary_segment, matches, position_filter, ranges);
   } else {
-    _scan_generic_segment(segment, chunk_id, matches, position_filter);
+    _scan_generic_segment(segment, matches, position_filter, ranges);
   }
 }
 
 void ColumnBetweenTableScanImpl::_scan_generic_segment(
-    const AbstractSegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
-    const std::shared_ptr<const AbstractPosList>& position_filter) const {
+    const AbstractSegment& segment, std::vector<ChunkOffset>& matches,
+    const std::shared_ptr<const AbstractPosList>& position_filter,
+    const std::optional<std::vector<ChunkOffsetRange>>& ranges) const {
   segment_with_iterators_filtered(segment, position_filter, [&](auto it, [[maybe_unused]] const auto end) {
     using ColumnDataType = typename decltype(it)::ValueType;
 
@@ -85,7 +98,9 @@ void ColumnBetweenTableScanImpl::_scan_generic_segment(
         auto between_comparator = [&](const auto& position) {
           return between_comparator_function(position.value(), typed_left_value, typed_right_value);
         };
-        _scan_with_iterators<true>(between_comparator, it, end, chunk_id, matches);
+        _for_each_range(ranges, it, end, [&](auto range_begin, auto range_end) {
+          _scan_with_iterators<true>(between_comparator, range_begin, range_end, matches);
+        });
       });
     } else {
       Fail("Dictionary and Reference segments have their own code paths and should be handled there");
@@ -94,8 +109,9 @@ void ColumnBetweenTableScanImpl::_scan_generic_segment(
 }
 
 void ColumnBetweenTableScanImpl::_scan_dictionary_segment(
-    const BaseDictionarySegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
-    const std::shared_ptr<const AbstractPosList>& position_filter) {
+    const BaseDictionarySegment& segment, std::vector<ChunkOffset>& matches,
+    const std::shared_ptr<const AbstractPosList>& position_filter,
+    const std::optional<std::vector<ChunkOffsetRange>>& ranges) {
   ValueID lower_bound_value_id;
   if (is_lower_inclusive_between(predicate_condition)) {
     lower_bound_value_id = segment.lower_bound(left_value);
@@ -122,7 +138,9 @@ void ColumnBetweenTableScanImpl::_scan_dictionary_segment(
         static const auto always_true = [](const auto&) {
           return true;
         };
-        _scan_with_iterators<true>(always_true, left_it, left_end, chunk_id, matches);
+        _for_each_range(ranges, left_it, left_end, [&](auto range_begin, auto range_end) {
+          _scan_with_iterators<true>(always_true, range_begin, range_end, matches);
+        });
       });
     } else {
       // No NULLs, all entries match.
@@ -142,7 +160,7 @@ void ColumnBetweenTableScanImpl::_scan_dictionary_segment(
            ++offset) {
         // `matches` might already contain entries if it is called multiple times by
         // AbstractDereferencedColumnTableScanImpl::_scan_reference_segment.
-        matches[output_start_offset + offset] = RowID{chunk_id, ChunkOffset{offset}};
+        matches[output_start_offset + offset] = ChunkOffset{offset};
       }
     }
 
@@ -162,9 +180,22 @@ void ColumnBetweenTableScanImpl::_scan_dictionary_segment(
    */
 
   // In order to avoid having to explicitly check for NULL (represented by a ValueID with the value
-  // `segment.unique_values_count()`) we may have to adjust the upper bound to not include the NULL-ValueID
+  // `segment.null_value_id()`) we may have to adjust the upper bound to not include the NULL-ValueID
   if (upper_bound_value_id == INVALID_VALUE_ID) {
-    upper_bound_value_id = segment.unique_values_count();
+    upper_bound_value_id = segment.null_value_id();
+  }
+
+  // Without a position filter, bit-packed attribute vectors are scanned on their packed words (see
+  // bit_packed_scan.hpp).
+  const auto attribute_vector = segment.attribute_vector();
+  const auto* bit_packing_vector = dynamic_cast<const BitPackingVector*>(attribute_vector.get());
+  if (!position_filter && bit_packing_vector) {
+    const auto bitmap = ranges ? scan_bit_packed_vector(*bit_packing_vector, lower_bound_value_id,
+                                                        upper_bound_value_id, false, segment.null_value_id(), *ranges)
+                               : scan_bit_packed_vector(*bit_packing_vector, lower_bound_value_id,
+                                                        upper_bound_value_id, false, segment.null_value_id());
+    append_bitmap_matches(bitmap, matches);
+    return;
   }
 
   const auto value_id_diff = upper_bound_value_id - lower_bound_value_id;
@@ -177,14 +208,17 @@ void ColumnBetweenTableScanImpl::_scan_dictionary_segment(
 
   attribute_vector_iterable.with_iterators(position_filter, [&](auto left_it, auto left_end) {
     // No need to check for NULL because NULL would be represented as a value ID outside of our range
-    _scan_with_iterators<false>(comparator, left_it, left_end, chunk_id, matches);
+    _for_each_range(ranges, left_it, left_end, [&](auto range_begin, auto range_end) {
+      _scan_with_iterators<false>(comparator, range_begin, range_end, matches);
+    });
   });
 }
 
-void ColumnBetweenTableScanImpl::_scan_sorted_segment(const AbstractSegment& segment, const ChunkID chunk_id,
-                                                      RowIDPosList& matches,
+void ColumnBetweenTableScanImpl::_scan_sorted_segment(const AbstractSegment& segment,
+                                                      std::vector<ChunkOffset>& matches,
                                                       const std::shared_ptr<const AbstractPosList>& position_filter,
-                                                      const SortMode sort_mode) {
+                                                      const SortMode sort_mode,
+                                                      const std::optional<std::vector<ChunkOffsetRange>>& ranges) {
   resolve_data_and_segment_type(segment, [&](const auto type, const auto& typed_segment) {
     using ColumnDataType = typename decltype(type)::type;
 
@@ -193,12 +227,18 @@ void ColumnBetweenTableScanImpl::_scan_sorted_segment(const AbstractSegment& seg
     } else {
       auto segment_iterable = create_iterable_from_segment(typed_segment);
       segment_iterable.with_iterators(position_filter, [&](auto segment_begin, auto segment_end) {
+        // See ColumnVsValueTableScanImpl::_scan_sorted_segment().
+        if (ranges) {
+          segment_end = segment_begin + static_cast<std::ptrdiff_t>(ranges->back().end);
+          segment_begin += static_cast<std::ptrdiff_t>(ranges->front().begin);
+        }
+
         const auto typed_left_value = boost::get<ColumnDataType>(left_value);
         const auto typed_right_value = boost::get<ColumnDataType>(right_value);
         auto sorted_segment_search = SortedSegmentSearch(segment_begin, segment_end, sort_mode, _column_is_nullable,
                                                          predicate_condition, typed_left_value, typed_right_value);
 
-        sorted_segment_search.scan_sorted_segment(chunk_id, matches, position_filter);
+        sorted_segment_search.scan_sorted_segment(matches, position_filter);
 
         if (sorted_segment_search.no_rows_matching) {
           ++num_chunks_with_early_out;
@@ -1,10 +1,13 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
+#include <vector>
 
 #include "abstract_dereferenced_column_table_scan_impl.hpp"
 #include "all_type_variant.hpp"
+#include "storage/segment_zone_map.hpp"
 #include "types.hpp"
 
 namespace hyrise {
@@ -33,18 +36,23 @@ class ColumnBetweenTableScanImpl : public AbstractDereferencedColumnTableScanImp
   const AllTypeVariant right_value;
 
  protected:
-  void _scan_non_reference_segment(const AbstractSegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
+  void _scan_non_reference_segment(const AbstractSegment& segment, const ChunkID chunk_id,
+                                   std::vector<ChunkOffset>& matches,
                                    const std::shared_ptr<const AbstractPosList>& position_filter) override;
 
-  void _scan_generic_segment(const AbstractSegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
-                             const std::shared_ptr<const AbstractPosList>& position_filter) const;
+  // The scans only consider the given ranges of chunk offsets (see AbstractTableScanImpl::_qualifying_ranges()).
+  void _scan_generic_segment(const AbstractSegment& segment, std::vector<ChunkOffset>& matches,
+                             const std::shared_ptr<const AbstractPosList>& position_filter,
+                             const std::optional<std::vector<ChunkOffsetRange>>& ranges) const;
 
   // Optimized scan on DictionarySegments
-  void _scan_dictionary_segment(const BaseDictionarySegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
-                                const std::shared_ptr<const AbstractPosList>& position_filter);
+  void _scan_dictionary_segment(const BaseDictionarySegment& segment, std::vector<ChunkOffset>& matches,
+                                const std::shared_ptr<const AbstractPosList>& position_filter,
+                                const std::optional<std::vector<ChunkOffsetRange>>& ranges);
 
-  void _scan_sorted_segment(const AbstractSegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
-                            const std::shared_ptr<const AbstractPosList>& position_filter, const SortMode sort_mode);
+  void _scan_sorted_segment(const AbstractSegment& segment, std::vector<ChunkOffset>& matches,
+                            const std::shared_ptr<const AbstractPosList>& position_filter, const SortMode sort_mode,
+                            const std::optional<std::vector<ChunkOffsetRange>>& ranges);
 
  private:
   const bool _column_is_nullable;
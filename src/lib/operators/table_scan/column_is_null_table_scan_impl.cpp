@@ -2,12 +2,14 @@
 
 #include <cstddef>
 #include <memory>
+#include <optional>
 #include <string>
+#include <vector>
 
 #include "storage/abstract_segment.hpp"
 #include "storage/base_value_segment.hpp"
-#include "storage/pos_lists/row_id_pos_list.hpp"
 #include "storage/segment_iterate.hpp"
+#include "storage/segment_zone_map.hpp"
 #include "storage/value_segment/null_value_vector_iterable.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
@@ -26,33 +28,42 @@ std::string ColumnIsNullTableScanImpl::description() const {
   return "IsNullScan";
 }
 
-std::shared_ptr<RowIDPosList> ColumnIsNullTableScanImpl::scan_chunk(const ChunkID chunk_id) {
+std::vector<ChunkOffset> ColumnIsNullTableScanImpl::scan_chunk(const ChunkID chunk_id) {
   const auto& chunk = _in_table->get_chunk(chunk_id);
   const auto& segment = chunk->get_segment(_column_id);
 
-  auto matches = std::make_shared<RowIDPosList>();
+  auto matches = std::vector<ChunkOffset>{};
 
   if (const auto value_segment = std::dynamic_pointer_cast<BaseValueSegment>(segment)) {
-    _scan_value_segment(*value_segment, chunk_id, *matches);
+    _scan_value_segment(*value_segment, matches);
   } else {
     const auto& chunk_sorted_by = chunk->individually_sorted_by();
     if (!chunk_sorted_by.empty()) {
       for (const auto& sorted_by : chunk_sorted_by) {
         if (sorted_by.column == _column_id) {
-          _scan_generic_sorted_segment(*segment, chunk_id, *matches, sorted_by.sort_mode);
+          _scan_generic_sorted_segment(*segment, matches, sorted_by.sort_mode);
           ++num_chunks_with_binary_search;
           return matches;
         }
       }
     }
-    _scan_generic_segment(*segment, chunk_id, *matches);
+
+    // Skip the blocks of encoded segments that contain no NULLs (IS NULL) or only NULLs (IS NOT NULL).
+    const auto ranges = _qualifying_ranges(*segment, nullptr, _predicate_condition, NULL_VALUE);
+    if (ranges && ranges->empty()) {
+      ++num_chunks_with_early_out;
+      return matches;
+    }
+
+    _scan_generic_segment(*segment, matches, ranges);
   }
 
   return matches;
 }
 
-void ColumnIsNullTableScanImpl::_scan_generic_segment(const AbstractSegment& segment, const ChunkID chunk_id,
-                                                      RowIDPosList& matches) const {
+void ColumnIsNullTableScanImpl::_scan_generic_segment(
+    const AbstractSegment& segment, std::vector<ChunkOffset>& matches,
+    const std::optional<std::vector<ChunkOffsetRange>>& ranges) const {
   segment_with_iterators(segment, [&](auto iter, [[maybe_unused]] const auto end) {
     // This may also be called for a ValueSegment if `segment` is a ReferenceSegment pointing to a single ValueSegment.
     const auto invert = _predicate_condition == PredicateCondition::IsNotNull;
@@ -60,12 +71,15 @@ void ColumnIsNullTableScanImpl::_scan_generic_segment(const AbstractSegment& seg
       return invert ^ value.is_null();
     };
 
-    _scan_with_iterators<false>(functor, iter, end, chunk_id, matches);
+    _for_each_range(ranges, iter, end, [&](auto range_begin, auto range_end) {
+      _scan_with_iterators<false>(functor, range_begin, range_end, matches);
+    });
   });
 }
 
-void ColumnIsNullTableScanImpl::_scan_generic_sorted_segment(const AbstractSegment& segment, const ChunkID chunk_id,
-                                                             RowIDPosList& matches, const SortMode sorted_by) const {
+void ColumnIsNullTableScanImpl::_scan_generic_sorted_segment(const AbstractSegment& segment,
+                                                             std::vector<ChunkOffset>& matches,
+                                                             const SortMode sorted_by) const {
   const bool is_nulls_first = sorted_by == SortMode::Ascending || sorted_by == SortMode::Descending;
   const bool predicate_is_null = _predicate_condition == PredicateCondition::IsNull;
   segment_with_iterators(segment, [&](auto begin, auto end) {
@@ -95,15 +109,15 @@ void ColumnIsNullTableScanImpl::_scan_generic_sorted_segment(const AbstractSegme
     size_t output_idx = matches.size();
     matches.resize(matches.size() + std::distance(begin, end));
     for (auto segment_it = begin; segment_it != end; ++segment_it) {
-      matches[output_idx++] = RowID{chunk_id, segment_it->chunk_offset()};
+      matches[output_idx++] = segment_it->chunk_offset();
     }
   });
 }
 
-void ColumnIsNullTableScanImpl::_scan_value_segment(const BaseValueSegment& segment, const ChunkID chunk_id,
-                                                    RowIDPosList& matches) {
+void ColumnIsNullTableScanImpl::_scan_value_segment(const BaseValueSegment& segment,
+                                                    std::vector<ChunkOffset>& matches) {
   if (_matches_all(segment)) {
-    _add_all(chunk_id, matches, segment.size());
+    _add_all(matches, segment.size());
     return;
   }
 
@@ -121,7 +135,7 @@ void ColumnIsNullTableScanImpl::_scan_value_segment(const BaseValueSegment& segm
     return invert ^ value.is_null();
   };
   iterable.with_iterators([&](auto iter, auto end) {
-    _scan_with_iterators<false>(functor, iter, end, chunk_id, matches);
+    _scan_with_iterators<false>(functor, iter, end, matches);
   });
 }
 
@@ -151,10 +165,10 @@ bool ColumnIsNullTableScanImpl::_matches_none(const BaseValueSegment& segment) c
   }
 }
 
-void ColumnIsNullTableScanImpl::_add_all(const ChunkID chunk_id, RowIDPosList& matches, const size_t segment_size) {
+void ColumnIsNullTableScanImpl::_add_all(std::vector<ChunkOffset>& matches, const size_t segment_size) {
   const auto num_rows = segment_size;
   for (auto chunk_offset = ChunkOffset{0}; chunk_offset < num_rows; ++chunk_offset) {
-    matches.emplace_back(chunk_id, chunk_offset);
+    matches.emplace_back(chunk_offset);
   }
 }
 
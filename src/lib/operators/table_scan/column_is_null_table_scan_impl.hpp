@@ -3,9 +3,12 @@
 #include <algorithm>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <string>
+#include <vector>
 
 #include "abstract_dereferenced_column_table_scan_impl.hpp"
+#include "storage/segment_zone_map.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
@@ -24,15 +27,17 @@ class ColumnIsNullTableScanImpl : public AbstractTableScanImpl {
 
   std::string description() const override;
 
-  std::shared_ptr<RowIDPosList> scan_chunk(const ChunkID chunk_id) override;
+  std::vector<ChunkOffset> scan_chunk(const ChunkID chunk_id) override;
 
  protected:
-  void _scan_generic_segment(const AbstractSegment& segment, const ChunkID chunk_id, RowIDPosList& matches) const;
-  void _scan_generic_sorted_segment(const AbstractSegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
+  // Only scans the given ranges of chunk offsets (see AbstractTableScanImpl::_qualifying_ranges()).
+  void _scan_generic_segment(const AbstractSegment& segment, std::vector<ChunkOffset>& matches,
+                             const std::optional<std::vector<ChunkOffsetRange>>& ranges) const;
+  void _scan_generic_sorted_segment(const AbstractSegment& segment, std::vector<ChunkOffset>& matches,
                                     const SortMode sorted_by) const;
 
   // Optimized scan on ValueSegments
-  void _scan_value_segment(const BaseValueSegment& segment, const ChunkID chunk_id, RowIDPosList& matches);
+  void _scan_value_segment(const BaseValueSegment& segment, std::vector<ChunkOffset>& matches);
 
   /**
    * @defgroup Methods used for handling value segments
@@ -43,7 +48,7 @@ class ColumnIsNullTableScanImpl : public AbstractTableScanImpl {
 
   bool _matches_none(const BaseValueSegment& segment) const;
 
-  static void _add_all(const ChunkID chunk_id, RowIDPosList& matches, const size_t segment_size);
+  static void _add_all(std::vector<ChunkOffset>& matches, const size_t segment_size);
 
   /**@}*/
 
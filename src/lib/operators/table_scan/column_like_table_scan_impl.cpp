@@ -2,22 +2,45 @@
 
 #include <cstddef>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <utility>
+#include <variant>
 #include <vector>
 
 #include "abstract_dereferenced_column_table_scan_impl.hpp"
+#include "expression/evaluation/like_matcher.hpp"
 #include "storage/abstract_segment.hpp"
 #include "storage/base_dictionary_segment.hpp"
 #include "storage/create_iterable_from_segment.hpp"
+#include "storage/dictionary_segment.hpp"
 #include "storage/encoding_type.hpp"
+#include "storage/fsst_segment.hpp"
+#include "storage/fsst_segment/fsst_segment_iterable.hpp"
 #include "storage/pos_lists/abstract_pos_list.hpp"
-#include "storage/pos_lists/row_id_pos_list.hpp"
 #include "storage/segment_iterables/create_iterable_from_attribute_vector.hpp"
 #include "storage/segment_iterate.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
+namespace {
+
+using namespace hyrise;  // NOLINT(build/namespaces)
+
+// Returns "hello" for the pattern "hello%" and std::nullopt for all other patterns.
+std::optional<pmr_string> prefix_of_starts_with_pattern(const pmr_string& pattern) {
+  const auto tokens = LikeMatcher::pattern_string_to_tokens(pattern);
+  if (tokens.size() == 2 && std::holds_alternative<pmr_string>(tokens[0]) &&
+      tokens[1] == LikeMatcher::PatternToken{LikeMatcher::Wildcard::AnyChars}) {
+    return std::get<pmr_string>(tokens[0]);
+  }
+  return std::nullopt;
+}
+
+}  // namespace
+
 namespace hyrise {
 
 ColumnLikeTableScanImpl::ColumnLikeTableScanImpl(const std::shared_ptr<const Table>& in_table, const ColumnID column_id,
@@ -25,28 +48,33 @@ ColumnLikeTableScanImpl::ColumnLikeTableScanImpl(const std::shared_ptr<const Tab
                                                  const pmr_string& pattern)
     : AbstractDereferencedColumnTableScanImpl{in_table, column_id, init_predicate_condition},
       _matcher{pattern},
-      _invert_results(predicate_condition == PredicateCondition::NotLike) {}
+      _invert_results(predicate_condition == PredicateCondition::NotLike),
+      _exact_pattern{LikeMatcher::contains_wildcard(pattern) ? std::nullopt : std::optional<pmr_string>{pattern}},
+      _prefix_pattern{prefix_of_starts_with_pattern(pattern)} {}
 
 std::string ColumnLikeTableScanImpl::description() const {
   return "ColumnLike";
 }
 
 void ColumnLikeTableScanImpl::_scan_non_reference_segment(
-    const AbstractSegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
+    const AbstractSegment& segment, const ChunkID /*chunk_id*/, std::vector<ChunkOffset>& matches,
     const std::shared_ptr<const AbstractPosList>& position_filter) {
   // For dictionary segments where the number of unique values is not higher than the number of (potentially filtered)
   // input rows, use an optimized implementation.
   if (const auto* dictionary_segment = dynamic_cast<const BaseDictionarySegment*>(&segment);
       dictionary_segment &&
       (!position_filter || dictionary_segment->unique_values_count() <= position_filter->size())) {
-    _scan_dictionary_segment(*dictionary_segment, chunk_id, matches, position_filter);
+    _scan_dictionary_segment(*dictionary_segment, matches, position_filter);
+  } else if (const auto* fsst_segment = dynamic_cast<const FSSTSegment<pmr_string>*>(&segment);
+             fsst_segment && (_exact_pattern || _prefix_pattern)) {
+    _scan_fsst_segment(*fsst_segment, matches, position_filter);
   } else {
-    _scan_generic_segment(segment, chunk_id, matches, position_filter);
+    _scan_generic_segment(segment, matches, position_filter);
   }
 }
 
 void ColumnLikeTableScanImpl::_scan_generic_segment(
-    const AbstractSegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
+    const AbstractSegment& segment, std::vector<ChunkOffset>& matches,
     const std::shared_ptr<const AbstractPosList>& position_filter) const {
   segment_with_iterators_filtered(segment, position_filter, [&](auto iter, [[maybe_unused]] const auto end) {
     // Don't instantiate this for ReferenceSegments to save compile time as ReferenceSegments are handled
@@ -59,7 +87,7 @@ void ColumnLikeTableScanImpl::_scan_generic_segment(
           const auto functor = [&](const auto& position) {
             return resolved_matcher(position.value());
           };
-          _scan_with_iterators<true>(functor, iter, end, chunk_id, matches);
+          _scan_with_iterators<true>(functor, iter, end, matches);
         });
       } else {
         Fail("Can only handle strings");
@@ -70,24 +98,27 @@ void ColumnLikeTableScanImpl::_scan_generic_segment(
   });
 }
 
-void ColumnLikeTableScanImpl::_scan_dictionary_segment(const BaseDictionarySegment& segment, const ChunkID chunk_id,
-                                                       RowIDPosList& matches,
+void ColumnLikeTableScanImpl::_scan_dictionary_segment(const BaseDictionarySegment& segment,
+                                                       std::vector<ChunkOffset>& matches,
                                                        const std::shared_ptr<const AbstractPosList>& position_filter) {
   // First, build a bitmap containing 1s/0s for matching/non-matching dictionary values. Second, iterate over the
   // attribute vector and check against the bitmap. If too many input rows have already been removed (are not part of
   // position_filter), this optimization is detrimental. See caller for that case.
-  std::pair<size_t, std::vector<bool>> result;
+  auto result = std::shared_ptr<const DictionaryMatches>{};
 
   if (segment.encoding_type() == EncodingType::Dictionary) {
     const auto& typed_segment = static_cast<const DictionarySegment<pmr_string>&>(segment);
-    result = _find_matches_in_dictionary(*typed_segment.dictionary());
+    result = typed_segment.shares_dictionary()
+                 ? _find_matches_in_shared_dictionary(typed_segment.dictionary())
+                 : std::make_shared<const DictionaryMatches>(_find_matches_in_dictionary(*typed_segment.dictionary()));
   } else {
     const auto& typed_segment = static_cast<const FixedStringDictionarySegment<pmr_string>&>(segment);
-    result = _find_matches_in_dictionary(*typed_segment.fixed_string_dictionary());
+    result = std::make_shared<const DictionaryMatches>(
+        _find_matches_in_dictionary(*typed_segment.fixed_string_dictionary()));
   }
 
-  const auto& match_count = result.first;
-  const auto& dictionary_matches = result.second;
+  const auto& match_count = result->first;
+  const auto& dictionary_matches = result->second;
 
   auto attribute_vector_iterable = create_iterable_from_attribute_vector(segment);
 
@@ -97,7 +128,7 @@ void ColumnLikeTableScanImpl::_scan_dictionary_segment(const BaseDictionarySegme
       static const auto always_true = [](const auto&) {
         return true;
       };
-      _scan_with_iterators<true>(always_true, iter, end, chunk_id, matches);
+      _scan_with_iterators<true>(always_true, iter, end, matches);
     });
 
     return;
@@ -114,13 +145,54 @@ void ColumnLikeTableScanImpl::_scan_dictionary_segment(const BaseDictionarySegme
   };
 
   attribute_vector_iterable.with_iterators(position_filter, [&](auto iter, auto end) {
-    _scan_with_iterators<true>(dictionary_lookup, iter, end, chunk_id, matches);
+    _scan_with_iterators<true>(dictionary_lookup, iter, end, matches);
   });
 }
 
+void ColumnLikeTableScanImpl::_scan_fsst_segment(const FSSTSegment<pmr_string>& segment,
+                                                 std::vector<ChunkOffset>& matches,
+                                                 const std::shared_ptr<const AbstractPosList>& position_filter) const {
+  const auto& symbol_table = segment.symbol_table();
+
+  // Patterns without wildcards are compared to the values' codes, as FSST compresses deterministically (see
+  // ColumnVsValueTableScanImpl). For prefix patterns, only the symbols that cover the prefix are decoded.
+  auto pattern_codes = std::string{};
+  if (_exact_pattern) {
+    symbol_table.compress(*_exact_pattern, pattern_codes);
+  }
+  const auto pattern_codes_view = std::string_view{pattern_codes};
+
+  const auto iterable = FSSTSegmentIterable<pmr_string, true>{segment};
+  iterable.with_iterators(position_filter, [&](auto iter, auto end) {
+    if (_exact_pattern) {
+      const auto functor = [&](const auto& position) {
+        return (position.value() == pattern_codes_view) != _invert_results;
+      };
+      _scan_with_iterators<true>(functor, iter, end, matches);
+    } else {
+      const auto functor = [&](const auto& position) {
+        return symbol_table.starts_with(position.value(), *_prefix_pattern) != _invert_results;
+      };
+      _scan_with_iterators<true>(functor, iter, end, matches);
+    }
+  });
+}
+
+std::shared_ptr<const ColumnLikeTableScanImpl::DictionaryMatches>
+ColumnLikeTableScanImpl::_find_matches_in_shared_dictionary(
+    const std::shared_ptr<const pmr_vector<pmr_string>>& dictionary) {
+  const auto lock = std::lock_guard<std::mutex>{_shared_dictionary_matches_mutex};
+  auto& matches = _shared_dictionary_matches[dictionary];
+  if (!matches) {
+    matches = std::make_shared<const DictionaryMatches>(_find_matches_in_dictionary(*dictionary));
+  }
+  return matches;
+}
+
 template <typename D>
-std::pair<size_t, std::vector<bool>> ColumnLikeTableScanImpl::_find_matches_in_dictionary(const D& dictionary) const {
-  auto result = std::pair<size_t, std::vector<bool>>{};
+ColumnLikeTableScanImpl::DictionaryMatches ColumnLikeTableScanImpl::_find_matches_in_dictionary(
+    const D& dictionary) const {
+  auto result = DictionaryMatches{};
 
   auto& count = result.first;
   auto& dictionary_matches = result.second;
@@ -2,8 +2,11 @@
 
 #include <map>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <regex>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -11,6 +14,7 @@
 
 #include "abstract_dereferenced_column_table_scan_impl.hpp"
 #include "expression/evaluation/like_matcher.hpp"
+#include "storage/fsst_segment.hpp"
 #include "types.hpp"
 
 namespace hyrise {
@@ -25,6 +29,10 @@ class Table;
  * - For dictionary segments, we check the values in the dictionary and store the matches in a vector
  *   in order to avoid having to look up each value ID of the attribute vector in the dictionary. This also
  *   enables us to detect if all or none of the values in the segment satisfy the expression.
+ *   Dictionaries that are shared by the segments of multiple chunks (see ChunkEncoder::encode_with_global_dictionary)
+ *   are only checked once per scan.
+ * - For FSST segments, patterns without wildcards and prefix patterns (e.g., 'hello%') are evaluated on the compressed
+ *   values. Other patterns decompress each value.
  *
  * Performance Notes: Uses std::regex as a slow fallback and resorts to much faster Pattern matchers for special cases,
  *                    e.g., StartsWithPattern. 
@@ -37,25 +45,45 @@ class ColumnLikeTableScanImpl : public AbstractDereferencedColumnTableScanImpl {
   std::string description() const override;
 
  protected:
-  void _scan_non_reference_segment(const AbstractSegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
+  void _scan_non_reference_segment(const AbstractSegment& segment, const ChunkID chunk_id,
+                                   std::vector<ChunkOffset>& matches,
                                    const std::shared_ptr<const AbstractPosList>& position_filter) override;
 
-  void _scan_generic_segment(const AbstractSegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
+  void _scan_generic_segment(const AbstractSegment& segment, std::vector<ChunkOffset>& matches,
                              const std::shared_ptr<const AbstractPosList>& position_filter) const;
-  void _scan_dictionary_segment(const BaseDictionarySegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
+  void _scan_dictionary_segment(const BaseDictionarySegment& segment, std::vector<ChunkOffset>& matches,
                                 const std::shared_ptr<const AbstractPosList>& position_filter);
+  void _scan_fsst_segment(const FSSTSegment<pmr_string>& segment, std::vector<ChunkOffset>& matches,
+                          const std::shared_ptr<const AbstractPosList>& position_filter) const;
+
+  // Number of matches and the result of each dictionary entry
+  using DictionaryMatches = std::pair<size_t, std::vector<bool>>;
 
   /**
    * Used for dictionary segments
    * @returns number of matches and the result of each dictionary entry
    */
   template <typename D>
-  std::pair<size_t, std::vector<bool>> _find_matches_in_dictionary(const D& dictionary) const;
+  DictionaryMatches _find_matches_in_dictionary(const D& dictionary) const;
+
+  // Returns the matches of a dictionary that is shared by multiple segments. The first call for a dictionary finds the
+  // matches, later calls (e.g., for the segments of the other chunks) reuse them.
+  std::shared_ptr<const DictionaryMatches> _find_matches_in_shared_dictionary(
+      const std::shared_ptr<const pmr_vector<pmr_string>>& dictionary);
 
   const LikeMatcher _matcher;
 
   // For NOT LIKE support
   const bool _invert_results;
+
+  // Set if the pattern has no wildcards or the form 'hello%', respectively. Used for FSST segments.
+  const std::optional<pmr_string> _exact_pattern;
+  const std::optional<pmr_string> _prefix_pattern;
+
+  // Chunks are scanned concurrently, so access to the matches of shared dictionaries is synchronized.
+  std::mutex _shared_dictionary_matches_mutex;
+  std::unordered_map<std::shared_ptr<const pmr_vector<pmr_string>>, std::shared_ptr<const DictionaryMatches>>
+      _shared_dictionary_matches;
 };
 
 }  // namespace hyrise
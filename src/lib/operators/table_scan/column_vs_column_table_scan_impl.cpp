@@ -2,13 +2,15 @@
 
 #include <functional>
 #include <memory>
+#include <optional>
 #include <string>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 #include "operators/table_scan/abstract_table_scan_impl.hpp"
 #include "resolve_type.hpp"
 #include "storage/create_iterable_from_segment.hpp"
-#include "storage/pos_lists/row_id_pos_list.hpp"
 #include "storage/reference_segment/reference_segment_iterable.hpp"
 #include "storage/segment_iterables/any_segment_iterable.hpp"
 #include "storage/segment_iterables/segment_positions.hpp"
@@ -33,12 +35,12 @@ std::string ColumnVsColumnTableScanImpl::description() const {
   return "ColumnVsColumn";
 }
 
-std::shared_ptr<RowIDPosList> ColumnVsColumnTableScanImpl::scan_chunk(ChunkID chunk_id) {
+std::vector<ChunkOffset> ColumnVsColumnTableScanImpl::scan_chunk(ChunkID chunk_id) {
   const auto chunk = _in_table->get_chunk(chunk_id);
   const auto left_segment = chunk->get_segment(_left_column_id);
   const auto right_segment = chunk->get_segment(_right_column_id);
 
-  auto result = std::shared_ptr<RowIDPosList>{};
+  auto result = std::optional<std::vector<ChunkOffset>>{};
 
   /**
    * Reducing the compile time:
@@ -79,24 +81,24 @@ std::shared_ptr<RowIDPosList> ColumnVsColumnTableScanImpl::scan_chunk(ChunkID ch
                                            std::decay_t<decltype(right_it)>>) {  // NOLINT
                 // Either both reference segments use the MultipleChunkIterator (which uses erased accessors anyway)
                 // or they are resolved to the underlying segment iterators (e.g., Dictionary and Dictionary)
-                result = _typed_scan_chunk_with_iterators<EraseTypes::OnlyInDebugBuild>(chunk_id, left_it, left_end,
-                                                                                        right_it, right_end);
+                result = _typed_scan_chunk_with_iterators<EraseTypes::OnlyInDebugBuild>(left_it, left_end, right_it,
+                                                                                        right_end);
               }
             });
           });
         } else {
           // Same segment types - do not erase types in Release builds
           result = _typed_scan_chunk_with_iterables<EraseTypes::OnlyInDebugBuild>(
-              chunk_id, create_iterable_from_segment<ColumnDataType>(left_typed_segment),
+              create_iterable_from_segment<ColumnDataType>(left_typed_segment),
               create_iterable_from_segment<ColumnDataType>(*right_typed_segment));
         }
       }
     });
 
-    // `result` will still be nullptr if the SegmentTypes were not the same - if that's the case we have to take the
+    // `result` will still be empty if the SegmentTypes were not the same - if that's the case we have to take the
     // "slow" path further down to perform the scan
     if (result) {
-      return result;
+      return std::move(*result);
     }
   }
 
@@ -117,26 +119,25 @@ std::shared_ptr<RowIDPosList> ColumnVsColumnTableScanImpl::scan_chunk(ChunkID ch
         auto right_iterable = create_any_segment_iterable<RightColumnDataType>(*right_segment);
 
         PerformanceWarning("ColumnVsColumnTableScan using type-erased iterators");
-        result = _typed_scan_chunk_with_iterables<EraseTypes::Always>(chunk_id, left_iterable, right_iterable);
+        result = _typed_scan_chunk_with_iterables<EraseTypes::Always>(left_iterable, right_iterable);
       } else {
         Fail("Trying to compare strings and non-strings");
       }
     });
   });
 
-  return result;
+  return std::move(*result);
 }
 
 template <EraseTypes erase_comparator_type, typename LeftIterable, typename RightIterable>
-std::shared_ptr<RowIDPosList> __attribute__((noinline))
-ColumnVsColumnTableScanImpl::_typed_scan_chunk_with_iterables(ChunkID chunk_id, const LeftIterable& left_iterable,
+std::vector<ChunkOffset> __attribute__((noinline))
+ColumnVsColumnTableScanImpl::_typed_scan_chunk_with_iterables(const LeftIterable& left_iterable,
                                                               const RightIterable& right_iterable) const {
-  auto matches_out = std::shared_ptr<RowIDPosList>{};
+  auto matches_out = std::vector<ChunkOffset>{};
 
   left_iterable.with_iterators([&](auto left_it, const auto left_end) {
     right_iterable.with_iterators([&](auto right_it, const auto right_end) {
-      matches_out =
-          _typed_scan_chunk_with_iterators<erase_comparator_type>(chunk_id, left_it, left_end, right_it, right_end);
+      matches_out = _typed_scan_chunk_with_iterators<erase_comparator_type>(left_it, left_end, right_it, right_end);
     });
   });
 
@@ -144,11 +145,11 @@ ColumnVsColumnTableScanImpl::_typed_scan_chunk_with_iterables(ChunkID chunk_id,
 }
 
 template <EraseTypes erase_comparator_type, typename LeftIterator, typename RightIterator>
-std::shared_ptr<RowIDPosList> __attribute__((noinline))
-ColumnVsColumnTableScanImpl::_typed_scan_chunk_with_iterators(ChunkID chunk_id, LeftIterator& left_it,
-                                                              const LeftIterator& left_end, RightIterator& right_it,
+std::vector<ChunkOffset> __attribute__((noinline))
+ColumnVsColumnTableScanImpl::_typed_scan_chunk_with_iterators(LeftIterator& left_it, const LeftIterator& left_end,
+                                                              RightIterator& right_it,
                                                               const RightIterator& right_end) const {
-  auto matches_out = std::make_shared<RowIDPosList>();
+  auto matches_out = std::vector<ChunkOffset>{};
 
   auto condition_was_flipped = false;
   auto maybe_flipped_condition = _predicate_condition;
@@ -176,12 +177,10 @@ ColumnVsColumnTableScanImpl::_typed_scan_chunk_with_iterators(ChunkID chunk_id,
     if (condition_was_flipped) {
       const auto erased_comparator = conditionally_erase_comparator_type(comparator, right_it, left_it);
       // NOLINTNEXTLINE(readability-suspicious-call-argument): flipped arguments by intention.
-      AbstractTableScanImpl::_scan_with_iterators<true>(erased_comparator, right_it, right_end, chunk_id, *matches_out,
-                                                        left_it);
+      AbstractTableScanImpl::_scan_with_iterators<true>(erased_comparator, right_it, right_end, matches_out, left_it);
     } else {
       const auto erased_comparator = conditionally_erase_comparator_type(comparator, left_it, right_it);
-      AbstractTableScanImpl::_scan_with_iterators<true>(erased_comparator, left_it, left_end, chunk_id, *matches_out,
-                                                        right_it);
+      AbstractTableScanImpl::_scan_with_iterators<true>(erased_comparator, left_it, left_end, matches_out, right_it);
     }
   });
 
@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "abstract_table_scan_impl.hpp"
 #include "types.hpp"
@@ -29,7 +30,7 @@ class ColumnVsColumnTableScanImpl : public AbstractTableScanImpl {
 
   std::string description() const override;
 
-  std::shared_ptr<RowIDPosList> scan_chunk(ChunkID chunk_id) override;
+  std::vector<ChunkOffset> scan_chunk(ChunkID chunk_id) override;
 
  private:
   const std::shared_ptr<const Table> _in_table;
@@ -38,13 +39,13 @@ class ColumnVsColumnTableScanImpl : public AbstractTableScanImpl {
   const ColumnID _right_column_id;
 
   template <EraseTypes erase_comparator_type, typename LeftIterable, typename RightIterable>
-  std::shared_ptr<RowIDPosList> _typed_scan_chunk_with_iterables(ChunkID chunk_id, const LeftIterable& left_iterable,
-                                                                 const RightIterable& right_iterable) const;
+  std::vector<ChunkOffset> _typed_scan_chunk_with_iterables(const LeftIterable& left_iterable,
+                                                            const RightIterable& right_iterable) const;
 
   template <EraseTypes erase_comparator_type, typename LeftIterator, typename RightIterator>
-  std::shared_ptr<RowIDPosList> _typed_scan_chunk_with_iterators(ChunkID chunk_id, LeftIterator& left_it,
-                                                                 const LeftIterator& left_end, RightIterator& right_it,
-                                                                 const RightIterator& right_end) const;
+  std::vector<ChunkOffset> _typed_scan_chunk_with_iterators(LeftIterator& left_it, const LeftIterator& left_end,
+                                                            RightIterator& right_it,
+                                                            const RightIterator& right_end) const;
 };
 
 }  // namespace hyrise
@@ -2,25 +2,33 @@
 
 #include <cstddef>
 #include <memory>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <type_traits>
 #include <vector>
 
 #include "abstract_dereferenced_column_table_scan_impl.hpp"
 #include "all_type_variant.hpp"
+#include "bit_packed_scan.hpp"
 #include "resolve_type.hpp"
 #include "sorted_segment_search.hpp"
 #include "storage/abstract_segment.hpp"
 #include "storage/base_dictionary_segment.hpp"
+#include "storage/chunk.hpp"
 #include "storage/create_iterable_from_segment.hpp"
+#include "storage/fsst_segment.hpp"
+#include "storage/fsst_segment/fsst_segment_iterable.hpp"
 #include "storage/pos_lists/abstract_pos_list.hpp"
-#include "storage/pos_lists/row_id_pos_list.hpp"
 #include "storage/segment_iterables/create_iterable_from_attribute_vector.hpp"
 #include "storage/segment_iterate.hpp"
+#include "storage/segment_zone_map.hpp"
 #include "storage/table.hpp"
+#include "storage/vector_compression/bitpacking/bitpacking_vector.hpp"
 #include "type_comparison.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
+#include "utils/pruning_utils.hpp"
 
 namespace hyrise {
 
@@ -31,7 +39,7 @@ ColumnVsValueTableScanImpl::ColumnVsValueTableScanImpl(const std::shared_ptr<con
     : AbstractDereferencedColumnTableScanImpl{in_table, column_id, init_predicate_condition},
       value{init_value},
       _column_is_nullable{in_table->column_is_nullable(column_id)} {
-  Assert(in_table->column_data_type(column_id) == data_type_from_all_type_variant(value),
+  Assert(storage_data_type(in_table->column_data_type(column_id)) == data_type_from_all_type_variant(value),
          "Cannot use ColumnVsValueTableScanImpl for scan where column and value data type do not match. Use "
          "ExpressionEvaluatorTableScanImpl.");
 }
@@ -41,29 +49,56 @@ std::string ColumnVsValueTableScanImpl::description() const {
 }
 
 void ColumnVsValueTableScanImpl::_scan_non_reference_segment(
-    const AbstractSegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
+    const AbstractSegment& segment, const ChunkID chunk_id, std::vector<ChunkOffset>& matches,
     const std::shared_ptr<const AbstractPosList>& position_filter) {
+  // Skip the blocks of the segment that cannot contain matches according to its zone map.
+  const auto ranges = _qualifying_ranges(segment, position_filter, predicate_condition, value);
+  if (ranges && ranges->empty()) {
+    ++num_chunks_with_early_out;
+    return;
+  }
+
   const auto& chunk_sorted_by = _in_table->get_chunk(chunk_id)->individually_sorted_by();
 
   if (!chunk_sorted_by.empty()) {
     for (const auto& sorted_by : chunk_sorted_by) {
       if (sorted_by.column == _column_id) {
-        _scan_sorted_segment(segment, chunk_id, matches, position_filter, sorted_by.sort_mode);
+        _scan_sorted_segment(segment, matches, position_filter, sorted_by.sort_mode, ranges);
         return;
       }
     }
   }
 
   if (const auto* dictionary_segment = dynamic_cast<const BaseDictionarySegment*>(&segment)) {
-    _scan_dictionary_segment(*dictionary_segment, chunk_id, matches, position_filter);
+    _scan_dictionary_segment(*dictionary_segment, matches, position_filter, ranges);
+  } else if (const auto* fsst_segment = dynamic_cast<const FSSTSegment<pmr_string>*>(&segment);
+             fsst_segment && (predicate_condition == PredicateCondition::Equals ||
+                              predicate_condition == PredicateCondition::NotEquals)) {
+    _scan_fsst_segment(*fsst_segment, matches, position_filter, ranges);
   } else {
-    _scan_generic_segment(segment, chunk_id, matches, position_filter);
+    _scan_generic_segment(segment, matches, position_filter, ranges);
+  }
+}
+
+bool ColumnVsValueTableScanImpl::_chunk_can_be_skipped(const Chunk& chunk, const ColumnID column_id) const {
+  // Range predicates are already handled by zone maps and the early outs of the dictionary scan. For equality
+  // predicates on unsorted, high-cardinality columns, the Bloom filters of the pruning statistics are more selective.
+  if (predicate_condition != PredicateCondition::Equals) {
+    return false;
+  }
+
+  const auto& pruning_statistics = chunk.pruning_statistics();
+  if (!pruning_statistics || !(*pruning_statistics)[column_id]) {
+    return false;
   }
+
+  return can_prune(*(*pruning_statistics)[column_id], predicate_condition, value);
 }
 
 void ColumnVsValueTableScanImpl::_scan_generic_segment(
-    const AbstractSegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
-    const std::shared_ptr<const AbstractPosList>& position_filter) const {
+    const AbstractSegment& segment, std::vector<ChunkOffset>& matches,
+    const std::shared_ptr<const AbstractPosList>& position_filter,
+    const std::optional<std::vector<ChunkOffsetRange>>& ranges) const {
   segment_with_iterators_filtered(segment, position_filter, [&](auto it, [[maybe_unused]] const auto end) {
     // Don't instantiate this for this for DictionarySegments and ReferenceSegments to save compile time.
     // DictionarySegments are handled in _scan_dictionary_segment()
@@ -78,7 +113,9 @@ void ColumnVsValueTableScanImpl::_scan_generic_segment(
         auto comparator = [predicate_comparator, typed_value](const auto& position) {
           return predicate_comparator(position.value(), typed_value);
         };
-        _scan_with_iterators<true>(comparator, it, end, chunk_id, matches);
+        _for_each_range(ranges, it, end, [&](auto range_begin, auto range_end) {
+          _scan_with_iterators<true>(comparator, range_begin, range_end, matches);
+        });
       });
     } else {
       Fail("Dictionary- and ReferenceSegments have their own code paths and should be handled there");
@@ -86,9 +123,38 @@ void ColumnVsValueTableScanImpl::_scan_generic_segment(
   });
 }
 
+void ColumnVsValueTableScanImpl::_scan_fsst_segment(
+    const FSSTSegment<pmr_string>& segment, std::vector<ChunkOffset>& matches,
+    const std::shared_ptr<const AbstractPosList>& position_filter,
+    const std::optional<std::vector<ChunkOffsetRange>>& ranges) const {
+  // FSST compresses deterministically. Thus, a value equals the search value if and only if their codes are equal, and
+  // the search value is compressed once instead of decompressing every value of the segment.
+  auto search_value_codes = std::string{};
+  segment.symbol_table().compress(boost::get<pmr_string>(value), search_value_codes);
+  const auto search_value_codes_view = std::string_view{search_value_codes};
+
+  const auto iterable = FSSTSegmentIterable<pmr_string, true>{segment};
+  iterable.with_iterators(position_filter, [&](auto it, auto end) {
+    _for_each_range(ranges, it, end, [&](auto range_begin, auto range_end) {
+      if (predicate_condition == PredicateCondition::Equals) {
+        const auto comparator = [search_value_codes_view](const auto& position) {
+          return position.value() == search_value_codes_view;
+        };
+        _scan_with_iterators<true>(comparator, range_begin, range_end, matches);
+      } else {
+        const auto comparator = [search_value_codes_view](const auto& position) {
+          return position.value() != search_value_codes_view;
+        };
+        _scan_with_iterators<true>(comparator, range_begin, range_end, matches);
+      }
+    });
+  });
+}
+
 void ColumnVsValueTableScanImpl::_scan_dictionary_segment(
-    const BaseDictionarySegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
-    const std::shared_ptr<const AbstractPosList>& position_filter) {
+    const BaseDictionarySegment& segment, std::vector<ChunkOffset>& matches,
+    const std::shared_ptr<const AbstractPosList>& position_filter,
+    const std::optional<std::vector<ChunkOffsetRange>>& ranges) {
   /**
    * ValueID search_vid;              // left value id
    * AllTypeVariant search_vid_value; // dict.value_by_value_id(search_vid)
@@ -111,12 +177,15 @@ void ColumnVsValueTableScanImpl::_scan_dictionary_segment(
    * Early Outs
    *
    * Operator        | All rows match if:                                     | No rows match if:
-   * column == value | search_vid_value == value && unique_values_count == 1  | search_vid_value != value
-   * column != value | search_vid_value != value                              | search_vid_value == value && unique_values_count == 1
+   * column == value | search_vid_value == value && dictionary_size == 1      | search_vid_value != value
+   * column != value | search_vid_value != value                              | search_vid_value == value && dictionary_size == 1
    * column <  value | search_vid == INVALID_VALUE_ID                         | search_vid == 0
    * column <= value | search_vid == INVALID_VALUE_ID                         | search_vid == 0
    * column >  value | search_vid == 0                                        | search_vid == INVALID_VALUE_ID
    * column >= value | search_vid == 0                                        | search_vid == INVALID_VALUE_ID
+   *
+   * The size of the dictionary (i.e., null_value_id()) is not necessarily the number of distinct values in the segment,
+   * as dictionaries can be shared by multiple segments (see DictionarySegment::unique_values_count).
    */
 
   auto iterable = create_iterable_from_attribute_vector(segment);
@@ -128,7 +197,9 @@ void ColumnVsValueTableScanImpl::_scan_dictionary_segment(
         static const auto always_true = [](const auto&) {
           return true;
         };
-        _scan_with_iterators<true>(always_true, it, end, chunk_id, matches);
+        _for_each_range(ranges, it, end, [&](auto range_begin, auto range_end) {
+          _scan_with_iterators<true>(always_true, range_begin, range_end, matches);
+        });
       });
     } else {
       // No NULLs, all rows match.
@@ -148,7 +219,7 @@ void ColumnVsValueTableScanImpl::_scan_dictionary_segment(
            ++offset) {
         // `matches` might already contain entries if it is called multiple times by
         // AbstractDereferencedColumnTableScanImpl::_scan_reference_segment.
-        matches[output_start_offset + offset] = RowID{chunk_id, ChunkOffset{offset}};
+        matches[output_start_offset + offset] = ChunkOffset{offset};
       }
     }
 
@@ -160,6 +231,31 @@ void ColumnVsValueTableScanImpl::_scan_dictionary_segment(
     return;
   }
 
+  // Without a position filter, bit-packed attribute vectors are scanned on their packed words (see
+  // bit_packed_scan.hpp). After the early outs, search_value_id is a valid value ID.
+  const auto attribute_vector = segment.attribute_vector();
+  const auto* bit_packing_vector = dynamic_cast<const BitPackingVector*>(attribute_vector.get());
+  if (!position_filter && bit_packing_vector) {
+    auto lower_bound_value_id = search_value_id;
+    auto upper_bound_value_id = ValueID{search_value_id + 1};
+    if (predicate_condition == PredicateCondition::LessThan ||
+        predicate_condition == PredicateCondition::LessThanEquals) {
+      lower_bound_value_id = ValueID{0};
+      upper_bound_value_id = search_value_id;
+    } else if (predicate_condition == PredicateCondition::GreaterThan ||
+               predicate_condition == PredicateCondition::GreaterThanEquals) {
+      upper_bound_value_id = segment.null_value_id();
+    }
+
+    const auto invert = predicate_condition == PredicateCondition::NotEquals;
+    const auto bitmap = ranges ? scan_bit_packed_vector(*bit_packing_vector, lower_bound_value_id,
+                                                        upper_bound_value_id, invert, segment.null_value_id(), *ranges)
+                               : scan_bit_packed_vector(*bit_packing_vector, lower_bound_value_id,
+                                                        upper_bound_value_id, invert, segment.null_value_id());
+    append_bitmap_matches(bitmap, matches);
+    return;
+  }
+
   _with_operator_for_dict_segment_scan([&](auto predicate_comparator) {
     auto comparator = [predicate_comparator, search_value_id](const auto& position) {
       return predicate_comparator(position.value(), search_value_id);
@@ -169,21 +265,24 @@ void ColumnVsValueTableScanImpl::_scan_dictionary_segment(
       // dictionary.size() represents a NULL in the AttributeVector. For some PredicateConditions, we can
       // avoid explicitly checking for it, since the condition (e.g., LessThan) would never return true for
       // dictionary.size() anyway.
-      if (predicate_condition == PredicateCondition::Equals ||
-          predicate_condition == PredicateCondition::LessThanEquals ||
-          predicate_condition == PredicateCondition::LessThan) {
-        _scan_with_iterators<false>(comparator, it, end, chunk_id, matches);
-      } else {
-        _scan_with_iterators<true>(comparator, it, end, chunk_id, matches);
-      }
+      _for_each_range(ranges, it, end, [&](auto range_begin, auto range_end) {
+        if (predicate_condition == PredicateCondition::Equals ||
+            predicate_condition == PredicateCondition::LessThanEquals ||
+            predicate_condition == PredicateCondition::LessThan) {
+          _scan_with_iterators<false>(comparator, range_begin, range_end, matches);
+        } else {
+          _scan_with_iterators<true>(comparator, range_begin, range_end, matches);
+        }
+      });
     });
   });
 }
 
-void ColumnVsValueTableScanImpl::_scan_sorted_segment(const AbstractSegment& segment, const ChunkID chunk_id,
-                                                      RowIDPosList& matches,
+void ColumnVsValueTableScanImpl::_scan_sorted_segment(const AbstractSegment& segment,
+                                                      std::vector<ChunkOffset>& matches,
                                                       const std::shared_ptr<const AbstractPosList>& position_filter,
-                                                      const SortMode sort_mode) {
+                                                      const SortMode sort_mode,
+                                                      const std::optional<std::vector<ChunkOffsetRange>>& ranges) {
   resolve_data_and_segment_type(segment, [&](const auto type, const auto& typed_segment) {
     using ColumnDataType = typename decltype(type)::type;
 
@@ -192,10 +291,17 @@ void ColumnVsValueTableScanImpl::_scan_sorted_segment(const AbstractSegment& seg
     } else {
       auto segment_iterable = create_iterable_from_segment(typed_segment);
       segment_iterable.with_iterators(position_filter, [&](auto segment_begin, auto segment_end) {
+        // Matching rows of a sorted segment are located between the first and the last qualifying block. Narrowing the
+        // search range keeps the results identical, as any subrange of a sorted segment is sorted as well.
+        if (ranges) {
+          segment_end = segment_begin + static_cast<std::ptrdiff_t>(ranges->back().end);
+          segment_begin += static_cast<std::ptrdiff_t>(ranges->front().begin);
+        }
+
         auto sorted_segment_search = SortedSegmentSearch(segment_begin, segment_end, sort_mode, _column_is_nullable,
                                                          predicate_condition, boost::get<ColumnDataType>(value));
 
-        sorted_segment_search.scan_sorted_segment(chunk_id, matches, position_filter);
+        sorted_segment_search.scan_sorted_segment(matches, position_filter);
 
         if (sorted_segment_search.no_rows_matching) {
           ++num_chunks_with_early_out;
@@ -231,7 +337,7 @@ bool ColumnVsValueTableScanImpl::_value_matches_all(const BaseDictionarySegment&
   switch (predicate_condition) {
     case PredicateCondition::Equals:
       return search_value_id != INVALID_VALUE_ID && segment.value_of_value_id(search_value_id) == value &&
-             segment.unique_values_count() == size_t{1u};
+             segment.null_value_id() == ValueID{1u};
 
     case PredicateCondition::NotEquals:
       return search_value_id == INVALID_VALUE_ID || segment.value_of_value_id(search_value_id) != value;
@@ -257,7 +363,7 @@ bool ColumnVsValueTableScanImpl::_value_matches_none(const BaseDictionarySegment
 
     case PredicateCondition::NotEquals:
       return search_value_id != INVALID_VALUE_ID && value == segment.value_of_value_id(search_value_id) &&
-             segment.unique_values_count() == size_t{1u};
+             segment.null_value_id() == ValueID{1u};
 
     case PredicateCondition::LessThan:
     case PredicateCondition::LessThanEquals:
@@ -2,6 +2,7 @@
 
 #include <functional>
 #include <memory>
+#include <optional>
 #include <string>
 #include <tuple>
 #include <utility>
@@ -9,6 +10,8 @@
 
 #include "abstract_dereferenced_column_table_scan_impl.hpp"
 #include "all_type_variant.hpp"
+#include "storage/fsst_segment.hpp"
+#include "storage/segment_zone_map.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
@@ -21,6 +24,7 @@ namespace hyrise {
  * - For dictionary segments, we basically look up the value ID of the constant value in the dictionary
  *   in order to avoid having to look up each value ID of the attribute vector in the dictionary. This also
  *   enables us to detect if all or none of the values in the segment satisfy the expression.
+ * - For FSST segments, equality predicates are evaluated on the compressed values (see _scan_fsst_segment()).
  */
 class ColumnVsValueTableScanImpl : public AbstractDereferencedColumnTableScanImpl {
  public:
@@ -32,16 +36,26 @@ class ColumnVsValueTableScanImpl : public AbstractDereferencedColumnTableScanImp
   const AllTypeVariant value;
 
  protected:
-  void _scan_non_reference_segment(const AbstractSegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
+  void _scan_non_reference_segment(const AbstractSegment& segment, const ChunkID chunk_id,
+                                   std::vector<ChunkOffset>& matches,
                                    const std::shared_ptr<const AbstractPosList>& position_filter) override;
 
-  void _scan_generic_segment(const AbstractSegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
-                             const std::shared_ptr<const AbstractPosList>& position_filter) const;
-  void _scan_dictionary_segment(const BaseDictionarySegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
-                                const std::shared_ptr<const AbstractPosList>& position_filter);
-
-  void _scan_sorted_segment(const AbstractSegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
-                            const std::shared_ptr<const AbstractPosList>& position_filter, const SortMode sort_mode);
+  bool _chunk_can_be_skipped(const Chunk& chunk, const ColumnID column_id) const override;
+
+  // The scans only consider the given ranges of chunk offsets (see AbstractTableScanImpl::_qualifying_ranges()).
+  void _scan_generic_segment(const AbstractSegment& segment, std::vector<ChunkOffset>& matches,
+                             const std::shared_ptr<const AbstractPosList>& position_filter,
+                             const std::optional<std::vector<ChunkOffsetRange>>& ranges) const;
+  void _scan_dictionary_segment(const BaseDictionarySegment& segment, std::vector<ChunkOffset>& matches,
+                                const std::shared_ptr<const AbstractPosList>& position_filter,
+                                const std::optional<std::vector<ChunkOffsetRange>>& ranges);
+  void _scan_fsst_segment(const FSSTSegment<pmr_string>& segment, std::vector<ChunkOffset>& matches,
+                          const std::shared_ptr<const AbstractPosList>& position_filter,
+                          const std::optional<std::vector<ChunkOffsetRange>>& ranges) const;
+
+  void _scan_sorted_segment(const AbstractSegment& segment, std::vector<ChunkOffset>& matches,
+                            const std::shared_ptr<const AbstractPosList>& position_filter, const SortMode sort_mode,
+                            const std::optional<std::vector<ChunkOffsetRange>>& ranges);
 
   /**
    * @defgroup Methods used for handling dictionary segments
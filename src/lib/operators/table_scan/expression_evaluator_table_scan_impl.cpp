@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "expression/abstract_expression.hpp"
 #include "expression/evaluation/expression_evaluator.hpp"
@@ -18,9 +19,15 @@ std::string ExpressionEvaluatorTableScanImpl::description() const {
   return "ExpressionEvaluator";
 }
 
-std::shared_ptr<RowIDPosList> ExpressionEvaluatorTableScanImpl::scan_chunk(ChunkID chunk_id) {
-  return std::make_shared<RowIDPosList>(
-      ExpressionEvaluator{_in_table, chunk_id}.evaluate_expression_to_pos_list(*_expression));
+std::vector<ChunkOffset> ExpressionEvaluatorTableScanImpl::scan_chunk(ChunkID chunk_id) {
+  const auto pos_list = ExpressionEvaluator{_in_table, chunk_id}.evaluate_expression_to_pos_list(*_expression);
+
+  auto matches = std::vector<ChunkOffset>{};
+  matches.reserve(pos_list.size());
+  for (const auto& row_id : pos_list) {
+    matches.emplace_back(row_id.chunk_offset);
+  }
+  return matches;
 }
 
 }  // namespace hyrise
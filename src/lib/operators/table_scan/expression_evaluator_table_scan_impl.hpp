@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "abstract_table_scan_impl.hpp"
 #include "expression/abstract_expression.hpp"
@@ -23,7 +24,7 @@ class ExpressionEvaluatorTableScanImpl : public AbstractTableScanImpl {
                                    const std::shared_ptr<const AbstractExpression>& expression);
 
   std::string description() const override;
-  std::shared_ptr<RowIDPosList> scan_chunk(ChunkID chunk_id) override;
+  std::vector<ChunkOffset> scan_chunk(ChunkID chunk_id) override;
 
  private:
   std::shared_ptr<const Table> _in_table;
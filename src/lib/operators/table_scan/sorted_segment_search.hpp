@@ -5,12 +5,13 @@
 #include <optional>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include <boost/range.hpp>
 #include <boost/range/join.hpp>
 
 #include "all_type_variant.hpp"
-#include "storage/pos_lists/row_id_pos_list.hpp"
+#include "storage/pos_lists/abstract_pos_list.hpp"
 #include "types.hpp"
 
 namespace hyrise {
@@ -41,7 +42,7 @@ class SortedSegmentSearch {
         _nullable{nullable},
         _is_ascending{sorted_by == SortMode::Ascending} {}
 
-  void scan_sorted_segment(const ChunkID chunk_id, RowIDPosList& matches,
+  void scan_sorted_segment(std::vector<ChunkOffset>& matches,
                            const std::shared_ptr<const AbstractPosList>& position_filter) {
     if (_nullable) {
       // Decrease the effective sort range by excluding null values.
@@ -57,7 +58,7 @@ class SortedSegmentSearch {
     }
 
     if (_predicate_condition == PredicateCondition::NotEquals) {
-      _handle_not_equals(chunk_id, matches, position_filter);
+      _handle_not_equals(matches, position_filter);
       return;
     }
 
@@ -66,7 +67,7 @@ class SortedSegmentSearch {
     } else {
       _set_begin_and_end_positions_for_vs_value_scan();
     }
-    _write_rows_to_matches(_begin, _end, chunk_id, matches, position_filter);
+    _write_rows_to_matches(_begin, _end, matches, position_filter);
   }
 
   // Flags to indicate whether a shortcut was taken to skip scanning.
@@ -269,7 +270,7 @@ class SortedSegmentSearch {
    *
    * Note: All comments within this method are written from the point of ranges in ascending sort order.
    */
-  void _handle_not_equals(const ChunkID chunk_id, RowIDPosList& matches,
+  void _handle_not_equals(std::vector<ChunkOffset>& matches,
                           const std::shared_ptr<const AbstractPosList>& position_filter) {
     auto first_segment_value = _begin->value();
     auto last_segment_value = (_end - 1)->value();
@@ -279,7 +280,7 @@ class SortedSegmentSearch {
 
     if (_first_search_value < first_segment_value || _first_search_value > last_segment_value) {
       all_rows_matching = true;
-      _write_rows_to_matches(_begin, _end, chunk_id, matches, position_filter);
+      _write_rows_to_matches(_begin, _end, matches, position_filter);
       return;
     }
 
@@ -292,14 +293,14 @@ class SortedSegmentSearch {
     if (first_bound == _end) {
       // Neither the search value nor anything greater than it are found. Output the whole range and skip the call to
       // _get_last_bound().
-      _write_rows_to_matches(_begin, _end, chunk_id, matches, position_filter);
+      _write_rows_to_matches(_begin, _end, matches, position_filter);
       return;
     }
 
     if (first_bound->value() != _first_search_value) {
       // If the first value >= search value is not equal to the search value, then the search value doesn't occur at
       // all. Output the whole range and skip the call to _get_last_bound().
-      _write_rows_to_matches(_begin, _end, chunk_id, matches, position_filter);
+      _write_rows_to_matches(_begin, _end, matches, position_filter);
       return;
     }
 
@@ -308,25 +309,24 @@ class SortedSegmentSearch {
     if (last_bound == _end) {
       // If no value > search value is found, output everything from start to first occurrence and skip the need for
       // boost::join().
-      _write_rows_to_matches(_begin, first_bound, chunk_id, matches, position_filter);
+      _write_rows_to_matches(_begin, first_bound, matches, position_filter);
       return;
     }
 
     if (first_bound == _begin) {
       // If the search value is right at the start, output everything from the first value > search value to end and
       // skip the need for boost::join().
-      _write_rows_to_matches(last_bound, _end, chunk_id, matches, position_filter);
+      _write_rows_to_matches(last_bound, _end, matches, position_filter);
       return;
     }
 
     const auto range = boost::range::join(boost::make_iterator_range(_begin, first_bound),
                                           boost::make_iterator_range(last_bound, _end));
-    _write_rows_to_matches(range.begin(), range.end(), chunk_id, matches, position_filter);
+    _write_rows_to_matches(range.begin(), range.end(), matches, position_filter);
   }
 
   template <typename ResultIteratorType>
-  void _write_rows_to_matches(ResultIteratorType begin, ResultIteratorType end, const ChunkID chunk_id,
-                              RowIDPosList& matches,
+  void _write_rows_to_matches(ResultIteratorType begin, ResultIteratorType end, std::vector<ChunkOffset>& matches,
                               const std::shared_ptr<const AbstractPosList>& position_filter) const {
     if (begin == end) {
       return;
@@ -348,7 +348,7 @@ class SortedSegmentSearch {
      */
     if (position_filter || _predicate_condition == PredicateCondition::NotEquals) {
       for (; begin != end; ++begin) {
-        matches[output_idx] = RowID{chunk_id, begin->chunk_offset()};
+        matches[output_idx] = begin->chunk_offset();
         ++output_idx;
       }
     } else {
@@ -356,7 +356,7 @@ class SortedSegmentSearch {
       const auto distance = std::distance(begin, end);
 
       for (auto chunk_offset = ChunkOffset{0}; chunk_offset < distance; ++chunk_offset) {
-        matches[output_idx] = RowID{chunk_id, ChunkOffset{first_offset + chunk_offset}};
+        matches[output_idx] = ChunkOffset{first_offset + chunk_offset};
         ++output_idx;
       }
     }
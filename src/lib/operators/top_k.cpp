@@ -0,0 +1,554 @@
+#include "top_k.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "hyrise.hpp"
+#include "operators/abstract_operator.hpp"
+#include "operators/abstract_read_only_operator.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
+#include "sort/normalized_key.hpp"
+#include "statistics/attribute_statistics.hpp"
+#include "statistics/base_attribute_statistics.hpp"
+#include "statistics/statistics_objects/min_max_filter.hpp"
+#include "statistics/statistics_objects/range_filter.hpp"
+#include "storage/base_segment_accessor.hpp"
+#include "storage/chunk.hpp"
+#include "storage/create_iterable_from_segment.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+#include "utils/timer.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT(build/namespaces)
+
+// Returns the pruning statistics that cover the values of a segment. For ReferenceSegments, the statistics of the
+// referenced chunk are returned if the segment references a single chunk.
+std::shared_ptr<const BaseAttributeStatistics> pruning_statistics_for_segment(const Table& table,
+                                                                              const ChunkID chunk_id,
+                                                                              const ColumnID column_id) {
+  auto chunk = table.get_chunk(chunk_id);
+  auto statistics_column_id = column_id;
+
+  if (table.type() == TableType::References) {
+    const auto& reference_segment = static_cast<const ReferenceSegment&>(*chunk->get_segment(column_id));
+    const auto& pos_list = reference_segment.pos_list();
+    if (pos_list->empty() || !pos_list->references_single_chunk()) {
+      return nullptr;
+    }
+
+    chunk = reference_segment.referenced_table()->get_chunk(pos_list->common_chunk_id());
+    statistics_column_id = reference_segment.referenced_column_id();
+  }
+
+  if (!chunk || !chunk->pruning_statistics()) {
+    return nullptr;
+  }
+
+  return (*chunk->pruning_statistics())[statistics_column_id];
+}
+
+/**
+ * Selects the first k rows of a table. Rows are stored in Candidates, which hold the normalized keys, the full values
+ * of string sort columns (to break ties between equal prefixes), and the positions of the rows.
+ */
+class TopKImpl {
+ public:
+  // A row to be compared. `position` is the row's position in the input table, which is used to break ties.
+  struct Row {
+    const uint8_t* key;
+    const pmr_string* strings;
+    size_t position;
+  };
+
+  struct Candidates {
+    std::vector<uint8_t> keys;
+    std::vector<pmr_string> strings;
+    std::vector<RowID> row_ids;
+    std::vector<size_t> positions;
+
+    // Slots of the candidates. While rows are selected, this is a heap with the worst candidate in front. Afterwards,
+    // the slots are sorted.
+    std::vector<size_t> order;
+  };
+
+  TopKImpl(const std::shared_ptr<const Table>& table, const std::vector<SortColumnDefinition>& sort_definitions,
+           const size_t k, TopK::PerformanceData& performance_data)
+      : _table(table), _k(k), _performance_data(performance_data) {
+    _sort_columns.reserve(sort_definitions.size());
+    for (const auto& sort_definition : sort_definitions) {
+      auto& sort_column = _sort_columns.emplace_back();
+      sort_column.column_id = sort_definition.column;
+      sort_column.sort_mode = sort_definition.sort_mode;
+      sort_column.key_offset = _key_bytes;
+
+      resolve_data_type(_table->column_data_type(sort_definition.column), [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+        if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+          sort_column.string_index = _string_column_count;
+          ++_string_column_count;
+        }
+        if (_sort_columns.size() == 1) {
+          _first_value_bytes = normalized_value_bytes<ColumnDataType>();
+        }
+        _key_bytes += 1 + normalized_value_bytes<ColumnDataType>();
+      });
+    }
+
+    _can_prune = !_table->column_is_nullable(_sort_columns.front().column_id);
+  }
+
+  // Selects the best k rows from the given chunks. The returned candidates are sorted.
+  Candidates select(const ChunkID begin_chunk_id, const ChunkID end_chunk_id,
+                    const std::vector<size_t>& chunk_row_offsets) {
+    auto candidates = Candidates{};
+    const auto slot_less = [&](const size_t lhs, const size_t rhs) {
+      return less(_row(candidates, lhs), _row(candidates, rhs));
+    };
+
+    auto chunk_keys = std::vector<uint8_t>{};
+    auto chunk_strings = std::vector<pmr_string>{};
+
+    for (auto chunk_id = begin_chunk_id; chunk_id < end_chunk_id; ++chunk_id) {
+      if (_can_skip_chunk(chunk_id)) {
+        ++_performance_data.num_chunks_pruned;
+        continue;
+      }
+
+      const auto chunk = _table->get_chunk(chunk_id);
+      Assert(chunk, "Did not expect deleted chunk here.");  // see https://github.com/hyrise/hyrise/issues/1686
+      const auto chunk_size = chunk->size();
+
+      chunk_keys.assign(chunk_size * _key_bytes, uint8_t{0});
+      chunk_strings.resize(chunk_size * _string_column_count);
+      for (const auto& sort_column : _sort_columns) {
+        resolve_data_type(_table->column_data_type(sort_column.column_id), [&](auto type) {
+          using ColumnDataType = typename decltype(type)::type;
+
+          write_normalized_segment<ColumnDataType>(
+              *chunk->get_segment(sort_column.column_id), sort_column.sort_mode, &chunk_keys[sort_column.key_offset],
+              _key_bytes, [&](const ChunkOffset chunk_offset, const ColumnDataType& value) {
+                if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+                  chunk_strings[chunk_offset * _string_column_count + *sort_column.string_index] = value;
+                }
+              });
+        });
+      }
+
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+        const auto row = Row{&chunk_keys[chunk_offset * _key_bytes],
+                             chunk_strings.data() + chunk_offset * _string_column_count,
+                             chunk_row_offsets[chunk_id] + chunk_offset};
+
+        if (candidates.order.size() < _k) {
+          const auto slot = candidates.order.size();
+          candidates.keys.resize((slot + 1) * _key_bytes);
+          candidates.strings.resize((slot + 1) * _string_column_count);
+          candidates.row_ids.resize(slot + 1);
+          candidates.positions.resize(slot + 1);
+          _store(candidates, slot, row, RowID{chunk_id, chunk_offset});
+          candidates.order.emplace_back(slot);
+          std::push_heap(candidates.order.begin(), candidates.order.end(), slot_less);
+          continue;
+        }
+
+        if (!less(row, _row(candidates, candidates.order.front()))) {
+          continue;
+        }
+
+        std::pop_heap(candidates.order.begin(), candidates.order.end(), slot_less);
+        _store(candidates, candidates.order.back(), row, RowID{chunk_id, chunk_offset});
+        std::push_heap(candidates.order.begin(), candidates.order.end(), slot_less);
+      }
+
+      if (candidates.order.size() == _k) {
+        _update_threshold(_row(candidates, candidates.order.front()));
+      }
+    }
+
+    std::sort_heap(candidates.order.begin(), candidates.order.end(), slot_less);
+    return candidates;
+  }
+
+  // Merges two sorted sets of candidates and keeps the best k rows.
+  Candidates merge(const Candidates& lhs, const Candidates& rhs) const {
+    const auto row_count = std::min(lhs.order.size() + rhs.order.size(), _k);
+
+    auto merged = Candidates{};
+    merged.keys.resize(row_count * _key_bytes);
+    merged.strings.resize(row_count * _string_column_count);
+    merged.row_ids.resize(row_count);
+    merged.positions.resize(row_count);
+    merged.order.resize(row_count);
+
+    auto lhs_index = size_t{0};
+    auto rhs_index = size_t{0};
+    for (auto slot = size_t{0}; slot < row_count; ++slot) {
+      const auto take_lhs =
+          rhs_index == rhs.order.size() ||
+          (lhs_index < lhs.order.size() &&
+           less(_row(lhs, lhs.order[lhs_index]), _row(rhs, rhs.order[rhs_index])));
+      const auto& source = take_lhs ? lhs : rhs;
+      const auto source_slot = take_lhs ? lhs.order[lhs_index++] : rhs.order[rhs_index++];
+
+      _store(merged, slot, _row(source, source_slot), source.row_ids[source_slot]);
+      merged.order[slot] = slot;
+    }
+
+    return merged;
+  }
+
+  // Compares two rows by their normalized keys. Strings that share their prefix are compared in full before the
+  // remainder of the key is compared.
+  bool less(const Row& lhs, const Row& rhs) const {
+    auto key_offset = size_t{0};
+    for (const auto& sort_column : _sort_columns) {
+      if (!sort_column.string_index) {
+        continue;
+      }
+
+      const auto string_prefix_end = sort_column.key_offset + 1 + NORMALIZED_KEY_STRING_PREFIX_BYTES;
+      const auto result = std::memcmp(lhs.key + key_offset, rhs.key + key_offset, string_prefix_end - key_offset);
+      if (result != 0) {
+        return result < 0;
+      }
+      key_offset = string_prefix_end;
+
+      // Both values are NULL.
+      if (lhs.key[sort_column.key_offset] == 0) {
+        continue;
+      }
+
+      const auto& lhs_value = lhs.strings[*sort_column.string_index];
+      const auto& rhs_value = rhs.strings[*sort_column.string_index];
+      if (lhs_value != rhs_value) {
+        return (lhs_value < rhs_value) == (sort_column.sort_mode == SortMode::Ascending);
+      }
+    }
+
+    const auto result = std::memcmp(lhs.key + key_offset, rhs.key + key_offset, _key_bytes - key_offset);
+    if (result != 0) {
+      return result < 0;
+    }
+
+    return lhs.position < rhs.position;
+  }
+
+ protected:
+  struct SortColumn {
+    ColumnID column_id{INVALID_COLUMN_ID};
+    SortMode sort_mode{SortMode::Ascending};
+    // Offset of the column's NULL byte in the normalized key.
+    size_t key_offset{0};
+    // Index of the column's value in the strings of a row. Only set for string columns.
+    std::optional<size_t> string_index;
+  };
+
+  Row _row(const Candidates& candidates, const size_t slot) const {
+    return Row{&candidates.keys[slot * _key_bytes], candidates.strings.data() + slot * _string_column_count,
+               candidates.positions[slot]};
+  }
+
+  void _store(Candidates& candidates, const size_t slot, const Row& row, const RowID row_id) const {
+    std::memcpy(&candidates.keys[slot * _key_bytes], row.key, _key_bytes);
+    std::copy(row.strings, row.strings + _string_column_count, candidates.strings.data() + slot * _string_column_count);
+    candidates.row_ids[slot] = row_id;
+    candidates.positions[slot] = row.position;
+  }
+
+  // The threshold is the normalized value of the first sort column of the worst row in a full heap. As the heap of
+  // each job holds k rows, the result does not contain rows that are ordered after any threshold.
+  void _update_threshold(const Row& worst_row) {
+    if (!_can_prune) {
+      return;
+    }
+
+    const auto* const value = worst_row.key + 1;
+    const auto lock = std::lock_guard<std::mutex>{_threshold_mutex};
+    if (_threshold.empty() || std::memcmp(value, _threshold.data(), _first_value_bytes) < 0) {
+      _threshold.assign(value, value + _first_value_bytes);
+    }
+    _has_threshold = true;
+  }
+
+  bool _can_skip_chunk(const ChunkID chunk_id) {
+    if (!_has_threshold) {
+      return false;
+    }
+
+    const auto& sort_column = _sort_columns.front();
+    const auto statistics = pruning_statistics_for_segment(*_table, chunk_id, sort_column.column_id);
+    if (!statistics) {
+      return false;
+    }
+
+    auto can_skip = false;
+    resolve_data_type(_table->column_data_type(sort_column.column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      const auto attribute_statistics =
+          std::dynamic_pointer_cast<const AttributeStatistics<ColumnDataType>>(statistics);
+      if (!attribute_statistics) {
+        return;
+      }
+
+      // The value of the chunk that would be ordered first.
+      const auto ascending = sort_column.sort_mode == SortMode::Ascending;
+      auto best_value = std::optional<ColumnDataType>{};
+      if (attribute_statistics->min_max_filter) {
+        best_value = ascending ? attribute_statistics->min_max_filter->min : attribute_statistics->min_max_filter->max;
+      } else if constexpr (std::is_arithmetic_v<ColumnDataType>) {
+        const auto& range_filter = attribute_statistics->range_filter;
+        if (range_filter && !range_filter->ranges.empty()) {
+          best_value = ascending ? range_filter->ranges.front().first : range_filter->ranges.back().second;
+        }
+      }
+
+      if (!best_value) {
+        return;
+      }
+
+      auto best_key = std::vector<uint8_t>(_first_value_bytes);
+      write_normalized_value(*best_value, best_key.data());
+      if (!ascending) {
+        for (auto& byte : best_key) {
+          byte = ~byte;
+        }
+      }
+
+      // For strings, only the prefixes are compared. A larger prefix implies a larger string, so skipping the chunk is
+      // still correct. Equal values are not skipped, as they might be ordered first due to the following columns.
+      const auto lock = std::lock_guard<std::mutex>{_threshold_mutex};
+      can_skip = std::memcmp(best_key.data(), _threshold.data(), _first_value_bytes) > 0;
+    });
+
+    return can_skip;
+  }
+
+  // NOLINTBEGIN(cppcoreguidelines-avoid-const-or-ref-data-members)
+  const std::shared_ptr<const Table> _table;
+  const size_t _k;
+  TopK::PerformanceData& _performance_data;
+  // NOLINTEND(cppcoreguidelines-avoid-const-or-ref-data-members)
+
+  std::vector<SortColumn> _sort_columns;
+  size_t _key_bytes{0};
+  size_t _string_column_count{0};
+
+  // Number of bytes of the first sort column's normalized value.
+  size_t _first_value_bytes{0};
+  bool _can_prune{false};
+
+  std::atomic_bool _has_threshold{false};
+  std::mutex _threshold_mutex;
+  std::vector<uint8_t> _threshold;
+};
+
+// Writes the rows given by the sorted candidates into ValueSegments.
+std::shared_ptr<Table> write_output_table(const Table& input_table, const TopKImpl::Candidates& candidates) {
+  const auto output_table = std::make_shared<Table>(input_table.column_definitions(), TableType::Data);
+  const auto row_count = candidates.order.size();
+  const auto output_chunk_size = static_cast<size_t>(Chunk::DEFAULT_SIZE);
+  const auto output_chunk_count = (row_count + output_chunk_size - 1) / output_chunk_size;
+  auto output_segments_by_chunk = std::vector<Segments>(output_chunk_count);
+
+  const auto input_chunk_count = input_table.chunk_count();
+  const auto column_count = input_table.column_count();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    const auto column_is_nullable = input_table.column_is_nullable(column_id);
+
+    resolve_data_type(input_table.column_data_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      auto accessor_by_chunk_id =
+          std::vector<std::unique_ptr<AbstractSegmentAccessor<ColumnDataType>>>(input_chunk_count);
+      for (const auto& row_id : candidates.row_ids) {
+        auto& accessor = accessor_by_chunk_id[row_id.chunk_id];
+        if (!accessor) {
+          accessor = create_segment_accessor<ColumnDataType>(
+              input_table.get_chunk(row_id.chunk_id)->get_segment(column_id));
+        }
+      }
+
+      for (auto output_chunk_id = size_t{0}; output_chunk_id < output_chunk_count; ++output_chunk_id) {
+        const auto begin_row = output_chunk_id * output_chunk_size;
+        const auto end_row = std::min(begin_row + output_chunk_size, row_count);
+
+        auto values = pmr_vector<ColumnDataType>(end_row - begin_row);
+        auto null_values = pmr_vector<bool>(column_is_nullable ? end_row - begin_row : 0);
+        for (auto row = begin_row; row < end_row; ++row) {
+          const auto& row_id = candidates.row_ids[candidates.order[row]];
+          const auto typed_value = accessor_by_chunk_id[row_id.chunk_id]->access(row_id.chunk_offset);
+          if (typed_value) {
+            values[row - begin_row] = *typed_value;
+          } else {
+            null_values[row - begin_row] = true;
+          }
+        }
+
+        if (column_is_nullable) {
+          output_segments_by_chunk[output_chunk_id].emplace_back(
+              std::make_shared<ValueSegment<ColumnDataType>>(std::move(values), std::move(null_values)));
+        } else {
+          output_segments_by_chunk[output_chunk_id].emplace_back(
+              std::make_shared<ValueSegment<ColumnDataType>>(std::move(values)));
+        }
+      }
+    });
+  }
+
+  for (auto& segments : output_segments_by_chunk) {
+    output_table->append_chunk(segments);
+  }
+
+  return output_table;
+}
+
+}  // namespace
+
+namespace hyrise {
+
+TopK::TopK(const std::shared_ptr<const AbstractOperator>& input_operator,
+           const std::vector<SortColumnDefinition>& sort_definitions, const size_t k)
+    : AbstractReadOnlyOperator(OperatorType::TopK, input_operator, nullptr, std::make_unique<PerformanceData>()),
+      _sort_definitions(sort_definitions),
+      _k(k) {
+  DebugAssert(!_sort_definitions.empty(), "Expected at least one sort criterion");
+}
+
+const std::vector<SortColumnDefinition>& TopK::sort_definitions() const {
+  return _sort_definitions;
+}
+
+size_t TopK::k() const {
+  return _k;
+}
+
+const std::string& TopK::name() const {
+  static const auto name = std::string{"TopK"};
+  return name;
+}
+
+std::string TopK::description(DescriptionMode description_mode) const {
+  const auto separator = (description_mode == DescriptionMode::SingleLine ? ' ' : '\n');
+
+  auto stream = std::stringstream{};
+  stream << AbstractOperator::description(description_mode) << separator << "k: " << _k;
+  return stream.str();
+}
+
+std::shared_ptr<AbstractOperator> TopK::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_left_input,
+    const std::shared_ptr<AbstractOperator>& /*copied_right_input*/,
+    std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& /*copied_ops*/) const {
+  return std::make_shared<TopK>(copied_left_input, _sort_definitions, _k);
+}
+
+void TopK::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
+
+std::shared_ptr<const Table> TopK::_on_execute() {
+  const auto& input_table = left_input_table();
+
+  for (const auto& column_sort_definition : _sort_definitions) {
+    Assert(column_sort_definition.column != INVALID_COLUMN_ID, "TopK: Invalid column in sort definition");
+    Assert(column_sort_definition.column < input_table->column_count(),
+           "TopK: Column ID is greater than table's column count");
+  }
+
+  if (input_table->row_count() == 0 || _k == 0) {
+    return Table::create_dummy_table(input_table->column_definitions());
+  }
+
+  auto& step_performance_data = dynamic_cast<PerformanceData&>(*performance_data);
+  auto timer = Timer{};
+  auto impl = TopKImpl{input_table, _sort_definitions, _k, step_performance_data};
+
+  // Small chunks are bundled together to avoid unnecessary scheduling overhead.
+  const auto chunk_count = input_table->chunk_count();
+  auto chunk_row_offsets = std::vector<size_t>(chunk_count);
+  auto job_begin_chunk_ids = std::vector<ChunkID>{};
+  auto row_count = size_t{0};
+  auto job_row_count = size_t{0};
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = input_table->get_chunk(chunk_id);
+    Assert(chunk, "Did not expect deleted chunk here.");  // see https://github.com/hyrise/hyrise/issues/1686
+
+    if (job_begin_chunk_ids.empty() || job_row_count >= Chunk::DEFAULT_SIZE) {
+      job_begin_chunk_ids.emplace_back(chunk_id);
+      job_row_count = 0;
+    }
+    chunk_row_offsets[chunk_id] = row_count;
+    row_count += chunk->size();
+    job_row_count += chunk->size();
+  }
+
+  const auto job_count = job_begin_chunk_ids.size();
+  auto candidates = std::vector<TopKImpl::Candidates>(job_count);
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(job_count);
+  for (auto job_index = size_t{0}; job_index < job_count; ++job_index) {
+    const auto begin_chunk_id = job_begin_chunk_ids[job_index];
+    const auto end_chunk_id = job_index + 1 < job_count ? job_begin_chunk_ids[job_index + 1] : chunk_count;
+    jobs.emplace_back(std::make_shared<JobTask>([&, job_index, begin_chunk_id, end_chunk_id] {
+      candidates[job_index] = impl.select(begin_chunk_id, end_chunk_id, chunk_row_offsets);
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+  step_performance_data.set_step_runtime(OperatorSteps::SelectCandidates, timer.lap());
+
+  // Merge pairs of candidates until a single set of candidates is left.
+  while (candidates.size() > 1) {
+    const auto merged_count = (candidates.size() + 1) / 2;
+    auto merged_candidates = std::vector<TopKImpl::Candidates>(merged_count);
+
+    jobs.clear();
+    for (auto merged_index = size_t{0}; merged_index < merged_count; ++merged_index) {
+      const auto lhs_index = 2 * merged_index;
+      if (lhs_index + 1 == candidates.size()) {
+        merged_candidates[merged_index] = std::move(candidates[lhs_index]);
+        continue;
+      }
+
+      jobs.emplace_back(std::make_shared<JobTask>([&, merged_index, lhs_index] {
+        merged_candidates[merged_index] = impl.merge(candidates[lhs_index], candidates[lhs_index + 1]);
+      }));
+    }
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+    candidates = std::move(merged_candidates);
+  }
+  step_performance_data.set_step_runtime(OperatorSteps::MergeCandidates, timer.lap());
+
+  const auto output_table = write_output_table(*input_table, candidates.front());
+
+  const auto output_chunk_count = output_table->chunk_count();
+  for (auto output_chunk_id = ChunkID{0}; output_chunk_id < output_chunk_count; ++output_chunk_id) {
+    const auto& output_chunk = output_table->get_chunk(output_chunk_id);
+    output_chunk->set_immutable();
+    output_chunk->set_individually_sorted_by(_sort_definitions.front());
+  }
+
+  step_performance_data.set_step_runtime(OperatorSteps::WriteOutput, timer.lap());
+  return output_table;
+}
+
+}  // namespace hyrise
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "abstract_read_only_operator.hpp"
+#include "operators/operator_performance_data.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+/**
+ * Operator that outputs the first k rows of a table when ordered by one or multiple columns. It is equivalent to a
+ * Sort followed by a Limit, but does not sort the entire input. Chunks are processed in parallel jobs, each keeping a
+ * bounded heap of the best k rows it has seen. Rows are compared by their normalized keys (see normalized_key.hpp).
+ * Afterwards, the heaps are merged pairwise in parallel.
+ *
+ * Once the heap of a job is full, its worst row provides a threshold for the first sort column. Chunks whose pruning
+ * statistics (MinMaxFilter or RangeFilter) show that all of their values are ordered after the threshold cannot
+ * contribute to the result and are skipped. For referencing input tables, the statistics of the referenced chunk are
+ * used if a chunk references a single chunk. As pruning statistics do not cover NULLs, which are ordered first,
+ * chunks are only skipped if the first sort column is not nullable.
+ *
+ * Like the Sort operator, TopK is stable and orders NULLs first. As the output is small, it is always materialized.
+ * TopK operators are created by the LQPTranslator for SortNodes that have been marked by the TopKRule.
+ */
+class TopK : public AbstractReadOnlyOperator {
+ public:
+  enum class OperatorSteps : uint8_t { SelectCandidates, MergeCandidates, WriteOutput };
+
+  struct PerformanceData : public OperatorPerformanceData<OperatorSteps> {
+    std::atomic_size_t num_chunks_pruned{0};
+
+    void output_to_stream(std::ostream& stream, DescriptionMode description_mode) const override {
+      OperatorPerformanceData<OperatorSteps>::output_to_stream(stream, description_mode);
+
+      const auto separator = (description_mode == DescriptionMode::SingleLine ? ' ' : '\n');
+      stream << separator << "Chunks: " << num_chunks_pruned.load() << " skipped by pruning statistics.";
+    }
+  };
+
+  TopK(const std::shared_ptr<const AbstractOperator>& input_operator,
+       const std::vector<SortColumnDefinition>& sort_definitions, const size_t k);
+
+  const std::vector<SortColumnDefinition>& sort_definitions() const;
+
+  size_t k() const;
+
+  const std::string& name() const override;
+
+  std::string description(DescriptionMode description_mode) const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_left_input,
+      const std::shared_ptr<AbstractOperator>& /*copied_right_input*/,
+      std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& /*copied_ops*/) const override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+
+  const std::vector<SortColumnDefinition> _sort_definitions;
+  const size_t _k;
+};
+
+}  // namespace hyrise
@@ -16,6 +16,8 @@
 #include "operators/abstract_read_only_operator.hpp"
 #include "storage/chunk.hpp"
 #include "storage/pos_lists/abstract_pos_list.hpp"
+#include "storage/pos_lists/compressed_pos_list.hpp"
+#include "storage/pos_lists/entire_chunk_pos_list.hpp"
 #include "storage/pos_lists/row_id_pos_list.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/table.hpp"
@@ -34,6 +36,10 @@
  * ReferenceMatrices.
  * Using a implementation derived from std::set_union, the two virtual pos lists are merged into the result table.
  *
+ * If both inputs consist of a single ColumnCluster and each of their chunks references a different chunk with a
+ * sorted, duplicate-free PosList (as produced by TableScans), no sorting is required at all. For each referenced chunk,
+ * the PosLists of both inputs are united with a bitmap OR (see CompressedPosList::unite).
+ *
  *
  * ### About ReferenceMatrices
  * The ReferenceMatrix consists of N rows and X columns of RowIDs.
@@ -92,6 +98,11 @@ std::shared_ptr<const Table> UnionPositions::_on_execute() {
     return early_result;
   }
 
+  const auto compressed_result = _unite_compressed_pos_lists();
+  if (compressed_result) {
+    return compressed_result;
+  }
+
   const auto& left_in_table = *left_input_table();
 
   /**
@@ -337,6 +348,93 @@ std::shared_ptr<const Table> UnionPositions::_prepare_operator() {
   return nullptr;
 }
 
+std::shared_ptr<const Table> UnionPositions::_unite_compressed_pos_lists() const {
+  if (_column_cluster_offsets.size() != 1) {
+    return nullptr;
+  }
+
+  const auto& referenced_table = _referenced_tables.front();
+  const auto referenced_chunk_count = referenced_table->chunk_count();
+
+  // UnionPositions removes duplicates and emits the remaining RowIDs in sorted order. CompressedPosLists and
+  // EntireChunkPosLists are sorted and free of duplicates, so uniting the offsets of all PosLists that reference the
+  // same chunk yields exactly the output of the general path, one chunk per referenced chunk. We only take this path
+  // if every input chunk references a single chunk and each referenced chunk is referenced by at most one chunk per
+  // input, which is the case for the outputs of scans on the same table. This bounds the number of unions per
+  // referenced chunk to two.
+  const auto is_eligible = [&](const Table& table) {
+    auto chunk_is_referenced = std::vector<bool>(referenced_chunk_count, false);
+    const auto chunk_count = table.chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto& segment = static_cast<const ReferenceSegment&>(*table.get_chunk(chunk_id)->get_segment(ColumnID{0}));
+      const auto& pos_list = segment.pos_list();
+      if (pos_list->empty()) {
+        continue;
+      }
+
+      if (!std::dynamic_pointer_cast<const CompressedPosList>(pos_list) &&
+          !std::dynamic_pointer_cast<const EntireChunkPosList>(pos_list)) {
+        return false;
+      }
+
+      const auto referenced_chunk_id = pos_list->common_chunk_id();
+      if (referenced_chunk_id >= referenced_chunk_count || chunk_is_referenced[referenced_chunk_id]) {
+        return false;
+      }
+      chunk_is_referenced[referenced_chunk_id] = true;
+    }
+    return true;
+  };
+
+  if (!is_eligible(*left_input_table()) || !is_eligible(*right_input_table())) {
+    return nullptr;
+  }
+
+  auto pos_lists = std::vector<std::shared_ptr<const CompressedPosList>>(referenced_chunk_count);
+  const auto unite = [&](const Table& table) {
+    const auto chunk_count = table.chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto& segment = static_cast<const ReferenceSegment&>(*table.get_chunk(chunk_id)->get_segment(ColumnID{0}));
+      const auto& pos_list = segment.pos_list();
+      if (pos_list->empty()) {
+        continue;
+      }
+
+      const auto referenced_chunk_id = pos_list->common_chunk_id();
+      auto compressed_pos_list = std::dynamic_pointer_cast<const CompressedPosList>(pos_list);
+      if (!compressed_pos_list) {
+        auto offsets = std::vector<ChunkOffset>(pos_list->size());
+        std::iota(offsets.begin(), offsets.end(), ChunkOffset{0});
+        compressed_pos_list = std::make_shared<CompressedPosList>(referenced_chunk_id, std::move(offsets));
+      }
+
+      auto& united_pos_list = pos_lists[referenced_chunk_id];
+      united_pos_list =
+          united_pos_list ? CompressedPosList::unite(*united_pos_list, *compressed_pos_list) : compressed_pos_list;
+    }
+  };
+  unite(*left_input_table());
+  unite(*right_input_table());
+
+  auto out_table = std::make_shared<Table>(left_input_table()->column_definitions(), TableType::References);
+  const auto column_count = out_table->column_count();
+  for (const auto& pos_list : pos_lists) {
+    if (!pos_list) {
+      continue;
+    }
+
+    auto output_segments = Segments{};
+    output_segments.reserve(column_count);
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      output_segments.emplace_back(
+          std::make_shared<ReferenceSegment>(referenced_table, _referenced_column_ids[column_id], pos_list));
+    }
+    out_table->append_chunk(output_segments);
+  }
+
+  return out_table;
+}
+
 UnionPositions::ReferenceMatrix UnionPositions::_build_reference_matrix(
     const std::shared_ptr<const Table>& input_table) const {
   ReferenceMatrix reference_matrix;
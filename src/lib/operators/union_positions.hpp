@@ -111,6 +111,15 @@ class UnionPositions : public AbstractReadOnlyOperator {
    */
   std::shared_ptr<const Table> _prepare_operator();
 
+  /**
+   * Fast path for inputs whose chunks each reference a different chunk of a single table using a sorted PosList
+   * (CompressedPosList or EntireChunkPosList), as produced by TableScans on the same table. Instead of sorting and
+   * merging ReferenceMatrices, the PosLists referencing the same chunk are united with bitmap ORs.
+   *
+   * @returns the result table or nullptr if the inputs are not eligible for the fast path.
+   */
+  std::shared_ptr<const Table> _unite_compressed_pos_lists() const;
+
   UnionPositions::ReferenceMatrix _build_reference_matrix(const std::shared_ptr<const Table>& input_table) const;
   static bool _compare_reference_matrix_rows(const ReferenceMatrix& left_matrix, size_t left_row_idx,
                                              const ReferenceMatrix& right_matrix, size_t right_row_idx);
@@ -0,0 +1,723 @@
+#include "window.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <span>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <boost/container_hash/hash.hpp>
+
+#include "all_type_variant.hpp"
+#include "expression/pqp_column_expression.hpp"
+#include "expression/window_expression.hpp"
+#include "expression/window_function_expression.hpp"
+#include "hyrise.hpp"
+#include "operators/abstract_operator.hpp"
+#include "operators/abstract_read_only_operator.hpp"
+#include "operators/aggregate/window_function_traits.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
+#include "sort/normalized_key.hpp"
+#include "storage/chunk.hpp"
+#include "storage/pos_lists/entire_chunk_pos_list.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+#include "utils/timer.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT(build/namespaces)
+
+// Window partitions are distributed to hash partitions of about this size, each of which is sorted and evaluated by a
+// separate job.
+constexpr auto ROWS_PER_HASH_PARTITION = size_t{1} << 15;
+constexpr auto MAX_HASH_PARTITION_COUNT = size_t{256};
+
+ColumnID column_id_of(const AbstractExpression& expression) {
+  Assert(expression.type == ExpressionType::PQPColumn,
+         "Window: Expected '" + expression.as_column_name() + "' to be a column of the input table.");
+  return static_cast<const PQPColumnExpression&>(expression).column_id;
+}
+
+/**
+ * Evaluates a window function on a table. Rows are identified by their position in the table, i.e., the number of
+ * rows in previous chunks plus their chunk offset. The normalized keys of the PARTITION BY columns (always ordered
+ * ascending) are followed by the keys of the ORDER BY columns. The full values of string columns are kept to compare
+ * strings that share their prefix.
+ */
+template <typename ArgumentType>
+class WindowImpl {
+ public:
+  WindowImpl(const std::shared_ptr<const Table>& table, const WindowFunction window_function,
+             const FrameDescription& frame_description, const std::vector<ColumnID>& partition_by_column_ids,
+             const std::vector<SortColumnDefinition>& order_by_definitions,
+             const std::optional<ColumnID>& argument_column_id)
+      : _table(table),
+        _window_function(window_function),
+        _frame_description(frame_description),
+        _argument_column_id(argument_column_id),
+        _partition_column_count(partition_by_column_ids.size()) {
+    for (const auto column_id : partition_by_column_ids) {
+      _add_key_column(column_id, SortMode::Ascending);
+    }
+    _partition_key_bytes = _key_bytes;
+
+    for (const auto& order_by_definition : order_by_definitions) {
+      _add_key_column(order_by_definition.column, order_by_definition.sort_mode);
+    }
+
+    const auto row_count = _table->row_count();
+    _keys.resize(row_count * _key_bytes);
+    _strings.resize(row_count * _string_column_count);
+    if (_argument_column_id) {
+      _argument_values.resize(row_count);
+      _argument_null_values.resize(row_count);
+    }
+  }
+
+  // Materializes the keys and argument values of the given chunks and assigns their rows to hash partitions. Returns
+  // the positions of the rows for each hash partition.
+  std::vector<std::vector<size_t>> partition(const ChunkID begin_chunk_id, const ChunkID end_chunk_id,
+                                             const std::vector<size_t>& chunk_row_offsets,
+                                             const size_t hash_partition_count) {
+    auto hash_partitions = std::vector<std::vector<size_t>>(hash_partition_count);
+
+    for (auto chunk_id = begin_chunk_id; chunk_id < end_chunk_id; ++chunk_id) {
+      const auto chunk = _table->get_chunk(chunk_id);
+      Assert(chunk, "Did not expect deleted chunk here.");  // see https://github.com/hyrise/hyrise/issues/1686
+      const auto chunk_size = chunk->size();
+      const auto row_offset = chunk_row_offsets[chunk_id];
+
+      for (const auto& key_column : _key_columns) {
+        resolve_data_type(_table->column_data_type(key_column.column_id), [&](auto type) {
+          using ColumnDataType = typename decltype(type)::type;
+
+          write_normalized_segment<ColumnDataType>(
+              *chunk->get_segment(key_column.column_id), key_column.sort_mode,
+              &_keys[row_offset * _key_bytes + key_column.key_offset], _key_bytes,
+              [&](const ChunkOffset chunk_offset, const ColumnDataType& value) {
+                if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+                  _strings[(row_offset + chunk_offset) * _string_column_count + *key_column.string_index] = value;
+                }
+              });
+        });
+      }
+
+      if (_argument_column_id) {
+        segment_iterate<ArgumentType>(*chunk->get_segment(*_argument_column_id), [&](const auto& position) {
+          const auto row = row_offset + position.chunk_offset();
+          if (position.is_null()) {
+            _argument_null_values[row] = true;
+          } else {
+            _argument_values[row] = position.value();
+          }
+        });
+      }
+
+      for (auto row = row_offset; row < row_offset + chunk_size; ++row) {
+        hash_partitions[hash_partition_count == 1 ? 0 : _partition_hash(row) % hash_partition_count].emplace_back(row);
+      }
+    }
+
+    return hash_partitions;
+  }
+
+  // Sorts the rows of a hash partition and evaluates the window function for each of its window partitions. The
+  // results are written to the rows' positions.
+  template <typename ResultType>
+  void compute(std::vector<size_t>& rows, std::vector<ResultType>& results, std::vector<uint8_t>& result_null_values) {
+    const auto column_count = _key_columns.size();
+    std::sort(rows.begin(), rows.end(), [&](const size_t lhs, const size_t rhs) {
+      const auto result = _compare(lhs, rhs, 0, column_count);
+      return result != 0 ? result < 0 : lhs < rhs;
+    });
+
+    auto peer_groups = PeerGroups{};
+    const auto row_count = rows.size();
+    auto partition_begin = size_t{0};
+    while (partition_begin < row_count) {
+      auto partition_end = partition_begin + 1;
+      while (partition_end < row_count &&
+             _compare(rows[partition_begin], rows[partition_end], 0, _partition_column_count) == 0) {
+        ++partition_end;
+      }
+
+      const auto partition = std::span<const size_t>{rows.data() + partition_begin, partition_end - partition_begin};
+      if (_frame_description.type != FrameType::Rows || !aggregate_functions.contains(_window_function)) {
+        _collect_peer_groups(partition, peer_groups);
+      }
+      _compute_partition(partition, peer_groups, results, result_null_values);
+
+      partition_begin = partition_end;
+    }
+  }
+
+ protected:
+  struct KeyColumn {
+    ColumnID column_id{INVALID_COLUMN_ID};
+    SortMode sort_mode{SortMode::Ascending};
+    size_t key_offset{0};
+
+    // Size of the NULL byte and the normalized value.
+    size_t key_bytes{0};
+
+    // Index of the column in the rows' strings. Only set for string columns.
+    std::optional<size_t> string_index;
+  };
+
+  // Peers are rows of a partition with equal ORDER BY values. For each row of a partition, `row_groups` holds the
+  // index of its peer group. `group_begins` holds the first row of each peer group, followed by the partition size.
+  struct PeerGroups {
+    std::vector<size_t> row_groups;
+    std::vector<size_t> group_begins;
+  };
+
+  void _add_key_column(const ColumnID column_id, const SortMode sort_mode) {
+    auto& key_column = _key_columns.emplace_back();
+    key_column.column_id = column_id;
+    key_column.sort_mode = sort_mode;
+    key_column.key_offset = _key_bytes;
+
+    resolve_data_type(_table->column_data_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+        key_column.string_index = _string_column_count;
+        ++_string_column_count;
+      }
+      key_column.key_bytes = 1 + normalized_value_bytes<ColumnDataType>();
+    });
+
+    _key_bytes += key_column.key_bytes;
+  }
+
+  size_t _partition_hash(const size_t row) const {
+    const auto* const key = &_keys[row * _key_bytes];
+    auto hash = boost::hash_range(key, key + _partition_key_bytes);
+    for (auto column_index = size_t{0}; column_index < _partition_column_count; ++column_index) {
+      const auto& key_column = _key_columns[column_index];
+      if (key_column.string_index) {
+        const auto& value = _strings[row * _string_column_count + *key_column.string_index];
+        boost::hash_combine(hash, std::hash<std::string_view>{}(std::string_view{value}));
+      }
+    }
+    return hash;
+  }
+
+  // Compares two rows by the given key columns. Returns a negative value if the left row is ordered first, a positive
+  // value if the right row is ordered first, and zero if their values are equal.
+  int _compare(const size_t lhs, const size_t rhs, const size_t column_begin, const size_t column_end) const {
+    const auto* const lhs_key = &_keys[lhs * _key_bytes];
+    const auto* const rhs_key = &_keys[rhs * _key_bytes];
+    for (auto column_index = column_begin; column_index < column_end; ++column_index) {
+      const auto& key_column = _key_columns[column_index];
+      const auto result =
+          std::memcmp(lhs_key + key_column.key_offset, rhs_key + key_column.key_offset, key_column.key_bytes);
+      if (result != 0) {
+        return result;
+      }
+
+      // Strings with equal prefixes are compared in full, unless both are NULL.
+      if (key_column.string_index && lhs_key[key_column.key_offset] != 0) {
+        const auto& lhs_value = _strings[lhs * _string_column_count + *key_column.string_index];
+        const auto& rhs_value = _strings[rhs * _string_column_count + *key_column.string_index];
+        if (lhs_value != rhs_value) {
+          return (lhs_value < rhs_value) == (key_column.sort_mode == SortMode::Ascending) ? -1 : 1;
+        }
+      }
+    }
+
+    return 0;
+  }
+
+  void _collect_peer_groups(const std::span<const size_t>& partition, PeerGroups& peer_groups) const {
+    const auto row_count = partition.size();
+    peer_groups.row_groups.resize(row_count);
+    peer_groups.group_begins.clear();
+    for (auto row = size_t{0}; row < row_count; ++row) {
+      if (row == 0 || _compare(partition[row - 1], partition[row], _partition_column_count, _key_columns.size()) != 0) {
+        peer_groups.group_begins.emplace_back(row);
+      }
+      peer_groups.row_groups[row] = peer_groups.group_begins.size() - 1;
+    }
+    peer_groups.group_begins.emplace_back(row_count);
+  }
+
+  // Returns the first index of a frame bound (`is_end == false`) or the index after the last index of a frame bound
+  // (`is_end == true`) for the given index. Indexes are rows for ROWS frames and peer groups for RANGE and GROUPS
+  // frames.
+  static size_t _bound_index(const FrameBound& bound, const size_t index, const size_t count, const bool is_end) {
+    if (bound.unbounded) {
+      return is_end ? count : 0;
+    }
+
+    switch (bound.type) {
+      case FrameBoundType::Preceding:
+        if (index < bound.offset) {
+          return 0;
+        }
+        return is_end ? index - bound.offset + 1 : index - bound.offset;
+      case FrameBoundType::CurrentRow:
+        return is_end ? index + 1 : index;
+      case FrameBoundType::Following: {
+        const auto remaining = count - index - (is_end ? 1 : 0);
+        return bound.offset >= remaining ? count : index + bound.offset + (is_end ? 1 : 0);
+      }
+    }
+    Fail("Invalid enum value.");
+  }
+
+  // Returns the first row of the row's frame and the row after its last row.
+  std::pair<size_t, size_t> _frame(const size_t row, const size_t row_count, const PeerGroups& peer_groups) const {
+    const auto& start = _frame_description.start;
+    const auto& end = _frame_description.end;
+    if (_frame_description.type == FrameType::Rows) {
+      return {_bound_index(start, row, row_count, false), _bound_index(end, row, row_count, true)};
+    }
+
+    // RANGE frames only have UNBOUNDED and CURRENT ROW bounds, which makes them equal to GROUPS frames without offsets.
+    const auto group = peer_groups.row_groups[row];
+    const auto group_count = peer_groups.group_begins.size() - 1;
+    return {peer_groups.group_begins[_bound_index(start, group, group_count, false)],
+            peer_groups.group_begins[_bound_index(end, group, group_count, true)]};
+  }
+
+  // Evaluates an aggregate over the frames of all rows of a partition. As both the first and the last row of a frame
+  // never decrease, each row enters the frame (`add`) and leaves it (`remove`) at most once. `write` stores the
+  // aggregate of a row's frame. Frames whose start lies after their end (e.g., ROWS BETWEEN 1 PRECEDING AND 3
+  // PRECEDING) are empty. For them, the frame's end is moved to its start so that no row is removed before it was added.
+  template <typename Add, typename Remove, typename Write>
+  void _slide_frames(const size_t row_count, const PeerGroups& peer_groups, const Add& add, const Remove& remove,
+                     const Write& write) const {
+    auto frame_begin = size_t{0};
+    auto frame_end = size_t{0};
+    for (auto row = size_t{0}; row < row_count; ++row) {
+      const auto [begin, end] = _frame(row, row_count, peer_groups);
+      for (; frame_end < std::max(begin, end); ++frame_end) {
+        add(frame_end);
+      }
+      for (; frame_begin < begin; ++frame_begin) {
+        remove(frame_begin);
+      }
+      write(row);
+    }
+  }
+
+  template <typename ResultType>
+  void _compute_partition(const std::span<const size_t>& partition, const PeerGroups& peer_groups,
+                          std::vector<ResultType>& results, std::vector<uint8_t>& result_null_values) const {
+    const auto row_count = partition.size();
+    const auto is_null = [&](const size_t row) {
+      return _argument_column_id && _argument_null_values[partition[row]];
+    };
+
+    switch (_window_function) {
+      case WindowFunction::RowNumber:
+      case WindowFunction::Rank:
+      case WindowFunction::DenseRank:
+      case WindowFunction::PercentRank:
+      case WindowFunction::CumeDist:
+        if constexpr (std::is_arithmetic_v<ResultType>) {
+          for (auto row = size_t{0}; row < row_count; ++row) {
+            const auto group = peer_groups.row_groups[row];
+            const auto group_begin = peer_groups.group_begins[group];
+            auto& result = results[partition[row]];
+            switch (_window_function) {
+              case WindowFunction::RowNumber:
+                result = static_cast<ResultType>(row + 1);
+                break;
+              case WindowFunction::Rank:
+                result = static_cast<ResultType>(group_begin + 1);
+                break;
+              case WindowFunction::DenseRank:
+                result = static_cast<ResultType>(group + 1);
+                break;
+              case WindowFunction::PercentRank:
+                result = row_count > 1 ? static_cast<ResultType>(group_begin) / static_cast<ResultType>(row_count - 1)
+                                       : ResultType{0};
+                break;
+              default:
+                result = static_cast<ResultType>(peer_groups.group_begins[group + 1]) /
+                         static_cast<ResultType>(row_count);
+            }
+          }
+          return;
+        }
+        break;
+
+      case WindowFunction::Count:
+        if constexpr (std::is_same_v<ResultType, int64_t>) {
+          auto count = int64_t{0};
+          _slide_frames(
+              row_count, peer_groups,
+              [&](const size_t row) {
+                count += is_null(row) ? 0 : 1;
+              },
+              [&](const size_t row) {
+                count -= is_null(row) ? 0 : 1;
+              },
+              [&](const size_t row) {
+                results[partition[row]] = count;
+              });
+          return;
+        }
+        break;
+
+      case WindowFunction::Sum:
+      case WindowFunction::Avg:
+        if constexpr (std::is_arithmetic_v<ArgumentType> && std::is_arithmetic_v<ResultType>) {
+          using SumType = typename WindowFunctionTraits<ArgumentType, WindowFunction::Sum>::ReturnType;
+          auto sum = SumType{0};
+          auto count = size_t{0};
+          _slide_frames(
+              row_count, peer_groups,
+              [&](const size_t row) {
+                if (!is_null(row)) {
+                  sum += static_cast<SumType>(_argument_values[partition[row]]);
+                  ++count;
+                }
+              },
+              [&](const size_t row) {
+                if (!is_null(row)) {
+                  sum -= static_cast<SumType>(_argument_values[partition[row]]);
+                  --count;
+                }
+              },
+              [&](const size_t row) {
+                const auto position = partition[row];
+                if (count == 0) {
+                  result_null_values[position] = true;
+                } else if (_window_function == WindowFunction::Sum) {
+                  results[position] = static_cast<ResultType>(sum);
+                } else {
+                  results[position] = static_cast<ResultType>(sum) / static_cast<ResultType>(count);
+                }
+              });
+          return;
+        }
+        break;
+
+      case WindowFunction::Min:
+      case WindowFunction::Max:
+        if constexpr (std::is_same_v<ResultType, ArgumentType>) {
+          // The rows of the frame whose values can still become the frame's minimum (maximum), i.e., rows that are not
+          // followed by a smaller (larger) value. Their values are ordered ascending (descending).
+          auto candidates = std::deque<size_t>{};
+          const auto is_min = _window_function == WindowFunction::Min;
+          _slide_frames(
+              row_count, peer_groups,
+              [&](const size_t row) {
+                if (is_null(row)) {
+                  return;
+                }
+                const auto& value = _argument_values[partition[row]];
+                while (!candidates.empty()) {
+                  const auto& candidate_value = _argument_values[partition[candidates.back()]];
+                  if (is_min ? candidate_value < value : value < candidate_value) {
+                    break;
+                  }
+                  candidates.pop_back();
+                }
+                candidates.emplace_back(row);
+              },
+              [&](const size_t row) {
+                if (!candidates.empty() && candidates.front() == row) {
+                  candidates.pop_front();
+                }
+              },
+              [&](const size_t row) {
+                const auto position = partition[row];
+                if (candidates.empty()) {
+                  result_null_values[position] = true;
+                } else {
+                  results[position] = _argument_values[partition[candidates.front()]];
+                }
+              });
+          return;
+        }
+        break;
+
+      case WindowFunction::CountDistinct:
+      case WindowFunction::StandardDeviationSample:
+      case WindowFunction::Any:
+        break;
+    }
+
+    Fail("Window function " + window_function_to_string.left.at(_window_function) + " is not supported.");
+  }
+
+  // NOLINTBEGIN(cppcoreguidelines-avoid-const-or-ref-data-members)
+  const std::shared_ptr<const Table> _table;
+  const WindowFunction _window_function;
+  const FrameDescription& _frame_description;
+  const std::optional<ColumnID> _argument_column_id;
+  const size_t _partition_column_count;
+  // NOLINTEND(cppcoreguidelines-avoid-const-or-ref-data-members)
+
+  std::vector<KeyColumn> _key_columns;
+  size_t _key_bytes{0};
+  size_t _partition_key_bytes{0};
+  size_t _string_column_count{0};
+
+  std::vector<uint8_t> _keys;
+  std::vector<pmr_string> _strings;
+  std::vector<ArgumentType> _argument_values;
+  std::vector<uint8_t> _argument_null_values;
+};
+
+}  // namespace
+
+namespace hyrise {
+
+Window::Window(const std::shared_ptr<const AbstractOperator>& input_operator,
+               const std::shared_ptr<WindowFunctionExpression>& window_function_expression)
+    : AbstractReadOnlyOperator(OperatorType::Window, input_operator, nullptr,
+                               std::make_unique<OperatorPerformanceData<OperatorSteps>>()),
+      _window_function_expression(window_function_expression) {
+  const auto& window = _window_function_expression->window();
+  Assert(window && window->type == ExpressionType::Window, "Window: Expected window function with a window.");
+
+  const auto& window_expression = static_cast<const WindowExpression&>(*window);
+  const auto expression_count = window_expression.arguments.size();
+  for (auto expression_idx = size_t{0}; expression_idx < expression_count; ++expression_idx) {
+    const auto column_id = column_id_of(*window_expression.arguments[expression_idx]);
+    if (expression_idx < window_expression.order_by_expressions_begin_idx) {
+      _partition_by_column_ids.emplace_back(column_id);
+    } else {
+      _order_by_definitions.emplace_back(
+          column_id, window_expression.sort_modes[expression_idx - window_expression.order_by_expressions_begin_idx]);
+    }
+  }
+
+  // COUNT(*) is represented by a PQPColumnExpression with an INVALID_COLUMN_ID (see LQPTranslator).
+  const auto& argument = _window_function_expression->argument();
+  if (argument) {
+    const auto argument_column_id = column_id_of(*argument);
+    if (argument_column_id != INVALID_COLUMN_ID) {
+      _argument_column_id = argument_column_id;
+    }
+  }
+
+  const auto window_function = _window_function_expression->window_function;
+  Assert(window_function != WindowFunction::CountDistinct &&
+             window_function != WindowFunction::StandardDeviationSample && window_function != WindowFunction::Any,
+         "Window: " + window_function_to_string.left.at(window_function) + " is not supported.");
+  Assert(!aggregate_functions.contains(window_function) || window_function == WindowFunction::Count ||
+             _argument_column_id,
+         "Window: Aggregate functions require an argument.");
+
+  const auto& frame_description = window_expression.frame_description;
+  const auto is_peer_bound = [](const auto& bound) {
+    return bound.unbounded || bound.type == FrameBoundType::CurrentRow;
+  };
+  Assert(frame_description.type != FrameType::Range ||
+             (is_peer_bound(frame_description.start) && is_peer_bound(frame_description.end)),
+         "Window: RANGE frames with offsets are not supported.");
+}
+
+const std::shared_ptr<WindowFunctionExpression>& Window::window_function_expression() const {
+  return _window_function_expression;
+}
+
+const std::vector<ColumnID>& Window::partition_by_column_ids() const {
+  return _partition_by_column_ids;
+}
+
+const std::vector<SortColumnDefinition>& Window::order_by_definitions() const {
+  return _order_by_definitions;
+}
+
+const std::string& Window::name() const {
+  static const auto name = std::string{"Window"};
+  return name;
+}
+
+std::string Window::description(DescriptionMode description_mode) const {
+  const auto separator = (description_mode == DescriptionMode::SingleLine ? ' ' : '\n');
+
+  auto stream = std::stringstream{};
+  stream << AbstractOperator::description(description_mode) << separator
+         << _window_function_expression->description(AbstractExpression::DescriptionMode::Detailed);
+  return stream.str();
+}
+
+std::shared_ptr<AbstractOperator> Window::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_left_input,
+    const std::shared_ptr<AbstractOperator>& /*copied_right_input*/,
+    std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& /*copied_ops*/) const {
+  return std::make_shared<Window>(copied_left_input, _window_function_expression);
+}
+
+void Window::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
+
+std::shared_ptr<const Table> Window::_on_execute() {
+  const auto& input_table = left_input_table();
+  const auto window_function = _window_function_expression->window_function;
+  const auto& frame_description =
+      static_cast<const WindowExpression&>(*_window_function_expression->window()).frame_description;
+
+  auto& step_performance_data = dynamic_cast<OperatorPerformanceData<OperatorSteps>&>(*performance_data);
+  auto timer = Timer{};
+
+  // Small chunks are bundled together to avoid unnecessary scheduling overhead.
+  const auto chunk_count = input_table->chunk_count();
+  auto chunk_row_offsets = std::vector<size_t>(chunk_count);
+  auto job_begin_chunk_ids = std::vector<ChunkID>{};
+  auto row_count = size_t{0};
+  auto job_row_count = size_t{0};
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = input_table->get_chunk(chunk_id);
+    Assert(chunk, "Did not expect deleted chunk here.");  // see https://github.com/hyrise/hyrise/issues/1686
+
+    if (job_begin_chunk_ids.empty() || job_row_count >= Chunk::DEFAULT_SIZE) {
+      job_begin_chunk_ids.emplace_back(chunk_id);
+      job_row_count = 0;
+    }
+    chunk_row_offsets[chunk_id] = row_count;
+    row_count += chunk->size();
+    job_row_count += chunk->size();
+  }
+
+  // Without PARTITION BY, all rows belong to the same window partition.
+  auto hash_partition_count = size_t{1};
+  if (!_partition_by_column_ids.empty()) {
+    hash_partition_count =
+        std::min(std::bit_ceil(std::max(row_count / ROWS_PER_HASH_PARTITION, size_t{1})), MAX_HASH_PARTITION_COUNT);
+  }
+
+  const auto result_data_type = _window_function_expression->data_type();
+  const auto result_is_nullable =
+      aggregate_functions.contains(window_function) && window_function != WindowFunction::Count;
+  const auto argument_data_type =
+      _argument_column_id ? input_table->column_data_type(*_argument_column_id) : DataType::Int;
+
+  auto result_segments = Segments(chunk_count);
+  resolve_data_type(argument_data_type, [&](auto argument_type) {
+    using ArgumentType = typename decltype(argument_type)::type;
+
+    auto impl = WindowImpl<ArgumentType>{input_table,      window_function,       frame_description,
+                                         _partition_by_column_ids, _order_by_definitions, _argument_column_id};
+
+    const auto job_count = job_begin_chunk_ids.size();
+    auto hash_partitions_by_job = std::vector<std::vector<std::vector<size_t>>>(job_count);
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    jobs.reserve(job_count);
+    for (auto job_index = size_t{0}; job_index < job_count; ++job_index) {
+      const auto begin_chunk_id = job_begin_chunk_ids[job_index];
+      const auto end_chunk_id = job_index + 1 < job_count ? job_begin_chunk_ids[job_index + 1] : chunk_count;
+      jobs.emplace_back(std::make_shared<JobTask>([&, job_index, begin_chunk_id, end_chunk_id] {
+        hash_partitions_by_job[job_index] =
+            impl.partition(begin_chunk_id, end_chunk_id, chunk_row_offsets, hash_partition_count);
+      }));
+    }
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+    step_performance_data.set_step_runtime(OperatorSteps::Partition, timer.lap());
+
+    resolve_data_type(result_data_type, [&](auto result_type) {
+      using ResultType = typename decltype(result_type)::type;
+
+      auto results = std::vector<ResultType>(row_count);
+      auto result_null_values = std::vector<uint8_t>(result_is_nullable ? row_count : 0);
+
+      jobs.clear();
+      jobs.reserve(hash_partition_count);
+      for (auto hash_partition = size_t{0}; hash_partition < hash_partition_count; ++hash_partition) {
+        jobs.emplace_back(std::make_shared<JobTask>([&, hash_partition] {
+          auto rows = std::vector<size_t>{};
+          for (auto& hash_partitions : hash_partitions_by_job) {
+            auto& job_rows = hash_partitions[hash_partition];
+            rows.insert(rows.end(), job_rows.begin(), job_rows.end());
+            job_rows = {};
+          }
+          impl.compute(rows, results, result_null_values);
+        }));
+      }
+      Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+      step_performance_data.set_step_runtime(OperatorSteps::Compute, timer.lap());
+
+      for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+        const auto begin_row = chunk_row_offsets[chunk_id];
+        const auto end_row = begin_row + input_table->get_chunk(chunk_id)->size();
+
+        auto values = pmr_vector<ResultType>(std::make_move_iterator(results.begin() + begin_row),
+                                             std::make_move_iterator(results.begin() + end_row));
+        if (result_is_nullable) {
+          auto null_values = pmr_vector<bool>(result_null_values.begin() + begin_row,
+                                              result_null_values.begin() + end_row);
+          result_segments[chunk_id] =
+              std::make_shared<ValueSegment<ResultType>>(std::move(values), std::move(null_values));
+        } else {
+          result_segments[chunk_id] = std::make_shared<ValueSegment<ResultType>>(std::move(values));
+        }
+      }
+    });
+  });
+
+  auto output_column_definitions = input_table->column_definitions();
+  const auto result_column_definition = TableColumnDefinition{_window_function_expression->as_column_name(),
+                                                              result_data_type, result_is_nullable};
+  output_column_definitions.emplace_back(result_column_definition);
+
+  // For referencing input tables, the results are stored in a separate table and referenced by the output, just like
+  // the Projection does for newly computed columns.
+  const auto input_is_reference = input_table->type() == TableType::References;
+  auto result_table = std::shared_ptr<Table>{};
+  if (input_is_reference) {
+    result_table = std::make_shared<Table>(TableColumnDefinitions{result_column_definition}, TableType::Data);
+  }
+
+  auto output_chunks = std::vector<std::shared_ptr<Chunk>>(chunk_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto input_chunk = input_table->get_chunk(chunk_id);
+    const auto column_count = input_chunk->column_count();
+
+    auto segments = Segments{};
+    segments.reserve(column_count + 1);
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      segments.emplace_back(input_chunk->get_segment(column_id));
+    }
+
+    auto output_chunk = std::shared_ptr<Chunk>{};
+    if (input_is_reference) {
+      result_table->append_chunk({result_segments[chunk_id]});
+      const auto pos_list = std::make_shared<EntireChunkPosList>(chunk_id, input_chunk->size());
+      segments.emplace_back(std::make_shared<ReferenceSegment>(result_table, ColumnID{0}, pos_list));
+      output_chunk = std::make_shared<Chunk>(std::move(segments));
+    } else {
+      segments.emplace_back(result_segments[chunk_id]);
+      output_chunk = std::make_shared<Chunk>(std::move(segments), input_chunk->mvcc_data());
+      output_chunk->increase_invalid_row_count(input_chunk->invalid_row_count(), std::memory_order_relaxed);
+    }
+    output_chunk->set_immutable();
+
+    const auto& sorted_by = input_chunk->individually_sorted_by();
+    if (!sorted_by.empty()) {
+      output_chunk->set_individually_sorted_by(sorted_by);
+    }
+
+    output_chunks[chunk_id] = output_chunk;
+  }
+  step_performance_data.set_step_runtime(OperatorSteps::WriteOutput, timer.lap());
+
+  return std::make_shared<Table>(output_column_definitions, input_table->type(), std::move(output_chunks),
+                                 input_table->uses_mvcc());
+}
+
+}  // namespace hyrise
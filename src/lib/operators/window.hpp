@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "abstract_read_only_operator.hpp"
+#include "expression/window_function_expression.hpp"
+#include "operators/operator_performance_data.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+/**
+ * Operator that evaluates a window function (see window_function_expression.hpp) for every row of its input and
+ * appends the result as a new column. The rows keep their order: the input segments are forwarded and the results are
+ * added as ValueSegments. For referencing input tables, the results are wrapped in ReferenceSegments that point to a
+ * table holding the results, as done by the Projection.
+ *
+ * The rows are distributed to hash partitions by their PARTITION BY values so that all rows of a window partition end
+ * up in the same hash partition. Each hash partition is sorted by the PARTITION BY and ORDER BY values and evaluated by
+ * a separate job. Like in the Sort operator, rows are compared by their normalized keys (see normalized_key.hpp). Rows
+ * with equal values keep their input order.
+ *
+ * Ranking functions (ROW_NUMBER, RANK, DENSE_RANK, PERCENT_RANK, CUME_DIST) only depend on the position of a row and
+ * its peers (i.e., rows with equal ORDER BY values) within the partition. Aggregate functions (MIN, MAX, SUM, AVG,
+ * COUNT) are evaluated over the frame of each row. As the bounds of the frames only move forward within a partition,
+ * the frames are evaluated incrementally: rows entering the frame are added to the aggregate, and rows leaving the
+ * frame are removed from it. MIN and MAX keep a monotonic queue of the values in the frame. Thus, every row is added
+ * and removed at most once, independent of the frame size. For floating-point arguments, removing values from the
+ * running sum can cause rounding errors that recomputing the frame would not have.
+ *
+ * ROWS and GROUPS frames are supported with arbitrary offsets. RANGE frames are only supported with UNBOUNDED and
+ * CURRENT ROW bounds. COUNT(DISTINCT), STDDEV_SAMP, and ANY cannot be evaluated as window functions yet.
+ *
+ * The PARTITION BY and ORDER BY expressions as well as the argument of the window function are expected to be columns
+ * of the input table, i.e., PQPColumnExpressions.
+ */
+class Window : public AbstractReadOnlyOperator {
+ public:
+  enum class OperatorSteps : uint8_t { Partition, Compute, WriteOutput };
+
+  Window(const std::shared_ptr<const AbstractOperator>& input_operator,
+         const std::shared_ptr<WindowFunctionExpression>& window_function_expression);
+
+  const std::shared_ptr<WindowFunctionExpression>& window_function_expression() const;
+
+  const std::vector<ColumnID>& partition_by_column_ids() const;
+
+  const std::vector<SortColumnDefinition>& order_by_definitions() const;
+
+  const std::string& name() const override;
+
+  std::string description(DescriptionMode description_mode) const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_left_input,
+      const std::shared_ptr<AbstractOperator>& /*copied_right_input*/,
+      std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& /*copied_ops*/) const override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+
+  const std::shared_ptr<WindowFunctionExpression> _window_function_expression;
+  std::vector<ColumnID> _partition_by_column_ids;
+  std::vector<SortColumnDefinition> _order_by_definitions;
+
+  // Not set for COUNT(*) and ranking functions.
+  std::optional<ColumnID> _argument_column_id;
+};
+
+}  // namespace hyrise
@@ -35,6 +35,7 @@
 #include "strategy/semi_join_reduction_rule.hpp"
 #include "strategy/stored_table_column_alignment_rule.hpp"
 #include "strategy/subquery_to_join_rule.hpp"
+#include "strategy/top_k_rule.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 #include "utils/timer.hpp"
@@ -268,6 +269,9 @@ std::shared_ptr<Optimizer> Optimizer::create_default_optimizer() {
 
   optimizer->add_rule(std::make_unique<PredicateMergeRule>());
 
+  // Run last, as other rules might still insert nodes between SortNodes and LimitNodes or add outputs to SortNodes.
+  optimizer->add_rule(std::make_unique<TopKRule>());
+
   return optimizer;
 }
 
@@ -149,7 +149,7 @@ void InExpressionRewriteRule::_apply_to_plan_without_subqueries(
     const auto& right_side_expressions = static_cast<ListExpression&>(*in_expression->set()).elements();
 
     // Check whether all elements are literal values of the same data type (that is not NULL).
-    std::optional<DataType> common_data_type = left_expression->data_type();
+    std::optional<DataType> common_data_type = storage_data_type(left_expression->data_type());
     for (const auto& element : right_side_expressions) {
       if (element->type != ExpressionType::Value) {
         common_data_type = std::nullopt;
@@ -0,0 +1,55 @@
+#include "top_k_rule.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "expression/value_expression.hpp"
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/limit_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/sort_node.hpp"
+#include "lossless_cast.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+std::string TopKRule::name() const {
+  static const auto name = std::string{"TopKRule"};
+  return name;
+}
+
+void TopKRule::_apply_to_plan_without_subqueries(const std::shared_ptr<AbstractLQPNode>& lqp_root) const {
+  visit_lqp(lqp_root, [&](const auto& node) {
+    if (node->type != LQPNodeType::Limit) {
+      return LQPVisitation::VisitInputs;
+    }
+
+    const auto input_node = node->left_input();
+    if (input_node->type != LQPNodeType::Sort || input_node->output_count() > 1) {
+      return LQPVisitation::VisitInputs;
+    }
+
+    // Parameters of prepared statements and subqueries are only known when the plan is executed.
+    const auto& limit_node = static_cast<const LimitNode&>(*node);
+    const auto value_expression = std::dynamic_pointer_cast<const ValueExpression>(limit_node.num_rows_expression());
+    if (!value_expression ||
+        (value_expression->data_type() != DataType::Int && value_expression->data_type() != DataType::Long)) {
+      return LQPVisitation::VisitInputs;
+    }
+
+    const auto row_count = lossless_variant_cast<int64_t>(value_expression->value);
+    if (!row_count || *row_count < 0 || static_cast<uint64_t>(*row_count) > MAX_TOP_K) {
+      return LQPVisitation::VisitInputs;
+    }
+
+    // The members of the SortNode are const, so we replace it with an annotated copy.
+    const auto& sort_node = static_cast<const SortNode&>(*input_node);
+    lqp_replace_node(input_node,
+                     SortNode::make(sort_node.node_expressions, sort_node.sort_modes, static_cast<size_t>(*row_count)));
+    return LQPVisitation::VisitInputs;
+  });
+}
+
+}  // namespace hyrise
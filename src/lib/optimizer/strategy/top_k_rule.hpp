@@ -0,0 +1,31 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_rule.hpp"
+
+namespace hyrise {
+
+class AbstractLQPNode;
+
+/**
+ * This rule marks SortNodes that are directly followed by a LimitNode with a constant row count (e.g., for
+ * `ORDER BY a LIMIT 10`). The LQPTranslator translates marked SortNodes into TopK operators, which only keep the first
+ * rows instead of sorting the entire input. The LimitNode is kept, as it does not add notable costs on top of the
+ * already limited output.
+ *
+ * SortNodes that have further outputs are not marked, as these outputs require the entire sorted input. Limits that
+ * exceed MAX_TOP_K are not considered, as the parallel Sort operator is faster for large results.
+ */
+class TopKRule : public AbstractRule {
+ public:
+  static constexpr auto MAX_TOP_K = size_t{100'000};
+
+  std::string name() const override;
+
+ protected:
+  void _apply_to_plan_without_subqueries(const std::shared_ptr<AbstractLQPNode>& lqp_root) const override;
+};
+
+}  // namespace hyrise
@@ -11,6 +11,7 @@
 #include "all_type_variant.hpp"
 #include "storage/abstract_encoded_segment.hpp"
 #include "storage/abstract_segment.hpp"
+#include "storage/pos_lists/compressed_pos_list.hpp"
 #include "storage/pos_lists/entire_chunk_pos_list.hpp"
 #include "storage/pos_lists/row_id_pos_list.hpp"
 #include "storage/reference_segment.hpp"
@@ -75,8 +76,10 @@ template <typename Functor>
 void resolve_data_type(DataType data_type, const Functor& functor) {
   DebugAssert(data_type != DataType::Null, "data_type cannot be null.");
 
+  // Logical data types (i.e., Date) are resolved to the type that stores their values.
+  const auto resolved_data_type = storage_data_type(data_type);
   hana::for_each(data_type_pairs, [&](auto data_type_pair) {
-    if (hana::first(data_type_pair) == data_type) {
+    if (hana::first(data_type_pair) == resolved_data_type) {
       // The + before hana::second - which returns a reference - converts its return value into a value
       functor(+hana::second(data_type_pair));
       return;
@@ -146,6 +149,8 @@ void resolve_pos_list_type(const std::shared_ptr<const AbstractPosList>& untyped
     } else if (const auto entire_chunk_pos_list =
                    std::dynamic_pointer_cast<const EntireChunkPosList>(untyped_pos_list)) {
       functor(entire_chunk_pos_list);
+    } else if (const auto compressed_pos_list = std::dynamic_pointer_cast<const CompressedPosList>(untyped_pos_list)) {
+      functor(compressed_pos_list);
     } else {
       Fail("Unrecognized PosList type encountered");
     }
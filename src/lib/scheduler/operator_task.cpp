@@ -7,9 +7,11 @@
 #include <vector>
 
 #include "concurrency/transaction_context.hpp"
+#include "operators/abstract_join_operator.hpp"
 #include "operators/abstract_operator.hpp"
 #include "operators/abstract_read_write_operator.hpp"
 #include "operators/get_table.hpp"
+#include "operators/join_hash.hpp"
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/task_utils.hpp"
 #include "types.hpp"
@@ -86,6 +88,71 @@ void link_tasks_for_subquery_pruning(const std::unordered_set<std::shared_ptr<Op
   }
 }
 
+/**
+ * Lets hash joins publish their build input to the GetTable operator at the bottom of their probe input, which uses it
+ * as a runtime join filter to prune chunks (see get_table.hpp). For semi joins, the build side is the right input.
+ * For inner joins, JoinHash chooses the smaller input at runtime. Either direction is correct as rows without a join
+ * partner never make it into the result, so we publish the input chosen by the LQPTranslator, which has the smaller
+ * estimated cardinality (see JoinHash::runtime_join_filter_from_left_input()). The task of the build input becomes a
+ * predecessor of the GetTable task.
+ */
+void link_tasks_for_runtime_join_filters(const std::unordered_set<std::shared_ptr<OperatorTask>>& tasks) {
+  for (const auto& task : tasks) {
+    const auto& op = task->get_operator();
+    if (op->type() != OperatorType::JoinHash || op->executed()) {
+      continue;
+    }
+
+    const auto& join = static_cast<const JoinHash&>(*op);
+    const auto& primary_predicate = join.primary_predicate();
+    if (primary_predicate.predicate_condition != PredicateCondition::Equals ||
+        (join.mode() != JoinMode::Inner && join.mode() != JoinMode::Semi)) {
+      continue;
+    }
+
+    const auto build_input_is_left = join.runtime_join_filter_from_left_input();
+    const auto build_input = build_input_is_left ? op->mutable_left_input() : op->mutable_right_input();
+    const auto build_column_id =
+        build_input_is_left ? primary_predicate.column_ids.first : primary_predicate.column_ids.second;
+    const auto probe_column_id =
+        build_input_is_left ? primary_predicate.column_ids.second : primary_predicate.column_ids.first;
+
+    // Validate and TableScan forward the columns of their input unchanged. If any operator on the way down to the
+    // GetTable has another consumer, pruning chunks would change that consumer's input.
+    auto probe_operator = build_input_is_left ? op->mutable_right_input() : op->mutable_left_input();
+    while ((probe_operator->type() == OperatorType::Validate || probe_operator->type() == OperatorType::TableScan) &&
+           probe_operator->consumer_count() == 1) {
+      probe_operator = probe_operator->mutable_left_input();
+    }
+
+    if (probe_operator->type() != OperatorType::GetTable || probe_operator->consumer_count() != 1 ||
+        probe_operator->executed()) {
+      continue;
+    }
+
+    // Linking the tasks would create a cycle if the GetTable task already is a (transitive) predecessor of the build
+    // input's task, e.g., when the GetTable is also used by an uncorrelated subquery on the build side.
+    const auto& get_table_task = probe_operator->get_or_create_operator_task();
+    const auto& build_task = build_input->get_or_create_operator_task();
+    Assert(tasks.contains(get_table_task) && tasks.contains(build_task), "Unknown OperatorTask.");
+    auto creates_cycle = false;
+    visit_tasks_upwards(get_table_task, [&](const auto& successor) {
+      if (successor == build_task) {
+        creates_cycle = true;
+        return TaskUpwardVisitation::DoNotVisitSuccessors;
+      }
+      return TaskUpwardVisitation::VisitSuccessors;
+    });
+
+    if (creates_cycle) {
+      continue;
+    }
+
+    static_cast<GetTable&>(*probe_operator).set_runtime_join_filter(build_input, build_column_id, probe_column_id);
+    build_task->set_as_predecessor_of(get_table_task);
+  }
+}
+
 }  // namespace
 
 namespace hyrise {
@@ -110,6 +177,10 @@ OperatorTask::make_tasks_from_operator(const std::shared_ptr<AbstractOperator>&
   // it is acyclic.
   link_tasks_for_subquery_pruning(operator_tasks_set);
 
+  // Hash joins publish their build input to the GetTable operators on their probe side. As for subquery pruning, this
+  // requires the entire task graph.
+  link_tasks_for_runtime_join_filters(operator_tasks_set);
+
   // Ensure the task graph is acyclic, i.e., no task is any (n-th) successor of itself. Tasks in cycles would end up in
   // a deadlock during execution, mutually waiting for the other tasks' execution. Even if the tasks are never executed,
   // cycles create memory leaks since tasks hold shared pointers to their predecessors.
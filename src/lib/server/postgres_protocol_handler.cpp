@@ -3,8 +3,8 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
-#include <optional>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -73,6 +73,16 @@ void PostgresProtocolHandler<SocketType>::send_ready_for_query() {
   _write_buffer.flush();
 }
 
+template <typename SocketType>
+size_t PostgresProtocolHandler<SocketType>::buffered_bytes() const {
+  return _read_buffer.size() + _read_buffer.received_data_size();
+}
+
+template <typename SocketType>
+void PostgresProtocolHandler<SocketType>::add_received_messages(const std::string_view messages) {
+  _read_buffer.add_received_data(messages);
+}
+
 template <typename SocketType>
 PostgresMessageType PostgresProtocolHandler<SocketType>::read_packet_type() {
   return static_cast<PostgresMessageType>(_read_buffer.template get_value<char>());
@@ -103,7 +113,8 @@ void PostgresProtocolHandler<SocketType>::send_row_description_header(const uint
 
 template <typename SocketType>
 void PostgresProtocolHandler<SocketType>::send_row_description(const std::string& column_name, const uint32_t object_id,
-                                                               const int16_t type_width) {
+                                                               const int16_t type_width,
+                                                               const ResultFormat result_format) {
   _write_buffer.put_string(column_name);
   // This field contains the table ID (OID in postgres). We have to set it in order to fulfill the protocol
   // specification. We do not know what it's good for.
@@ -113,37 +124,18 @@ void PostgresProtocolHandler<SocketType>::send_row_description(const std::string
   _write_buffer.template put_value<int32_t>(object_id);   // Object id of type
   _write_buffer.template put_value<int16_t>(type_width);  // Data type size
   _write_buffer.template put_value<int32_t>(-1);          // No modifier
-  _write_buffer.template put_value<int16_t>(0u);          // Text format
+  // Format code of the column's values: text (0) or binary (1).
+  _write_buffer.template put_value<int16_t>(static_cast<int16_t>(result_format));
 }
 
 template <typename SocketType>
-void PostgresProtocolHandler<SocketType>::send_data_row(
-    const std::vector<std::optional<std::string>>& values_as_strings, const uint32_t string_length_sum) {
-  // The documentation of the fields in this message can be found at:
-  // https://www.postgresql.org/docs/12/static/protocol-message-formats.html
-
+void PostgresProtocolHandler<SocketType>::send_serialized_data_row(const uint16_t column_count,
+                                                                   const std::string& serialized_values) {
   _write_buffer.template put_value(PostgresMessageType::DataRow);
-
-  const auto packet_size =
-      LENGTH_FIELD_SIZE + sizeof(uint16_t) + values_as_strings.size() * LENGTH_FIELD_SIZE + string_length_sum;
-
+  const auto packet_size = LENGTH_FIELD_SIZE + sizeof(uint16_t) + serialized_values.size();
   _write_buffer.template put_value<uint32_t>(static_cast<uint32_t>(packet_size));
-
-  // Number of columns in row
-  _write_buffer.template put_value<uint16_t>(static_cast<uint16_t>(values_as_strings.size()));
-
-  for (const auto& value_string : values_as_strings) {
-    if (value_string) {
-      // Size of string representation of value, NOT of value type's size
-      _write_buffer.template put_value<uint32_t>(static_cast<uint32_t>(value_string->size()));
-
-      // Text mode means all values are sent as non-terminated strings
-      _write_buffer.put_string(*value_string, HasNullTerminator::No);
-    } else {
-      // NULL values are represented by setting the value's length to -1
-      _write_buffer.template put_value<int32_t>(-1);
-    }
-  }
+  _write_buffer.template put_value<uint16_t>(column_count);
+  _write_buffer.put_string(serialized_values, HasNullTerminator::No);
 }
 
 template <typename SocketType>
@@ -221,11 +213,15 @@ PreparedStatementDetails PostgresProtocolHandler<SocketType>::read_bind_packet()
 
   const auto num_result_column_format_codes = _read_buffer.template get_value<int16_t>();
 
-  for (auto format_code = 0; format_code < num_result_column_format_codes; ++format_code) {
-    Assert(_read_buffer.template get_value<int16_t>() == 0, "Assuming all result columns to be in text format (0)");
+  auto result_formats = std::vector<ResultFormat>{};
+  result_formats.reserve(num_result_column_format_codes);
+  for (auto format_code_index = 0; format_code_index < num_result_column_format_codes; ++format_code_index) {
+    const auto format_code = _read_buffer.template get_value<int16_t>();
+    Assert(format_code == 0 || format_code == 1, "Unknown result format code " + std::to_string(format_code) + ".");
+    result_formats.emplace_back(static_cast<ResultFormat>(format_code));
   }
 
-  return {statement_name, portal, parameter_values};
+  return {statement_name, portal, parameter_values, result_formats};
 }
 
 template <typename SocketType>
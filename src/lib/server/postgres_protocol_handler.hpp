@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -15,11 +16,18 @@ namespace hyrise {
 
 using ErrorMessages = std::unordered_map<PostgresMessageType, std::string>;
 
-// This struct stores a prepared statement's name, its portal used and the specified parameters.
+// Format of the values of a result column. Clients choose the format per column when binding a prepared statement.
+// Simple queries always return text. The values of the enum are the format codes of the PostgreSQL protocol.
+enum class ResultFormat : int16_t { Text = 0, Binary = 1 };
+
+// This struct stores a prepared statement's name, its portal used, the specified parameters, and the requested result
+// formats. As in the PostgreSQL protocol, no result format means that all columns are sent as text and a single result
+// format applies to all columns.
 struct PreparedStatementDetails {
   std::string statement_name;
   std::string portal;
   std::vector<AllTypeVariant> parameters;
+  std::vector<ResultFormat> result_formats;
 };
 
 // This class extracts information from client messages and serializes the response data according to the PostgreSQL
@@ -40,6 +48,12 @@ class PostgresProtocolHandler {
   // Ready to receive a new packet
   void send_ready_for_query();
 
+  // Number of bytes that have been received from the client but not been read yet.
+  size_t buffered_bytes() const;
+
+  // Add messages that have already been received from the client (see ReadBuffer::add_received_data).
+  void add_received_messages(const std::string_view messages);
+
   // Read first byte of next packet to determine its type
   PostgresMessageType read_packet_type();
 
@@ -48,9 +62,11 @@ class PostgresProtocolHandler {
 
   // Send query result
   void send_row_description_header(const uint32_t total_column_name_length, const uint16_t column_count);
-  void send_row_description(const std::string& column_name, const uint32_t object_id, const int16_t type_width);
-  void send_data_row(const std::vector<std::optional<std::string>>& values_as_strings,
-                     const uint32_t string_length_sum);
+  void send_row_description(const std::string& column_name, const uint32_t object_id, const int16_t type_width,
+                            const ResultFormat result_format = ResultFormat::Text);
+  // Send a row whose values have already been serialized, i.e., each value is preceded by its length (or -1 for NULL)
+  // in network byte order. See ResultSerializer::send_query_response.
+  void send_serialized_data_row(const uint16_t column_count, const std::string& serialized_values);
   void send_command_complete(const std::string& command_complete_message);
 
   // Messages for parsing prepared statements
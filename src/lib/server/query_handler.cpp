@@ -1,16 +1,21 @@
 #include "query_handler.hpp"
 
+#include <cctype>
 #include <cstddef>
 #include <memory>
+#include <optional>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "sql/SQLStatement.h"
 #include "sql/TransactionStatement.h"
 
+#include "all_type_variant.hpp"
 #include "expression/abstract_expression.hpp"
+#include "expression/correlated_parameter_expression.hpp"
 #include "expression/value_expression.hpp"
 #include "hyrise.hpp"
 #include "logical_query_plan/lqp_translator.hpp"
@@ -26,6 +31,41 @@
 #include "storage/prepared_plan.hpp"
 #include "utils/assert.hpp"
 
+namespace {
+
+using namespace hyrise;  // NOLINT(build/namespaces)
+
+// Collapses whitespace outside of quotes so that statements that only differ in their formatting share a cache entry.
+std::string normalize_sql(const std::string& query) {
+  auto normalized_query = std::string{};
+  normalized_query.reserve(query.size());
+
+  auto quote = char{0};
+  auto pending_whitespace = false;
+  for (const auto character : query) {
+    if (!quote && std::isspace(static_cast<unsigned char>(character))) {
+      pending_whitespace = true;
+      continue;
+    }
+
+    if (pending_whitespace && !normalized_query.empty()) {
+      normalized_query += ' ';
+    }
+    pending_whitespace = false;
+
+    if (character == quote) {
+      quote = char{0};
+    } else if (!quote && (character == '\'' || character == '"')) {
+      quote = character;
+    }
+    normalized_query += character;
+  }
+
+  return normalized_query;
+}
+
+}  // namespace
+
 namespace hyrise {
 
 std::pair<ExecutionInformation, std::shared_ptr<TransactionContext>> QueryHandler::execute_pipeline(
@@ -67,7 +107,8 @@ std::pair<ExecutionInformation, std::shared_ptr<TransactionContext>> QueryHandle
   return {execution_info, sql_pipeline.transaction_context()};
 }
 
-void QueryHandler::setup_prepared_plan(const std::string& statement_name, const std::string& query) {
+std::optional<std::string> QueryHandler::setup_prepared_plan(const std::string& statement_name,
+                                                             const std::string& query) {
   // Named prepared statements must be explicitly closed before they can be redefined by another Parse message.
   // An unnamed prepared statement lasts only until the next Parse statement specifying the unnamed statement as
   // destination is issued
@@ -78,6 +119,17 @@ void QueryHandler::setup_prepared_plan(const std::string& statement_name, const
     Hyrise::get().storage_manager.drop_prepared_plan(statement_name);
   }
 
+  // Statements that any session prepared before are neither parsed nor translated again. Only cacheable statements are
+  // cached, so a hit also means that the physical plans of the statement can be cached.
+  auto cache_key = normalize_sql(query);
+  const auto& prepared_plan_cache = Hyrise::get().prepared_plan_cache;
+  if (prepared_plan_cache) {
+    if (const auto cached_prepared_plan = prepared_plan_cache->try_get(cache_key)) {
+      Hyrise::get().storage_manager.add_prepared_plan(statement_name, *cached_prepared_plan);
+      return cache_key;
+    }
+  }
+
   auto pipeline = SQLPipelineBuilder{query}.create_pipeline();
   const auto& lqps = pipeline.get_unoptimized_logical_plans();
 
@@ -94,15 +146,68 @@ void QueryHandler::setup_prepared_plan(const std::string& statement_name, const
   const auto prepared_plan = std::make_shared<PreparedPlan>(lqp, parameter_ids_of_value_placeholders);
 
   Hyrise::get().storage_manager.add_prepared_plan(statement_name, prepared_plan);
+
+  if (!translation_info.cacheable) {
+    return std::nullopt;
+  }
+
+  if (prepared_plan_cache) {
+    prepared_plan_cache->set(cache_key, prepared_plan);
+  }
+
+  return cache_key;
 }
 
-std::shared_ptr<AbstractOperator> QueryHandler::bind_prepared_plan(const PreparedStatementDetails& statement_details) {
+std::shared_ptr<AbstractOperator> QueryHandler::bind_prepared_plan(const PreparedStatementDetails& statement_details,
+                                                                   const std::optional<std::string>& cache_key) {
   AssertInput(Hyrise::get().storage_manager.has_prepared_plan(statement_details.statement_name),
               "The specified statement does not exist.");
 
   const auto prepared_plan = Hyrise::get().storage_manager.get_prepared_plan(statement_details.statement_name);
 
   const auto parameter_count = statement_details.parameters.size();
+  const auto& prepared_pqp_cache = Hyrise::get().prepared_pqp_cache;
+  auto use_cache = prepared_pqp_cache && cache_key && parameter_count == prepared_plan->parameter_ids.size();
+  for (const auto& parameter : statement_details.parameters) {
+    // NULL parameters have no data type that a parameterized plan could be optimized for.
+    use_cache &= !variant_is_null(parameter);
+  }
+
+  if (use_cache) {
+    // The data types of the parameters are part of the key, as the optimizer and the translator might choose different
+    // operators for them.
+    auto parameterized_cache_key = *cache_key;
+    auto parameters = std::unordered_map<ParameterID, AllTypeVariant>{};
+    for (auto parameter_idx = size_t{0}; parameter_idx < parameter_count; ++parameter_idx) {
+      const auto& parameter = statement_details.parameters[parameter_idx];
+      parameterized_cache_key += '\0' + std::to_string(static_cast<int>(data_type_from_all_type_variant(parameter)));
+      parameters.emplace(prepared_plan->parameter_ids[parameter_idx], parameter);
+    }
+
+    auto cached_pqp = prepared_pqp_cache->try_get(parameterized_cache_key);
+    if (!cached_pqp) {
+      auto parameter_expressions = std::vector<std::shared_ptr<AbstractExpression>>{parameter_count};
+      for (auto parameter_idx = size_t{0}; parameter_idx < parameter_count; ++parameter_idx) {
+        const auto parameter_info = CorrelatedParameterExpression::ReferencedExpressionInfo{
+            data_type_from_all_type_variant(statement_details.parameters[parameter_idx]),
+            "$" + std::to_string(parameter_idx + 1)};
+        const auto parameter_id = prepared_plan->parameter_ids[parameter_idx];
+        parameter_expressions[parameter_idx] =
+            std::make_shared<CorrelatedParameterExpression>(parameter_id, parameter_info);
+      }
+
+      auto lqp = prepared_plan->instantiate(parameter_expressions);
+      lqp = Optimizer::create_default_optimizer()->optimize(std::move(lqp));
+      cached_pqp = LQPTranslator{}.translate_node(lqp);
+      prepared_pqp_cache->set(parameterized_cache_key, *cached_pqp);
+    }
+
+    // The cached PQP is shared by all sessions and must not be executed. Thus, each binding works on a copy.
+    const auto pqp = (*cached_pqp)->deep_copy();
+    pqp->set_parameters(parameters);
+    return pqp;
+  }
+
   auto parameter_expressions = std::vector<std::shared_ptr<AbstractExpression>>{parameter_count};
   for (auto parameter_idx = size_t{0}; parameter_idx < parameter_count; ++parameter_idx) {
     parameter_expressions[parameter_idx] =
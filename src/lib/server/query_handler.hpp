@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <variant>
@@ -32,9 +33,19 @@ class QueryHandler {
       const std::string& query, const SendExecutionInfo send_execution_info,
       const std::shared_ptr<TransactionContext>& transaction_context);
 
-  static void setup_prepared_plan(const std::string& statement_name, const std::string& query);
-
-  static std::shared_ptr<AbstractOperator> bind_prepared_plan(const PreparedStatementDetails& statement_details);
+  // Returns the key under which the physical plans of the prepared statement can be cached (i.e., its normalized SQL
+  // string), or std::nullopt if the statement must not be cached (e.g., because it accesses meta tables). If
+  // Hyrise::get().prepared_plan_cache is set, cacheable statements are only parsed and translated the first time they
+  // are prepared.
+  static std::optional<std::string> setup_prepared_plan(const std::string& statement_name, const std::string& query);
+
+  // If a cache key is given and Hyrise::get().prepared_pqp_cache is set, the statement is optimized and translated with
+  // parameters instead of the bound values. The resulting PQP is cached for all sessions. Binding the same statement
+  // again (with parameters of the same data types) only copies the cached PQP and sets the parameters. As the bound
+  // values are unknown to the optimizer, value-dependent optimizations such as chunk pruning are not applied to cached
+  // plans.
+  static std::shared_ptr<AbstractOperator> bind_prepared_plan(
+      const PreparedStatementDetails& statement_details, const std::optional<std::string>& cache_key = std::nullopt);
 
   static std::shared_ptr<const Table> execute_prepared_plan(const std::shared_ptr<AbstractOperator>& physical_plan);
 
@@ -5,6 +5,7 @@
 #include <cstddef>
 #include <iterator>
 #include <string>
+#include <string_view>
 
 #include <boost/system/detail/error_code.hpp>
 
@@ -85,6 +86,18 @@ std::string ReadBuffer<SocketType>::get_string(const size_t string_length,
   return result;
 }
 
+template <typename SocketType>
+void ReadBuffer<SocketType>::add_received_data(const std::string_view data) {
+  _received_data.erase(0, _received_data_position);
+  _received_data_position = 0;
+  _received_data.append(data);
+}
+
+template <typename SocketType>
+size_t ReadBuffer<SocketType>::received_data_size() const {
+  return _received_data.size() - _received_data_position;
+}
+
 template <typename SocketType>
 void ReadBuffer<SocketType>::_receive_if_necessary(const size_t bytes_required) {
   // Already enough data present in buffer
@@ -92,6 +105,17 @@ void ReadBuffer<SocketType>::_receive_if_necessary(const size_t bytes_required)
     return;
   }
 
+  // Move data that has already been received into the buffer.
+  if (received_data_size() > 0) {
+    const auto bytes_to_copy = std::min(maximum_capacity() - size(), received_data_size());
+    _current_position = std::copy_n(_received_data.cbegin() + static_cast<std::ptrdiff_t>(_received_data_position),
+                                    bytes_to_copy, _current_position);
+    _received_data_position += bytes_to_copy;
+    if (size() >= bytes_required) {
+      return;
+    }
+  }
+
   // Buffer might contain unread data, so cannot read full buffer size
   const auto maximum_readable_size = maximum_capacity() - size();
 
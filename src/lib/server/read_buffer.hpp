@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <string>
+#include <string_view>
 
 #include "ring_buffer_iterator.hpp"
 #include "server_types.hpp"
@@ -50,6 +51,13 @@ class ReadBuffer {
                          const HasNullTerminator has_null_terminator = HasNullTerminator::Yes);
   std::string get_string();
 
+  // Add data that has already been received from the network device, e.g., by asynchronous reads. This data is
+  // consumed before anything is read from the network device.
+  void add_received_data(const std::string_view data);
+
+  // Number of bytes added via add_received_data that have not been moved into the buffer yet.
+  size_t received_data_size() const;
+
  private:
   void _receive_if_necessary(const size_t bytes_required = 1);
 
@@ -59,6 +67,8 @@ class ReadBuffer {
   // This iterator points to the field after the last unread element of the array.
   RingBufferIterator _current_position{_data};
   std::shared_ptr<SocketType> _socket;
+  std::string _received_data;
+  size_t _received_data_position{0};
 };
 
 }  // namespace hyrise
@@ -1,27 +1,93 @@
 #include "result_serializer.hpp"
 
+#include <bit>
 #include <cstdint>
 #include <memory>
-#include <optional>
 #include <string>
+#include <type_traits>
 #include <vector>
 
+#include <boost/endian/conversion.hpp>
+#include <boost/lexical_cast.hpp>
+
 #include "all_type_variant.hpp"
-#include "lossy_cast.hpp"
 #include "operators/abstract_operator.hpp"
 #include "postgres_protocol_handler.hpp"
 #include "query_handler.hpp"
+#include "resolve_type.hpp"
 #include "storage/chunk.hpp"
+#include "storage/segment_iterate.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
+#include "utils/date_time_utils.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT(build/namespaces)
+
+ResultFormat column_result_format(const std::vector<ResultFormat>& result_formats, const ColumnID column_id) {
+  if (result_formats.empty()) {
+    return ResultFormat::Text;
+  }
+
+  return result_formats.size() == 1 ? result_formats.front() : result_formats[column_id];
+}
+
+template <typename T>
+void append_network_order(std::string& buffer, const T value) {
+  const auto network_value = boost::endian::native_to_big(value);
+  buffer.append(reinterpret_cast<const char*>(&network_value), sizeof(T));
+}
+
+// Appends the length of the value followed by the value itself. Numbers in binary format are sent in network byte
+// order, floating-point numbers as their IEEE 754 representation. Strings are the same in both formats.
+template <typename T>
+void append_value(std::string& buffer, const T& value, const ResultFormat result_format) {
+  if constexpr (std::is_same_v<T, pmr_string>) {
+    append_network_order(buffer, static_cast<int32_t>(value.size()));
+    buffer.append(value.data(), value.size());
+  } else if (result_format == ResultFormat::Binary) {
+    append_network_order(buffer, static_cast<int32_t>(sizeof(T)));
+    if constexpr (std::is_same_v<T, float>) {
+      append_network_order(buffer, std::bit_cast<uint32_t>(value));
+    } else if constexpr (std::is_same_v<T, double>) {
+      append_network_order(buffer, std::bit_cast<uint64_t>(value));
+    } else {
+      append_network_order(buffer, value);
+    }
+  } else {
+    const auto value_string = boost::lexical_cast<std::string>(value);
+    append_network_order(buffer, static_cast<int32_t>(value_string.size()));
+    buffer.append(value_string);
+  }
+}
+
+// PostgreSQL sends dates as 'YYYY-MM-DD' in text format and as the number of days since 2000-01-01 in binary format.
+// Hyrise stores them as the number of days since 1970-01-01.
+void append_date_value(std::string& buffer, const int32_t days, const ResultFormat result_format) {
+  constexpr auto POSTGRES_DATE_EPOCH_DAYS = int32_t{10'957};
+
+  if (result_format == ResultFormat::Binary) {
+    append_value(buffer, days - POSTGRES_DATE_EPOCH_DAYS, result_format);
+    return;
+  }
+
+  append_value(buffer, pmr_string{days_to_date_string(days)}, result_format);
+}
+
+}  // namespace
 
 namespace hyrise {
 
 template <typename SocketType>
 void ResultSerializer::send_table_description(
     const std::shared_ptr<const Table>& table,
-    const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler) {
+    const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler,
+    const std::vector<ResultFormat>& result_formats) {
+  Assert(result_formats.size() <= 1 || result_formats.size() == table->column_count(),
+         "Expected a result format for each column.");
+
   // Calculate sum of length of all column names
   uint32_t column_name_length_sum = 0;
   for (auto& column_name : table->column_names()) {
@@ -60,47 +126,80 @@ void ResultSerializer::send_table_description(
         object_id = 25;
         type_width = -1;
         break;
+      case DataType::Date:
+        object_id = 1082;
+        type_width = 4;
+        break;
       case DataType::Null:
         Fail("Bad DataType");
     }
-    postgres_protocol_handler->send_row_description(table->column_name(column_id), object_id, type_width);
+    postgres_protocol_handler->send_row_description(table->column_name(column_id), object_id, type_width,
+                                                    column_result_format(result_formats, column_id));
   }
 }
 
 template <typename SocketType>
 void ResultSerializer::send_query_response(
     const std::shared_ptr<const Table>& table,
-    const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler) {
-  auto values_as_strings = std::vector<std::optional<std::string>>(table->column_count());
+    const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler,
+    const std::vector<ResultFormat>& result_formats) {
+  const auto column_count = table->column_count();
+  Assert(result_formats.size() <= 1 || result_formats.size() == column_count,
+         "Expected a result format for each column.");
+
+  // For each column, the serialized values of the current chunk and the offsets at which the values of a row start.
+  // The buffers are reused for all chunks.
+  auto serialized_columns = std::vector<std::string>(column_count);
+  auto value_offsets = std::vector<std::vector<size_t>>(column_count);
+  auto serialized_row = std::string{};
 
   const auto chunk_count = table->chunk_count();
 
   // Iterate over each chunk in result table
-  for (ChunkID chunk_id{0}; chunk_id < chunk_count; chunk_id++) {
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
     const auto chunk = table->get_chunk(chunk_id);
     const auto chunk_size = chunk->size();
 
-    const auto column_count = table->column_count();
-    auto segments = Segments(column_count);
-    for (auto column_id = ColumnID{0}; column_id < column_count; column_id++) {
-      segments[column_id] = chunk->get_segment(column_id);
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      auto& serialized_column = serialized_columns[column_id];
+      auto& offsets = value_offsets[column_id];
+      serialized_column.clear();
+      offsets.clear();
+      offsets.reserve(chunk_size + 1);
+
+      const auto result_format = column_result_format(result_formats, column_id);
+      const auto is_date_column = table->column_data_type(column_id) == DataType::Date;
+      resolve_data_type(table->column_data_type(column_id), [&](const auto data_type_t) {
+        using ColumnDataType = typename decltype(data_type_t)::type;
+
+        segment_iterate<ColumnDataType>(*chunk->get_segment(column_id), [&](const auto& position) {
+          offsets.emplace_back(serialized_column.size());
+          if (position.is_null()) {
+            // NULL values are represented by setting the value's length to -1.
+            append_network_order(serialized_column, int32_t{-1});
+          } else if constexpr (std::is_same_v<ColumnDataType, int32_t>) {
+            if (is_date_column) {
+              append_date_value(serialized_column, position.value(), result_format);
+            } else {
+              append_value(serialized_column, position.value(), result_format);
+            }
+          } else {
+            append_value(serialized_column, position.value(), result_format);
+          }
+        });
+      });
+      offsets.emplace_back(serialized_column.size());
     }
 
     // Iterate over each row in chunk
     for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
-      auto string_length_sum = uint32_t{0};
-      // Iterate over each attribute in row
-      for (auto segment_id = ColumnID{0}; segment_id < column_count; segment_id++) {
-        const auto attribute_value = (*segments[segment_id])[chunk_offset];
-        // The PostgreSQL protocol requires the conversion of values to strings
-        const auto string_value = lossy_variant_cast<pmr_string>(attribute_value);
-        if (string_value) {
-          // Sum up string lengths for a row to save an extra loop during serialization
-          string_length_sum += static_cast<uint32_t>(string_value->size());
-        }
-        values_as_strings[segment_id] = string_value;
+      serialized_row.clear();
+      for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+        const auto& offsets = value_offsets[column_id];
+        serialized_row.append(serialized_columns[column_id], offsets[chunk_offset],
+                              offsets[chunk_offset + 1] - offsets[chunk_offset]);
       }
-      postgres_protocol_handler->send_data_row(values_as_strings, string_length_sum);
+      postgres_protocol_handler->send_serialized_data_row(static_cast<uint16_t>(column_count), serialized_row);
     }
   }
 }
@@ -138,17 +237,21 @@ std::string ResultSerializer::build_command_complete_message(const OperatorType
 }
 
 template void ResultSerializer::send_table_description<Socket>(const std::shared_ptr<const Table>&,
-                                                               const std::shared_ptr<PostgresProtocolHandler<Socket>>&);
+                                                               const std::shared_ptr<PostgresProtocolHandler<Socket>>&,
+                                                               const std::vector<ResultFormat>&);
 
 template void ResultSerializer::send_table_description<boost::asio::posix::stream_descriptor>(
     const std::shared_ptr<const Table>&,
-    const std::shared_ptr<PostgresProtocolHandler<boost::asio::posix::stream_descriptor>>&);
+    const std::shared_ptr<PostgresProtocolHandler<boost::asio::posix::stream_descriptor>>&,
+    const std::vector<ResultFormat>&);
 
 template void ResultSerializer::send_query_response<Socket>(const std::shared_ptr<const Table>&,
-                                                            const std::shared_ptr<PostgresProtocolHandler<Socket>>&);
+                                                            const std::shared_ptr<PostgresProtocolHandler<Socket>>&,
+                                                            const std::vector<ResultFormat>&);
 
 template void ResultSerializer::send_query_response<boost::asio::posix::stream_descriptor>(
     const std::shared_ptr<const Table>&,
-    const std::shared_ptr<PostgresProtocolHandler<boost::asio::posix::stream_descriptor>>&);
+    const std::shared_ptr<PostgresProtocolHandler<boost::asio::posix::stream_descriptor>>&,
+    const std::vector<ResultFormat>&);
 
 }  // namespace hyrise
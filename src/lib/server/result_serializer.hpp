@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "operators/abstract_operator.hpp"
 #include "postgres_protocol_handler.hpp"
@@ -11,20 +12,27 @@ namespace hyrise {
 
 struct ExecutionInformation;
 
-// The ResultSerializer serializes the result data returned by Hyrise according to PostgreSQL Wire Protocol.
+// The ResultSerializer serializes the result data returned by Hyrise according to PostgreSQL Wire Protocol. The
+// result formats are given as requested by the client (see PreparedStatementDetails). No result format means that all
+// columns are sent as text.
 class ResultSerializer {
  public:
   // Serialize information about the result table
   template <typename SocketType>
   static void send_table_description(
       const std::shared_ptr<const Table>& table,
-      const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler);
+      const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler,
+      const std::vector<ResultFormat>& result_formats = {});
 
+  // Serialize the attributes of the result table and send them row-wise. The table is serialized chunk by chunk and
+  // column by column, so that only the current chunk is held in serialized form. The rows of a chunk are passed on to
+  // the WriteBuffer, which sends them as soon as it is full. In the binary format, numbers are sent in network byte
+  // order without converting them to strings.
   template <typename SocketType>
-  // Cast attributes of the result table and send them row-wise
   static void send_query_response(
       const std::shared_ptr<const Table>& table,
-      const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler);
+      const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler,
+      const std::vector<ResultFormat>& result_formats = {});
 
   // Build completion message after query execution containing the statement type and the number of rows affected
   static std::string build_command_complete_message(const ExecutionInformation& execution_information,
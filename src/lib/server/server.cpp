@@ -7,7 +7,12 @@
 #include <memory>
 #include <string>
 #include <thread>
+#include <vector>
 
+#include <boost/asio/bind_executor.hpp>
+#include <boost/asio/error.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/asio/strand.hpp>
 #include <boost/system/error_code.hpp>
 
 #include "hyrise.hpp"
@@ -21,8 +26,12 @@ namespace hyrise {
 
 // Specified port (default: 5432) will be opened after initializing the _acceptor
 Server::Server(const boost::asio::ip::address& address, const uint16_t port,
-               const SendExecutionInfo send_execution_info)
-    : _acceptor(_io_service, boost::asio::ip::tcp::endpoint(address, port)), _send_execution_info(send_execution_info) {
+               const SendExecutionInfo send_execution_info, const uint32_t io_thread_count)
+    : _acceptor(_io_service, boost::asio::ip::tcp::endpoint(address, port)),
+      _acceptor_strand(boost::asio::make_strand(_io_service)),
+      _send_execution_info(send_execution_info),
+      _io_thread_count(io_thread_count) {
+  Assert(_io_thread_count > 0, "The server requires at least one I/O thread.");
   std::cout << "Server started at " << server_address() << " and port " << server_port() << ".\nRun 'psql -h localhost "
             << server_address() << "' to connect to the server\n." << std::flush;
 }
@@ -36,48 +45,62 @@ void Server::run() {
   // Set caches
   Hyrise::get().default_pqp_cache = std::make_shared<SQLPhysicalPlanCache>();
   Hyrise::get().default_lqp_cache = std::make_shared<SQLLogicalPlanCache>();
+  Hyrise::get().prepared_plan_cache = std::make_shared<SQLPreparedPlanCache>();
+  Hyrise::get().prepared_pqp_cache = std::make_shared<SQLPhysicalPlanCache>();
 
   _is_initialized = true;
   _accept_new_session();
+
+  // The calling thread is one of the I/O threads. The I/O threads only wait for connections and requests, the requests
+  // themselves are handled by the scheduler's workers (see Session).
+  auto io_threads = std::vector<std::thread>{};
+  io_threads.reserve(_io_thread_count - 1);
+  for (auto thread_id = uint32_t{1}; thread_id < _io_thread_count; ++thread_id) {
+    io_threads.emplace_back([&, thread_id]() {
+      const auto thread_name = "server_io_" + std::to_string(thread_id);
+#ifdef __APPLE__
+      pthread_setname_np(thread_name.c_str());
+#elif __linux__
+      pthread_setname_np(pthread_self(), thread_name.c_str());
+#endif
+      _io_service.run();
+    });
+  }
+
   _io_service.run();
+
+  for (auto& io_thread : io_threads) {
+    io_thread.join();
+  }
 }
 
 void Server::_accept_new_session() {
   // Create a new session. This will also open a new data socket in order to communicate with the client
   // For more information on TCP ports + Asio see:
   // https://www.gamedev.net/forums/topic/586557-boostasio-allowing-multiple-connections-to-a-single-server-socket/
-  auto new_session = std::make_shared<Session>(_io_service, _send_execution_info);
-  _acceptor.async_accept(*(new_session->socket()),
-                         boost::bind(&Server::_start_session, this, new_session, boost::asio::placeholders::error));
+  // The session is destroyed as soon as neither a pending accept or wait nor a scheduled job references it. We track
+  // the number of sessions that are alive so that the server does not shut down while sessions still use the socket.
+  ++_num_running_sessions;
+  auto new_session = std::shared_ptr<Session>(new Session(_io_service, _send_execution_info),
+                                              [&num_running_sessions = _num_running_sessions](Session* session) {
+                                                delete session;
+                                                --num_running_sessions;
+                                              });
+  _acceptor.async_accept(
+      *(new_session->socket()),
+      boost::asio::bind_executor(_acceptor_strand, boost::bind(&Server::_start_session, this, new_session,
+                                                               boost::asio::placeholders::error)));
 }
 
 void Server::_start_session(const std::shared_ptr<Session>& new_session, const boost::system::error_code& error) {
-  Assert(!error, error.message());
-
-  std::thread session_thread([session = new_session, &num_running_sessions = this->_num_running_sessions]() mutable {
-    const std::string thread_name = "server_p_" + std::to_string(session->socket()->remote_endpoint().port());
-#ifdef __APPLE__
-    pthread_setname_np(thread_name.c_str());
-#elif __linux__
-    pthread_setname_np(pthread_self(), thread_name.c_str());
-#endif
-
-    ++num_running_sessions;
-
-    session->run();
+  // The acceptor has been closed during shutdown.
+  if (error == boost::asio::error::operation_aborted) {
+    return;
+  }
 
-    // Destroy the session before reducing the number of running sessions. This makes sure that the server has not shut
-    // down yet. In case session.use_count is not yet zero, this makes sure that the destructor is not called in
-    // the detached thread.
-    session.reset();
-    --num_running_sessions;
-  });
+  Assert(!error, error.message());
 
-  // We ensure that all threads are completed before the server is shut down by tracking the number of running threads
-  // in _num_running_sessions. The alternative would be to store the std::thread objects in some kind of data structure
-  // and call join() on all of them before shutting down the server. This would result in a growing number of completed
-  // threads waiting to be joined and the need for a cleanup procedure.
-  session_thread.detach();
+  new_session->start();
   _accept_new_session();
 }
 
@@ -90,6 +113,12 @@ uint16_t Server::server_port() const {
 }
 
 void Server::shutdown() {
+  // The acceptor is not thread-safe. Hence, it is only used within a strand, i.e., by one I/O thread at a time. Closing
+  // the acceptor aborts the pending accept.
+  boost::asio::post(_acceptor_strand, [&]() {
+    _acceptor.close();
+  });
+
   while (_num_running_sessions > 0) {
     // This busy wait might be inefficient, but as this is only to guarantee a clean shutdown, it's good enough.
     std::this_thread::yield();
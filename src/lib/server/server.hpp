@@ -1,9 +1,12 @@
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <memory>
 
 #include <boost/asio/io_service.hpp>
 #include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/strand.hpp>
 
 #include "server_types.hpp"
 #include "session.hpp"
@@ -12,9 +15,10 @@ namespace hyrise {
 
 /* In the following a short description of the classes used for the server implementation.
 
-*  Server - Opens and binds a server socket. Starts a new session per client.
+*  Server - Opens and binds a server socket. Starts a new session per client. Runs a fixed number of I/O threads that
+*           wait for incoming connections and requests.
 *  Session - Creates a data socket for client server communication. It is responsible for the message flow and holds
-*            session-specific data.
+*            session-specific data. Requests are handled by jobs of the NodeQueueScheduler.
 *  PostgresProtocolHandler - This class operates on the message level. It serializes and de-serializes information from
 *                            messages.
 *  PostgresMessageTypes - Set of different message types supported by Hyrise.
@@ -31,9 +35,13 @@ namespace hyrise {
 
 class Server {
  public:
-  Server(const boost::asio::ip::address& address, const uint16_t port, const SendExecutionInfo send_execution_info);
+  // Waiting for connections and requests is cheap, so few I/O threads suffice for many connections.
+  static constexpr auto DEFAULT_IO_THREAD_COUNT = uint32_t{2};
 
-  // Start server to accept new sessions.
+  Server(const boost::asio::ip::address& address, const uint16_t port, const SendExecutionInfo send_execution_info,
+         const uint32_t io_thread_count = DEFAULT_IO_THREAD_COUNT);
+
+  // Start server to accept new sessions. Blocks until the server is shut down.
   void run();
 
   // Return the port the server is running on.
@@ -42,7 +50,7 @@ class Server {
   // Get the current address the server is running. This is important especially for multi-NIC devices.
   boost::asio::ip::address server_address() const;
 
-  // Shutdown Hyrise server.
+  // Shutdown Hyrise server. Stops accepting new sessions and waits for the running sessions to finish.
   void shutdown();
 
   // Indicates if setup is completed.
@@ -53,10 +61,13 @@ class Server {
 
   void _start_session(const std::shared_ptr<Session>& new_session, const boost::system::error_code& error);
 
+  // Number of sessions that have not been destroyed yet, including the session waiting for the next connection.
   std::atomic_uint64_t _num_running_sessions{0};
   boost::asio::io_service _io_service;
   boost::asio::ip::tcp::acceptor _acceptor;
+  boost::asio::strand<boost::asio::io_service::executor_type> _acceptor_strand;
   const SendExecutionInfo _send_execution_info;
+  const uint32_t _io_thread_count;
   std::atomic_bool _is_initialized{false};
 };
 }  // namespace hyrise
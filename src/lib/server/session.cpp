@@ -1,18 +1,26 @@
 #include "session.hpp"
 
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <exception>
 #include <iostream>
 #include <memory>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <tuple>
 
+#include <boost/asio.hpp>
+#include <boost/system/error_code.hpp>
+
 #include "client_disconnect_exception.hpp"
 #include "hyrise.hpp"
 #include "postgres_message_type.hpp"
 #include "postgres_protocol_handler.hpp"
 #include "query_handler.hpp"
 #include "result_serializer.hpp"
+#include "scheduler/job_task.hpp"
 #include "server_types.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
@@ -28,30 +36,134 @@ std::shared_ptr<Socket> Session::socket() {
   return _socket;
 }
 
-void Session::run() {
+void Session::start() {
   // Set TCP_NODELAY in order to disable Nagle's algorithm. It handles congestion control in TCP networks. Therefore,
   // small packets are buffered and sent out later as one large packet. This might introduce a delay of up to 40 ms
   // which we have to avoid. Further reading: https://howdoesinternetwork.com/2015/nagles-algorithm
   _socket->set_option(boost::asio::ip::tcp::no_delay(true));
-  _establish_connection();
-  while (!_terminate_session) {
-    try {
-      _handle_request();
-    } catch (const ClientDisconnectException& /* exception */) {
-      return;
-    } catch (const std::exception& e) {
-      std::cerr << "Exception in session with client port " << _socket->remote_endpoint().port() << ":\n"
-                << e.what() << '\n';
-      const auto error_messages = ErrorMessages{{PostgresMessageType::HumanReadableError, e.what()}};
-      _postgres_protocol_handler->send_error_message(error_messages);
-      _postgres_protocol_handler->send_ready_for_query();
-      // In case of an error, an error message has to be send to the client followed by a "ReadyForQuery" message.
-      // Messages that have already been received are processed further. A "sync" message makes the server send another
-      // "ReadyForQuery" message. In order to avoid this, we set this flag for further operations. As soon as a new
-      // query arrives it must be set to false again to ensure correct message flow.
-      _sync_send_after_error = true;
+  _receive_requests();
+}
+
+void Session::_receive_requests() {
+  _socket->async_read_some(
+      boost::asio::buffer(_receive_buffer),
+      [session = shared_from_this()](const boost::system::error_code& error, const size_t bytes_received) {
+        // The read fails if the client disconnected or the socket was closed. Dropping the handler destroys the
+        // session.
+        if (error) {
+          return;
+        }
+
+        session->_received_data.append(session->_receive_buffer.data(), bytes_received);
+        const auto message_bytes = session->_complete_messages_size();
+        // Malformed messages cannot be framed. As for errors, dropping the handler closes the connection.
+        if (!message_bytes) {
+          return;
+        }
+
+        if (*message_bytes == 0) {
+          session->_receive_requests();
+          return;
+        }
+
+        // Query execution might take a while and must not block the I/O threads. Thus, the complete messages are
+        // handled by the scheduler. The job resumes reading once they have been handled.
+        session->_postgres_protocol_handler->add_received_messages(
+            std::string_view{session->_received_data.data(), *message_bytes});
+        session->_received_data.erase(0, *message_bytes);
+        auto job = std::make_shared<JobTask>([session]() {
+          if (session->_handle_requests()) {
+            session->_receive_requests();
+          }
+        });
+        job->schedule();
+      });
+}
+
+std::optional<size_t> Session::_complete_messages_size() {
+  // Special SSL version number that we catch to deny SSL support, see PostgresProtocolHandler.
+  constexpr auto SSL_REQUEST_CODE = uint32_t{80877103};
+  // The SSL deny packet consists of a single byte and is sent while no job of the session is running.
+  static constexpr auto SSL_DENY_PACKET = PostgresMessageType::SslNo;
+
+  const auto read_network_value = [&](const size_t position) {
+    auto network_value = uint32_t{0};
+    std::memcpy(&network_value, _received_data.data() + position, sizeof(uint32_t));
+    return ntohl(network_value);
+  };
+
+  auto complete_bytes = size_t{0};
+  while (true) {
+    // Except for the startup packet, all messages start with a one-byte message type followed by the message length.
+    const auto header_size =
+        _startup_packet_expected ? size_t{LENGTH_FIELD_SIZE} : sizeof(PostgresMessageType) + LENGTH_FIELD_SIZE;
+    if (_received_data.size() - complete_bytes < header_size) {
+      break;
     }
+
+    // The message length includes the length field itself, but not the message type.
+    const auto message_length = read_network_value(complete_bytes + header_size - LENGTH_FIELD_SIZE);
+    if (message_length < LENGTH_FIELD_SIZE) {
+      return std::nullopt;
+    }
+
+    const auto message_size = header_size - LENGTH_FIELD_SIZE + size_t{message_length};
+    if (_received_data.size() - complete_bytes < message_size) {
+      break;
+    }
+
+    if (_startup_packet_expected) {
+      // The startup packet is the first message of a connection. Thus, no complete messages precede it.
+      DebugAssert(complete_bytes == 0, "Unexpected messages before the startup packet.");
+      if (message_length == 2 * LENGTH_FIELD_SIZE && read_network_value(LENGTH_FIELD_SIZE) == SSL_REQUEST_CODE) {
+        // We currently do not support SSL. The client sends the actual startup packet after receiving the denial.
+        _received_data.erase(0, message_size);
+        boost::asio::async_write(*_socket, boost::asio::buffer(&SSL_DENY_PACKET, sizeof(SSL_DENY_PACKET)),
+                                 [session = shared_from_this()](const boost::system::error_code& /* error */,
+                                                                const size_t /* bytes_transferred */) {});
+        continue;
+      }
+      _startup_packet_expected = false;
+    }
+
+    complete_bytes += message_size;
+  }
+
+  return complete_bytes;
+}
+
+bool Session::_handle_requests() {
+  try {
+    if (!_connection_established) {
+      _establish_connection();
+      _connection_established = true;
+    }
+
+    // Requests of the extended query protocol (e.g., parse, bind, execute, sync) are usually sent at once. We handle
+    // all requests that have been received completely. Thus, no request requires reading from the socket.
+    while (!_terminate_session && _postgres_protocol_handler->buffered_bytes() > 0) {
+      try {
+        _handle_request();
+      } catch (const ClientDisconnectException& /* exception */) {
+        throw;
+      } catch (const std::exception& e) {
+        std::cerr << "Exception in session with client port " << _socket->remote_endpoint().port() << ":\n"
+                  << e.what() << '\n';
+        const auto error_messages = ErrorMessages{{PostgresMessageType::HumanReadableError, e.what()}};
+        _postgres_protocol_handler->send_error_message(error_messages);
+        _postgres_protocol_handler->send_ready_for_query();
+        // In case of an error, an error message has to be send to the client followed by a "ReadyForQuery" message.
+        // Messages that have already been received are processed further. A "sync" message makes the server send
+        // another "ReadyForQuery" message. In order to avoid this, we set this flag for further operations. As soon as
+        // a new query arrives it must be set to false again to ensure correct message flow.
+        _sync_send_after_error = true;
+      }
+    }
+  } catch (const ClientDisconnectException& /* exception */) {
+    return false;
   }
+
+  return !_terminate_session;
 }
 
 void Session::_establish_connection() {
@@ -147,7 +259,11 @@ void Session::_handle_simple_query() {
 
 void Session::_handle_parse_command() {
   const auto [statement_name, query] = _postgres_protocol_handler->read_parse_packet();
-  QueryHandler::setup_prepared_plan(statement_name, query);
+  _prepared_plan_cache_keys.erase(statement_name);
+  const auto cache_key = QueryHandler::setup_prepared_plan(statement_name, query);
+  if (cache_key) {
+    _prepared_plan_cache_keys.emplace(statement_name, *cache_key);
+  }
 
   _postgres_protocol_handler->send_status_message(PostgresMessageType::ParseComplete);
 
@@ -169,11 +285,15 @@ void Session::_handle_bind_command() {
   // Since bind and execute packet usually arrive together, we still have to handle the execute packet. Therefore,
   // we first store a nullptr in the portals map to signalize an error. However, if binding succeeds in the next step
   // this nullptr gets replaced by the correct pqp. Before executing the prepared statement we make a check for errors.
-  _portals.emplace(parameters.portal, nullptr);
+  _portals.emplace(parameters.portal, Portal{nullptr, parameters.result_formats});
 
-  const auto pqp = QueryHandler::bind_prepared_plan(parameters);
+  const auto cache_key_it = _prepared_plan_cache_keys.find(parameters.statement_name);
+  const auto cache_key = cache_key_it != _prepared_plan_cache_keys.end()
+                             ? std::optional<std::string>{cache_key_it->second}
+                             : std::optional<std::string>{};
+  const auto pqp = QueryHandler::bind_prepared_plan(parameters, cache_key);
 
-  _portals[parameters.portal] = pqp;
+  _portals[parameters.portal].physical_plan = pqp;
   _postgres_protocol_handler->send_status_message(PostgresMessageType::BindComplete);
 
   // Ready for query + flush will be done after reading sync message
@@ -196,12 +316,13 @@ void Session::_handle_execute() {
 
   // In case of an error occured during binding there is no pqp available. Hence, early return here since there is
   // nothing to execute.
-  if (!portal_it->second) {
+  if (!portal_it->second.physical_plan) {
     _portals.erase(portal_it);
     return;
   }
 
-  const auto physical_plan = portal_it->second;
+  const auto physical_plan = portal_it->second.physical_plan;
+  const auto result_formats = portal_it->second.result_formats;
 
   if (portal_name.empty()) {
     _portals.erase(portal_it);
@@ -217,8 +338,8 @@ void Session::_handle_execute() {
   uint64_t row_count = 0;
   // If there is no result table, e.g. after an INSERT command, we cannot send row data
   if (result_table) {
-    ResultSerializer::send_table_description(result_table, _postgres_protocol_handler);
-    ResultSerializer::send_query_response(result_table, _postgres_protocol_handler);
+    ResultSerializer::send_table_description(result_table, _postgres_protocol_handler, result_formats);
+    ResultSerializer::send_query_response(result_table, _postgres_protocol_handler, result_formats);
     row_count = result_table->row_count();
   } else {
     _postgres_protocol_handler->send_status_message(PostgresMessageType::NoDataResponse);
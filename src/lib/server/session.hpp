@@ -1,8 +1,12 @@
 #pragma once
 
+#include <array>
+#include <functional>
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "concurrency/transaction_context.hpp"
 #include "operators/abstract_operator.hpp"
@@ -16,16 +20,39 @@ namespace hyrise {
 // portals used for CURSOR operations are currently not supported by Hyrise. For further documentation see here:
 // https://www.postgresql.org/docs/12/protocol-overview.html#PROTOCOL-QUERY-CONCEPTS
 // Example usage can be found here: https://stackoverflow.com/questions/52479293/postgresql-refcursor-and-portal-name
-class Session {
+//
+// Sessions do not own a thread. The server's I/O threads read the client's messages asynchronously. Only once at least
+// one message has been received completely (i.e., its header and its length-prefixed body), a job is scheduled that
+// handles all complete messages (see _handle_requests). Thus, neither I/O threads nor the scheduler's workers block
+// while waiting for clients, and the number of threads is independent of the number of connections. The session keeps
+// itself alive via shared_from_this() as long as it has a pending read or a scheduled job.
+class Session : public std::enable_shared_from_this<Session> {
  public:
   explicit Session(boost::asio::io_service& io_service, const SendExecutionInfo send_execution_info);
 
-  // Start new session.
-  void run();
+  // Start new session. Returns immediately, the requests are handled asynchronously.
+  void start();
 
   std::shared_ptr<Socket> socket();
 
  private:
+  // A bound prepared statement and the formats in which the client expects its results.
+  struct Portal {
+    std::shared_ptr<AbstractOperator> physical_plan;
+    std::vector<ResultFormat> result_formats;
+  };
+
+  // Read asynchronously until at least one complete message has been received, then schedule a job that handles the
+  // received requests.
+  void _receive_requests();
+
+  // Returns the number of bytes of the complete messages at the beginning of _received_data or std::nullopt if the
+  // client sent a malformed message. Denies SSL requests.
+  std::optional<size_t> _complete_messages_size();
+
+  // Handle the complete messages that have been received. Returns false if the session has ended.
+  bool _handle_requests();
+
   // Establish new connection by exchanging parameters.
   void _establish_connection();
 
@@ -53,9 +80,17 @@ class Session {
   const std::shared_ptr<Socket> _socket;
   const std::shared_ptr<PostgresProtocolHandler<Socket>> _postgres_protocol_handler;
   const SendExecutionInfo _send_execution_info;
+  // Data read from the socket that does not form complete messages yet, and the buffer for asynchronous reads.
+  std::string _received_data;
+  std::array<char, SERVER_BUFFER_SIZE> _receive_buffer{};
+  // The startup packet (and SSL requests preceding it) does not start with a message type.
+  bool _startup_packet_expected = true;
+  bool _connection_established = false;
   bool _terminate_session = false;
   bool _sync_send_after_error = false;
   std::shared_ptr<TransactionContext> _transaction_context;
-  std::unordered_map<std::string, std::shared_ptr<AbstractOperator>> _portals;
+  std::unordered_map<std::string, Portal> _portals;
+  // Keys of the physical plans of this session's prepared statements in the server-wide prepared_pqp_cache.
+  std::unordered_map<std::string, std::string> _prepared_plan_cache_keys;
 };
 }  // namespace hyrise
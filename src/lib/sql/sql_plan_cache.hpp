@@ -9,8 +9,10 @@ namespace hyrise {
 
 class AbstractOperator;
 class AbstractLQPNode;
+class PreparedPlan;
 
 using SQLPhysicalPlanCache = GDFSCache<std::string, std::shared_ptr<AbstractOperator>>;
 using SQLLogicalPlanCache = GDFSCache<std::string, std::shared_ptr<AbstractLQPNode>>;
+using SQLPreparedPlanCache = GDFSCache<std::string, std::shared_ptr<PreparedPlan>>;
 
 }  // namespace hyrise
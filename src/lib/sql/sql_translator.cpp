@@ -26,6 +26,7 @@
 #include "expression/arithmetic_expression.hpp"
 #include "expression/between_expression.hpp"
 #include "expression/binary_predicate_expression.hpp"
+#include "expression/cast_expression.hpp"
 #include "expression/exists_expression.hpp"
 #include "expression/expression_functional.hpp"
 #include "expression/expression_utils.hpp"
@@ -300,6 +301,78 @@ FrameBound translate_frame_bound(const hsql::FrameBound& hsql_frame_bound) {
   return FrameBound{static_cast<uint64_t>(offset), bound_type, hsql_frame_bound.unbounded};
 }
 
+/**
+ * Values of DataType::Date are the number of days since 1970-01-01. Date literals and casts of string literals as DATE
+ * are translated to this number, which is cast as Date so that the expression keeps its data type.
+ */
+std::shared_ptr<AbstractExpression> date_value(const int32_t days) {
+  return cast_(value_(days), DataType::Date);
+}
+
+// Returns the number of days of an expression created by date_value().
+std::optional<int32_t> date_value_days(const AbstractExpression& expression) {
+  if (expression.type != ExpressionType::Cast || expression.data_type() != DataType::Date) {
+    return std::nullopt;
+  }
+
+  const auto& argument = *static_cast<const CastExpression&>(expression).argument();
+  if (argument.type != ExpressionType::Value) {
+    return std::nullopt;
+  }
+
+  const auto& value = static_cast<const ValueExpression&>(argument).value;
+  if (value.type() != typeid(int32_t)) {
+    return std::nullopt;
+  }
+  return boost::get<int32_t>(value);
+}
+
+/**
+ * Adapts an operand that is compared with a column to the column's representation of dates. For Date columns, string
+ * literals and date values are replaced with their number of days. Thus, predicates such as
+ * `d_date BETWEEN '2000-01-01' AND DATE '2000-12-31'` are evaluated as integer comparisons. Placeholders are cast as
+ * Date so that the parameters of prepared statements can be passed as strings. Many benchmarks store dates in String
+ * columns. For these, date values are replaced with their ISO 8601 extended representation.
+ */
+std::shared_ptr<AbstractExpression> adapt_date_operand(const std::shared_ptr<AbstractExpression>& operand,
+                                                       const std::shared_ptr<AbstractExpression>& column) {
+  if (column->type != ExpressionType::LQPColumn) {
+    return operand;
+  }
+
+  const auto column_data_type = column->data_type();
+  const auto days = date_value_days(*operand);
+  if (column_data_type == DataType::String && days) {
+    return value_(pmr_string{days_to_date_string(*days)});
+  }
+
+  if (column_data_type != DataType::Date) {
+    return operand;
+  }
+
+  if (days) {
+    return value_(*days);
+  }
+
+  if (operand->type == ExpressionType::Placeholder) {
+    return cast_(operand, DataType::Date);
+  }
+
+  if (operand->type != ExpressionType::Value) {
+    return operand;
+  }
+
+  const auto& value = static_cast<const ValueExpression&>(*operand).value;
+  if (value.type() != typeid(pmr_string)) {
+    return operand;
+  }
+
+  const auto& date_string = boost::get<pmr_string>(value);
+  const auto date_days = date_string_to_days(date_string);
+  AssertInput(date_days, "'" + std::string{date_string} + "' is not a valid ISO 8601 extended date.");
+  return value_(*date_days);
+}
+
 }  // namespace
 
 namespace hyrise {
@@ -1613,15 +1686,14 @@ std::shared_ptr<AbstractLQPNode> SQLTranslator::_translate_create_table(const hs
           column_definition.data_type = DataType::String;
           break;
         case hsql::DataType::DATE:
-          std::cout << "WARNING: Parsing DATE to string since date and time data types are not yet supported.\n";
-          column_definition.data_type = DataType::String;
+          column_definition.data_type = DataType::Date;
           break;
         case hsql::DataType::DATETIME:
-          std::cout << "WARNING: Parsing DATETIME to string since date and time data types are not yet supported.\n";
+          std::cout << "WARNING: Parsing DATETIME to string since timestamp data types are not yet supported.\n";
           column_definition.data_type = DataType::String;
           break;
         case hsql::DataType::TIME:
-          std::cout << "WARNING: Parsing TIME to string since date and time data types are not yet supported.\n";
+          std::cout << "WARNING: Parsing TIME to string since time data types are not yet supported.\n";
           column_definition.data_type = DataType::String;
           break;
         case hsql::DataType::BOOLEAN:
@@ -1880,13 +1952,9 @@ std::shared_ptr<AbstractExpression> SQLTranslator::_translate_hsql_expr(
       return null_();
 
     case hsql::kExprLiteralDate: {
-      if (name.size() == 10) {
-        const auto timestamp = string_to_timestamp(name);
-        if (timestamp) {
-          return value_(pmr_string{name});
-        }
-      }
-      FailInput("'" + name + "' is not a valid ISO 8601 extended date.");
+      const auto days = date_string_to_days(name);
+      AssertInput(days, "'" + name + "' is not a valid ISO 8601 extended date.");
+      return date_value(*days);
     }
 
     case hsql::kExprParameter: {
@@ -2162,16 +2230,21 @@ std::shared_ptr<AbstractExpression> SQLTranslator::_translate_hsql_expr(
 
         // Handle intervals.
         if (right->type == ExpressionType::Interval) {
+          const auto& interval_expression = static_cast<IntervalExpression&>(*right);
+          // We already ensured to have either Addition or Substraction right at the beginning
+          const auto duration = arithmetic_operator == ArithmeticOperator::Addition ? interval_expression.duration
+                                                                                    : -interval_expression.duration;
+          if (const auto start_days = date_value_days(*left)) {
+            const auto end_date = date_interval(days_to_date(*start_days), duration, interval_expression.unit);
+            return date_value(date_to_days(end_date));
+          }
+
           AssertInput(left->type == ExpressionType::Value && left->data_type() == DataType::String,
-                      "Interval can only be applied to ValueExpression with String value.");
+                      "Interval can only be applied to dates or to ValueExpressions with String value.");
           const auto start_date_string =
               std::string{boost::get<pmr_string>(static_cast<ValueExpression&>(*left).value)};
           const auto start_timestamp = string_to_timestamp(start_date_string);
           AssertInput(start_timestamp, "'" + start_date_string + "' is not a valid ISO 8601 extended date.");
-          const auto& interval_expression = static_cast<IntervalExpression&>(*right);
-          // We already ensured to have either Addition or Substraction right at the beginning
-          const auto duration = arithmetic_operator == ArithmeticOperator::Addition ? interval_expression.duration
-                                                                                    : -interval_expression.duration;
           const auto end_date = date_interval(start_timestamp->date(), duration, interval_expression.unit);
           return value_(pmr_string{date_to_string(end_date)});
         }
@@ -2185,13 +2258,15 @@ std::shared_ptr<AbstractExpression> SQLTranslator::_translate_hsql_expr(
 
         if (is_binary_predicate_condition(predicate_condition)) {
           Assert(left && right, "Unexpected SQLParserResult. Didn't receive two arguments for binary_expression.");
-          return std::make_shared<BinaryPredicateExpression>(predicate_condition, left, right);
+          return std::make_shared<BinaryPredicateExpression>(predicate_condition, adapt_date_operand(left, right),
+                                                             adapt_date_operand(right, left));
         }
 
         if (predicate_condition == PredicateCondition::BetweenInclusive) {
           Assert(expr.exprList && expr.exprList->size() == 2, "Expected two arguments for BETWEEN.");
-          return between_inclusive_(left, _translate_hsql_expr(*(*expr.exprList)[0], sql_identifier_resolver),
-                                    _translate_hsql_expr(*(*expr.exprList)[1], sql_identifier_resolver));
+          const auto lower_bound = _translate_hsql_expr(*(*expr.exprList)[0], sql_identifier_resolver);
+          const auto upper_bound = _translate_hsql_expr(*(*expr.exprList)[1], sql_identifier_resolver);
+          return between_inclusive_(left, adapt_date_operand(lower_bound, left), adapt_date_operand(upper_bound, left));
         }
       }
 
@@ -2219,7 +2294,8 @@ std::shared_ptr<AbstractExpression> SQLTranslator::_translate_hsql_expr(
 
           arguments.reserve(expr.exprList->size());
           for (const auto* hsql_argument : *expr.exprList) {
-            arguments.emplace_back(_translate_hsql_expr(*hsql_argument, sql_identifier_resolver));
+            arguments.emplace_back(
+                adapt_date_operand(_translate_hsql_expr(*hsql_argument, sql_identifier_resolver), left));
           }
 
           const auto array = std::make_shared<ListExpression>(arguments);
@@ -2260,32 +2336,38 @@ std::shared_ptr<AbstractExpression> SQLTranslator::_translate_hsql_expr(
       const auto source_data_type = left->data_type();
       const auto target_hsql_data_type = expr.columnType.data_type;
 
-      if (target_hsql_data_type == hsql::DataType::DATE || target_hsql_data_type == hsql::DataType::DATETIME) {
-        AssertInput(source_data_type == DataType::String,
-                    "Cannot cast " + left->as_column_name() + " as " +
-                        std::string{magic_enum::enum_name(target_hsql_data_type)} + ".");
-        // We do not know if an expression to be casted other than a ValueExpression actually contains date time
-        // values, and we cannot check this later due to the lack of proper data types.
-        AssertInput(left->type == ExpressionType::Value, "Only ValueExpressions can be casted as " +
-                                                             std::string{magic_enum::enum_name(target_hsql_data_type)});
-        const auto input_string = std::string{boost::get<pmr_string>(static_cast<ValueExpression&>(*left).value)};
-
-        if (target_hsql_data_type == hsql::DataType::DATE) {
-          // We do not have a Date data type, so we check if the date is valid and return its ValueExpression.
-          const auto timestamp = string_to_timestamp(input_string);
-          AssertInput(timestamp && input_string.size() == 10,
-                      "'" + input_string + "' is not a valid ISO 8601 extended date.");
+      if (target_hsql_data_type == hsql::DataType::DATE) {
+        AssertInput(source_data_type == DataType::String || source_data_type == DataType::Date ||
+                        source_data_type == DataType::Null,
+                    "Cannot cast " + left->as_column_name() + " as DATE.");
+        if (source_data_type == DataType::Date) {
           return left;
         }
 
-        if (target_hsql_data_type == hsql::DataType::DATETIME) {
-          const auto date_time = string_to_timestamp(input_string);
-          AssertInput(date_time, "'" + input_string + "' is not a valid ISO 8601 extended timestamp.");
-          // Parsing valid timestamps is also possible for at first glance invalid strings (see
-          // utils/date_time_utils.hpp for details). To always obtain a semantically meaningful result, we retrieve the
-          // created timestamp's string representation.
-          return value_(pmr_string{timestamp_to_string(*date_time)});
+        // Literals are translated to the number of days right away. Other strings are checked when the cast is
+        // evaluated.
+        if (left->type != ExpressionType::Value || source_data_type == DataType::Null) {
+          return cast_(left, DataType::Date);
         }
+
+        const auto input_string = std::string{boost::get<pmr_string>(static_cast<ValueExpression&>(*left).value)};
+        const auto days = date_string_to_days(input_string);
+        AssertInput(days, "'" + input_string + "' is not a valid ISO 8601 extended date.");
+        return date_value(*days);
+      }
+
+      if (target_hsql_data_type == hsql::DataType::DATETIME) {
+        AssertInput(source_data_type == DataType::String, "Cannot cast " + left->as_column_name() + " as DATETIME.");
+        // Timestamps are stored as strings. We do not know if an expression to be casted other than a ValueExpression
+        // actually contains timestamps, and we cannot check this later.
+        AssertInput(left->type == ExpressionType::Value, "Only ValueExpressions can be casted as DATETIME.");
+        const auto input_string = std::string{boost::get<pmr_string>(static_cast<ValueExpression&>(*left).value)};
+        const auto date_time = string_to_timestamp(input_string);
+        AssertInput(date_time, "'" + input_string + "' is not a valid ISO 8601 extended timestamp.");
+        // Parsing valid timestamps is also possible for at first glance invalid strings (see utils/date_time_utils.hpp
+        // for details). To always obtain a semantically meaningful result, we retrieve the created timestamp's string
+        // representation.
+        return value_(pmr_string{timestamp_to_string(*date_time)});
       }
 
       const auto data_type_iter = supported_hsql_data_types.find(expr.columnType.data_type);
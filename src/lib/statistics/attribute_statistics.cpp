@@ -14,6 +14,7 @@
 #include "statistics/statistics_objects/min_max_filter.hpp"
 #include "statistics/statistics_objects/null_value_ratio_statistics.hpp"
 #include "statistics/statistics_objects/range_filter.hpp"
+#include "statistics/statistics_objects/split_block_bloom_filter.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
@@ -35,6 +36,9 @@ void AttributeStatistics<T>::set_statistics_object(
     histogram = histogram_object;
   } else if (const auto min_max_object = std::dynamic_pointer_cast<const MinMaxFilter<T>>(statistics_object)) {
     min_max_filter = min_max_object;
+  } else if (const auto bloom_filter_object =
+                 std::dynamic_pointer_cast<const SplitBlockBloomFilter<T>>(statistics_object)) {
+    bloom_filter = bloom_filter_object;
   } else if (const auto null_value_ratio_object =
                  std::dynamic_pointer_cast<const NullValueRatioStatistics>(statistics_object)) {
     null_value_ratio = null_value_ratio_object;
@@ -80,6 +84,10 @@ std::shared_ptr<const BaseAttributeStatistics> AttributeStatistics<T>::scaled(co
     }
   }
 
+  if (bloom_filter) {
+    statistics->set_statistics_object(bloom_filter->scaled(selectivity));
+  }
+
   if (distinct_value_count) {
     statistics->set_statistics_object(distinct_value_count->scaled(selectivity));
   }
@@ -111,6 +119,10 @@ std::shared_ptr<const BaseAttributeStatistics> AttributeStatistics<T>::sliced(
     }
   }
 
+  if (bloom_filter) {
+    statistics->set_statistics_object(bloom_filter->sliced(predicate_condition, variant_value, variant_value2));
+  }
+
   // We do not slice the distinct value count because we do not know how it changes.
   return statistics;
 }
@@ -144,6 +156,10 @@ std::shared_ptr<const BaseAttributeStatistics> AttributeStatistics<T>::pruned(
     }
   }
 
+  if (bloom_filter) {
+    Fail("Pruning is not implemented for Bloom filters.");
+  }
+
   if (distinct_value_count) {
     Fail("Pruning is not implemented for distinct value count.");
   }
@@ -9,6 +9,7 @@
 #include "statistics/statistics_objects/min_max_filter.hpp"
 #include "statistics/statistics_objects/null_value_ratio_statistics.hpp"
 #include "statistics/statistics_objects/range_filter.hpp"
+#include "statistics/statistics_objects/split_block_bloom_filter.hpp"
 #include "types.hpp"
 
 namespace hyrise {
@@ -39,6 +40,7 @@ class AttributeStatistics : public BaseAttributeStatistics,
   std::shared_ptr<const AbstractHistogram<T>> histogram;
   std::shared_ptr<const MinMaxFilter<T>> min_max_filter;
   std::shared_ptr<const RangeFilter<T>> range_filter;
+  std::shared_ptr<const SplitBlockBloomFilter<T>> bloom_filter;
   std::shared_ptr<const NullValueRatioStatistics> null_value_ratio;
   std::shared_ptr<const DistinctValueCount> distinct_value_count;
 };
@@ -61,6 +63,10 @@ std::ostream& operator<<(std::ostream& stream, const AttributeStatistics<T>& att
     }
   }
 
+  if (attribute_statistics.bloom_filter) {
+    stream << "SplitBlockBloomFilter: " << *attribute_statistics.bloom_filter << '\n';
+  }
+
   if (attribute_statistics.null_value_ratio) {
     stream << "NullValueRatio: " << attribute_statistics.null_value_ratio->ratio << '\n';
   }
@@ -869,6 +869,7 @@ std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_operator_scan_pr
           column_statistics->histogram = input_statistics.histogram;
           column_statistics->min_max_filter = input_statistics.min_max_filter;
           column_statistics->range_filter = input_statistics.range_filter;
+          column_statistics->bloom_filter = input_statistics.bloom_filter;
           column_statistics->distinct_value_count = input_statistics.distinct_value_count;
         }
         output_column_statistics[left_column_id] = column_statistics;
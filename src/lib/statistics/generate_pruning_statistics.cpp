@@ -11,6 +11,7 @@
 #include "statistics/statistics_objects/equal_distinct_count_histogram.hpp"
 #include "statistics/statistics_objects/min_max_filter.hpp"
 #include "statistics/statistics_objects/range_filter.hpp"
+#include "statistics/statistics_objects/split_block_bloom_filter.hpp"
 #include "statistics/table_statistics.hpp"
 #include "storage/chunk.hpp"
 #include "storage/create_iterable_from_segment.hpp"
@@ -33,6 +34,12 @@ void create_pruning_statistics_for_segment(AttributeStatistics<T>& segment_stati
     }
   }
 
+  // RangeFilters store small sets of distinct values exactly. For all other segments, a Bloom filter allows pruning
+  // equality predicates, which value ranges cannot do for unsorted, high-cardinality columns.
+  if (!std::is_arithmetic_v<T> || dictionary.size() > DEFAULT_MAX_RANGES_COUNT) {
+    segment_statistics.set_statistics_object(SplitBlockBloomFilter<T>::build_filter(dictionary));
+  }
+
   segment_statistics.set_statistics_object(std::make_shared<DistinctValueCount>(dictionary.size()));
 }
 
@@ -0,0 +1,153 @@
+#include "split_block_bloom_filter.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include <boost/container_hash/hash.hpp>
+
+#include "abstract_statistics_object.hpp"
+#include "all_type_variant.hpp"
+#include "resolve_type.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT(build/namespaces)
+
+// Odd constants used to derive the bit positions within a block from the lower 32 bits of a value's hash. The same
+// constants are used by the split block Bloom filters of Apache Parquet.
+constexpr auto SALTS = std::array<uint32_t, 8>{0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+                                               0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+
+constexpr auto BITS_PER_BLOCK = sizeof(SplitBlockBloomFilter<int32_t>::Block) * 8;
+
+SplitBlockBloomFilter<int32_t>::Block block_mask(const uint32_t hash) {
+  auto mask = SplitBlockBloomFilter<int32_t>::Block{};
+  for (auto word_id = size_t{0}; word_id < mask.size(); ++word_id) {
+    mask[word_id] = uint32_t{1} << ((hash * SALTS[word_id]) >> 27);
+  }
+  return mask;
+}
+
+size_t block_id(const uint64_t hash, const size_t block_count) {
+  // Map the upper 32 bits of the hash to [0, block_count) without a modulo operation.
+  return static_cast<size_t>(((hash >> 32) * block_count) >> 32);
+}
+
+}  // namespace
+
+namespace hyrise {
+
+template <typename T>
+SplitBlockBloomFilter<T>::SplitBlockBloomFilter(std::vector<Block> init_blocks)
+    : AbstractStatisticsObject(data_type_from_type<T>()), blocks(std::move(init_blocks)) {
+  DebugAssert(!blocks.empty(), "Cannot construct empty SplitBlockBloomFilter.");
+}
+
+template <typename T>
+std::unique_ptr<SplitBlockBloomFilter<T>> SplitBlockBloomFilter<T>::build_filter(const pmr_vector<T>& dictionary,
+                                                                                 const uint32_t bits_per_value) {
+  // Empty dictionaries will, e.g., occur in segments with only NULLs - or empty segments.
+  if (dictionary.empty()) {
+    return nullptr;
+  }
+
+  Assert(bits_per_value > 0, "Number of bits per value must be positive.");
+  const auto block_count = (dictionary.size() * bits_per_value + BITS_PER_BLOCK - 1) / BITS_PER_BLOCK;
+  auto blocks = std::vector<Block>(block_count);
+
+  for (const auto& value : dictionary) {
+    const auto hash = _hash(value);
+    const auto mask = block_mask(static_cast<uint32_t>(hash));
+    auto& block = blocks[block_id(hash, block_count)];
+    for (auto word_id = size_t{0}; word_id < block.size(); ++word_id) {
+      block[word_id] |= mask[word_id];
+    }
+  }
+
+  return std::make_unique<SplitBlockBloomFilter<T>>(std::move(blocks));
+}
+
+template <typename T>
+Cardinality SplitBlockBloomFilter<T>::estimate_cardinality(
+    const PredicateCondition /*predicate_condition*/, const AllTypeVariant& /*variant_value*/,
+    const std::optional<AllTypeVariant>& /*variant_value2*/) const {
+  // As MinMaxFilters and RangeFilters, SplitBlockBloomFilters are created on a per-segment basis and do not know the
+  // number of rows.
+  Fail("Currently, SplitBlockBloomFilters cannot be used to estimate cardinalities.");
+}
+
+template <typename T>
+std::shared_ptr<const AbstractStatisticsObject> SplitBlockBloomFilter<T>::sliced(
+    const PredicateCondition predicate_condition, const AllTypeVariant& variant_value,
+    const std::optional<AllTypeVariant>& variant_value2) const {
+  if (does_not_contain(predicate_condition, variant_value, variant_value2)) {
+    return nullptr;
+  }
+
+  // A filter built for a set of values is also a valid filter for each of its subsets.
+  return this->shared_from_this();
+}
+
+template <typename T>
+std::shared_ptr<const AbstractStatisticsObject> SplitBlockBloomFilter<T>::scaled(
+    const Selectivity /*selectivity*/) const {
+  return this->shared_from_this();
+}
+
+template <typename T>
+bool SplitBlockBloomFilter<T>::does_not_contain(const PredicateCondition predicate_condition,
+                                                const AllTypeVariant& variant_value,
+                                                const std::optional<AllTypeVariant>& /*variant_value2*/) const {
+  // Early exit for NULL variants and all predicates but equality.
+  if (predicate_condition != PredicateCondition::Equals || variant_is_null(variant_value)) {
+    return false;
+  }
+
+  // We expect the caller (e.g., the ChunkPruningRule) to handle type-safe conversions. Boost will throw an exception
+  // if this was not done.
+  return !may_contain(boost::get<T>(variant_value));
+}
+
+template <typename T>
+bool SplitBlockBloomFilter<T>::may_contain(const T& value) const {
+  const auto hash = _hash(value);
+  const auto mask = block_mask(static_cast<uint32_t>(hash));
+  const auto& block = blocks[block_id(hash, blocks.size())];
+
+  for (auto word_id = size_t{0}; word_id < block.size(); ++word_id) {
+    if ((block[word_id] & mask[word_id]) == 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <typename T>
+size_t SplitBlockBloomFilter<T>::memory_usage() const {
+  return sizeof(*this) + blocks.capacity() * sizeof(Block);
+}
+
+template <typename T>
+uint64_t SplitBlockBloomFilter<T>::_hash(const T& value) {
+  // boost::hash is the identity for integers and leaves the lower bits of many floating-point values empty. The
+  // finalizer of MurmurHash3 spreads all input bits over both the upper bits (block id) and the lower bits (bit
+  // positions within the block).
+  auto hash = static_cast<uint64_t>(boost::hash_value(value));
+  hash ^= hash >> 33;
+  hash *= uint64_t{0xff51afd7ed558ccd};
+  hash ^= hash >> 33;
+  hash *= uint64_t{0xc4ceb9fe1a85ec53};
+  hash ^= hash >> 33;
+  return hash;
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(SplitBlockBloomFilter);
+
+}  // namespace hyrise
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "abstract_statistics_object.hpp"
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+static constexpr uint32_t DEFAULT_BLOOM_FILTER_BITS_PER_VALUE = 10;
+
+/**
+ * Filters are data structures that are primarily used for probabilistic membership queries. In Hyrise, they are
+ * typically created on a single segment. They can then be used to check whether a certain value exists in the segment.
+ *
+ * MinMaxFilters and RangeFilters only store value ranges. For unsorted, high-cardinality columns (e.g., order IDs or
+ * UUIDs), the range of each segment spans almost the entire domain, so that they cannot prune equality predicates. The
+ * SplitBlockBloomFilter approximates the set of distinct values instead: does_not_contain() never returns true for
+ * values that exist in the segment, but returns false for a small fraction of values that do not exist (roughly 1% with
+ * the default of ten bits per distinct value).
+ *
+ * We use a split block Bloom filter (as used by, e.g., Apache Parquet and Impala): Each value is hashed to a single
+ * block of 256 bits and sets one bit in each of the block's eight 32-bit words. Thus, a lookup touches a single cache
+ * line.
+ */
+template <typename T>
+class SplitBlockBloomFilter : public AbstractStatisticsObject,
+                              public std::enable_shared_from_this<SplitBlockBloomFilter<T>> {
+ public:
+  using Block = std::array<uint32_t, 8>;
+
+  explicit SplitBlockBloomFilter(std::vector<Block> init_blocks);
+
+  // Returns nullptr for empty dictionaries, as for RangeFilters.
+  static std::unique_ptr<SplitBlockBloomFilter<T>> build_filter(
+      const pmr_vector<T>& dictionary, const uint32_t bits_per_value = DEFAULT_BLOOM_FILTER_BITS_PER_VALUE);
+
+  Cardinality estimate_cardinality(const PredicateCondition /*predicate_condition*/,
+                                   const AllTypeVariant& /*variant_value*/,
+                                   const std::optional<AllTypeVariant>& /*variant_value2*/ = std::nullopt) const;
+
+  std::shared_ptr<const AbstractStatisticsObject> sliced(
+      const PredicateCondition predicate_condition, const AllTypeVariant& variant_value,
+      const std::optional<AllTypeVariant>& variant_value2 = std::nullopt) const override;
+
+  std::shared_ptr<const AbstractStatisticsObject> scaled(const Selectivity selectivity) const override;
+
+  // Only equality predicates can be answered. For all other predicate conditions, false is returned.
+  bool does_not_contain(const PredicateCondition predicate_condition, const AllTypeVariant& variant_value,
+                        const std::optional<AllTypeVariant>& variant_value2 = std::nullopt) const;
+
+  bool may_contain(const T& value) const;
+
+  size_t memory_usage() const;
+
+  const std::vector<Block> blocks;
+
+ protected:
+  static uint64_t _hash(const T& value);
+};
+
+template <typename T>
+std::ostream& operator<<(std::ostream& stream, const SplitBlockBloomFilter<T>& filter) {
+  stream << "{ " << filter.blocks.size() << " block(s) }";
+  return stream;
+}
+
+EXPLICITLY_DECLARE_DATA_TYPES(SplitBlockBloomFilter);
+
+}  // namespace hyrise
@@ -0,0 +1,17 @@
+#include "abstract_encoded_segment.hpp"
+
+#include <memory>
+
+#include "storage/segment_zone_map.hpp"
+
+namespace hyrise {
+
+std::shared_ptr<const BaseSegmentZoneMap> AbstractEncodedSegment::zone_map() const {
+  return _zone_map;
+}
+
+void AbstractEncodedSegment::set_zone_map(const std::shared_ptr<const BaseSegmentZoneMap>& zone_map) {
+  _zone_map = zone_map;
+}
+
+}  // namespace hyrise
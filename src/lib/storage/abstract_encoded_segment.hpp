@@ -1,11 +1,14 @@
 #pragma once
 
+#include <memory>
+
 #include "storage/abstract_segment.hpp"
 #include "storage/encoding_type.hpp"
 
 namespace hyrise {
 
 enum class CompressedVectorType : uint8_t;
+class BaseSegmentZoneMap;
 
 /**
  * @brief Base class of all encoded segments
@@ -24,6 +27,18 @@ class AbstractEncodedSegment : public AbstractSegment {
    * Returns the vector’s type if it does, else std::nullopt
    */
   virtual std::optional<CompressedVectorType> compressed_vector_type() const = 0;
+
+  /**
+   * Returns the zone map with per-block minima, maxima, and NULL counts (see segment_zone_map.hpp) or nullptr if none
+   * was built. Zone maps are set by the segment encoders before the segment is published and are not part of
+   * memory_usage(), similar to the pruning statistics of a chunk.
+   */
+  std::shared_ptr<const BaseSegmentZoneMap> zone_map() const;
+
+  void set_zone_map(const std::shared_ptr<const BaseSegmentZoneMap>& zone_map);
+
+ protected:
+  std::shared_ptr<const BaseSegmentZoneMap> _zone_map;
 };
 
 }  // namespace hyrise
@@ -0,0 +1,181 @@
+#include "alp_segment.hpp"
+
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <utility>
+
+#include "all_type_variant.hpp"
+#include "resolve_type.hpp"
+#include "storage/abstract_encoded_segment.hpp"
+#include "storage/abstract_segment.hpp"
+#include "storage/encoding_type.hpp"
+#include "storage/vector_compression/base_compressed_vector.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+#include "utils/performance_warning.hpp"
+
+namespace hyrise {
+
+template <typename T, typename U>
+ALPSegment<T, U>::ALPSegment(pmr_vector<uint8_t> exponents, pmr_vector<uint8_t> factors,
+                             pmr_vector<int64_t> block_minima,
+                             std::unique_ptr<const BaseCompressedVector> offset_values,
+                             pmr_vector<ChunkOffset> exception_positions, pmr_vector<T> exception_values,
+                             std::optional<pmr_vector<bool>> null_values)
+    : AbstractEncodedSegment{data_type_from_type<T>()},
+      _exponents{std::move(exponents)},
+      _factors{std::move(factors)},
+      _block_minima{std::move(block_minima)},
+      _offset_values{std::move(offset_values)},
+      _exception_positions{std::move(exception_positions)},
+      _exception_values{std::move(exception_values)},
+      _null_values{std::move(null_values)},
+      _decompressor{_offset_values->create_base_decompressor()} {
+  DebugAssert(_exponents.size() == _block_minima.size() && _factors.size() == _block_minima.size(),
+              "Expected one exponent, factor, and minimum per block.");
+  DebugAssert(_exception_positions.size() == _exception_values.size(),
+              "Expected one position per exception value.");
+}
+
+template <typename T, typename U>
+const pmr_vector<uint8_t>& ALPSegment<T, U>::exponents() const {
+  return _exponents;
+}
+
+template <typename T, typename U>
+const pmr_vector<uint8_t>& ALPSegment<T, U>::factors() const {
+  return _factors;
+}
+
+template <typename T, typename U>
+const pmr_vector<int64_t>& ALPSegment<T, U>::block_minima() const {
+  return _block_minima;
+}
+
+template <typename T, typename U>
+const BaseCompressedVector& ALPSegment<T, U>::offset_values() const {
+  return *_offset_values;
+}
+
+template <typename T, typename U>
+const pmr_vector<ChunkOffset>& ALPSegment<T, U>::exception_positions() const {
+  return _exception_positions;
+}
+
+template <typename T, typename U>
+const pmr_vector<T>& ALPSegment<T, U>::exception_values() const {
+  return _exception_values;
+}
+
+template <typename T, typename U>
+const std::optional<pmr_vector<bool>>& ALPSegment<T, U>::null_values() const {
+  return _null_values;
+}
+
+template <typename T, typename U>
+void ALPSegment<T, U>::decompress_block(const size_t block_index, T* values) const {
+  DebugAssert(block_index < _block_minima.size(), "Block index out of range.");
+
+  const auto block_begin = block_index * block_size;
+  const auto block_value_count = std::min(size_t{block_size}, _offset_values->size() - block_begin);
+  const auto block_minimum = _block_minima[block_index];
+  const auto factor_multiplier = powers_of_ten[_factors[block_index]];
+  const auto exponent_multiplier = inverse_powers_of_ten[_exponents[block_index]];
+
+  // Same computation as in decode(), but with the block's parameters hoisted out of the loop.
+  resolve_compressed_vector_type(*_offset_values, [&](const auto& offset_values) {
+    auto offset_it = offset_values.cbegin() + static_cast<std::ptrdiff_t>(block_begin);
+    for (auto index = size_t{0}; index < block_value_count; ++index, ++offset_it) {
+      const auto encoded_value = block_minimum + static_cast<int64_t>(*offset_it);
+      values[index] = static_cast<T>(static_cast<double>(encoded_value) * factor_multiplier * exponent_multiplier);
+    }
+  });
+
+  // Patch the exceptions of this block.
+  const auto exceptions_begin =
+      std::lower_bound(_exception_positions.cbegin(), _exception_positions.cend(),
+                       ChunkOffset{static_cast<ChunkOffset::base_type>(block_begin)});
+  for (auto exception_it = exceptions_begin; exception_it != _exception_positions.cend(); ++exception_it) {
+    const auto index = static_cast<size_t>(*exception_it) - block_begin;
+    if (index >= block_value_count) {
+      break;
+    }
+    values[index] = _exception_values[std::distance(_exception_positions.cbegin(), exception_it)];
+  }
+}
+
+template <typename T, typename U>
+AllTypeVariant ALPSegment<T, U>::operator[](const ChunkOffset chunk_offset) const {
+  PerformanceWarning("operator[] used");
+  DebugAssert(chunk_offset < size(), "Passed chunk offset must be valid.");
+
+  const auto typed_value = get_typed_value(chunk_offset);
+  if (!typed_value) {
+    return NULL_VALUE;
+  }
+  return *typed_value;
+}
+
+template <typename T, typename U>
+ChunkOffset ALPSegment<T, U>::size() const {
+  return static_cast<ChunkOffset>(_offset_values->size());
+}
+
+template <typename T, typename U>
+std::shared_ptr<AbstractSegment> ALPSegment<T, U>::copy_using_allocator(
+    const PolymorphicAllocator<size_t>& alloc) const {
+  auto new_exponents = pmr_vector<uint8_t>(_exponents, alloc);
+  auto new_factors = pmr_vector<uint8_t>(_factors, alloc);
+  auto new_block_minima = pmr_vector<int64_t>(_block_minima, alloc);
+  auto new_offset_values = _offset_values->copy_using_allocator(alloc);
+  auto new_exception_positions = pmr_vector<ChunkOffset>(_exception_positions, alloc);
+  auto new_exception_values = pmr_vector<T>(_exception_values, alloc);
+
+  std::optional<pmr_vector<bool>> null_values;
+  if (_null_values) {
+    null_values = pmr_vector<bool>(*_null_values, alloc);
+  }
+
+  auto copy = std::make_shared<ALPSegment>(std::move(new_exponents), std::move(new_factors),
+                                           std::move(new_block_minima), std::move(new_offset_values),
+                                           std::move(new_exception_positions), std::move(new_exception_values),
+                                           std::move(null_values));
+  copy->access_counter = access_counter;
+  copy->set_zone_map(_zone_map);
+  return copy;
+}
+
+template <typename T, typename U>
+size_t ALPSegment<T, U>::memory_usage(const MemoryUsageCalculationMode /*mode*/) const {
+  // MemoryUsageCalculationMode ignored since full calculation is efficient.
+  auto segment_size = sizeof(*this) + _exponents.capacity() + _factors.capacity() +
+                      sizeof(int64_t) * _block_minima.capacity() + _offset_values->data_size() +
+                      sizeof(ChunkOffset) * _exception_positions.capacity() + sizeof(T) * _exception_values.capacity();
+
+  if (_null_values) {
+    segment_size += _null_values->capacity() / CHAR_BIT;
+  }
+
+  return segment_size;
+}
+
+template <typename T, typename U>
+EncodingType ALPSegment<T, U>::encoding_type() const {
+  return EncodingType::ALP;
+}
+
+template <typename T, typename U>
+std::optional<CompressedVectorType> ALPSegment<T, U>::compressed_vector_type() const {
+  return _offset_values->type();
+}
+
+template class ALPSegment<float>;
+template class ALPSegment<double>;
+
+}  // namespace hyrise
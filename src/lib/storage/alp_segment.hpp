@@ -0,0 +1,153 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <type_traits>
+
+#include <boost/hana/contains.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+
+#include "abstract_encoded_segment.hpp"
+#include "storage/vector_compression/base_compressed_vector.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+class BaseCompressedVector;
+
+/**
+ * @brief Segment implementing an ALP-style (Adaptive Lossless floating-Point) encoding for float and double columns
+ *
+ * Many floating-point columns (e.g., prices or sensor readings) hold values that originate from decimals with few
+ * significant digits. Such values can be losslessly represented as integers: for a value v, an exponent e, and a
+ * factor f, the integer round(v * 10^e * 10^-f) is stored. When decoding it by multiplying with 10^f * 10^-e, the
+ * original value is restored bit by bit. Values for which this does not hold (e.g., NaN, infinity, -0.0, or values
+ * with too many significant digits) are stored as exceptions at full width.
+ *
+ * The segment is divided into fixed-size blocks. For each block, the encoder chooses the exponent and factor that
+ * result in the fewest exceptions and smallest integers. As in the FrameOfReferenceSegment, the integers of each block
+ * are stored as offsets from the block's minimum. The offsets are compressed using vector compression (by default,
+ * bit-packing). Exceptions are stored with their chunk offsets, the offsets at their positions are zero.
+ *
+ * Null values are stored in a separate vector. The offset at each position that is NULL is zero.
+ *
+ * A whole block can be decompressed with a tight loop over the offsets (see decompress_block()), which is used for
+ * sequential iteration. Point access decodes single values.
+ *
+ * std::enable_if_t must be used here and cannot be replaced by a static_assert, see frame_of_reference_segment.hpp.
+ */
+template <typename T, typename = std::enable_if_t<encoding_supports_data_type(enum_c<EncodingType, EncodingType::ALP>,
+                                                                              hana::type_c<T>)>>
+class ALPSegment : public AbstractEncodedSegment {
+ public:
+  // Same block size as in the ALP paper (Afroozeh et al., SIGMOD 2024).
+  static constexpr auto block_size = 1024u;
+
+  // T does not hold (many) more significant decimal digits, so larger exponents would only produce exceptions.
+  static constexpr auto max_exponent = uint8_t{std::is_same_v<T, float> ? 10 : 18};
+
+  // Values are scaled in double precision for both float and double. For floats, this restores more values than
+  // computing in single precision, and it avoids overflows if the class is instantiated for unsupported types (which
+  // can happen during overload resolution of create_iterable_from_segment).
+  static constexpr auto powers_of_ten = [] {
+    auto powers = std::array<double, max_exponent + 1>{};
+    powers[0] = 1.0;
+    for (auto exponent = size_t{1}; exponent <= max_exponent; ++exponent) {
+      powers[exponent] = powers[exponent - 1] * 10.0;
+    }
+    return powers;
+  }();
+
+  static constexpr auto inverse_powers_of_ten = [] {
+    auto powers = std::array<double, max_exponent + 1>{};
+    for (auto exponent = size_t{0}; exponent <= max_exponent; ++exponent) {
+      powers[exponent] = 1.0 / powers_of_ten[exponent];
+    }
+    return powers;
+  }();
+
+  ALPSegment(pmr_vector<uint8_t> exponents, pmr_vector<uint8_t> factors, pmr_vector<int64_t> block_minima,
+             std::unique_ptr<const BaseCompressedVector> offset_values, pmr_vector<ChunkOffset> exception_positions,
+             pmr_vector<T> exception_values, std::optional<pmr_vector<bool>> null_values);
+
+  const pmr_vector<uint8_t>& exponents() const;
+  const pmr_vector<uint8_t>& factors() const;
+  const pmr_vector<int64_t>& block_minima() const;
+  const BaseCompressedVector& offset_values() const;
+  const pmr_vector<ChunkOffset>& exception_positions() const;
+  const pmr_vector<T>& exception_values() const;
+  const std::optional<pmr_vector<bool>>& null_values() const;
+
+  static T decode(const int64_t encoded_value, const uint8_t exponent, const uint8_t factor) {
+    return static_cast<T>(static_cast<double>(encoded_value) * powers_of_ten[factor] * inverse_powers_of_ten[exponent]);
+  }
+
+  /**
+   * Writes the values of the block with the given index to `values`, which must hold at least block_size values. The
+   * values at positions that are NULL are undefined.
+   */
+  void decompress_block(const size_t block_index, T* values) const;
+
+  /**
+   * @defgroup AbstractSegment interface
+   * @{
+   */
+
+  AllTypeVariant operator[](const ChunkOffset chunk_offset) const final;
+
+  std::optional<T> get_typed_value(const ChunkOffset chunk_offset) const {
+    // performance critical - not in cpp to help with inlining
+    if (_null_values && (*_null_values)[chunk_offset]) {
+      return std::nullopt;
+    }
+
+    if (!_exception_positions.empty()) {
+      const auto exception_it =
+          std::lower_bound(_exception_positions.cbegin(), _exception_positions.cend(), chunk_offset);
+      if (exception_it != _exception_positions.cend() && *exception_it == chunk_offset) {
+        return _exception_values[std::distance(_exception_positions.cbegin(), exception_it)];
+      }
+    }
+
+    const auto block_index = chunk_offset / block_size;
+    const auto encoded_value = _block_minima[block_index] + static_cast<int64_t>(_decompressor->get(chunk_offset));
+    return decode(encoded_value, _exponents[block_index], _factors[block_index]);
+  }
+
+  ChunkOffset size() const final;
+
+  std::shared_ptr<AbstractSegment> copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const final;
+
+  size_t memory_usage(const MemoryUsageCalculationMode /*mode*/) const final;
+
+  /**@}*/
+
+  /**
+   * @defgroup AbstractEncodedSegment interface
+   * @{
+   */
+
+  EncodingType encoding_type() const final;
+  std::optional<CompressedVectorType> compressed_vector_type() const final;
+
+  /**@}*/
+
+ private:
+  const pmr_vector<uint8_t> _exponents;
+  const pmr_vector<uint8_t> _factors;
+  const pmr_vector<int64_t> _block_minima;
+  const std::unique_ptr<const BaseCompressedVector> _offset_values;
+  const pmr_vector<ChunkOffset> _exception_positions;
+  const pmr_vector<T> _exception_values;
+  const std::optional<pmr_vector<bool>> _null_values;
+  std::unique_ptr<BaseVectorDecompressor> _decompressor;
+};
+
+extern template class ALPSegment<float>;
+extern template class ALPSegment<double>;
+
+}  // namespace hyrise
@@ -0,0 +1,220 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <climits>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "storage/alp_segment.hpp"
+#include "storage/base_segment_encoder.hpp"
+#include "storage/value_segment.hpp"
+#include "storage/value_segment/value_segment_iterable.hpp"
+#include "storage/vector_compression/vector_compression.hpp"
+#include "types.hpp"
+#include "utils/enum_constant.hpp"
+
+namespace hyrise {
+
+/**
+ * Encodes float and double segments as described in alp_segment.hpp.
+ *
+ * For each block, the exponent and factor are chosen on a sample of the block's values: every combination with
+ * factor <= exponent is tried, and the combination with the smallest estimated size (bit width of the offsets plus
+ * exceptions at full width) wins. If the encoded integers of a block span more than 32 bits (the maximum supported by
+ * vector compression), all values of the block are stored as exceptions.
+ */
+class ALPEncoder : public SegmentEncoder<ALPEncoder> {
+ public:
+  static constexpr auto _encoding_type = enum_c<EncodingType, EncodingType::ALP>;
+  static constexpr auto _uses_vector_compression = true;  // see base_segment_encoder.hpp for details
+
+  // Number of values per block that are used to choose the block's exponent and factor.
+  static constexpr auto sample_size = size_t{32};
+
+  template <typename T>
+  std::shared_ptr<AbstractEncodedSegment> _on_encode(const AnySegmentIterable<T> segment_iterable,
+                                                     const PolymorphicAllocator<T>& allocator) {
+    static constexpr auto block_size = size_t{ALPSegment<T>::block_size};
+
+    // holds the values of the segment, NULLs are stored as zero
+    auto values = std::vector<T>{};
+
+    // holds whether a segment value is null
+    auto null_values = pmr_vector<bool>{allocator};
+
+    auto segment_contains_null_values = false;
+
+    segment_iterable.with_iterators([&](auto segment_it, const auto segment_end) {
+      const auto size = std::distance(segment_it, segment_end);
+      values.reserve(size);
+      null_values.reserve(size);
+
+      for (; segment_it != segment_end; ++segment_it) {
+        const auto segment_value = *segment_it;
+        const auto value_is_null = segment_value.is_null();
+        values.push_back(value_is_null ? T{0} : segment_value.value());
+        null_values.push_back(value_is_null);
+        segment_contains_null_values |= value_is_null;
+      }
+    });
+
+    const auto size = values.size();
+    const auto block_count = (size + block_size - 1) / block_size;
+
+    auto exponents = pmr_vector<uint8_t>{allocator};
+    auto factors = pmr_vector<uint8_t>{allocator};
+    auto block_minima = pmr_vector<int64_t>{allocator};
+    exponents.reserve(block_count);
+    factors.reserve(block_count);
+    block_minima.reserve(block_count);
+
+    // holds the uncompressed offset values, zero for NULLs and exceptions
+    auto offset_values = pmr_vector<uint32_t>(size, allocator);
+
+    auto exception_positions = pmr_vector<ChunkOffset>{allocator};
+    auto exception_values = pmr_vector<T>{allocator};
+
+    // used as optional input for the compression of the offset values
+    auto max_offset = uint32_t{0};
+
+    auto encoded_block_values = std::array<std::optional<int64_t>, block_size>{};
+
+    for (auto block_index = size_t{0}; block_index < block_count; ++block_index) {
+      const auto block_begin = block_index * block_size;
+      const auto block_end = std::min(block_begin + block_size, size);
+
+      auto [exponent, factor] = _choose_parameters(values, null_values, block_begin, block_end);
+
+      auto block_minimum = std::numeric_limits<int64_t>::max();
+      auto block_maximum = std::numeric_limits<int64_t>::min();
+      for (auto index = block_begin; index < block_end; ++index) {
+        auto& encoded_value = encoded_block_values[index - block_begin];
+        encoded_value = null_values[index] ? std::nullopt : _encode(values[index], exponent, factor);
+        if (encoded_value) {
+          block_minimum = std::min(block_minimum, *encoded_value);
+          block_maximum = std::max(block_maximum, *encoded_value);
+        }
+      }
+
+      if (block_minimum > block_maximum) {
+        // The block does not contain any encodable values.
+        block_minimum = 0;
+      } else if (static_cast<uint64_t>(block_maximum - block_minimum) > std::numeric_limits<uint32_t>::max()) {
+        // The offsets would not fit into uint32_t (required for vector compression). Store all values as exceptions.
+        std::fill(encoded_block_values.begin(), encoded_block_values.end(), std::nullopt);
+        exponent = 0;
+        factor = 0;
+        block_minimum = 0;
+      }
+
+      exponents.push_back(exponent);
+      factors.push_back(factor);
+      block_minima.push_back(block_minimum);
+
+      for (auto index = block_begin; index < block_end; ++index) {
+        if (null_values[index]) {
+          continue;
+        }
+
+        const auto& encoded_value = encoded_block_values[index - block_begin];
+        if (!encoded_value) {
+          exception_positions.emplace_back(static_cast<ChunkOffset::base_type>(index));
+          exception_values.push_back(values[index]);
+          continue;
+        }
+
+        const auto offset = static_cast<uint32_t>(*encoded_value - block_minimum);
+        offset_values[index] = offset;
+        max_offset = std::max(max_offset, offset);
+      }
+    }
+
+    auto compressed_offset_values = compress_vector(offset_values, vector_compression_type(), allocator, {max_offset});
+
+    auto optional_null_values =
+        segment_contains_null_values ? std::optional<pmr_vector<bool>>{std::move(null_values)} : std::nullopt;
+    return std::make_shared<ALPSegment<T>>(std::move(exponents), std::move(factors), std::move(block_minima),
+                                           std::move(compressed_offset_values), std::move(exception_positions),
+                                           std::move(exception_values), std::move(optional_null_values));
+  }
+
+ private:
+  // Returns the integer representation of the value or std::nullopt if decoding it does not restore the value.
+  template <typename T>
+  static std::optional<int64_t> _encode(const T value, const uint8_t exponent, const uint8_t factor) {
+    // Larger integers cannot be exactly represented as doubles. This check also fails for NaN and infinity.
+    static constexpr auto max_encoded_value = static_cast<double>(int64_t{1} << 52);
+
+    const auto scaled_value = static_cast<double>(value) * ALPSegment<T>::powers_of_ten[exponent] *
+                              ALPSegment<T>::inverse_powers_of_ten[factor];
+    if (!(std::abs(scaled_value) <= max_encoded_value)) {
+      return std::nullopt;
+    }
+
+    const auto encoded_value = static_cast<int64_t>(std::llround(scaled_value));
+    const auto decoded_value = ALPSegment<T>::decode(encoded_value, exponent, factor);
+
+    // Checking the sign bit excludes -0.0, which would be decoded as 0.0.
+    if (decoded_value != value || std::signbit(decoded_value) != std::signbit(value)) {
+      return std::nullopt;
+    }
+    return encoded_value;
+  }
+
+  template <typename T>
+  static std::pair<uint8_t, uint8_t> _choose_parameters(const std::vector<T>& values,
+                                                        const pmr_vector<bool>& null_values, const size_t block_begin,
+                                                        const size_t block_end) {
+    auto sample = std::vector<T>{};
+    sample.reserve(sample_size);
+    // An odd step avoids that only values at every n-th position of a periodic pattern end up in the sample.
+    const auto step = std::max(size_t{1}, (block_end - block_begin) / sample_size) | size_t{1};
+    for (auto index = block_begin; index < block_end && sample.size() < sample_size; index += step) {
+      if (!null_values[index]) {
+        sample.push_back(values[index]);
+      }
+    }
+
+    auto best_parameters = std::pair<uint8_t, uint8_t>{0, 0};
+    auto best_size = std::numeric_limits<uint64_t>::max();
+
+    // On ties, smaller exponents win, e.g., 1.5 is encoded as 15 (10^1) rather than 150 (10^2).
+    for (auto exponent = uint8_t{0}; exponent <= ALPSegment<T>::max_exponent; ++exponent) {
+      for (auto factor = uint8_t{0}; factor <= exponent; ++factor) {
+        auto exception_count = uint64_t{0};
+        auto minimum = std::numeric_limits<int64_t>::max();
+        auto maximum = std::numeric_limits<int64_t>::min();
+
+        for (const auto value : sample) {
+          const auto encoded_value = _encode(value, exponent, factor);
+          if (!encoded_value) {
+            ++exception_count;
+            continue;
+          }
+          minimum = std::min(minimum, *encoded_value);
+          maximum = std::max(maximum, *encoded_value);
+        }
+
+        const auto bit_width =
+            minimum <= maximum ? static_cast<uint64_t>(std::bit_width(static_cast<uint64_t>(maximum - minimum))) : 0;
+        const auto estimated_size =
+            sample.size() * bit_width + exception_count * (sizeof(T) + sizeof(ChunkOffset)) * CHAR_BIT;
+        if (estimated_size < best_size) {
+          best_size = estimated_size;
+          best_parameters = {exponent, factor};
+        }
+      }
+    }
+
+    return best_parameters;
+  }
+};
+
+}  // namespace hyrise
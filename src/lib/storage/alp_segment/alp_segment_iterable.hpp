@@ -0,0 +1,194 @@
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "storage/abstract_segment.hpp"
+#include "storage/alp_segment.hpp"
+#include "storage/segment_iterables.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
+
+namespace hyrise {
+
+template <typename T>
+class ALPSegmentIterable : public PointAccessibleSegmentIterable<ALPSegmentIterable<T>> {
+ public:
+  using ValueType = T;
+
+  explicit ALPSegmentIterable(const ALPSegment<T>& segment) : _segment{segment} {}
+
+  /**
+   * For the sequential access, the segment is decompressed block by block into a vector, so that the per-block
+   * parameters are only looked up once per block and the exceptions are patched without searching them for every
+   * value.
+   */
+  template <typename Functor>
+  void _on_with_iterators(const Functor& functor) const {
+    using ValueIterator = typename std::vector<T>::const_iterator;
+
+    const auto size = static_cast<size_t>(_segment.size());
+    _segment.access_counter[SegmentAccessCounter::AccessType::Sequential] += size;
+
+    // The vector is sized to full blocks so that decompress_block() can write the last block without bounds checks.
+    const auto block_count = _segment.block_minima().size();
+    auto decompressed_segment = std::vector<T>(block_count * ALPSegment<T>::block_size);
+    for (auto block_index = size_t{0}; block_index < block_count; ++block_index) {
+      _segment.decompress_block(block_index, decompressed_segment.data() + block_index * ALPSegment<T>::block_size);
+    }
+    decompressed_segment.resize(size);
+
+    if (_segment.null_values()) {
+      auto begin =
+          Iterator<ValueIterator>{decompressed_segment.cbegin(), _segment.null_values()->cbegin(), ChunkOffset{0u}};
+      auto end = Iterator<ValueIterator>{decompressed_segment.cend(), _segment.null_values()->cend(),
+                                         static_cast<ChunkOffset>(size)};
+      functor(begin, end);
+    } else {
+      auto begin = Iterator<ValueIterator>{decompressed_segment.cbegin(), std::nullopt, ChunkOffset{0u}};
+      auto end = Iterator<ValueIterator>{decompressed_segment.cend(), std::nullopt, static_cast<ChunkOffset>(size)};
+      functor(begin, end);
+    }
+  }
+
+  template <typename Functor, typename PosListType>
+  void _on_with_iterators(const std::shared_ptr<PosListType>& position_filter, const Functor& functor) const {
+    _segment.access_counter[SegmentAccessCounter::access_type(*position_filter)] += position_filter->size();
+    resolve_compressed_vector_type(_segment.offset_values(), [&](const auto& offset_values) {
+      using OffsetValueDecompressor = std::decay_t<decltype(offset_values.create_decompressor())>;
+      using PosListIteratorType = std::decay_t<decltype(position_filter->cbegin())>;
+
+      auto begin = PointAccessIterator<OffsetValueDecompressor, PosListIteratorType>{
+          &_segment, offset_values.create_decompressor(), position_filter->cbegin(), position_filter->cbegin()};
+
+      auto end = PointAccessIterator<OffsetValueDecompressor, PosListIteratorType>{
+          &_segment, offset_values.create_decompressor(), position_filter->cbegin(), position_filter->cend()};
+
+      functor(begin, end);
+    });
+  }
+
+  size_t _on_size() const {
+    return _segment.size();
+  }
+
+ private:
+  const ALPSegment<T>& _segment;
+
+ private:
+  template <typename ValueIterator>
+  class Iterator : public AbstractSegmentIterator<Iterator<ValueIterator>, SegmentPosition<T>> {
+   public:
+    using ValueType = T;
+    using IterableType = ALPSegmentIterable<T>;
+    using NullValueIterator = typename pmr_vector<bool>::const_iterator;
+
+   public:
+    // Begin and End Iterator
+    explicit Iterator(ValueIterator data_it, std::optional<NullValueIterator> null_value_it, ChunkOffset chunk_offset)
+        : _chunk_offset{chunk_offset}, _data_it{std::move(data_it)}, _null_value_it{std::move(null_value_it)} {}
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    void increment() {
+      ++_chunk_offset;
+      ++_data_it;
+      if (_null_value_it) {
+        ++(*_null_value_it);
+      }
+    }
+
+    void decrement() {
+      --_chunk_offset;
+      --_data_it;
+      if (_null_value_it) {
+        --(*_null_value_it);
+      }
+    }
+
+    void advance(std::ptrdiff_t n) {
+      _chunk_offset += n;
+      _data_it += n;
+      if (_null_value_it) {
+        *_null_value_it += n;
+      }
+    }
+
+    bool equal(const Iterator& other) const {
+      return _data_it == other._data_it;
+    }
+
+    std::ptrdiff_t distance_to(const Iterator& other) const {
+      return std::ptrdiff_t{other._chunk_offset} - std::ptrdiff_t{_chunk_offset};
+    }
+
+    SegmentPosition<T> dereference() const {
+      return SegmentPosition<T>{*_data_it, _null_value_it ? **_null_value_it : false, _chunk_offset};
+    }
+
+   private:
+    ChunkOffset _chunk_offset;
+    ValueIterator _data_it;
+    std::optional<NullValueIterator> _null_value_it;
+  };
+
+  template <typename OffsetValueDecompressor, typename PosListIteratorType>
+  class PointAccessIterator
+      : public AbstractPointAccessSegmentIterator<PointAccessIterator<OffsetValueDecompressor, PosListIteratorType>,
+                                                  SegmentPosition<T>, PosListIteratorType> {
+   public:
+    using ValueType = T;
+    using IterableType = ALPSegmentIterable<T>;
+
+    PointAccessIterator(const ALPSegment<T>* segment, OffsetValueDecompressor offset_value_decompressor,
+                        PosListIteratorType position_filter_begin, PosListIteratorType position_filter_it)
+        : AbstractPointAccessSegmentIterator<PointAccessIterator<OffsetValueDecompressor, PosListIteratorType>,
+                                             SegmentPosition<T>, PosListIteratorType>{std::move(position_filter_begin),
+                                                                                      std::move(position_filter_it)},
+          _segment{segment},
+          _offset_value_decompressor{std::move(offset_value_decompressor)} {}
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    SegmentPosition<T> dereference() const {
+      static constexpr auto block_size = ALPSegment<T>::block_size;
+
+      const auto& chunk_offsets = this->chunk_offsets();
+      const auto current_offset = chunk_offsets.offset_in_referenced_chunk;
+
+      const auto& null_values = _segment->null_values();
+      if (null_values && (*null_values)[current_offset]) {
+        return SegmentPosition<T>{T{}, true, chunk_offsets.offset_in_poslist};
+      }
+
+      const auto& exception_positions = _segment->exception_positions();
+      if (!exception_positions.empty()) {
+        const auto exception_it =
+            std::lower_bound(exception_positions.cbegin(), exception_positions.cend(), current_offset);
+        if (exception_it != exception_positions.cend() && *exception_it == current_offset) {
+          const auto value =
+              _segment->exception_values()[std::distance(exception_positions.cbegin(), exception_it)];
+          return SegmentPosition<T>{value, false, chunk_offsets.offset_in_poslist};
+        }
+      }
+
+      const auto block_index = current_offset / block_size;
+      const auto encoded_value = _segment->block_minima()[block_index] +
+                                 static_cast<int64_t>(_offset_value_decompressor.get(current_offset));
+      const auto value =
+          ALPSegment<T>::decode(encoded_value, _segment->exponents()[block_index], _segment->factors()[block_index]);
+
+      return SegmentPosition<T>{value, false, chunk_offsets.offset_in_poslist};
+    }
+
+   private:
+    const ALPSegment<T>* _segment;
+    mutable OffsetValueDecompressor _offset_value_decompressor;
+  };
+};
+
+}  // namespace hyrise
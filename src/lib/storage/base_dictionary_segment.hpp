@@ -40,7 +40,10 @@ class BaseDictionarySegment : public AbstractEncodedSegment {
   virtual AllTypeVariant value_of_value_id(const ValueID value_id) const = 0;
 
   /**
-   * @brief The size of the dictionary
+   * @brief The number of distinct values in the segment
+   *
+   * This is the size of the dictionary unless the dictionary is shared with other segments. As the value IDs of such
+   * segments refer to the shared dictionary, use null_value_id() as the upper bound of value IDs.
    */
   virtual ValueID::base_type unique_values_count() const = 0;
 
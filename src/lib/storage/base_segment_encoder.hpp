@@ -11,6 +11,7 @@
 #include "storage/abstract_segment.hpp"
 #include "storage/create_iterable_from_segment.hpp"
 #include "storage/encoding_type.hpp"
+#include "storage/segment_zone_map.hpp"
 #include "storage/vector_compression/vector_compression.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
@@ -19,6 +20,8 @@ namespace hyrise {
 
 namespace hana = boost::hana;
 
+class ALPEncoder;
+class FSSTEncoder;
 class LZ4Encoder;
 
 /**
@@ -144,7 +147,12 @@ class SegmentEncoder : public BaseSegmentEncoder {
     const auto iterable = create_any_segment_iterable<ColumnDataType>(*abstract_segment);
 
     // For now, we allocate without a specific memory source.
-    return _self()._on_encode(iterable, PolymorphicAllocator<ColumnDataType>{});
+    auto encoded_segment = _self()._on_encode(iterable, PolymorphicAllocator<ColumnDataType>{});
+
+    // The zone map is built from the input segment, which usually is an unencoded ValueSegment that is cheaper to
+    // iterate than the encoded segment.
+    encoded_segment->set_zone_map(build_segment_zone_map(*abstract_segment));
+    return encoded_segment;
   }
 
   /**@}*/
@@ -156,9 +164,13 @@ class SegmentEncoder : public BaseSegmentEncoder {
 
  private:
   // LZ4Encoder only supports BitPacking in order to reduce the compile time, see the comment in lz4_encoder.hpp.
-  VectorCompressionType _vector_compression_type = std::is_same_v<Derived, LZ4Encoder>
-                                                       ? VectorCompressionType::BitPacking
-                                                       : VectorCompressionType::FixedWidthInteger;
+  // ALPEncoder and FSSTEncoder default to BitPacking as their offsets usually need far fewer bits than a fixed-width
+  // integer.
+  VectorCompressionType _vector_compression_type =
+      (std::is_same_v<Derived, LZ4Encoder> || std::is_same_v<Derived, ALPEncoder> ||
+       std::is_same_v<Derived, FSSTEncoder>)
+          ? VectorCompressionType::BitPacking
+          : VectorCompressionType::FixedWidthInteger;
 
  private:
   Derived& _self() {
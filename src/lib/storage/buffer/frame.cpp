@@ -52,9 +52,10 @@ void Frame::unlock_exclusive_and_set_evicted() {
 }
 
 bool Frame::try_mark(const Frame::StateVersionType old_state_and_version) {
+  // The current state might have been changed concurrently. In that case, the compare-and-swap below fails.
   DebugAssert(
-      state(_state_and_version.load()) == UNLOCKED,
-      "Frame must be UNLOCKED to transition to MARKED, instead: " + std::to_string(state(_state_and_version.load())));
+      state(old_state_and_version) == UNLOCKED,
+      "Frame must be UNLOCKED to transition to MARKED, instead: " + std::to_string(state(old_state_and_version)));
   auto state_and_version = old_state_and_version;
   return _state_and_version.compare_exchange_strong(state_and_version,
                                                     _update_state_with_same_version(old_state_and_version, MARKED));
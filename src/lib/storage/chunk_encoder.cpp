@@ -1,8 +1,12 @@
 #include "chunk_encoder.hpp"
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
+#include <iterator>
 #include <map>
 #include <memory>
+#include <optional>
 #include <utility>
 #include <vector>
 
@@ -11,11 +15,15 @@
 #include "resolve_type.hpp"
 #include "statistics/generate_pruning_statistics.hpp"
 #include "storage/base_segment_encoder.hpp"
+#include "storage/dictionary_segment.hpp"
 #include "storage/encoding_type.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/segment_encoding_utils.hpp"
 #include "storage/segment_iterables/any_segment_iterable.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/segment_zone_map.hpp"
 #include "storage/value_segment.hpp"
+#include "storage/vector_compression/vector_compression.hpp"
 #include "table.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
@@ -191,4 +199,83 @@ void ChunkEncoder::encode_all_chunks(const std::shared_ptr<Table>& table,
   }
 }
 
+void ChunkEncoder::encode_with_global_dictionary(
+    const std::vector<std::pair<std::shared_ptr<Table>, ColumnID>>& columns,
+    const std::optional<VectorCompressionType>& vector_compression_type) {
+  Assert(!columns.empty(), "Expected at least one column to encode.");
+  const auto data_type = columns.front().first->column_data_type(columns.front().second);
+  for (const auto& [table, column_id] : columns) {
+    Assert(table->type() == TableType::Data, "Only columns of data tables can be encoded.");
+    Assert(table->column_data_type(column_id) == data_type, "Columns sharing a dictionary must have the same type.");
+  }
+
+  // Only immutable chunks are encoded, see ChunkEncoder::encode_chunk.
+  auto chunks = std::vector<std::pair<std::shared_ptr<Chunk>, ColumnID>>{};
+  for (const auto& [table, column_id] : columns) {
+    const auto chunk_count = table->chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+      if (chunk && !chunk->is_mutable()) {
+        chunks.emplace_back(chunk, column_id);
+      }
+    }
+  }
+
+  resolve_data_type(data_type, [&](const auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    // The distinct values of each segment are determined first. They are needed for the segments' statistics (see
+    // DictionarySegment::unique_values_count) and reduce the number of values to be merged into the dictionary.
+    const auto segment_count = chunks.size();
+    auto unique_values_counts = std::vector<ValueID::base_type>(segment_count);
+    auto values = std::vector<ColumnDataType>{};
+    for (auto segment_index = size_t{0}; segment_index < segment_count; ++segment_index) {
+      const auto& [chunk, column_id] = chunks[segment_index];
+      const auto segment_values_offset = values.size();
+      segment_iterate<ColumnDataType>(*chunk->get_segment(column_id), [&](const auto& position) {
+        if (!position.is_null()) {
+          values.emplace_back(position.value());
+        }
+      });
+
+      const auto segment_values_begin = values.begin() + static_cast<std::ptrdiff_t>(segment_values_offset);
+      std::sort(segment_values_begin, values.end());
+      values.erase(std::unique(segment_values_begin, values.end()), values.end());
+      unique_values_counts[segment_index] = static_cast<ValueID::base_type>(values.size() - segment_values_offset);
+    }
+    std::sort(values.begin(), values.end());
+    values.erase(std::unique(values.begin(), values.end()), values.end());
+
+    const auto dictionary = std::make_shared<const pmr_vector<ColumnDataType>>(values.cbegin(), values.cend());
+    values = {};
+    const auto null_value_id = static_cast<uint32_t>(dictionary->size());
+
+    for (auto segment_index = size_t{0}; segment_index < segment_count; ++segment_index) {
+      const auto& [chunk, column_id] = chunks[segment_index];
+      // The pruning statistics are derived from the dictionaries of the segments. They are generated before the
+      // segments are replaced so that they only cover the values of the respective chunk.
+      generate_chunk_pruning_statistics(chunk);
+
+      const auto& segment = *chunk->get_segment(column_id);
+      auto attribute_vector = pmr_vector<uint32_t>(segment.size());
+      segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+        attribute_vector[position.chunk_offset()] =
+            position.is_null() ? null_value_id
+                               : static_cast<uint32_t>(std::distance(
+                                     dictionary->cbegin(),
+                                     std::lower_bound(dictionary->cbegin(), dictionary->cend(), position.value())));
+      });
+
+      const auto compressed_attribute_vector = std::shared_ptr<const BaseCompressedVector>{
+          compress_vector(attribute_vector, vector_compression_type.value_or(VectorCompressionType::FixedWidthInteger),
+                          PolymorphicAllocator<size_t>{}, {null_value_id})};
+      const auto encoded_segment =
+          std::make_shared<DictionarySegment<ColumnDataType>>(dictionary, compressed_attribute_vector,
+                                                              unique_values_counts[segment_index], segment_count);
+      encoded_segment->set_zone_map(build_segment_zone_map(*encoded_segment));
+      chunk->replace_segment(column_id, encoded_segment);
+    }
+  });
+}
+
 }  // namespace hyrise
@@ -79,6 +79,20 @@ class ChunkEncoder {
    */
   static void encode_all_chunks(const std::shared_ptr<Table>& table,
                                 const SegmentEncodingSpec& segment_encoding_spec = {});
+
+  /**
+   * @brief Dictionary-encodes columns using a single dictionary for all of their chunks
+   *
+   * The dictionary holds the values of all immutable chunks of the passed columns, which may belong to different
+   * tables (e.g., a foreign key and the primary key it references). Thus, the value IDs are order-preserving codes
+   * that can be compared across chunks and columns (see global_dictionary_utils.hpp). Each segment still reports the
+   * number of its own distinct values and an equal share of the dictionary's memory. Mutable chunks are not encoded.
+   * As value IDs are dense, values that are inserted later cannot be added to the dictionary. Instead, the columns
+   * have to be encoded again once the new chunks become immutable.
+   */
+  static void encode_with_global_dictionary(
+      const std::vector<std::pair<std::shared_ptr<Table>, ColumnID>>& columns,
+      const std::optional<VectorCompressionType>& vector_compression_type = std::nullopt);
 };
 
 }  // namespace hyrise
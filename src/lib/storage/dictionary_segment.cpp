@@ -25,15 +25,27 @@ namespace hyrise {
 template <typename T>
 DictionarySegment<T>::DictionarySegment(const std::shared_ptr<const pmr_vector<T>>& dictionary,
                                         const std::shared_ptr<const BaseCompressedVector>& attribute_vector)
+    : DictionarySegment(dictionary, attribute_vector, static_cast<ValueID::base_type>(dictionary->size()),
+                        size_t{1}) {}
+
+template <typename T>
+DictionarySegment<T>::DictionarySegment(const std::shared_ptr<const pmr_vector<T>>& dictionary,
+                                        const std::shared_ptr<const BaseCompressedVector>& attribute_vector,
+                                        const ValueID::base_type unique_values_count,
+                                        const size_t dictionary_share_count)
     : BaseDictionarySegment(data_type_from_type<T>()),
       _dictionary{dictionary},
       _attribute_vector{attribute_vector},
+      _unique_values_count{unique_values_count},
+      _dictionary_share_count{dictionary_share_count},
       _decompressor{_attribute_vector->create_base_decompressor()} {
   // NULL is represented by _dictionary.size(). INVALID_VALUE_ID, which is the highest possible number in
   // ValueID::base_type (2^32 - 1), is needed to represent "value not found" in calls to lower_bound/upper_bound.
   // For a DictionarySegment of the max size Chunk::MAX_SIZE, those two values overlap.
 
   Assert(_dictionary->size() < std::numeric_limits<ValueID::base_type>::max(), "Input segment too big");
+  Assert(_unique_values_count <= _dictionary->size(), "Segment cannot have more distinct values than its dictionary.");
+  Assert(_dictionary_share_count > 0, "Dictionary must be used by at least one segment.");
 }
 
 template <typename T>
@@ -54,6 +66,11 @@ std::shared_ptr<const pmr_vector<T>> DictionarySegment<T>::dictionary() const {
   return _dictionary;
 }
 
+template <typename T>
+bool DictionarySegment<T>::shares_dictionary() const {
+  return _dictionary_share_count > 1;
+}
+
 template <typename T>
 ChunkOffset DictionarySegment<T>::size() const {
   return static_cast<ChunkOffset>(_attribute_vector->size());
@@ -63,9 +80,12 @@ template <typename T>
 std::shared_ptr<AbstractSegment> DictionarySegment<T>::copy_using_allocator(
     const PolymorphicAllocator<size_t>& alloc) const {
   auto new_attribute_vector = _attribute_vector->copy_using_allocator(alloc);
+  // The copy owns its copy of the dictionary, even if the dictionary was shared.
   auto new_dictionary = std::make_shared<pmr_vector<T>>(*_dictionary, alloc);
-  auto copy = std::make_shared<DictionarySegment<T>>(std::move(new_dictionary), std::move(new_attribute_vector));
+  auto copy = std::make_shared<DictionarySegment<T>>(std::move(new_dictionary), std::move(new_attribute_vector),
+                                                     _unique_values_count, size_t{1});
   copy->access_counter = access_counter;
+  copy->set_zone_map(_zone_map);
   return copy;
 }
 
@@ -73,10 +93,13 @@ template <typename T>
 size_t DictionarySegment<T>::memory_usage(const MemoryUsageCalculationMode mode) const {
   const auto common_elements_size = sizeof(*this) + _attribute_vector->data_size();
 
+  // Segments that share their dictionary report an equal share of it so that the memory usages of all segments sum up
+  // to the memory actually used.
   if constexpr (std::is_same_v<T, pmr_string>) {
-    return common_elements_size + string_vector_memory_usage(*_dictionary, mode);
+    return common_elements_size + (string_vector_memory_usage(*_dictionary, mode) / _dictionary_share_count);
   }
-  return common_elements_size + _dictionary->size() * sizeof(typename decltype(_dictionary)::element_type::value_type);
+  const auto dictionary_size = _dictionary->size() * sizeof(typename decltype(_dictionary)::element_type::value_type);
+  return common_elements_size + (dictionary_size / _dictionary_share_count);
 }
 
 template <typename T>
@@ -126,7 +149,7 @@ AllTypeVariant DictionarySegment<T>::value_of_value_id(const ValueID value_id) c
 
 template <typename T>
 ValueID::base_type DictionarySegment<T>::unique_values_count() const {
-  return static_cast<ValueID::base_type>(_dictionary->size());
+  return _unique_values_count;
 }
 
 template <typename T>
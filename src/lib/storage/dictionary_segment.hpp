@@ -14,7 +14,9 @@ class BaseCompressedVector;
 /**
  * @brief Segment implementing dictionary encoding
  *
- * Uses vector compression schemes for its attribute vector.
+ * Uses vector compression schemes for its attribute vector. The dictionary can be shared with the segments of other
+ * chunks (see ChunkEncoder::encode_with_global_dictionary). Such segments store the number of distinct values they
+ * contain and only account for their share of the dictionary in memory_usage().
  */
 template <typename T>
 class DictionarySegment : public BaseDictionarySegment {
@@ -22,9 +24,19 @@ class DictionarySegment : public BaseDictionarySegment {
   explicit DictionarySegment(const std::shared_ptr<const pmr_vector<T>>& dictionary,
                              const std::shared_ptr<const BaseCompressedVector>& attribute_vector);
 
+  // For dictionaries that are shared by `dictionary_share_count` segments. `unique_values_count` is the number of
+  // distinct values in this segment.
+  DictionarySegment(const std::shared_ptr<const pmr_vector<T>>& dictionary,
+                    const std::shared_ptr<const BaseCompressedVector>& attribute_vector,
+                    const ValueID::base_type unique_values_count, const size_t dictionary_share_count);
+
   // returns an underlying dictionary
   std::shared_ptr<const pmr_vector<T>> dictionary() const;
 
+  // Returns true if the dictionary is shared with other segments. Then, the dictionary may contain values that do not
+  // occur in this segment.
+  bool shares_dictionary() const;
+
   /**
    * @defgroup AbstractSegment interface
    * @{
@@ -66,7 +78,7 @@ class DictionarySegment : public BaseDictionarySegment {
   // dictionary anyway). Imagine a segment with values from 1 to 10. A scan for `WHERE a < 12` would retrieve
   // `lower_bound(12) == INVALID_VALUE_ID` and compare all values in the attribute vector to `< INVALID_VALUE_ID`.
   // Thus, returning INVALID_VALUE_ID makes comparisons much easier. However, the caller has to make sure that
-  // NULL values stored in the attribute vector (stored with a value ID of unique_values_count()) are excluded.
+  // NULL values stored in the attribute vector (stored with a value ID of null_value_id()) are excluded.
   // See #1471 for a deeper discussion.
   ValueID lower_bound(const AllTypeVariant& value) const final;
 
@@ -76,6 +88,8 @@ class DictionarySegment : public BaseDictionarySegment {
 
   AllTypeVariant value_of_value_id(const ValueID value_id) const final;
 
+  // The number of distinct values in this segment. It is smaller than the dictionary's size if the dictionary was built
+  // for multiple segments.
   ValueID::base_type unique_values_count() const final;
 
   std::shared_ptr<const BaseCompressedVector> attribute_vector() const final;
@@ -87,6 +101,8 @@ class DictionarySegment : public BaseDictionarySegment {
  protected:
   const std::shared_ptr<const pmr_vector<T>> _dictionary;
   const std::shared_ptr<const BaseCompressedVector> _attribute_vector;
+  const ValueID::base_type _unique_values_count;
+  const size_t _dictionary_share_count;
   std::unique_ptr<BaseVectorDecompressor> _decompressor;
 };
 
@@ -18,7 +18,7 @@ bool encoding_supports_data_type(EncodingType encoding_type, DataType data_type)
   hana::for_each(supported_data_types_for_encoding_type, [&](auto encoding_pair) {
     if (hana::first(encoding_pair).value == encoding_type) {
       hana::for_each(data_type_pairs, [&](auto data_type_pair) {
-        if (hana::first(data_type_pair) == data_type) {
+        if (hana::first(data_type_pair) == storage_data_type(data_type)) {
           result = hana::contains(hana::at_key(supported_data_types_for_encoding_type, hana::first(encoding_pair)),
                                   hana::second(data_type_pair));
           return;
@@ -75,6 +75,7 @@ std::shared_ptr<AbstractSegment> FixedStringDictionarySegment<T>::copy_using_all
   auto copy = std::make_shared<FixedStringDictionarySegment<T>>(new_dictionary, std::move(new_attribute_vector));
 
   copy->access_counter = access_counter;
+  copy->set_zone_map(_zone_map);
 
   return copy;
 }
@@ -75,6 +75,7 @@ std::shared_ptr<AbstractSegment> FrameOfReferenceSegment<T, U>::copy_using_alloc
   auto copy = std::make_shared<FrameOfReferenceSegment>(std::move(new_block_minima), std::move(null_values),
                                                         std::move(new_offset_values));
   copy->access_counter = access_counter;
+  copy->set_zone_map(_zone_map);
   return copy;
 }
 
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string_view>
+
+#include "abstract_encoded_segment.hpp"
+#include "storage/fsst_segment/fsst_symbol_table.hpp"
+#include "storage/vector_compression/base_compressed_vector.hpp"
+#include "storage/vector_compression/base_vector_decompressor.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+class BaseCompressedVector;
+
+/**
+ * @brief Segment implementing FSST (Fast Static Symbol Table) compression for strings
+ *
+ * Dictionary encoding does not pay off for high-cardinality strings such as URLs, comments, or e-mail addresses, and
+ * the LZ4Segment needs to decompress a whole block for accessing a single value. The FSSTSegment compresses each value
+ * individually with a per-segment symbol table (see fsst_symbol_table.hpp) that replaces frequent substrings of up to
+ * eight bytes with one-byte codes.
+ *
+ * The codes of all values are stored consecutively. The offsets vector holds size() + 1 entries, the codes of the value
+ * at position i are in [offsets[i], offsets[i + 1]). The offsets are compressed using vector compression (by default,
+ * bit-packing). Thus, a single value is decompressed without touching any other value.
+ *
+ * As the compression is deterministic, equality predicates can be evaluated on the codes without decompressing any
+ * value (see ColumnVsValueTableScanImpl and ColumnLikeTableScanImpl). Prefix predicates only decode the symbols that
+ * cover the prefix.
+ *
+ * Null values are stored in a separate vector. Values that are NULL have no codes.
+ */
+template <typename T>
+class FSSTSegment : public AbstractEncodedSegment {
+ public:
+  FSSTSegment(FSSTSymbolTable symbol_table, pmr_vector<char> compressed_values,
+              std::unique_ptr<const BaseCompressedVector> offsets, std::optional<pmr_vector<bool>> null_values);
+
+  const FSSTSymbolTable& symbol_table() const;
+  const pmr_vector<char>& compressed_values() const;
+  const BaseCompressedVector& offsets() const;
+  const std::optional<pmr_vector<bool>>& null_values() const;
+
+  // Returns the codes of the value at the given position. For NULLs, an empty string_view is returned.
+  std::string_view compressed_value(const ChunkOffset chunk_offset) const {
+    const auto begin = _decompressor->get(chunk_offset);
+    const auto end = _decompressor->get(chunk_offset + 1);
+    return std::string_view{_compressed_values.data() + begin, end - begin};
+  }
+
+  /**
+   * @defgroup AbstractSegment interface
+   * @{
+   */
+
+  AllTypeVariant operator[](const ChunkOffset chunk_offset) const final;
+
+  std::optional<T> get_typed_value(const ChunkOffset chunk_offset) const {
+    // performance critical - not in cpp to help with inlining
+    if (_null_values && (*_null_values)[chunk_offset]) {
+      return std::nullopt;
+    }
+    return _symbol_table.decompress(compressed_value(chunk_offset));
+  }
+
+  ChunkOffset size() const final;
+
+  std::shared_ptr<AbstractSegment> copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const final;
+
+  size_t memory_usage(const MemoryUsageCalculationMode /*mode*/) const final;
+
+  /**@}*/
+
+  /**
+   * @defgroup AbstractEncodedSegment interface
+   * @{
+   */
+
+  EncodingType encoding_type() const final;
+  std::optional<CompressedVectorType> compressed_vector_type() const final;
+
+  /**@}*/
+
+ private:
+  const FSSTSymbolTable _symbol_table;
+  const pmr_vector<char> _compressed_values;
+  const std::unique_ptr<const BaseCompressedVector> _offsets;
+  const std::optional<pmr_vector<bool>> _null_values;
+  std::unique_ptr<BaseVectorDecompressor> _decompressor;
+};
+
+extern template class FSSTSegment<pmr_string>;
+
+}  // namespace hyrise
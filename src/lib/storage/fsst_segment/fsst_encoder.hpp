@@ -0,0 +1,101 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "storage/base_segment_encoder.hpp"
+#include "storage/fsst_segment.hpp"
+#include "storage/fsst_segment/fsst_symbol_table.hpp"
+#include "storage/vector_compression/vector_compression.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+#include "utils/enum_constant.hpp"
+
+namespace hyrise {
+
+/**
+ * Encodes string segments as described in fsst_segment.hpp.
+ *
+ * The symbol table is built on a sample of about sample_size bytes, which consists of every n-th value of the
+ * segment. Afterwards, every value is compressed with the final symbol table.
+ */
+class FSSTEncoder : public SegmentEncoder<FSSTEncoder> {
+ public:
+  static constexpr auto _encoding_type = enum_c<EncodingType, EncodingType::FSST>;
+  static constexpr auto _uses_vector_compression = true;  // see base_segment_encoder.hpp for details
+
+  // Same sample size as in the FSST paper (Boncz et al., VLDB 2020).
+  static constexpr auto sample_size = size_t{16384};
+
+  template <typename T>
+  std::shared_ptr<AbstractEncodedSegment> _on_encode(const AnySegmentIterable<T> segment_iterable,
+                                                     const PolymorphicAllocator<T>& allocator) {
+    // holds the values of the segment back to back, NULLs are stored as empty strings
+    auto values = std::string{};
+    auto value_offsets = std::vector<size_t>{0};
+
+    // holds whether a segment value is null
+    auto null_values = pmr_vector<bool>{allocator};
+
+    auto segment_contains_null_values = false;
+
+    segment_iterable.with_iterators([&](auto segment_it, const auto segment_end) {
+      const auto size = std::distance(segment_it, segment_end);
+      value_offsets.reserve(size + 1);
+      null_values.reserve(size);
+
+      for (; segment_it != segment_end; ++segment_it) {
+        const auto segment_value = *segment_it;
+        const auto value_is_null = segment_value.is_null();
+        if (!value_is_null) {
+          values.append(segment_value.value());
+        }
+        value_offsets.push_back(values.size());
+        null_values.push_back(value_is_null);
+        segment_contains_null_values |= value_is_null;
+      }
+    });
+
+    const auto value_at = [&](const size_t index) {
+      return std::string_view{values}.substr(value_offsets[index], value_offsets[index + 1] - value_offsets[index]);
+    };
+
+    const auto size = null_values.size();
+    const auto step = std::max(size_t{1}, values.size() / sample_size);
+    auto sample = std::vector<std::string_view>{};
+    for (auto index = size_t{0}; index < size; index += step) {
+      sample.push_back(value_at(index));
+    }
+
+    auto symbol_table = FSSTSymbolTable::build(sample, allocator);
+
+    auto codes = std::string{};
+    codes.reserve(values.size());
+    auto offsets = pmr_vector<uint32_t>{allocator};
+    offsets.reserve(size + 1);
+    offsets.push_back(0);
+    for (auto index = size_t{0}; index < size; ++index) {
+      symbol_table.compress(value_at(index), codes);
+      Assert(codes.size() <= std::numeric_limits<uint32_t>::max(), "Compressed values exceed 4 GB.");
+      offsets.push_back(static_cast<uint32_t>(codes.size()));
+    }
+
+    auto compressed_values = pmr_vector<char>{codes.cbegin(), codes.cend(), allocator};
+    const auto max_offset = offsets.back();
+    auto compressed_offsets = compress_vector(offsets, vector_compression_type(), allocator, {max_offset});
+
+    auto optional_null_values =
+        segment_contains_null_values ? std::optional<pmr_vector<bool>>{std::move(null_values)} : std::nullopt;
+    return std::make_shared<FSSTSegment<T>>(std::move(symbol_table), std::move(compressed_values),
+                                            std::move(compressed_offsets), std::move(optional_null_values));
+  }
+};
+
+}  // namespace hyrise
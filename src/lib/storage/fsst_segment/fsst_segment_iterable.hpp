@@ -0,0 +1,168 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "storage/abstract_segment.hpp"
+#include "storage/fsst_segment.hpp"
+#include "storage/segment_iterables.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
+
+namespace hyrise {
+
+/**
+ * Iterates over the values of an FSSTSegment. Each value is decompressed independently on dereferencing.
+ *
+ * If CompressedValues is true, the iterators return the codes of the values (as std::string_view) instead. This is
+ * used by the table scans to evaluate predicates without decompressing the values.
+ */
+template <typename T, bool CompressedValues = false>
+class FSSTSegmentIterable : public PointAccessibleSegmentIterable<FSSTSegmentIterable<T, CompressedValues>> {
+ public:
+  using ValueType = std::conditional_t<CompressedValues, std::string_view, T>;
+
+  explicit FSSTSegmentIterable(const FSSTSegment<T>& segment) : _segment{segment} {}
+
+  template <typename Functor>
+  void _on_with_iterators(const Functor& functor) const {
+    _segment.access_counter[SegmentAccessCounter::AccessType::Sequential] += _segment.size();
+    resolve_compressed_vector_type(_segment.offsets(), [&](const auto& offsets) {
+      using OffsetDecompressor = std::decay_t<decltype(offsets.create_decompressor())>;
+
+      auto begin = Iterator<OffsetDecompressor>{&_segment, offsets.create_decompressor(), ChunkOffset{0}};
+      auto end = Iterator<OffsetDecompressor>{&_segment, offsets.create_decompressor(), _segment.size()};
+
+      functor(begin, end);
+    });
+  }
+
+  template <typename Functor, typename PosListType>
+  void _on_with_iterators(const std::shared_ptr<PosListType>& position_filter, const Functor& functor) const {
+    _segment.access_counter[SegmentAccessCounter::access_type(*position_filter)] += position_filter->size();
+    resolve_compressed_vector_type(_segment.offsets(), [&](const auto& offsets) {
+      using OffsetDecompressor = std::decay_t<decltype(offsets.create_decompressor())>;
+      using PosListIteratorType = std::decay_t<decltype(position_filter->cbegin())>;
+
+      auto begin = PointAccessIterator<OffsetDecompressor, PosListIteratorType>{
+          &_segment, offsets.create_decompressor(), position_filter->cbegin(), position_filter->cbegin()};
+
+      auto end = PointAccessIterator<OffsetDecompressor, PosListIteratorType>{
+          &_segment, offsets.create_decompressor(), position_filter->cbegin(), position_filter->cend()};
+
+      functor(begin, end);
+    });
+  }
+
+  size_t _on_size() const {
+    return _segment.size();
+  }
+
+ private:
+  const FSSTSegment<T>& _segment;
+
+  // Returns the value (or its codes) at the given position, assuming that it is not NULL.
+  template <typename OffsetDecompressor>
+  static ValueType _value(const FSSTSegment<T>& segment, OffsetDecompressor& offset_decompressor,
+                          const ChunkOffset chunk_offset) {
+    const auto begin = offset_decompressor.get(chunk_offset);
+    const auto end = offset_decompressor.get(chunk_offset + 1);
+    const auto codes = std::string_view{segment.compressed_values().data() + begin, end - begin};
+    if constexpr (CompressedValues) {
+      return codes;
+    } else {
+      return segment.symbol_table().decompress(codes);
+    }
+  }
+
+ private:
+  template <typename OffsetDecompressor>
+  class Iterator : public AbstractSegmentIterator<Iterator<OffsetDecompressor>,
+                                                  SegmentPosition<typename FSSTSegmentIterable::ValueType>> {
+   public:
+    using ValueType = typename FSSTSegmentIterable::ValueType;
+    using IterableType = FSSTSegmentIterable<T, CompressedValues>;
+
+   public:
+    // Begin and End Iterator
+    Iterator(const FSSTSegment<T>* segment, OffsetDecompressor offset_decompressor, ChunkOffset chunk_offset)
+        : _segment{segment}, _offset_decompressor{std::move(offset_decompressor)}, _chunk_offset{chunk_offset} {}
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    void increment() {
+      ++_chunk_offset;
+    }
+
+    void decrement() {
+      --_chunk_offset;
+    }
+
+    void advance(std::ptrdiff_t n) {
+      _chunk_offset += n;
+    }
+
+    bool equal(const Iterator& other) const {
+      return _chunk_offset == other._chunk_offset;
+    }
+
+    std::ptrdiff_t distance_to(const Iterator& other) const {
+      return std::ptrdiff_t{other._chunk_offset} - std::ptrdiff_t{_chunk_offset};
+    }
+
+    SegmentPosition<ValueType> dereference() const {
+      const auto& null_values = _segment->null_values();
+      if (null_values && (*null_values)[_chunk_offset]) {
+        return SegmentPosition<ValueType>{ValueType{}, true, _chunk_offset};
+      }
+      return SegmentPosition<ValueType>{_value(*_segment, _offset_decompressor, _chunk_offset), false, _chunk_offset};
+    }
+
+   private:
+    const FSSTSegment<T>* _segment;
+    mutable OffsetDecompressor _offset_decompressor;
+    ChunkOffset _chunk_offset;
+  };
+
+  template <typename OffsetDecompressor, typename PosListIteratorType>
+  class PointAccessIterator
+      : public AbstractPointAccessSegmentIterator<PointAccessIterator<OffsetDecompressor, PosListIteratorType>,
+                                                  SegmentPosition<typename FSSTSegmentIterable::ValueType>,
+                                                  PosListIteratorType> {
+   public:
+    using ValueType = typename FSSTSegmentIterable::ValueType;
+    using IterableType = FSSTSegmentIterable<T, CompressedValues>;
+
+    PointAccessIterator(const FSSTSegment<T>* segment, OffsetDecompressor offset_decompressor,
+                        PosListIteratorType position_filter_begin, PosListIteratorType position_filter_it)
+        : AbstractPointAccessSegmentIterator<PointAccessIterator<OffsetDecompressor, PosListIteratorType>,
+                                             SegmentPosition<ValueType>, PosListIteratorType>{
+              std::move(position_filter_begin), std::move(position_filter_it)},
+          _segment{segment},
+          _offset_decompressor{std::move(offset_decompressor)} {}
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    SegmentPosition<ValueType> dereference() const {
+      const auto& chunk_offsets = this->chunk_offsets();
+      const auto current_offset = chunk_offsets.offset_in_referenced_chunk;
+
+      const auto& null_values = _segment->null_values();
+      if (null_values && (*null_values)[current_offset]) {
+        return SegmentPosition<ValueType>{ValueType{}, true, chunk_offsets.offset_in_poslist};
+      }
+      return SegmentPosition<ValueType>{_value(*_segment, _offset_decompressor, current_offset), false,
+                                        chunk_offsets.offset_in_poslist};
+    }
+
+   private:
+    const FSSTSegment<T>* _segment;
+    mutable OffsetDecompressor _offset_decompressor;
+  };
+};
+
+}  // namespace hyrise
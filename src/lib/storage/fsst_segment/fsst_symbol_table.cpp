@@ -0,0 +1,223 @@
+#include "fsst_symbol_table.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <numeric>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT(build/namespaces)
+
+uint64_t pack_symbol(const std::string_view symbol) {
+  auto packed_symbol = uint64_t{0};
+  std::memcpy(&packed_symbol, symbol.data(), symbol.size());
+  return packed_symbol;
+}
+
+uint8_t first_byte(const uint64_t packed_symbol) {
+  return static_cast<uint8_t>(packed_symbol & 0xFFu);
+}
+
+}  // namespace
+
+namespace hyrise {
+
+FSSTSymbolTable FSSTSymbolTable::build(const std::vector<std::string_view>& sample,
+                                       const PolymorphicAllocator<size_t>& alloc) {
+  auto symbol_table = FSSTSymbolTable{pmr_vector<uint64_t>{alloc}, pmr_vector<uint8_t>{alloc}};
+
+  for (auto generation = size_t{0}; generation < generation_count; ++generation) {
+    auto gains = std::unordered_map<std::string_view, uint64_t>{};
+
+    for (const auto& value : sample) {
+      auto previous_length = size_t{0};
+      auto position = size_t{0};
+      while (position < value.size()) {
+        const auto length = symbol_table._longest_match(value, position).second;
+
+        gains[value.substr(position, length)] += length;
+        if (length > 1) {
+          gains[value.substr(position, 1)] += 1;
+        }
+        if (previous_length > 0 && previous_length + length <= max_symbol_length) {
+          gains[value.substr(position - previous_length, previous_length + length)] += previous_length + length;
+        }
+
+        previous_length = length;
+        position += length;
+      }
+    }
+
+    auto candidates = std::vector<std::pair<uint64_t, std::string_view>>{};
+    candidates.reserve(gains.size());
+    for (const auto& [candidate, gain] : gains) {
+      candidates.emplace_back(gain, candidate);
+    }
+
+    // Ties are broken by the symbol itself so that the table does not depend on the iteration order of the map.
+    const auto selected_count = std::min(max_symbol_count, candidates.size());
+    std::partial_sort(candidates.begin(), candidates.begin() + static_cast<std::ptrdiff_t>(selected_count),
+                      candidates.end(), [](const auto& lhs, const auto& rhs) {
+                        return lhs.first > rhs.first || (lhs.first == rhs.first && lhs.second < rhs.second);
+                      });
+
+    auto symbols = pmr_vector<uint64_t>{alloc};
+    auto symbol_lengths = pmr_vector<uint8_t>{alloc};
+    symbols.reserve(selected_count);
+    symbol_lengths.reserve(selected_count);
+    for (auto index = size_t{0}; index < selected_count; ++index) {
+      symbols.push_back(pack_symbol(candidates[index].second));
+      symbol_lengths.push_back(static_cast<uint8_t>(candidates[index].second.size()));
+    }
+
+    symbol_table = FSSTSymbolTable{std::move(symbols), std::move(symbol_lengths)};
+  }
+
+  return symbol_table;
+}
+
+FSSTSymbolTable::FSSTSymbolTable(pmr_vector<uint64_t> symbols, pmr_vector<uint8_t> symbol_lengths)
+    : _symbols{std::move(symbols)}, _symbol_lengths{std::move(symbol_lengths)} {
+  Assert(_symbols.size() == _symbol_lengths.size(), "Expected one length per symbol.");
+  Assert(_symbols.size() <= max_symbol_count, "Too many symbols for one-byte codes.");
+
+  auto order = std::vector<size_t>(_symbols.size());
+  std::iota(order.begin(), order.end(), size_t{0});
+  std::sort(order.begin(), order.end(), [&](const auto lhs, const auto rhs) {
+    const auto lhs_first_byte = first_byte(_symbols[lhs]);
+    const auto rhs_first_byte = first_byte(_symbols[rhs]);
+    if (lhs_first_byte != rhs_first_byte) {
+      return lhs_first_byte < rhs_first_byte;
+    }
+    if (_symbol_lengths[lhs] != _symbol_lengths[rhs]) {
+      return _symbol_lengths[lhs] > _symbol_lengths[rhs];
+    }
+    return _symbols[lhs] < _symbols[rhs];
+  });
+
+  auto ordered_symbols = pmr_vector<uint64_t>(_symbols.size(), _symbols.get_allocator());
+  auto ordered_symbol_lengths = pmr_vector<uint8_t>(_symbol_lengths.size(), _symbol_lengths.get_allocator());
+  for (auto code = size_t{0}; code < order.size(); ++code) {
+    const auto symbol_length = _symbol_lengths[order[code]];
+    Assert(symbol_length > 0 && symbol_length <= max_symbol_length, "Invalid symbol length.");
+    ordered_symbols[code] = _symbols[order[code]];
+    ordered_symbol_lengths[code] = symbol_length;
+  }
+  _symbols = std::move(ordered_symbols);
+  _symbol_lengths = std::move(ordered_symbol_lengths);
+
+  for (const auto symbol : _symbols) {
+    ++_code_ranges[first_byte(symbol) + 1];
+  }
+  std::partial_sum(_code_ranges.begin(), _code_ranges.end(), _code_ranges.begin());
+}
+
+const pmr_vector<uint64_t>& FSSTSymbolTable::symbols() const {
+  return _symbols;
+}
+
+const pmr_vector<uint8_t>& FSSTSymbolTable::symbol_lengths() const {
+  return _symbol_lengths;
+}
+
+void FSSTSymbolTable::compress(const std::string_view value, std::string& codes) const {
+  auto position = size_t{0};
+  while (position < value.size()) {
+    const auto [code, length] = _longest_match(value, position);
+    codes.push_back(static_cast<char>(code));
+    if (code == escape_code) {
+      codes.push_back(value[position]);
+    }
+    position += length;
+  }
+}
+
+pmr_string FSSTSymbolTable::decompress(const std::string_view codes) const {
+  // Determine the length first so that the string is allocated only once.
+  auto length = size_t{0};
+  for (auto index = size_t{0}; index < codes.size(); ++index) {
+    const auto code = static_cast<uint8_t>(codes[index]);
+    if (code == escape_code) {
+      ++index;
+      ++length;
+    } else {
+      length += _symbol_lengths[code];
+    }
+  }
+
+  auto value = pmr_string(length, '\0');
+  auto* output = value.data();
+  for (auto index = size_t{0}; index < codes.size(); ++index) {
+    const auto code = static_cast<uint8_t>(codes[index]);
+    if (code == escape_code) {
+      ++index;
+      *output = codes[index];
+      ++output;
+    } else {
+      std::memcpy(output, &_symbols[code], _symbol_lengths[code]);
+      output += _symbol_lengths[code];
+    }
+  }
+
+  return value;
+}
+
+bool FSSTSymbolTable::starts_with(const std::string_view codes, const std::string_view prefix) const {
+  auto prefix_position = size_t{0};
+  for (auto index = size_t{0}; index < codes.size() && prefix_position < prefix.size(); ++index) {
+    const auto code = static_cast<uint8_t>(codes[index]);
+    if (code == escape_code) {
+      ++index;
+      if (codes[index] != prefix[prefix_position]) {
+        return false;
+      }
+      ++prefix_position;
+      continue;
+    }
+
+    const auto compared_length = std::min(size_t{_symbol_lengths[code]}, prefix.size() - prefix_position);
+    if (std::memcmp(&_symbols[code], prefix.data() + prefix_position, compared_length) != 0) {
+      return false;
+    }
+    prefix_position += compared_length;
+  }
+
+  return prefix_position == prefix.size();
+}
+
+size_t FSSTSymbolTable::data_size() const {
+  return sizeof(uint64_t) * _symbols.capacity() + _symbol_lengths.capacity();
+}
+
+std::pair<uint8_t, size_t> FSSTSymbolTable::_longest_match(const std::string_view value, const size_t position) const {
+  const auto remaining_length = value.size() - position;
+  auto window = uint64_t{0};
+  std::memcpy(&window, value.data() + position, std::min(remaining_length, max_symbol_length));
+
+  const auto byte = first_byte(window);
+  for (auto code = size_t{_code_ranges[byte]}; code < _code_ranges[byte + 1]; ++code) {
+    const auto symbol_length = size_t{_symbol_lengths[code]};
+    if (symbol_length > remaining_length) {
+      continue;
+    }
+
+    const auto mask = symbol_length == max_symbol_length ? ~uint64_t{0} : (uint64_t{1} << (8 * symbol_length)) - 1;
+    if ((window & mask) == _symbols[code]) {
+      return {static_cast<uint8_t>(code), symbol_length};
+    }
+  }
+
+  return {escape_code, 1};
+}
+
+}  // namespace hyrise
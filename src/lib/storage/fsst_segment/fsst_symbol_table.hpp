@@ -0,0 +1,72 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "types.hpp"
+
+namespace hyrise {
+
+/**
+ * Symbol table of the FSST (Fast Static Symbol Table) string compression (Boncz et al., VLDB 2020).
+ *
+ * A symbol is a string of one to eight bytes. Each symbol is identified by a one-byte code. Strings are compressed by
+ * greedily replacing the longest symbol that matches at the current position with its code. Bytes that are not
+ * covered by any symbol are stored as the escape code followed by the byte itself. As the compression is
+ * deterministic, two strings are equal if and only if their compressed representations are equal.
+ *
+ * Symbols are stored as little-endian packed uint64_t values (unused bytes are zero). The codes are ordered by the
+ * first byte of their symbols and, for the same first byte, by descending symbol length. Thus, the candidates for the
+ * longest match at a position form a contiguous code range that is searched front to back.
+ */
+class FSSTSymbolTable {
+ public:
+  static constexpr auto max_symbol_count = size_t{255};
+  static constexpr auto max_symbol_length = size_t{8};
+  static constexpr auto escape_code = uint8_t{255};
+
+  // Number of iterations in which the symbol table is refined on the sample (five as in the FSST paper).
+  static constexpr auto generation_count = size_t{5};
+
+  /**
+   * Builds a symbol table for the given sample. In each generation, the sample is compressed with the current table.
+   * The used symbols, the concatenations of adjacent symbols (if not longer than eight bytes), and the single bytes
+   * are weighted by the number of bytes they cover. The max_symbol_count candidates with the highest weight form the
+   * table of the next generation.
+   */
+  static FSSTSymbolTable build(const std::vector<std::string_view>& sample, const PolymorphicAllocator<size_t>& alloc);
+
+  // The symbols do not need to be ordered, the constructor brings them into the order described above.
+  FSSTSymbolTable(pmr_vector<uint64_t> symbols, pmr_vector<uint8_t> symbol_lengths);
+
+  const pmr_vector<uint64_t>& symbols() const;
+  const pmr_vector<uint8_t>& symbol_lengths() const;
+
+  // Appends the codes of the compressed value to `codes`.
+  void compress(std::string_view value, std::string& codes) const;
+
+  pmr_string decompress(std::string_view codes) const;
+
+  // Checks if the value represented by `codes` starts with `prefix`. Only the symbols covering the prefix are decoded.
+  bool starts_with(std::string_view codes, std::string_view prefix) const;
+
+  size_t data_size() const;
+
+ private:
+  // Returns the code and length of the longest symbol that matches `value` at `position`. If no symbol matches, the
+  // escape code and a length of one are returned.
+  std::pair<uint8_t, size_t> _longest_match(std::string_view value, size_t position) const;
+
+  pmr_vector<uint64_t> _symbols;
+  pmr_vector<uint8_t> _symbol_lengths;
+
+  // The codes of symbols starting with byte b are in [_code_ranges[b], _code_ranges[b + 1]).
+  std::array<uint16_t, 257> _code_ranges{};
+};
+
+}  // namespace hyrise
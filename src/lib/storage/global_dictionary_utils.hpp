@@ -0,0 +1,124 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "storage/base_dictionary_segment.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_iterables/create_iterable_from_attribute_vector.hpp"
+#include "storage/segment_iterables/segment_positions.hpp"
+#include "storage/table.hpp"
+#include "storage/vector_compression/base_vector_decompressor.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace hyrise {
+
+/**
+ * A global dictionary is a dictionary that is shared by the DictionarySegments of all chunks of one or multiple
+ * columns (see ChunkEncoder::encode_with_global_dictionary). As the dictionary is sorted, the value IDs of these
+ * segments are order-preserving integer codes of the values that are valid across chunks and columns. Operators can
+ * thus group, join, and sort on the value IDs and only decode the values when writing their output.
+ */
+
+// Returns the dictionary shared by all segments of the column if there is one and nullptr otherwise. ReferenceSegments
+// are resolved to the segments they reference. Empty tables have no global dictionary.
+template <typename T>
+std::shared_ptr<const pmr_vector<T>> global_dictionary(const Table& table, const ColumnID column_id) {
+  auto dictionary = std::shared_ptr<const pmr_vector<T>>{};
+
+  // Chunks of a reference table usually all reference the same table, which only needs to be checked once.
+  auto last_referenced_table = std::shared_ptr<const Table>{};
+  auto last_referenced_column_id = INVALID_COLUMN_ID;
+  auto last_referenced_dictionary = std::shared_ptr<const pmr_vector<T>>{};
+
+  const auto chunk_count = table.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (!chunk) {
+      continue;
+    }
+
+    const auto segment = chunk->get_segment(column_id);
+    auto segment_dictionary = std::shared_ptr<const pmr_vector<T>>{};
+    if (const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(segment)) {
+      if (reference_segment->referenced_table() != last_referenced_table ||
+          reference_segment->referenced_column_id() != last_referenced_column_id) {
+        last_referenced_table = reference_segment->referenced_table();
+        last_referenced_column_id = reference_segment->referenced_column_id();
+        last_referenced_dictionary = global_dictionary<T>(*last_referenced_table, last_referenced_column_id);
+      }
+      segment_dictionary = last_referenced_dictionary;
+    } else if (const auto dictionary_segment = std::dynamic_pointer_cast<const DictionarySegment<T>>(segment)) {
+      segment_dictionary = dictionary_segment->dictionary();
+    }
+
+    if (!segment_dictionary || (dictionary && segment_dictionary != dictionary)) {
+      return nullptr;
+    }
+    dictionary = segment_dictionary;
+  }
+
+  return dictionary;
+}
+
+// Calls the functor with a SegmentPosition<ValueID> for every position of a segment of a column that has a global
+// dictionary. For ReferenceSegments, the chunk offset of a position is its offset in the ReferenceSegment, and NULL
+// positions (NULL_ROW_ID) are reported with the value ID that represents NULL in the referenced segments.
+template <typename Functor>
+void for_each_global_value_id(const AbstractSegment& segment, const Functor& functor) {
+  if (const auto* const dictionary_segment = dynamic_cast<const BaseDictionarySegment*>(&segment)) {
+    create_iterable_from_attribute_vector(*dictionary_segment).for_each(functor);
+    return;
+  }
+
+  Assert(dynamic_cast<const ReferenceSegment*>(&segment), "Expected DictionarySegment or ReferenceSegment.");
+  const auto& reference_segment = static_cast<const ReferenceSegment&>(segment);
+  const auto& pos_list = reference_segment.pos_list();
+  const auto& referenced_table = *reference_segment.referenced_table();
+  const auto referenced_column_id = reference_segment.referenced_column_id();
+  const auto referenced_segment = [&](const ChunkID chunk_id) -> const BaseDictionarySegment& {
+    const auto& abstract_segment = *referenced_table.get_chunk(chunk_id)->get_segment(referenced_column_id);
+    DebugAssert(dynamic_cast<const BaseDictionarySegment*>(&abstract_segment), "Column has no global dictionary.");
+    return static_cast<const BaseDictionarySegment&>(abstract_segment);
+  };
+
+  if (pos_list->empty()) {
+    return;
+  }
+
+  if (pos_list->references_single_chunk()) {
+    create_iterable_from_attribute_vector(referenced_segment(pos_list->common_chunk_id())).for_each(pos_list, functor);
+    return;
+  }
+
+  // All referenced segments share the dictionary and thus the value ID that represents NULL.
+  auto null_value_id = INVALID_VALUE_ID;
+  const auto referenced_chunk_count = referenced_table.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < referenced_chunk_count && null_value_id == INVALID_VALUE_ID;
+       ++chunk_id) {
+    if (referenced_table.get_chunk(chunk_id)) {
+      null_value_id = referenced_segment(chunk_id).null_value_id();
+    }
+  }
+
+  // Decompressors are created lazily, as a PosList usually references only a few of the referenced table's chunks.
+  auto decompressors = std::vector<std::unique_ptr<BaseVectorDecompressor>>(referenced_chunk_count);
+  auto chunk_offset = ChunkOffset{0};
+  for (const auto& row_id : *pos_list) {
+    if (row_id.is_null()) {
+      functor(SegmentPosition<ValueID>{null_value_id, true, chunk_offset});
+    } else {
+      auto& decompressor = decompressors[row_id.chunk_id];
+      if (!decompressor) {
+        decompressor = referenced_segment(row_id.chunk_id).attribute_vector()->create_base_decompressor();
+      }
+      const auto value_id = ValueID{decompressor->get(row_id.chunk_offset)};
+      functor(SegmentPosition<ValueID>{value_id, value_id == null_value_id, chunk_offset});
+    }
+    ++chunk_offset;
+  }
+}
+
+}  // namespace hyrise
@@ -37,11 +37,11 @@ GroupKeyIndex::GroupKeyIndex(const std::vector<std::shared_ptr<const AbstractSeg
   //    With this histogram, we want to count the occurences of each ValueID of the attribute vector.
   //    The ValueID for NULL in an attribute vector is the highest available ValueID in the dictionary + 1
   //    which is also the size of the dictionary.
-  //    `unique_values_count` returns the size of dictionary which does not store a ValueID for NULL.
-  //    Therefore we have `unique_values_count` ValueIDs (NULL-value-id is not included)
+  //    `null_value_id` returns the size of dictionary which does not store a ValueID for NULL.
+  //    Therefore we have `null_value_id` ValueIDs (NULL-value-id is not included)
   //    for which we want to count the occurrences.
   auto value_histogram = std::vector<ChunkOffset>{
-      _indexed_segment->unique_values_count() + 1u /*to mark the ending position */, ChunkOffset{0}};
+      _indexed_segment->null_value_id() + 1u /*to mark the ending position */, ChunkOffset{0}};
 
   // 2) Count the occurrences of value-ids: Iterate once over the attribute vector (i.e. value ids)
   //    and count the occurrences of each value id at their respective position in the dictionary,
@@ -1,9 +1,11 @@
 #include "lz4_segment.hpp"
 
+#include <algorithm>
 #include <climits>
 #include <cstddef>
 #include <iterator>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <sstream>
 #include <string>
@@ -431,8 +433,73 @@ std::pair<pmr_string, size_t> LZ4Segment<pmr_string>::decompress(const ChunkOffs
 
 template <typename T>
 T LZ4Segment<T>::decompress(const ChunkOffset& chunk_offset) const {
-  auto decompressed_block = std::vector<char>(_block_size, char{});
-  return decompress(chunk_offset, std::nullopt, decompressed_block).first;
+  const auto memory_offset = chunk_offset * sizeof(T);
+  const auto block = _decompressed_block(memory_offset / _block_size);
+  const auto value_offset = (memory_offset % _block_size) / sizeof(T);
+  return *(reinterpret_cast<const T*>(block->data()) + value_offset);
+}
+
+template <>
+pmr_string LZ4Segment<pmr_string>::decompress(const ChunkOffset& chunk_offset) const {
+  // See the comment in decompress(const ChunkOffset&, ...) for segments with only empty strings.
+  if (_lz4_blocks.empty()) {
+    return pmr_string{};
+  }
+
+  auto offset_decompressor = _string_offsets->create_base_decompressor();
+  const auto start_offset = size_t{offset_decompressor->get(chunk_offset)};
+  auto end_offset = size_t{0};
+  if (chunk_offset + 1 == offset_decompressor->size()) {
+    end_offset = (_lz4_blocks.size() - 1) * _block_size + _last_block_size;
+  } else {
+    end_offset = offset_decompressor->get(chunk_offset + 1);
+  }
+
+  if (start_offset == end_offset) {
+    return pmr_string{};
+  }
+
+  // The string might span multiple blocks. Its chars are copied block by block.
+  auto result = pmr_string{};
+  result.reserve(end_offset - start_offset);
+  const auto start_block = start_offset / _block_size;
+  const auto end_block = (end_offset - 1) / _block_size;
+  for (auto block_index = start_block; block_index <= end_block; ++block_index) {
+    const auto block = _decompressed_block(block_index);
+    const auto block_begin = block_index * _block_size;
+    const auto begin = std::max(start_offset, block_begin) - block_begin;
+    const auto end = std::min(end_offset, block_begin + block->size()) - block_begin;
+    result.append(block->data() + begin, end - begin);
+  }
+
+  return result;
+}
+
+template <typename T>
+std::shared_ptr<const std::vector<char>> LZ4Segment<T>::_decompressed_block(const size_t block_index) const {
+  {
+    const auto lock = std::lock_guard<std::mutex>{_block_cache_mutex};
+    const auto cached_block_it = std::find_if(_block_cache.begin(), _block_cache.end(), [&](const auto& cached_block) {
+      return cached_block.first == block_index;
+    });
+    if (cached_block_it != _block_cache.end()) {
+      // Move the block to the front so that it is evicted last.
+      std::rotate(_block_cache.begin(), cached_block_it, cached_block_it + 1);
+      return _block_cache.front().second;
+    }
+  }
+
+  auto decompressed_block = std::make_shared<std::vector<char>>();
+  _decompress_block_to_bytes(block_index, *decompressed_block);
+
+  const auto lock = std::lock_guard<std::mutex>{_block_cache_mutex};
+  // Another thread might have decompressed the same block in the meantime. In that case, we keep both copies until
+  // the older one is evicted. This is cheaper than holding the lock during decompression.
+  _block_cache.emplace(_block_cache.begin(), block_index, decompressed_block);
+  if (_block_cache.size() > block_cache_capacity) {
+    _block_cache.pop_back();
+  }
+  return decompressed_block;
 }
 
 template <typename T>
@@ -461,6 +528,7 @@ std::shared_ptr<AbstractSegment> LZ4Segment<T>::copy_using_allocator(const Polym
   }
 
   copy->access_counter = access_counter;
+  copy->set_zone_map(_zone_map);
 
   return copy;
 }
@@ -2,6 +2,7 @@
 
 #include <array>
 #include <memory>
+#include <mutex>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -23,6 +24,13 @@ class BaseCompressedVector;
 template <typename T>
 class LZ4Segment : public AbstractEncodedSegment {
  public:
+  /**
+   * Number of decompressed blocks that each segment keeps for single-value accesses (i.e., get_typed_value() as used
+   * by segment accessors when resolving ReferenceSegments or join indexes). With the default block size of 16 KB, the
+   * cache holds at most 64 KB per segment. Blocks are evicted in least-recently-used order.
+   */
+  static constexpr auto block_cache_capacity = size_t{4};
+
   /**
    * This is a container for an LZ4 compressed segment. It contains the compressed data in blocks, the necessary
    * metadata and the ability to decompress the data again.
@@ -124,8 +132,9 @@ class LZ4Segment : public AbstractEncodedSegment {
   std::vector<T> decompress() const;
 
   /**
-   * Retrieves a single value by only decompressing the block in resides in. Each call of this method causes the
-   * decompression of a block.
+   * Retrieves a single value by only decompressing the block(s) it resides in. Recently decompressed blocks are kept in
+   * a small, thread-safe cache of the segment (see block_cache_capacity), so that subsequent accesses to values of the
+   * same block do not decompress it again.
    *
    * @param chunk_offset The chunk offset identifies a single value in the segment.
    * @return The decompressed value.
@@ -181,6 +190,17 @@ class LZ4Segment : public AbstractEncodedSegment {
   const size_t _compressed_size;
   const size_t _num_elements;
 
+  // Recently decompressed blocks, the most recently used block first.
+  mutable std::mutex _block_cache_mutex;
+  mutable std::vector<std::pair<size_t, std::shared_ptr<const std::vector<char>>>> _block_cache;
+
+  /**
+   * Returns the decompressed block with the given index. If the block is in the block cache, it is returned without
+   * decompression. Otherwise, the block is decompressed and added to the cache. The lock is not held during
+   * decompression, so concurrent accesses to different blocks do not serialize.
+   */
+  std::shared_ptr<const std::vector<char>> _decompressed_block(const size_t block_index) const;
+
   /**
    * Decompress a single block into the provided buffer (the vector). This method writes to the buffer with the given
    * offset, i.e., the buffer can be larger than a single block.
@@ -221,6 +241,8 @@ class LZ4Segment : public AbstractEncodedSegment {
 template <>
 std::vector<pmr_string> LZ4Segment<pmr_string>::decompress() const;
 template <>
+pmr_string LZ4Segment<pmr_string>::decompress(const ChunkOffset&) const;
+template <>
 std::pair<pmr_string, size_t> LZ4Segment<pmr_string>::decompress(const ChunkOffset&,
                                                                  const std::optional<size_t> cached_block_index,
                                                                  std::vector<char>&) const;
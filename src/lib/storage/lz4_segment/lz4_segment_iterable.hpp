@@ -1,6 +1,8 @@
 #pragma once
 
+#include <algorithm>
 #include <memory>
+#include <numeric>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -42,6 +44,9 @@ class LZ4SegmentIterable : public PointAccessibleSegmentIterable<LZ4SegmentItera
    * For the point access, we first retrieve the values for all chunk offsets in the position list and then save
    * the decompressed values in a vector. The first value in that vector (index 0) is the value for the chunk offset
    * at index 0 in the position list.
+   *
+   * Position lists produced by selective joins are usually not sorted. To decompress each block only once, positions
+   * are resolved in the order of their chunk offsets, which groups them by block.
    */
   template <typename Functor, typename PosListType>
   void _on_with_iterators(const std::shared_ptr<PosListType>& position_filter, const Functor& functor) const {
@@ -55,12 +60,37 @@ class LZ4SegmentIterable : public PointAccessibleSegmentIterable<LZ4SegmentItera
     // element. If the requested element is not within that block, the next block will be decompressed and written to
     // `cached_block` while the value and the new block id are returned. In case the requested element is within the
     // cached block, the value and the input block id are returned.
-    for (auto index = size_t{0u}; index < position_filter_size; ++index) {
+    const auto decompress_position = [&](const size_t index) {
       const auto& position = (*position_filter)[index];
       // NOLINTNEXTLINE
       auto [value, block_index] = _segment.decompress(position.chunk_offset, cached_block_index, cached_block);
       decompressed_filtered_segment[index] = std::move(value);
       cached_block_index = block_index;
+    };
+
+    const auto chunk_offset_less = [&](const size_t lhs, const size_t rhs) {
+      return (*position_filter)[lhs].chunk_offset < (*position_filter)[rhs].chunk_offset;
+    };
+
+    auto is_sorted = true;
+    for (auto index = size_t{1}; index < position_filter_size; ++index) {
+      if (chunk_offset_less(index, index - 1)) {
+        is_sorted = false;
+        break;
+      }
+    }
+
+    if (is_sorted) {
+      for (auto index = size_t{0}; index < position_filter_size; ++index) {
+        decompress_position(index);
+      }
+    } else {
+      auto position_order = std::vector<size_t>(position_filter_size);
+      std::iota(position_order.begin(), position_order.end(), size_t{0});
+      std::sort(position_order.begin(), position_order.end(), chunk_offset_less);
+      for (const auto index : position_order) {
+        decompress_position(index);
+      }
     }
 
     using PosListIteratorType = decltype(position_filter->cbegin());
@@ -0,0 +1,221 @@
+#include "compressed_pos_list.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "storage/pos_lists/abstract_pos_list.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace hyrise {
+
+CompressedPosList::CompressedPosList(const ChunkID common_chunk_id, std::vector<ChunkOffset> sorted_offsets)
+    : _common_chunk_id{common_chunk_id}, _size{sorted_offsets.size()} {
+  DebugAssert(_common_chunk_id != INVALID_CHUNK_ID, "Cannot create CompressedPosList for INVALID_CHUNK_ID.");
+  DebugAssert(std::adjacent_find(sorted_offsets.cbegin(), sorted_offsets.cend(),
+                                 [](const auto lhs, const auto rhs) {
+                                   return lhs >= rhs;
+                                 }) == sorted_offsets.cend(),
+              "Offsets of a CompressedPosList have to be strictly increasing.");
+
+  if (sorted_offsets.empty()) {
+    return;
+  }
+
+  // Determine the size of each representation. Ties are broken in favor of the array, which provides the cheapest
+  // random accesses.
+  auto run_count = size_t{1};
+  for (auto index = size_t{1}; index < _size; ++index) {
+    if (sorted_offsets[index] != sorted_offsets[index - 1] + 1) {
+      ++run_count;
+    }
+  }
+  const auto word_count = sorted_offsets.back() / BITS_PER_WORD + 1;
+  const auto block_count = (word_count + WORDS_PER_RANK_BLOCK - 1) / WORDS_PER_RANK_BLOCK;
+
+  const auto array_size = _size * sizeof(ChunkOffset);
+  const auto runs_size = run_count * 2 * sizeof(ChunkOffset);
+  const auto bitmap_size = word_count * sizeof(uint64_t) + block_count * sizeof(ChunkOffset);
+
+  if (array_size <= runs_size && array_size <= bitmap_size) {
+    _offsets = std::move(sorted_offsets);
+    return;
+  }
+
+  if (runs_size <= bitmap_size) {
+    _representation = Representation::Runs;
+    _run_starts.reserve(run_count);
+    _run_end_indices.reserve(run_count);
+    _run_starts.emplace_back(sorted_offsets.front());
+    for (auto index = size_t{1}; index < _size; ++index) {
+      if (sorted_offsets[index] != sorted_offsets[index - 1] + 1) {
+        _run_end_indices.emplace_back(index);
+        _run_starts.emplace_back(sorted_offsets[index]);
+      }
+    }
+    _run_end_indices.emplace_back(_size);
+    return;
+  }
+
+  _representation = Representation::Bitmap;
+  _words.resize(word_count);
+  for (const auto offset : sorted_offsets) {
+    _words[offset / BITS_PER_WORD] |= uint64_t{1} << (offset % BITS_PER_WORD);
+  }
+
+  _block_ranks.reserve(block_count);
+  auto rank = size_t{0};
+  for (auto word_id = size_t{0}; word_id < word_count; ++word_id) {
+    if (word_id % WORDS_PER_RANK_BLOCK == 0) {
+      _block_ranks.emplace_back(rank);
+    }
+    rank += std::popcount(_words[word_id]);
+  }
+}
+
+std::shared_ptr<CompressedPosList> CompressedPosList::unite(const CompressedPosList& lhs,
+                                                            const CompressedPosList& rhs) {
+  Assert(lhs._common_chunk_id == rhs._common_chunk_id, "Can only unite PosLists that reference the same chunk.");
+  auto words = lhs._to_words();
+  const auto rhs_words = rhs._to_words();
+  words.resize(std::max(words.size(), rhs_words.size()));
+  for (auto word_id = size_t{0}; word_id < rhs_words.size(); ++word_id) {
+    words[word_id] |= rhs_words[word_id];
+  }
+  return _from_words(lhs._common_chunk_id, words);
+}
+
+bool CompressedPosList::references_single_chunk() const {
+  return true;
+}
+
+ChunkID CompressedPosList::common_chunk_id() const {
+  return _common_chunk_id;
+}
+
+RowID CompressedPosList::operator[](const size_t index) const {
+  DebugAssert(index < _size, "Invalid position accessed.");
+  switch (_representation) {
+    case Representation::Array:
+      return {_common_chunk_id, _offsets[index]};
+    case Representation::Runs: {
+      const auto run = _run_of_index(index);
+      const auto run_begin_index = run == 0 ? size_t{0} : size_t{_run_end_indices[run - 1]};
+      return {_common_chunk_id,
+              ChunkOffset{static_cast<ChunkOffset::base_type>(_run_starts[run] + index - run_begin_index)}};
+    }
+    case Representation::Bitmap:
+      return {_common_chunk_id, ChunkOffset{static_cast<ChunkOffset::base_type>(_select(index))}};
+  }
+  Fail("Invalid enum value.");
+}
+
+bool CompressedPosList::empty() const {
+  return _size == 0;
+}
+
+size_t CompressedPosList::size() const {
+  return _size;
+}
+
+size_t CompressedPosList::memory_usage(const MemoryUsageCalculationMode /*mode*/) const {
+  return sizeof(*this) +
+         (_offsets.capacity() + _run_starts.capacity() + _run_end_indices.capacity() + _block_ranks.capacity()) *
+             sizeof(ChunkOffset) +
+         _words.capacity() * sizeof(uint64_t);
+}
+
+CompressedPosList::Representation CompressedPosList::representation() const {
+  return _representation;
+}
+
+CompressedPosList::Iterator CompressedPosList::begin() const {
+  return {this, 0};
+}
+
+CompressedPosList::Iterator CompressedPosList::end() const {
+  return {this, _size};
+}
+
+CompressedPosList::Iterator CompressedPosList::cbegin() const {
+  return begin();
+}
+
+CompressedPosList::Iterator CompressedPosList::cend() const {
+  return end();
+}
+
+std::vector<uint64_t> CompressedPosList::_to_words() const {
+  switch (_representation) {
+    case Representation::Array: {
+      auto words = std::vector<uint64_t>(_offsets.empty() ? 0 : _offsets.back() / BITS_PER_WORD + 1);
+      for (const auto offset : _offsets) {
+        words[offset / BITS_PER_WORD] |= uint64_t{1} << (offset % BITS_PER_WORD);
+      }
+      return words;
+    }
+    case Representation::Runs: {
+      const auto run_count = _run_starts.size();
+      const auto last_offset = _run_starts.back() + _size - 1 - (run_count == 1 ? 0 : _run_end_indices[run_count - 2]);
+      auto words = std::vector<uint64_t>(last_offset / BITS_PER_WORD + 1);
+      auto run_begin_index = size_t{0};
+      for (auto run = size_t{0}; run < run_count; ++run) {
+        const auto run_end = _run_starts[run] + _run_end_indices[run] - run_begin_index;
+        for (auto offset = size_t{_run_starts[run]}; offset < run_end; ++offset) {
+          words[offset / BITS_PER_WORD] |= uint64_t{1} << (offset % BITS_PER_WORD);
+        }
+        run_begin_index = _run_end_indices[run];
+      }
+      return words;
+    }
+    case Representation::Bitmap:
+      return _words;
+  }
+  Fail("Invalid enum value.");
+}
+
+std::shared_ptr<CompressedPosList> CompressedPosList::_from_words(const ChunkID common_chunk_id,
+                                                                  const std::vector<uint64_t>& words) {
+  auto offsets = std::vector<ChunkOffset>{};
+  for (auto word_id = size_t{0}; word_id < words.size(); ++word_id) {
+    auto word = words[word_id];
+    while (word != 0) {
+      offsets.emplace_back(word_id * BITS_PER_WORD + std::countr_zero(word));
+      word &= word - 1;
+    }
+  }
+  return std::make_shared<CompressedPosList>(common_chunk_id, std::move(offsets));
+}
+
+size_t CompressedPosList::_run_of_index(const size_t index) const {
+  // The first run whose end index lies behind the index contains the position.
+  return std::distance(_run_end_indices.cbegin(),
+                       std::upper_bound(_run_end_indices.cbegin(), _run_end_indices.cend(), index));
+}
+
+size_t CompressedPosList::_select(const size_t index) const {
+  // Find the last block that starts with at most `index` preceding set bits, then search its words.
+  const auto block = std::distance(_block_ranks.cbegin(),
+                                   std::upper_bound(_block_ranks.cbegin(), _block_ranks.cend(), index)) -
+                     1;
+  auto remaining = index - _block_ranks[block];
+  for (auto word_id = block * WORDS_PER_RANK_BLOCK; word_id < _words.size(); ++word_id) {
+    auto word = _words[word_id];
+    const auto bit_count = static_cast<size_t>(std::popcount(word));
+    if (remaining < bit_count) {
+      for (; remaining > 0; --remaining) {
+        word &= word - 1;
+      }
+      return word_id * BITS_PER_WORD + std::countr_zero(word);
+    }
+    remaining -= bit_count;
+  }
+  Fail("Index exceeds the number of positions.");
+}
+
+}  // namespace hyrise
@@ -0,0 +1,179 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <boost/iterator/iterator_facade.hpp>
+
+#include "abstract_pos_list.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace hyrise {
+
+// A RowIDPosList spends eight bytes per position, even though selective scans on data tables produce PosLists that
+// reference a single chunk and hold strictly increasing ChunkOffsets. The CompressedPosList stores only these offsets
+// and chooses the smallest of three representations (similar to the containers of Roaring bitmaps):
+//   - Array:  the plain ChunkOffsets (four bytes per position)
+//   - Runs:   the start offset and the accumulated length of each run of consecutive offsets (eight bytes per run)
+//   - Bitmap: one bit per offset up to the largest offset, plus the number of set bits preceding every 512 bits
+// As for the EntireChunkPosList, all positions reference the same chunk and there are no NULL positions. Other than the
+// RowIDPosList, the CompressedPosList is immutable.
+class CompressedPosList final : public AbstractPosList {
+ public:
+  enum class Representation : uint8_t { Array, Runs, Bitmap };
+
+  static constexpr auto BITS_PER_WORD = size_t{64};
+  static constexpr auto WORDS_PER_RANK_BLOCK = size_t{8};
+
+  // Random access iterator that keeps track of the current run or bit position. Sequential iteration thus does not
+  // need the binary searches that operator[] requires for runs and bitmaps.
+  class Iterator : public boost::iterator_facade<Iterator, RowID, boost::random_access_traversal_tag, RowID> {
+   public:
+    Iterator(const CompressedPosList* pos_list, const size_t index) : _pos_list{pos_list}, _index{index} {
+      _seek();
+    }
+
+   private:
+    friend class boost::iterator_core_access;
+
+    void increment() {
+      ++_index;
+      if (_pos_list->_representation == Representation::Runs) {
+        if (_index == _pos_list->_run_end_indices[_cursor]) {
+          ++_cursor;
+        }
+      } else if (_pos_list->_representation == Representation::Bitmap) {
+        _cursor = _index < _pos_list->_size ? _pos_list->_next_set_bit(_cursor + 1)
+                                            : _pos_list->_words.size() * BITS_PER_WORD;
+      }
+    }
+
+    void decrement() {
+      --_index;
+      if (_pos_list->_representation == Representation::Runs) {
+        if (_cursor > 0 && _index < _pos_list->_run_end_indices[_cursor - 1]) {
+          --_cursor;
+        }
+      } else if (_pos_list->_representation == Representation::Bitmap) {
+        _cursor = _pos_list->_previous_set_bit(_cursor - 1);
+      }
+    }
+
+    void advance(const std::ptrdiff_t distance) {
+      _index += distance;
+      _seek();
+    }
+
+    bool equal(const Iterator& other) const {
+      DebugAssert(_pos_list == other._pos_list, "Iterator compared to iterator on different PosList instance.");
+      return _index == other._index;
+    }
+
+    std::ptrdiff_t distance_to(const Iterator& other) const {
+      return static_cast<std::ptrdiff_t>(other._index) - static_cast<std::ptrdiff_t>(_index);
+    }
+
+    RowID dereference() const {
+      DebugAssert(_index < _pos_list->_size, "Past-the-end iterator dereferenced.");
+      switch (_pos_list->_representation) {
+        case Representation::Array:
+          return {_pos_list->_common_chunk_id, _pos_list->_offsets[_index]};
+        case Representation::Runs: {
+          const auto run_begin_index = _cursor == 0 ? size_t{0} : size_t{_pos_list->_run_end_indices[_cursor - 1]};
+          return {_pos_list->_common_chunk_id,
+                  ChunkOffset{static_cast<ChunkOffset::base_type>(_pos_list->_run_starts[_cursor] + _index -
+                                                                  run_begin_index)}};
+        }
+        case Representation::Bitmap:
+          return {_pos_list->_common_chunk_id, ChunkOffset{static_cast<ChunkOffset::base_type>(_cursor)}};
+      }
+      Fail("Invalid enum value.");
+    }
+
+    // The cursor is the index of the current run for Runs and the current bit (i.e., the offset) for Bitmap.
+    // Past-the-end iterators point to the run count or bit count, respectively.
+    void _seek() {
+      if (_pos_list->_representation == Representation::Runs) {
+        _cursor = _index < _pos_list->_size ? _pos_list->_run_of_index(_index) : _pos_list->_run_starts.size();
+      } else if (_pos_list->_representation == Representation::Bitmap) {
+        _cursor = _index < _pos_list->_size ? _pos_list->_select(_index) : _pos_list->_words.size() * BITS_PER_WORD;
+      }
+    }
+
+    const CompressedPosList* _pos_list;
+    size_t _index;
+    size_t _cursor{0};
+  };
+
+  // Compresses the given offsets into the chunk common_chunk_id. The offsets have to be strictly increasing.
+  CompressedPosList(const ChunkID common_chunk_id, std::vector<ChunkOffset> sorted_offsets);
+
+  // Unites the positions of two CompressedPosLists that reference the same chunk. The union is evaluated as a
+  // word-wise OR of the lists' bitmaps. The representation of the result is chosen anew.
+  static std::shared_ptr<CompressedPosList> unite(const CompressedPosList& lhs, const CompressedPosList& rhs);
+
+  bool references_single_chunk() const final;
+  ChunkID common_chunk_id() const final;
+
+  RowID operator[](const size_t index) const final;
+
+  bool empty() const final;
+  size_t size() const final;
+  size_t memory_usage(const MemoryUsageCalculationMode /*mode*/) const final;
+
+  Representation representation() const;
+
+  Iterator begin() const;
+  Iterator end() const;
+  Iterator cbegin() const;
+  Iterator cend() const;
+
+ private:
+  // Returns one bit per offset up to the largest offset.
+  std::vector<uint64_t> _to_words() const;
+
+  static std::shared_ptr<CompressedPosList> _from_words(const ChunkID common_chunk_id,
+                                                        const std::vector<uint64_t>& words);
+
+  size_t _run_of_index(const size_t index) const;
+  size_t _select(const size_t index) const;
+
+  size_t _next_set_bit(const size_t bit) const {
+    auto word_id = bit / BITS_PER_WORD;
+    auto word = _words[word_id] & (~uint64_t{0} << (bit % BITS_PER_WORD));
+    while (word == 0) {
+      word = _words[++word_id];
+    }
+    return word_id * BITS_PER_WORD + std::countr_zero(word);
+  }
+
+  size_t _previous_set_bit(const size_t bit) const {
+    auto word_id = bit / BITS_PER_WORD;
+    auto word = _words[word_id] & (~uint64_t{0} >> (BITS_PER_WORD - 1 - (bit % BITS_PER_WORD)));
+    while (word == 0) {
+      word = _words[--word_id];
+    }
+    return word_id * BITS_PER_WORD + (BITS_PER_WORD - 1 - std::countl_zero(word));
+  }
+
+  const ChunkID _common_chunk_id;
+  size_t _size{0};
+  Representation _representation{Representation::Array};
+
+  // Array
+  std::vector<ChunkOffset> _offsets;
+
+  // Runs: _run_end_indices[run] is the number of positions in the runs up to and including `run`.
+  std::vector<ChunkOffset> _run_starts;
+  std::vector<ChunkOffset> _run_end_indices;
+
+  // Bitmap: _block_ranks[block] is the number of set bits in the words before the block of WORDS_PER_RANK_BLOCK words.
+  std::vector<uint64_t> _words;
+  std::vector<ChunkOffset> _block_ranks;
+};
+
+}  // namespace hyrise
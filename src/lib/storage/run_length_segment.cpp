@@ -68,6 +68,7 @@ std::shared_ptr<AbstractSegment> RunLengthSegment<T>::copy_using_allocator(
   auto copy = std::make_shared<RunLengthSegment<T>>(new_values, new_null_values, new_end_positions);
 
   copy->access_counter = access_counter;
+  copy->set_zone_map(_zone_map);
 
   return copy;
 }
@@ -0,0 +1,216 @@
+#include "segment_zone_map.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "resolve_type.hpp"
+#include "statistics/statistics_objects/min_max_filter.hpp"
+#include "storage/abstract_segment.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_iterables/any_segment_iterable.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+#include "utils/size_estimation_utils.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT(build/namespaces)
+
+template <typename T>
+std::shared_ptr<SegmentZoneMap<T>> build_typed_segment_zone_map(const AbstractSegment& segment) {
+  const auto segment_size = segment.size();
+  const auto block_count = (segment_size + BaseSegmentZoneMap::BLOCK_SIZE - 1) / BaseSegmentZoneMap::BLOCK_SIZE;
+
+  auto null_counts = std::vector<ChunkOffset>(block_count, ChunkOffset{0});
+  auto minima = std::vector<T>(block_count);
+  auto maxima = std::vector<T>(block_count);
+  auto block_has_values = std::vector<bool>(block_count, false);
+
+  const auto iterable = create_any_segment_iterable<T>(segment);
+  iterable.for_each([&](const auto& position) {
+    const auto block_id = position.chunk_offset() / BaseSegmentZoneMap::BLOCK_SIZE;
+    if (position.is_null()) {
+      ++null_counts[block_id];
+      return;
+    }
+
+    const auto& value = position.value();
+    if constexpr (std::is_floating_point_v<T>) {
+      // NaNs cannot be ordered. Widening the block's range to all values ensures that the block is never skipped.
+      if (std::isnan(value)) {
+        minima[block_id] = -std::numeric_limits<T>::infinity();
+        maxima[block_id] = std::numeric_limits<T>::infinity();
+        block_has_values[block_id] = true;
+        return;
+      }
+    }
+
+    if (!block_has_values[block_id]) {
+      minima[block_id] = value;
+      maxima[block_id] = value;
+      block_has_values[block_id] = true;
+      return;
+    }
+
+    if (value < minima[block_id]) {
+      minima[block_id] = value;
+    } else if (value > maxima[block_id]) {
+      maxima[block_id] = value;
+    }
+  });
+
+  return std::make_shared<SegmentZoneMap<T>>(segment_size, std::move(null_counts), std::move(minima),
+                                             std::move(maxima));
+}
+
+}  // namespace
+
+namespace hyrise {
+
+bool operator==(const ChunkOffsetRange& lhs, const ChunkOffsetRange& rhs) {
+  return lhs.begin == rhs.begin && lhs.end == rhs.end;
+}
+
+std::ostream& operator<<(std::ostream& stream, const ChunkOffsetRange& range) {
+  return stream << "[" << range.begin << ", " << range.end << ")";
+}
+
+BaseSegmentZoneMap::BaseSegmentZoneMap(const ChunkOffset segment_size, std::vector<ChunkOffset> null_counts)
+    : _segment_size{segment_size}, _null_counts{std::move(null_counts)} {
+  Assert(_null_counts.size() == (_segment_size + BLOCK_SIZE - 1) / BLOCK_SIZE, "Expected one NULL count per block.");
+}
+
+ChunkOffset BaseSegmentZoneMap::segment_size() const {
+  return _segment_size;
+}
+
+size_t BaseSegmentZoneMap::block_count() const {
+  return _null_counts.size();
+}
+
+ChunkOffsetRange BaseSegmentZoneMap::block_range(const size_t block_id) const {
+  DebugAssert(block_id < block_count(), "Block ID out of range.");
+  const auto begin = static_cast<ChunkOffset>(block_id * BLOCK_SIZE);
+  return {begin, std::min(static_cast<ChunkOffset>(begin + BLOCK_SIZE), _segment_size)};
+}
+
+ChunkOffset BaseSegmentZoneMap::null_count(const size_t block_id) const {
+  DebugAssert(block_id < block_count(), "Block ID out of range.");
+  return _null_counts[block_id];
+}
+
+std::vector<ChunkOffsetRange> BaseSegmentZoneMap::qualifying_ranges(
+    const PredicateCondition predicate_condition, const AllTypeVariant& value,
+    const std::optional<AllTypeVariant>& value2) const {
+  // Comparisons with NULL never evaluate to true.
+  const auto value_is_null = predicate_condition != PredicateCondition::IsNull &&
+                             predicate_condition != PredicateCondition::IsNotNull &&
+                             (variant_is_null(value) || (value2 && variant_is_null(*value2)));
+
+  auto ranges = std::vector<ChunkOffsetRange>{};
+  if (value_is_null) {
+    return ranges;
+  }
+
+  const auto block_count = this->block_count();
+  for (auto block_id = size_t{0}; block_id < block_count; ++block_id) {
+    const auto range = block_range(block_id);
+    const auto null_count = _null_counts[block_id];
+    const auto block_size = static_cast<ChunkOffset>(range.end - range.begin);
+
+    auto qualifies = true;
+    switch (predicate_condition) {
+      case PredicateCondition::IsNull:
+        qualifies = null_count > 0;
+        break;
+      case PredicateCondition::IsNotNull:
+        qualifies = null_count < block_size;
+        break;
+      default:
+        qualifies = null_count < block_size &&
+                    !_block_does_not_contain(block_id, predicate_condition, value, value2);
+    }
+
+    if (!qualifies) {
+      continue;
+    }
+
+    if (!ranges.empty() && ranges.back().end == range.begin) {
+      ranges.back().end = range.end;
+    } else {
+      ranges.push_back(range);
+    }
+  }
+
+  return ranges;
+}
+
+size_t BaseSegmentZoneMap::memory_usage() const {
+  return sizeof(*this) + (_null_counts.capacity() * sizeof(ChunkOffset));
+}
+
+template <typename T>
+SegmentZoneMap<T>::SegmentZoneMap(const ChunkOffset segment_size, std::vector<ChunkOffset> null_counts,
+                                  std::vector<T> minima, std::vector<T> maxima)
+    : BaseSegmentZoneMap{segment_size, std::move(null_counts)},
+      _minima{std::move(minima)},
+      _maxima{std::move(maxima)} {
+  Assert(_minima.size() == block_count() && _maxima.size() == block_count(),
+         "Expected one minimum and one maximum per block.");
+}
+
+template <typename T>
+const T& SegmentZoneMap<T>::minimum(const size_t block_id) const {
+  DebugAssert(block_id < block_count(), "Block ID out of range.");
+  return _minima[block_id];
+}
+
+template <typename T>
+const T& SegmentZoneMap<T>::maximum(const size_t block_id) const {
+  DebugAssert(block_id < block_count(), "Block ID out of range.");
+  return _maxima[block_id];
+}
+
+template <typename T>
+size_t SegmentZoneMap<T>::memory_usage() const {
+  auto memory_usage = sizeof(*this) + (_null_counts.capacity() * sizeof(ChunkOffset)) +
+                      ((_minima.capacity() + _maxima.capacity()) * sizeof(T));
+  if constexpr (std::is_same_v<T, pmr_string>) {
+    for (auto block_id = size_t{0}; block_id < block_count(); ++block_id) {
+      memory_usage += string_heap_size(_minima[block_id]) + string_heap_size(_maxima[block_id]);
+    }
+  }
+  return memory_usage;
+}
+
+template <typename T>
+bool SegmentZoneMap<T>::_block_does_not_contain(const size_t block_id, const PredicateCondition predicate_condition,
+                                                const AllTypeVariant& value,
+                                                const std::optional<AllTypeVariant>& value2) const {
+  // MinMaxFilter already implements the pruning logic for all predicate conditions (including LIKE prefixes).
+  return MinMaxFilter<T>{_minima[block_id], _maxima[block_id]}.does_not_contain(predicate_condition, value, value2);
+}
+
+std::shared_ptr<BaseSegmentZoneMap> build_segment_zone_map(const AbstractSegment& segment) {
+  Assert(!dynamic_cast<const ReferenceSegment*>(&segment), "Zone maps cannot be built for ReferenceSegments.");
+
+  auto zone_map = std::shared_ptr<BaseSegmentZoneMap>{};
+  resolve_data_type(segment.data_type(), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+    zone_map = build_typed_segment_zone_map<ColumnDataType>(segment);
+  });
+  return zone_map;
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(SegmentZoneMap);
+
+}  // namespace hyrise
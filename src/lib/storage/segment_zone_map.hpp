@@ -0,0 +1,95 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+class AbstractSegment;
+
+// Half-open range [begin, end) of chunk offsets.
+struct ChunkOffsetRange {
+  ChunkOffset begin;
+  ChunkOffset end;
+};
+
+bool operator==(const ChunkOffsetRange& lhs, const ChunkOffsetRange& rhs);
+
+std::ostream& operator<<(std::ostream& stream, const ChunkOffsetRange& range);
+
+/**
+ * Chunk pruning (see ChunkPruningRule) uses the minimum and maximum of entire segments. With the default chunk size,
+ * a single outlier suffices to make a segment's range useless. Zone maps store the minimum, the maximum, and the number
+ * of NULLs for each block of BLOCK_SIZE consecutive rows of an encoded segment instead. Table scans use them to skip
+ * blocks that cannot contain matching rows, which pays off for columns that are roughly (but not strictly) ordered,
+ * e.g., timestamps of a time series.
+ *
+ * Zone maps are built by the segment encoders (see SegmentEncoder::encode()) and are immutable afterwards.
+ */
+class BaseSegmentZoneMap : private Noncopyable {
+ public:
+  static constexpr auto BLOCK_SIZE = ChunkOffset{2048};
+
+  BaseSegmentZoneMap(const ChunkOffset segment_size, std::vector<ChunkOffset> null_counts);
+
+  virtual ~BaseSegmentZoneMap() = default;
+
+  ChunkOffset segment_size() const;
+
+  size_t block_count() const;
+
+  ChunkOffsetRange block_range(const size_t block_id) const;
+
+  ChunkOffset null_count(const size_t block_id) const;
+
+  /**
+   * Returns the ranges of chunk offsets that might contain rows for which the predicate holds. Adjacent qualifying
+   * blocks are merged into a single range. The ranges are sorted and only skip blocks for which it is guaranteed that
+   * no row matches. As for MinMaxFilters, the caller is responsible for passing values of the segment's data type.
+   */
+  std::vector<ChunkOffsetRange> qualifying_ranges(
+      const PredicateCondition predicate_condition, const AllTypeVariant& value,
+      const std::optional<AllTypeVariant>& value2 = std::nullopt) const;
+
+  virtual size_t memory_usage() const;
+
+ protected:
+  // Returns true if no non-NULL value of the block satisfies the predicate.
+  virtual bool _block_does_not_contain(const size_t block_id, const PredicateCondition predicate_condition,
+                                       const AllTypeVariant& value,
+                                       const std::optional<AllTypeVariant>& value2) const = 0;
+
+  const ChunkOffset _segment_size;
+  const std::vector<ChunkOffset> _null_counts;
+};
+
+template <typename T>
+class SegmentZoneMap : public BaseSegmentZoneMap {
+ public:
+  SegmentZoneMap(const ChunkOffset segment_size, std::vector<ChunkOffset> null_counts, std::vector<T> minima,
+                 std::vector<T> maxima);
+
+  // For blocks that only contain NULLs, minimum and maximum are default-constructed values.
+  const T& minimum(const size_t block_id) const;
+  const T& maximum(const size_t block_id) const;
+
+  size_t memory_usage() const final;
+
+ protected:
+  bool _block_does_not_contain(const size_t block_id, const PredicateCondition predicate_condition,
+                               const AllTypeVariant& value, const std::optional<AllTypeVariant>& value2) const final;
+
+  const std::vector<T> _minima;
+  const std::vector<T> _maxima;
+};
+
+// Builds the zone map of a non-reference segment by iterating over it once.
+std::shared_ptr<BaseSegmentZoneMap> build_segment_zone_map(const AbstractSegment& segment);
+
+EXPLICITLY_DECLARE_DATA_TYPES(SegmentZoneMap);
+
+}  // namespace hyrise
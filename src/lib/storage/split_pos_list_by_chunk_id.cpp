@@ -2,8 +2,12 @@
 
 #include <cstddef>
 #include <memory>
+#include <utility>
+#include <vector>
 
+#include "resolve_type.hpp"
 #include "storage/pos_lists/abstract_pos_list.hpp"
+#include "storage/pos_lists/compressed_pos_list.hpp"
 #include "storage/pos_lists/row_id_pos_list.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
@@ -15,33 +19,53 @@ PosListsByChunkID split_pos_list_by_chunk_id(const std::shared_ptr<const Abstrac
   DebugAssert(!input_pos_list->references_single_chunk() || input_pos_list->empty(),
               "No need to split a reference segment that references a single chunk");
 
-  // The input_pos_list references multiple chunks and we actually need to split it. Because we are supposed to return
-  // shared_ptr<const RowIDPosList>, we first create regular PosLists, add the values to them, and then convert these.
-
-  // Create RowIDPosLists and set them as `references_single_chunk`
+  // The input_pos_list references multiple chunks and we actually need to split it. We first collect the ChunkOffsets
+  // per chunk and then store them in the PosList type that fits them best.
+  auto offsets_by_chunk_id = std::vector<std::vector<ChunkOffset>>(number_of_chunks);
   auto pos_lists_by_chunk_id = PosListsByChunkID{number_of_chunks};
 
   for (auto chunk_id = ChunkID{0}; chunk_id < number_of_chunks; ++chunk_id) {
-    DebugAssert(chunk_id < number_of_chunks, "Inconsistent number_of_chunks passed");
-    auto& mapping = pos_lists_by_chunk_id[chunk_id];
-    mapping.row_ids = std::make_shared<RowIDPosList>();
-    mapping.row_ids->guarantee_single_chunk();
-    mapping.row_ids->reserve(input_pos_list->size() / number_of_chunks);
-    mapping.original_positions.reserve(input_pos_list->size() / number_of_chunks);
+    offsets_by_chunk_id[chunk_id].reserve(input_pos_list->size() / number_of_chunks);
+    pos_lists_by_chunk_id[chunk_id].original_positions.reserve(input_pos_list->size() / number_of_chunks);
   }
 
   // Iterate over the input_pos_list and split the entries by chunk_id
-  auto original_position = ChunkOffset{0};
-  for (const auto row_id : *input_pos_list) {
-    if (row_id.is_null()) {
-      original_position++;
+  auto strictly_increasing_by_chunk_id = std::vector<bool>(number_of_chunks, true);
+  resolve_pos_list_type(input_pos_list, [&](const auto& typed_pos_list) {
+    auto original_position = ChunkOffset{0};
+    for (const auto row_id : *typed_pos_list) {
+      if (row_id.is_null()) {
+        original_position++;
+        continue;
+      }
+
+      auto& offsets = offsets_by_chunk_id[row_id.chunk_id];
+      if (!offsets.empty() && offsets.back() >= row_id.chunk_offset) {
+        strictly_increasing_by_chunk_id[row_id.chunk_id] = false;
+      }
+
+      offsets.emplace_back(row_id.chunk_offset);
+      pos_lists_by_chunk_id[row_id.chunk_id].original_positions.emplace_back(original_position++);
+    }
+  });
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < number_of_chunks; ++chunk_id) {
+    auto& offsets = offsets_by_chunk_id[chunk_id];
+    if (offsets.empty()) {
       continue;
     }
 
-    auto& mapping = pos_lists_by_chunk_id[row_id.chunk_id];
+    if (strictly_increasing_by_chunk_id[chunk_id]) {
+      pos_lists_by_chunk_id[chunk_id].row_ids = std::make_shared<CompressedPosList>(chunk_id, std::move(offsets));
+      continue;
+    }
 
-    mapping.row_ids->emplace_back(row_id);
-    mapping.original_positions.emplace_back(original_position++);
+    auto row_ids = std::make_shared<RowIDPosList>(offsets.size());
+    row_ids->guarantee_single_chunk();
+    for (auto index = size_t{0}; index < offsets.size(); ++index) {
+      (*row_ids)[index] = RowID{chunk_id, offsets[index]};
+    }
+    pos_lists_by_chunk_id[chunk_id].row_ids = std::move(row_ids);
   }
 
   return pos_lists_by_chunk_id;
@@ -6,7 +6,7 @@
 
 #include "uninitialized_vector.hpp"
 
-#include "storage/pos_lists/row_id_pos_list.hpp"
+#include "storage/pos_lists/abstract_pos_list.hpp"
 #include "types.hpp"
 
 namespace hyrise {
@@ -15,7 +15,7 @@ namespace hyrise {
 // of which references only a single chunk. For each entry in that SubPosList, we need to keep its position in the
 // original PosList so that we can reassemble that PosList if needed.
 struct SubPosList {
-  std::shared_ptr<RowIDPosList> row_ids;
+  std::shared_ptr<const AbstractPosList> row_ids;
   std::vector<ChunkOffset> original_positions;
 };
 
@@ -25,7 +25,10 @@ using PosListsByChunkID = std::vector<SubPosList>;
 // The returned structs contains one of those PosList as well as the position of an entry within the original PosList.
 // For example, splitting [(1,3), (0,2), (1,2)] gives us two PosLists [(0,2)] and [(1,3), (1,2)] as well as the
 // original positions [1] and [0, 2]. These original positions are needed to reassemble the result.
-// The returned PosListsByChunkID has a guaranteed size of `number_of_chunks`, but the entries might be empty.
+// The returned PosListsByChunkID has a guaranteed size of `number_of_chunks`, but the entries might be empty (i.e.,
+// their row_ids are nullptr).
+// If the entries of a chunk are strictly increasing (e.g., because the input PosList is sorted), its SubPosList is a
+// CompressedPosList, which takes at most half the memory of a RowIDPosList. Otherwise, it is a RowIDPosList.
 
 PosListsByChunkID split_pos_list_by_chunk_id(const std::shared_ptr<const AbstractPosList>& input_pos_list,
                                              const size_t number_of_chunks);
@@ -22,6 +22,23 @@
 #include "utils/assert.hpp"
 #include "utils/meta_table_manager.hpp"
 
+namespace {
+
+using namespace hyrise;  // NOLINT(build/namespaces)
+
+// The cached plans of prepared statements (see QueryHandler) refer to the tables and views that existed when they were
+// created. Like the other plan caches, they are cleared entirely.
+void clear_prepared_plan_caches() {
+  if (const auto& prepared_plan_cache = Hyrise::get().prepared_plan_cache) {
+    prepared_plan_cache->clear();
+  }
+  if (const auto& prepared_pqp_cache = Hyrise::get().prepared_pqp_cache) {
+    prepared_pqp_cache->clear();
+  }
+}
+
+}  // namespace
+
 namespace hyrise {
 
 void StorageManager::add_table(const std::string& name, std::shared_ptr<Table> table) {
@@ -45,6 +62,7 @@ void StorageManager::add_table(const std::string& name, std::shared_ptr<Table> t
   generate_chunk_pruning_statistics(table);
 
   _tables[name] = std::move(table);
+  clear_prepared_plan_caches();
 }
 
 void StorageManager::drop_table(const std::string& name) {
@@ -53,6 +71,7 @@ void StorageManager::drop_table(const std::string& name) {
 
   // The concurrent_unordered_map does not support concurrency-safe erasure. Thus, we simply reset the table pointer.
   _tables[name] = nullptr;
+  clear_prepared_plan_caches();
 }
 
 std::shared_ptr<Table> StorageManager::get_table(const std::string& name) const {
@@ -111,6 +130,7 @@ void StorageManager::add_view(const std::string& name, const std::shared_ptr<LQP
          "Cannot add view " + name + " - a view with the same name already exists");
 
   _views[name] = view;
+  clear_prepared_plan_caches();
 }
 
 void StorageManager::drop_view(const std::string& name) {
@@ -118,6 +138,7 @@ void StorageManager::drop_view(const std::string& name) {
   Assert(view_iter != _views.end() && view_iter->second, "Error deleting view. No such view named '" + name + "'");
 
   _views[name] = nullptr;
+  clear_prepared_plan_caches();
 }
 
 std::shared_ptr<LQPView> StorageManager::get_view(const std::string& name) const {
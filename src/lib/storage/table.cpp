@@ -113,7 +113,7 @@ Table::Table(const TableColumnDefinitions& column_definitions, const TableType t
 
       for (auto column_id = ColumnID{0}; column_id < num_columns; ++column_id) {
         const auto& segment = chunk->get_segment(column_id);
-        Assert(segment->data_type() == column_data_type(column_id), "Invalid Segment DataType.");
+        Assert(segment->data_type() == storage_data_type(column_data_type(column_id)), "Invalid Segment DataType.");
 
         // Currently, tables in Hyrise are either entirely of type TableType::Data or TableTable::References. Within a
         // table, different segments can reference different tables (e.g., when two tables have been joined). However,
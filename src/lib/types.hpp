@@ -4,10 +4,12 @@
 #include <cstdint>
 #include <functional>
 #include <limits>
+#include <new>
 #include <ostream>
 #include <string>
 #include <string_view>
 #include <tuple>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -63,6 +65,13 @@ using Selectivity = float;
 // and could be, e.g., "Estimated Runtime" or "Estimated Memory Usage" (though the former is by far the most common)
 using Cost = float;
 
+namespace detail {
+
+// See PolymorphicAllocator::construct.
+inline thread_local bool default_initialize_pmr_elements{false};
+
+}  // namespace detail
+
 // We use polymorphic memory resources to allow containers (e.g., vectors, or strings) to retrieve their memory from
 // different memory sources. These sources are, for example, specific NUMA nodes or non-volatile memory. Without PMR,
 // we would need to explicitly make the allocator part of the class. This would make DRAM and NVM containers type-
@@ -70,7 +79,35 @@ using Cost = float;
 //
 // TODO(anyone): replace this with std::pmr once libc++ supports PMR.
 template <typename T>
-using PolymorphicAllocator = boost::container::pmr::polymorphic_allocator<T>;
+class PolymorphicAllocator : public boost::container::pmr::polymorphic_allocator<T> {
+ public:
+  using boost::container::pmr::polymorphic_allocator<T>::polymorphic_allocator;
+
+  PolymorphicAllocator() noexcept = default;
+
+  // Allows conversions between element types and from the allocators that boost's implementation returns.
+  template <typename U>
+  PolymorphicAllocator(const boost::container::pmr::polymorphic_allocator<U>& other) noexcept  // NOLINT
+      : boost::container::pmr::polymorphic_allocator<T>{other.resource()} {}
+
+  PolymorphicAllocator select_on_container_copy_construction() const {
+    return PolymorphicAllocator{};
+  }
+
+  // Elements are value-initialized, i.e., zeroed for trivial types, unless detail::default_initialize_pmr_elements is
+  // set for the current thread. In that case, trivial elements are default-initialized and the memory is not written.
+  // This allows vectors to be constructed in place on existing (possibly read-only) data (see MappedBinaryFile).
+  template <typename U, typename... Args>
+  void construct(U* pointer, Args&&... args) {
+    if constexpr (sizeof...(Args) == 0 && std::is_trivially_default_constructible_v<U>) {
+      if (detail::default_initialize_pmr_elements) {
+        ::new (static_cast<void*>(pointer)) U;
+        return;
+      }
+    }
+    boost::container::pmr::polymorphic_allocator<T>::construct(pointer, std::forward<Args>(args)...);
+  }
+};
 
 // The string type that is used internally to store data. It's hard to draw the line between this and std::string or
 // give advice when to use what. Generally, everything that is user-supplied data (mostly, data stored in a table) is a
@@ -1,11 +1,14 @@
 #include "date_time_utils.hpp"
 
+#include <cstddef>
 #include <cstdint>
 #include <optional>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 
 #include <boost/date_time/gregorian/gregorian.hpp>
+#include <boost/date_time/posix_time/posix_time.hpp>
 #include <boost/lexical_cast/bad_lexical_cast.hpp>
 
 #include "magic_enum.hpp"
@@ -13,20 +16,68 @@
 #include "types.hpp"
 #include "utils/assert.hpp"
 
+namespace {
+
+// Parses the digits in [begin, begin + digit_count). Returns std::nullopt if any of the characters is not a digit.
+std::optional<uint16_t> parse_digits(const std::string_view string, const size_t begin, const size_t digit_count) {
+  auto result = uint16_t{0};
+  for (auto index = begin; index < begin + digit_count; ++index) {
+    const auto character = string[index];
+    if (character < '0' || character > '9') {
+      return std::nullopt;
+    }
+    result = static_cast<uint16_t>(result * 10 + (character - '0'));
+  }
+  return result;
+}
+
+const auto DATE_EPOCH = boost::gregorian::date{1970, 1, 1};
+
+}  // namespace
+
 namespace hyrise {
 
-std::optional<boost::posix_time::ptime> string_to_timestamp(const std::string& timestamp_string) {
+std::optional<boost::posix_time::ptime> string_to_timestamp(const std::string_view timestamp_string) {
+  // Dates and timestamps are stored as strings, so expressions such as EXTRACT parse them for every row. Boost's
+  // stream-based parsing is slow and reports invalid values via exceptions. Thus, we parse the fixed-width formats
+  // 'YYYY-MM-DD' and 'YYYY-MM-DD HH:MM:SS' ourselves and only fall back to Boost for other formats (e.g., fractional
+  // seconds or single-digit fields).
+  const auto size = timestamp_string.size();
+  if ((size == 10 || (size == 19 && timestamp_string[10] == ' ' && timestamp_string[13] == ':' &&
+                      timestamp_string[16] == ':')) &&
+      timestamp_string[4] == '-' && timestamp_string[7] == '-') {
+    const auto year = parse_digits(timestamp_string, 0, 4);
+    const auto month = parse_digits(timestamp_string, 5, 2);
+    const auto day = parse_digits(timestamp_string, 8, 2);
+    const auto hours = size == 19 ? parse_digits(timestamp_string, 11, 2) : uint16_t{0};
+    const auto minutes = size == 19 ? parse_digits(timestamp_string, 14, 2) : uint16_t{0};
+    const auto seconds = size == 19 ? parse_digits(timestamp_string, 17, 2) : uint16_t{0};
+
+    if (year && month && day && hours && minutes && seconds) {
+      // Boost does not support years before 1400 (see header).
+      if (*year < 1400 || *month < 1 || *month > 12 || *day < 1 ||
+          *day > boost::gregorian::gregorian_calendar::end_of_month_day(*year, *month)) {
+        return std::nullopt;
+      }
+
+      // Out-of-bounds times overflow into the next time unit, as for Boost's parsing.
+      return boost::posix_time::ptime{boost::gregorian::date{*year, *month, *day},
+                                      boost::posix_time::hours{*hours} + boost::posix_time::minutes{*minutes} +
+                                          boost::posix_time::seconds{*seconds}};
+    }
+  }
+
   // NOLINTBEGIN(bugprone-empty-catch): We catch parsing exceptions since we return a std::nullopt if the input string
   // is not a valid timestamp.
   try {
-    if (timestamp_string.size() == 10) {
+    if (size == 10) {
       // This is a date without time information.
-      const auto date = boost::gregorian::from_simple_string(timestamp_string);
+      const auto date = boost::gregorian::from_simple_string(std::string{timestamp_string});
       if (!date.is_not_a_date()) {
         return boost::posix_time::ptime{date};
       }
     } else {
-      const auto timestamp = boost::posix_time::time_from_string(timestamp_string);
+      const auto timestamp = boost::posix_time::time_from_string(std::string{timestamp_string});
       if (!timestamp.is_not_a_date_time()) {
         return timestamp;
       }
@@ -71,4 +122,28 @@ std::string timestamp_to_string(const boost::posix_time::ptime& timestamp) {
   return string_representation;
 }
 
+std::optional<int32_t> date_string_to_days(const std::string_view date_string) {
+  if (date_string.size() != 10) {
+    return std::nullopt;
+  }
+
+  const auto timestamp = string_to_timestamp(date_string);
+  if (!timestamp) {
+    return std::nullopt;
+  }
+  return date_to_days(timestamp->date());
+}
+
+int32_t date_to_days(const boost::gregorian::date& date) {
+  return static_cast<int32_t>((date - DATE_EPOCH).days());
+}
+
+boost::gregorian::date days_to_date(const int32_t days) {
+  return DATE_EPOCH + boost::gregorian::days{days};
+}
+
+std::string days_to_date_string(const int32_t days) {
+  return date_to_string(days_to_date(days));
+}
+
 }  // namespace hyrise
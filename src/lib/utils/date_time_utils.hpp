@@ -1,7 +1,9 @@
 #pragma once
 
+#include <cstdint>
 #include <optional>
 #include <string>
+#include <string_view>
 
 #include <boost/date_time/posix_time/posix_time.hpp>
 
@@ -15,9 +17,10 @@ namespace hyrise {
  * for timestamps, e.g., '2000-01-01 25:61:61' is valid and the overflow is added to the subsequent time unit. In this
  * example, the resulting timestamp is '2000-01-02 02:02:01'. This behavior is enabled by Boost's time math, see
  * https://www.boost.org/doc/libs/1_79_0/doc/html/date_time/examples.html#date_time.examples.time_math
- * Notably, Boost's timestamps do not support years < 1400 or > 9999.
+ * Notably, Boost's timestamps do not support years < 1400 or > 9999. The fixed-width formats "YYYY-MM-DD" and
+ * "YYYY-MM-DD HH:MM:SS" are parsed without Boost's (comparably slow) string parsing.
  */
-std::optional<boost::posix_time::ptime> string_to_timestamp(const std::string& timestamp_string);
+std::optional<boost::posix_time::ptime> string_to_timestamp(const std::string_view timestamp_string);
 
 /**
  * This also handles edge cases with days that are the end of a month.
@@ -32,4 +35,17 @@ std::string date_to_string(const boost::gregorian::date& date);
 // ISO 8601 extended format representation of the timestamp without time indicator.
 std::string timestamp_to_string(const boost::posix_time::ptime& timestamp);
 
+/**
+ * Values of DataType::Date are stored as the number of days since 1970-01-01. Returns std::nullopt if the string is not
+ * a valid date in the format "YYYY-MM-DD".
+ */
+std::optional<int32_t> date_string_to_days(const std::string_view date_string);
+
+int32_t date_to_days(const boost::gregorian::date& date);
+
+boost::gregorian::date days_to_date(const int32_t days);
+
+// ISO 8601 extended format representation of a DataType::Date value.
+std::string days_to_date_string(const int32_t days);
+
 }  // namespace hyrise
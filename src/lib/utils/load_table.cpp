@@ -15,6 +15,7 @@
 #include "string_utils.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
+#include "utils/date_time_utils.hpp"
 
 namespace hyrise {
 
@@ -70,6 +71,10 @@ std::shared_ptr<Table> load_table(const std::string& file_name, ChunkOffset chun
     for (auto column_id = ColumnID{0}; column_id < string_value_count; ++column_id) {
       if (table->column_is_nullable(column_id) && string_values[column_id] == "null") {
         variant_values[column_id] = NULL_VALUE;
+      } else if (table->column_data_type(column_id) == DataType::Date) {
+        const auto days = date_string_to_days(string_values[column_id]);
+        Assert(days, "Invalid date " + string_values[column_id] + " for column " + table->column_name(column_id) + ".");
+        variant_values[column_id] = *days;
       } else {
         resolve_data_type(table->column_data_type(column_id), [&](auto data_type_t) {
           using ColumnDataType = typename decltype(data_type_t)::type;
@@ -18,6 +18,9 @@
 #include "expression/abstract_expression.hpp"
 #include "expression/expression_functional.hpp"
 #include "expression/expression_utils.hpp"
+#include "expression/in_expression.hpp"
+#include "expression/list_expression.hpp"
+#include "expression/value_expression.hpp"
 #include "hyrise.hpp"
 #include "logical_query_plan/predicate_node.hpp"  // IWYU pragma: keep
 #include "logical_query_plan/stored_table_node.hpp"
@@ -25,8 +28,10 @@
 #include "operators/operator_scan_predicate.hpp"
 #include "resolve_type.hpp"
 #include "statistics/attribute_statistics.hpp"
-#include "statistics/statistics_objects/min_max_filter.hpp"  // IWYU pragma: keep
-#include "statistics/statistics_objects/range_filter.hpp"    // IWYU pragma: keep
+#include "statistics/base_attribute_statistics.hpp"
+#include "statistics/statistics_objects/min_max_filter.hpp"            // IWYU pragma: keep
+#include "statistics/statistics_objects/range_filter.hpp"              // IWYU pragma: keep
+#include "statistics/statistics_objects/split_block_bloom_filter.hpp"  // IWYU pragma: keep
 #include "statistics/table_statistics.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
@@ -35,36 +40,82 @@ namespace {
 
 using namespace hyrise;  // NOLINT(build/namespaces)
 
-// Check whether any of the statistics objects available for this Segment identify the predicate as prunable.
-bool can_prune(const BaseAttributeStatistics& base_segment_statistics, const PredicateCondition predicate_condition,
-               const AllTypeVariant& variant_value, const std::optional<AllTypeVariant>& variant_value2) {
-  auto can_prune = false;
+// Prunes the chunks that cannot contain any value of an IN list, e.g., `a IN (1, 5, 17)`. OperatorScanPredicates
+// cannot represent such predicates, but the ChunkPruningRule runs before the InExpressionRewriteRule turns them into
+// disjunctions or semi joins. Returns std::nullopt if the predicate is not a (non-negated) IN list of values.
+std::optional<std::set<ChunkID>> compute_chunk_exclude_list_for_in_list(
+    const InExpression& in_expression, const StoredTableNode& stored_table_node_without_column_pruning,
+    const std::shared_ptr<StoredTableNode>& stored_table_node) {
+  const auto list_expression = std::dynamic_pointer_cast<const ListExpression>(in_expression.set());
+  if (in_expression.is_negated() || !list_expression || in_expression.operand()->type != ExpressionType::LQPColumn) {
+    return std::nullopt;
+  }
 
-  resolve_data_type(base_segment_statistics.data_type, [&](const auto data_type_t) {
-    using ColumnDataType = typename decltype(data_type_t)::type;
+  const auto column_id = stored_table_node_without_column_pruning.find_column_id(*in_expression.operand());
+  if (!column_id) {
+    return std::nullopt;
+  }
 
-    const auto& segment_statistics = static_cast<const AttributeStatistics<ColumnDataType>&>(base_segment_statistics);
+  // As for the other predicates, we rather skip pruning than pruning chunks based on lossy casts.
+  const auto column_data_type = in_expression.operand()->data_type();
+  auto values = std::vector<AllTypeVariant>{};
+  values.reserve(list_expression->elements().size());
+  for (const auto& element : list_expression->elements()) {
+    const auto value_expression = std::dynamic_pointer_cast<const ValueExpression>(element);
+    if (!value_expression) {
+      return std::nullopt;
+    }
 
-    // Range filters are only available for arithmetic (non-string) types.
-    if constexpr (std::is_arithmetic_v<ColumnDataType>) {
-      if (segment_statistics.range_filter) {
-        if (segment_statistics.range_filter->does_not_contain(predicate_condition, variant_value, variant_value2)) {
-          can_prune = true;
-        }
-      }
-      // RangeFilters contain all the information stored in a MinMaxFilter. There is no point in having both.
-      DebugAssert(!segment_statistics.min_max_filter,
-                  "Segment should not have a MinMaxFilter and a RangeFilter at the same time");
+    auto value = lossless_variant_cast(value_expression->value, column_data_type);
+    if (!value) {
+      return std::nullopt;
     }
+    values.emplace_back(std::move(*value));
+  }
 
-    if (segment_statistics.min_max_filter) {
-      if (segment_statistics.min_max_filter->does_not_contain(predicate_condition, variant_value, variant_value2)) {
-        can_prune = true;
-      }
+  auto excluded_chunk_ids = std::set<ChunkID>{};
+  const auto table = Hyrise::get().storage_manager.get_table(stored_table_node->table_name);
+  const auto& already_pruned_chunk_ids = stored_table_node->pruned_chunk_ids();
+  const auto chunk_count = table->chunk_count();
+  auto num_rows_pruned = size_t{0};
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    if (!chunk || !chunk->pruning_statistics()) {
+      continue;
     }
-  });
 
-  return can_prune;
+    const auto& segment_statistics = *(*chunk->pruning_statistics())[*column_id];
+    const auto prunable = std::all_of(values.cbegin(), values.cend(), [&](const auto& value) {
+      return can_prune(segment_statistics, PredicateCondition::Equals, value);
+    });
+    if (!prunable) {
+      continue;
+    }
+
+    if (std::find(already_pruned_chunk_ids.begin(), already_pruned_chunk_ids.end(), chunk_id) ==
+        already_pruned_chunk_ids.end()) {
+      num_rows_pruned += chunk->size();
+    }
+    excluded_chunk_ids.insert(chunk_id);
+  }
+
+  // The statistics objects cannot be pruned for IN lists, so we scale the statistics of all columns.
+  if (num_rows_pruned > size_t{0}) {
+    const auto& old_statistics =
+        stored_table_node->table_statistics ? stored_table_node->table_statistics : table->table_statistics();
+    const auto remaining_row_count = std::max(0.0f, old_statistics->row_count - static_cast<float>(num_rows_pruned));
+    const auto scale = old_statistics->row_count > 0 ? remaining_row_count / old_statistics->row_count : 1.0f;
+
+    auto column_statistics = std::vector<std::shared_ptr<const BaseAttributeStatistics>>{};
+    column_statistics.reserve(old_statistics->column_statistics.size());
+    for (const auto& old_column_statistics : old_statistics->column_statistics) {
+      column_statistics.emplace_back(old_column_statistics->scaled(scale));
+    }
+    stored_table_node->table_statistics =
+        std::make_shared<TableStatistics>(std::move(column_statistics), remaining_row_count);
+  }
+
+  return excluded_chunk_ids;
 }
 
 template <typename T>
@@ -108,6 +159,43 @@ namespace hyrise {
 
 using namespace expression_functional;  // NOLINT(build/namespaces)
 
+bool can_prune(const BaseAttributeStatistics& base_segment_statistics, const PredicateCondition predicate_condition,
+               const AllTypeVariant& variant_value, const std::optional<AllTypeVariant>& variant_value2) {
+  auto prunable = false;
+
+  resolve_data_type(base_segment_statistics.data_type, [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    const auto& segment_statistics = static_cast<const AttributeStatistics<ColumnDataType>&>(base_segment_statistics);
+
+    // Range filters are only available for arithmetic (non-string) types.
+    if constexpr (std::is_arithmetic_v<ColumnDataType>) {
+      if (segment_statistics.range_filter) {
+        if (segment_statistics.range_filter->does_not_contain(predicate_condition, variant_value, variant_value2)) {
+          prunable = true;
+        }
+      }
+      // RangeFilters contain all the information stored in a MinMaxFilter. There is no point in having both.
+      DebugAssert(!segment_statistics.min_max_filter,
+                  "Segment should not have a MinMaxFilter and a RangeFilter at the same time");
+    }
+
+    if (segment_statistics.min_max_filter) {
+      if (segment_statistics.min_max_filter->does_not_contain(predicate_condition, variant_value, variant_value2)) {
+        prunable = true;
+      }
+    }
+
+    if (segment_statistics.bloom_filter) {
+      if (segment_statistics.bloom_filter->does_not_contain(predicate_condition, variant_value, variant_value2)) {
+        prunable = true;
+      }
+    }
+  });
+
+  return prunable;
+}
+
 std::set<ChunkID> compute_chunk_exclude_list(const PredicatePruningChain& predicate_pruning_chain,
                                              const std::shared_ptr<StoredTableNode>& stored_table_node) {
   auto pruned_chunk_ids_by_predicate_node_cache =
@@ -148,6 +236,17 @@ std::set<ChunkID> compute_chunk_exclude_list(
     const auto predicate_without_column_pruning = expression_copy_and_adapt_to_different_lqp(
         predicate, {{stored_table_node, stored_table_node_without_column_pruning}});
 
+    if (const auto in_expression = std::dynamic_pointer_cast<InExpression>(predicate_without_column_pruning)) {
+      const auto in_list_excluded_chunk_ids = compute_chunk_exclude_list_for_in_list(
+          *in_expression, *stored_table_node_without_column_pruning, stored_table_node);
+      if (in_list_excluded_chunk_ids) {
+        excluded_chunk_ids_by_predicate_node.emplace(std::make_pair(stored_table_node, predicate_node),
+                                                     *in_list_excluded_chunk_ids);
+        excluded_chunk_ids.insert(in_list_excluded_chunk_ids->begin(), in_list_excluded_chunk_ids->end());
+        continue;
+      }
+    }
+
     // OperatorScanPredicate::from_expression cannot translate predicates that contain subqueries, even though they do
     // not influence other predicates. Thus, we replace subquery expressions by placeholders. Doing so, we can build a
     // predicate that will simply be skipped for pruning rather than abort and do not prune at all.
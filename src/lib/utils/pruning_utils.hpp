@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <set>
 #include <unordered_map>
 #include <utility>
@@ -8,10 +9,12 @@
 
 #include <boost/container_hash/hash.hpp>
 
+#include "all_type_variant.hpp"
 #include "types.hpp"
 
 namespace hyrise {
 
+class BaseAttributeStatistics;
 class StoredTableNode;
 class TableStatistics;
 struct OperatorScanPredicate;
@@ -30,6 +33,12 @@ std::set<ChunkID> compute_chunk_exclude_list(
 std::set<ChunkID> compute_chunk_exclude_list(const PredicatePruningChain& predicate_pruning_chain,
                                              const std::shared_ptr<StoredTableNode>& stored_table_node);
 
+// Checks whether any of the statistics objects available for a segment (see Chunk::pruning_statistics()) guarantee that
+// no value of the segment satisfies the predicate. The caller is responsible for casting the values to the segment's
+// data type.
+bool can_prune(const BaseAttributeStatistics& segment_statistics, const PredicateCondition predicate_condition,
+               const AllTypeVariant& variant_value, const std::optional<AllTypeVariant>& variant_value2 = std::nullopt);
+
 std::shared_ptr<TableStatistics> prune_table_statistics(const TableStatistics& old_statistics,
                                                         OperatorScanPredicate predicate, size_t num_rows_pruned);
 
@@ -15,6 +15,7 @@
 #include "storage/table_column_definition.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
+#include "utils/date_time_utils.hpp"
 #include "utils/load_table.hpp"
 
 namespace {
@@ -252,6 +253,7 @@ void SQLiteWrapper::create_sqlite_table(const Table& table, const std::string& t
         column_types.emplace_back("REAL");
         break;
       case DataType::String:
+      case DataType::Date:
         column_types.emplace_back("TEXT");
         break;
       case DataType::Null:
@@ -340,6 +342,13 @@ void SQLiteWrapper::create_sqlite_table(const Table& table, const std::string& t
               sqlite3_bind_return_code = sqlite3_bind_text(insert_into_statement, sqlite_column_id, string_value.c_str(), static_cast<int>(string_value.size()), SQLITE_TRANSIENT);  // NOLINT
               // clang-format on
             } break;
+            case DataType::Date: {
+              // SQLite has no date type. Dates are stored as ISO 8601 strings, which compare like the dates.
+              const auto date_string = days_to_date_string(boost::get<int32_t>(value));
+              // clang-format off
+              sqlite3_bind_return_code = sqlite3_bind_text(insert_into_statement, sqlite_column_id, date_string.c_str(), static_cast<int>(date_string.size()), SQLITE_TRANSIENT);  // NOLINT
+              // clang-format on
+            } break;
             case DataType::Null:
               Fail("SQLiteWrapper: column type not supported.");
               break;
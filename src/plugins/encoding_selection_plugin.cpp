@@ -0,0 +1,315 @@
+#include "encoding_selection_plugin.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "hyrise.hpp"
+#include "storage/abstract_segment.hpp"
+#include "storage/chunk.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/encoding_type.hpp"
+#include "storage/segment_access_counter.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "storage/table.hpp"
+#include "storage/vector_compression/vector_compression.hpp"
+#include "types.hpp"
+#include "utils/abstract_plugin.hpp"
+#include "utils/assert.hpp"
+#include "utils/format_bytes.hpp"
+#include "utils/log_manager.hpp"
+#include "utils/pausable_loop_thread.hpp"
+
+namespace hyrise {
+
+EncodingSelectionPlugin::MemoryBudgetSetting::MemoryBudgetSetting()
+    : AbstractSetting("EncodingSelectionPlugin.MemoryBudget"),
+      _value{std::to_string(std::numeric_limits<size_t>::max())},
+      _budget{std::numeric_limits<size_t>::max()} {}
+
+const std::string& EncodingSelectionPlugin::MemoryBudgetSetting::description() const {
+  static const auto description = std::string{"Memory budget in bytes for all segments of immutable chunks"};
+  return description;
+}
+
+const std::string& EncodingSelectionPlugin::MemoryBudgetSetting::get() {
+  return _value;
+}
+
+void EncodingSelectionPlugin::MemoryBudgetSetting::set(const std::string& value) {
+  AssertInput(!value.empty() && std::all_of(value.cbegin(), value.cend(), ::isdigit),
+              "Memory budget must be a number of bytes, got '" + value + "'.");
+  _budget = std::stoull(value);
+  _value = value;
+}
+
+size_t EncodingSelectionPlugin::MemoryBudgetSetting::budget() const {
+  return _budget;
+}
+
+EncodingSelectionPlugin::EncodingSelectionPlugin() : _memory_budget_setting{std::make_shared<MemoryBudgetSetting>()} {}
+
+std::string EncodingSelectionPlugin::description() const {
+  return "Workload-driven encoding selection plugin";
+}
+
+void EncodingSelectionPlugin::start() {
+  _memory_budget_setting->register_at_settings_manager();
+
+  _loop_thread = std::make_unique<PausableLoopThread>(IDLE_DELAY_ENCODING_SELECTION, [&](size_t /*unused*/) {
+    _select_and_apply_encodings();
+  });
+}
+
+void EncodingSelectionPlugin::stop() {
+  // Call destructor of PausableLoopThread to terminate its thread.
+  _loop_thread.reset();
+  _memory_budget_setting->unregister_at_settings_manager();
+
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  _segment_states.clear();
+}
+
+std::vector<std::pair<PluginFunctionName, PluginFunctionPointer>>
+EncodingSelectionPlugin::provided_user_executable_functions() {
+  return {{"SelectEncodings", [&]() {
+             _select_and_apply_encodings();
+           }}};
+}
+
+SegmentEncodingSpec EncodingSelectionPlugin::compact_encoding_spec(const DataType data_type) {
+  auto encoding_type = EncodingType::Dictionary;
+  switch (data_type) {
+    case DataType::Int:
+    case DataType::Long:
+    case DataType::Date:
+      encoding_type = EncodingType::FrameOfReference;
+      break;
+    case DataType::Float:
+    case DataType::Double:
+      encoding_type = EncodingType::ALP;
+      break;
+    case DataType::String:
+      encoding_type = EncodingType::FSST;
+      break;
+    case DataType::Null:
+      Fail("Segments of type Null cannot be encoded.");
+  }
+
+  if (!encoding_supports_data_type(encoding_type, data_type)) {
+    encoding_type = EncodingType::Dictionary;
+  }
+  return SegmentEncodingSpec{encoding_type, VectorCompressionType::BitPacking};
+}
+
+SegmentEncodingSpec EncodingSelectionPlugin::fast_encoding_spec(const DataType /*data_type*/) {
+  return SegmentEncodingSpec{EncodingType::Dictionary, VectorCompressionType::FixedWidthInteger};
+}
+
+std::vector<SegmentEncodingSpec> EncodingSelectionPlugin::candidate_encoding_specs(const DataType data_type) {
+  auto encoding_specs = std::vector<SegmentEncodingSpec>{compact_encoding_spec(data_type)};
+  for (const auto& encoding_spec : {SegmentEncodingSpec{EncodingType::Dictionary, VectorCompressionType::BitPacking},
+                                    fast_encoding_spec(data_type)}) {
+    if (std::find(encoding_specs.cbegin(), encoding_specs.cend(), encoding_spec) == encoding_specs.cend()) {
+      encoding_specs.push_back(encoding_spec);
+    }
+  }
+  return encoding_specs;
+}
+
+uint64_t EncodingSelectionPlugin::weighted_access_count(const SegmentAccessCounter& access_counter) {
+  using AccessType = SegmentAccessCounter::AccessType;
+  const auto random_accesses =
+      access_counter[AccessType::Point] + access_counter[AccessType::Monotonic] + access_counter[AccessType::Random];
+  const auto sequential_accesses = access_counter[AccessType::Sequential] + access_counter[AccessType::Dictionary];
+  return (RANDOM_ACCESS_WEIGHT * random_accesses) + sequential_accesses;
+}
+
+size_t EncodingSelectionPlugin::_memory_budget() const {
+  return _memory_budget_setting->budget();
+}
+
+size_t EncodingSelectionPlugin::_select_and_apply_encodings() {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+
+  struct Candidate {
+    SegmentKey key;
+    std::shared_ptr<Chunk> chunk;
+    DataType data_type;
+    std::shared_ptr<AbstractSegment> segment;
+    SegmentAccessCounter access_counter;
+    SegmentEncodingSpec current_spec;
+    SegmentEncodingSpec baseline_spec;
+    size_t baseline_size;
+    size_t fast_size;
+    double access_score;
+    bool use_fast_encoding;
+  };
+
+  const auto estimate_size = [](const std::shared_ptr<AbstractSegment>& segment, const DataType data_type,
+                                const SegmentEncodingSpec& encoding_spec) {
+    if (get_segment_encoding_spec(segment) == encoding_spec) {
+      return segment->memory_usage(MemoryUsageCalculationMode::Full);
+    }
+    const auto encoded_segment = ChunkEncoder::encode_segment(segment, data_type, encoding_spec);
+    return encoded_segment->memory_usage(MemoryUsageCalculationMode::Full);
+  };
+
+  // States of segments that no longer exist are dropped by only keeping the states of segments visited in this run.
+  auto segment_states = std::map<SegmentKey, SegmentState>{};
+  auto candidates = std::vector<Candidate>{};
+  auto estimated_size = size_t{0};
+
+  for (const auto& [table_name, table] : Hyrise::get().storage_manager.tables()) {
+    const auto chunk_count = table->chunk_count();
+    const auto column_count = table->column_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto& chunk = table->get_chunk(chunk_id);
+      // Skip physically deleted chunks and chunks that are still being filled.
+      if (!chunk || chunk->is_mutable()) {
+        continue;
+      }
+
+      for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+        const auto segment = chunk->get_segment(column_id);
+        const auto data_type = table->column_data_type(column_id);
+        auto key = SegmentKey{table_name, chunk_id, column_id};
+
+        // Take a snapshot of the counters before estimating sizes, as encoding a segment accesses it as well.
+        auto access_counter = segment->access_counter;
+        const auto access_count = weighted_access_count(access_counter);
+
+        const auto state_it = _segment_states.find(key);
+        if (state_it == _segment_states.end() || state_it->second.segment.lock() != segment) {
+          // The segment is only observed in this run (see header).
+          auto state = SegmentState{};
+          state.segment = segment;
+          state.access_count = access_count;
+          segment_states.emplace(key, std::move(state));
+          estimated_size += segment->memory_usage(MemoryUsageCalculationMode::Full);
+          continue;
+        }
+
+        auto state = state_it->second;
+        const auto accesses_since_last_run = access_count - std::min(access_count, state.access_count);
+        state.access_score =
+            (state.access_score * ACCESS_SCORE_DECAY) + static_cast<double>(accesses_since_last_run);
+
+        const auto encoding_size = [&](const SegmentEncodingSpec& encoding_spec) {
+          for (const auto& [cached_encoding_spec, size] : state.encoding_sizes) {
+            if (cached_encoding_spec == encoding_spec) {
+              return size;
+            }
+          }
+          const auto size = estimate_size(segment, data_type, encoding_spec);
+          state.encoding_sizes.emplace_back(encoding_spec, size);
+          return size;
+        };
+
+        // The current encoding is the baseline unless a candidate is considerably smaller.
+        const auto current_spec = get_segment_encoding_spec(segment);
+        const auto current_size = encoding_size(current_spec);
+        auto smallest_spec = current_spec;
+        auto smallest_size = current_size;
+        for (const auto& encoding_spec : candidate_encoding_specs(data_type)) {
+          const auto size = encoding_size(encoding_spec);
+          if (size < smallest_size) {
+            smallest_spec = encoding_spec;
+            smallest_size = size;
+          }
+        }
+
+        auto baseline_spec = current_spec;
+        auto baseline_size = current_size;
+        if (static_cast<double>(smallest_size) <= (1.0 - MIN_SIZE_REDUCTION) * static_cast<double>(current_size)) {
+          baseline_spec = smallest_spec;
+          baseline_size = smallest_size;
+        }
+
+        estimated_size += baseline_size;
+        candidates.emplace_back(Candidate{key, chunk, data_type, segment, std::move(access_counter), current_spec,
+                                          baseline_spec, baseline_size, encoding_size(fast_encoding_spec(data_type)),
+                                          state.access_score, false});
+        segment_states.emplace(std::move(key), std::move(state));
+      }
+    }
+  }
+
+  // Upgrade accessed segments in the order of their access scores per additional byte while the budget allows it.
+  // Segments for which the fast encoding is not larger than the baseline always come first. Segments that already use
+  // the fast encoding keep it with a lower score.
+  const auto additional_size = [&](const Candidate& candidate) {
+    return candidate.fast_size - std::min(candidate.fast_size, candidate.baseline_size);
+  };
+
+  auto accessed_candidates = std::vector<Candidate*>{};
+  for (auto& candidate : candidates) {
+    const auto minimum_score =
+        candidate.current_spec == fast_encoding_spec(candidate.data_type) ? KEEP_ACCESS_SCORE : UPGRADE_ACCESS_SCORE;
+    if (candidate.access_score >= minimum_score) {
+      accessed_candidates.push_back(&candidate);
+    }
+  }
+
+  std::sort(accessed_candidates.begin(), accessed_candidates.end(), [&](const auto* lhs, const auto* rhs) {
+    // Compare lhs_score / lhs_size > rhs_score / rhs_size without dividing by zero.
+    return lhs->access_score * static_cast<double>(additional_size(*rhs)) >
+           rhs->access_score * static_cast<double>(additional_size(*lhs));
+  });
+
+  const auto memory_budget = _memory_budget();
+  for (auto* candidate : accessed_candidates) {
+    const auto candidate_additional_size = additional_size(*candidate);
+    if (candidate_additional_size == 0 || estimated_size + candidate_additional_size <= memory_budget) {
+      candidate->use_fast_encoding = true;
+      estimated_size += candidate_additional_size;
+    }
+  }
+
+  // Re-encode all segments whose encoding changes. Chunk::replace_segment() swaps the segment atomically, so that
+  // concurrently running operators either see the previous or the new segment.
+  auto reencoded_segment_count = size_t{0};
+  for (auto& candidate : candidates) {
+    auto& state = segment_states[candidate.key];
+    const auto encoding_spec =
+        candidate.use_fast_encoding ? fast_encoding_spec(candidate.data_type) : candidate.baseline_spec;
+    const auto column_id = std::get<2>(candidate.key);
+
+    if (candidate.current_spec != encoding_spec) {
+      const auto encoded_segment = ChunkEncoder::encode_segment(candidate.segment, candidate.data_type, encoding_spec);
+      encoded_segment->access_counter = candidate.access_counter;
+      candidate.chunk->replace_segment(column_id, encoded_segment);
+      state.segment = encoded_segment;
+      state.access_count = weighted_access_count(candidate.access_counter);
+      ++reencoded_segment_count;
+      continue;
+    }
+
+    // Accesses caused by estimating the sizes are not counted as accesses of the workload.
+    state.access_count = weighted_access_count(candidate.segment->access_counter);
+  }
+
+  _segment_states = std::move(segment_states);
+
+  if (reencoded_segment_count > 0) {
+    Hyrise::get().log_manager.add_message("EncodingSelectionPlugin",
+                                          "Re-encoded " + std::to_string(reencoded_segment_count) +
+                                              " segment(s), estimated size is " + format_bytes(estimated_size),
+                                          LogLevel::Info);
+  }
+
+  return reencoded_segment_count;
+}
+
+EXPORT_PLUGIN(EncodingSelectionPlugin);
+
+}  // namespace hyrise
@@ -0,0 +1,135 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "storage/abstract_segment.hpp"
+#include "storage/encoding_type.hpp"
+#include "storage/segment_access_counter.hpp"
+#include "types.hpp"
+#include "utils/abstract_plugin.hpp"
+#include "utils/pausable_loop_thread.hpp"
+#include "utils/settings/abstract_setting.hpp"
+
+namespace hyrise {
+
+/**
+ * Hand-tuned encodings per table do not adapt when the workload changes. This plugin periodically re-encodes the
+ * segments of immutable chunks based on how they were accessed in the previous runs.
+ *
+ * For every segment, the plugin considers a set of candidate encodings: the segment's current encoding, a compact
+ * encoding for its data type (FrameOfReference, ALP, or FSST with bit-packing), Dictionary with bit-packing, and the
+ * fast encoding (Dictionary with fixed-width integers). The smallest candidate is the segment's baseline. Switching to
+ * a smaller baseline only pays off if it saves at least MIN_SIZE_REDUCTION of the current size. Afterwards, accessed
+ * segments are upgraded to the fast encoding in the order of their access scores per additional byte, as long as the
+ * estimated size of all segments stays within the memory budget. The budget can be changed via the
+ * EncodingSelectionPlugin.MemoryBudget setting (in bytes, unlimited by default).
+ *
+ * The access score of a segment is the sum of its accesses in all runs, where the accesses of each previous run are
+ * weighted by ACCESS_SCORE_DECAY. Random accesses are weighted higher than sequential accesses as they suffer more from
+ * compact encodings. Segments are upgraded if their score reaches UPGRADE_ACCESS_SCORE and keep the fast encoding until
+ * it drops below KEEP_ACCESS_SCORE. Thus, intermittently accessed segments do not alternate between encodings.
+ *
+ * Segments that the plugin has not seen before are not re-encoded in the same run. Their access counters serve as the
+ * baseline for the next run, so that accesses from before the plugin was started (e.g., by encoding the table) do not
+ * count, and loading the plugin does not re-encode the entire database at once.
+ *
+ * The sizes of the candidate encodings are estimated by encoding the segment once and cached afterwards, as the data
+ * of immutable chunks does not change.
+ */
+class EncodingSelectionPlugin : public AbstractPlugin {
+  friend class EncodingSelectionPluginTest;
+
+ public:
+  EncodingSelectionPlugin();
+
+  std::string description() const final;
+
+  void start() final;
+
+  void stop() final;
+
+  std::vector<std::pair<PluginFunctionName, PluginFunctionPointer>> provided_user_executable_functions() final;
+
+  /**
+   * IDLE_DELAY_ENCODING_SELECTION: sleep between two runs of the encoding selection.
+   * RANDOM_ACCESS_WEIGHT: weight of point, monotonic, and random accesses compared to sequential accesses.
+   * ACCESS_SCORE_DECAY: weight of the previous access score in each run.
+   * UPGRADE_ACCESS_SCORE / KEEP_ACCESS_SCORE: minimum access scores to upgrade to or to keep the fast encoding.
+   * MIN_SIZE_REDUCTION: minimum share of the current size that a smaller baseline encoding must save.
+   */
+  constexpr static std::chrono::milliseconds IDLE_DELAY_ENCODING_SELECTION = std::chrono::milliseconds(10'000);
+  constexpr static uint64_t RANDOM_ACCESS_WEIGHT = 10;
+  constexpr static double ACCESS_SCORE_DECAY = 0.5;
+  constexpr static double UPGRADE_ACCESS_SCORE = 1.0;
+  constexpr static double KEEP_ACCESS_SCORE = 0.25;
+  constexpr static double MIN_SIZE_REDUCTION = 0.2;
+
+  static SegmentEncodingSpec compact_encoding_spec(const DataType data_type);
+  static SegmentEncodingSpec fast_encoding_spec(const DataType data_type);
+
+  // Encodings that are considered in addition to the current encoding of a segment, without duplicates.
+  static std::vector<SegmentEncodingSpec> candidate_encoding_specs(const DataType data_type);
+
+  static uint64_t weighted_access_count(const SegmentAccessCounter& access_counter);
+
+ protected:
+  // Identifies a segment by table name, chunk ID, and column ID.
+  using SegmentKey = std::tuple<std::string, ChunkID, ColumnID>;
+
+  struct SegmentState {
+    // The segment the state belongs to. If the stored segment differs from the current one (e.g., because the table
+    // was replaced or the segment was re-encoded by someone else), the state is discarded.
+    std::weak_ptr<const AbstractSegment> segment;
+
+    // Weighted access count at the end of the previous run.
+    uint64_t access_count{0};
+
+    // Decayed weighted access count of all runs (see above).
+    double access_score{0.0};
+
+    // Cached estimated sizes of the segment in the given encodings.
+    std::vector<std::pair<SegmentEncodingSpec, size_t>> encoding_sizes;
+  };
+
+  // Chooses and applies encodings for all immutable chunks once. Returns the number of re-encoded segments.
+  size_t _select_and_apply_encodings();
+
+  size_t _memory_budget() const;
+
+  std::unique_ptr<PausableLoopThread> _loop_thread;
+
+  // Guards _segment_states, as runs can also be triggered by the user-executable function.
+  std::mutex _mutex;
+  std::map<SegmentKey, SegmentState> _segment_states;
+
+ private:
+  class MemoryBudgetSetting : public AbstractSetting {
+   public:
+    MemoryBudgetSetting();
+
+    const std::string& description() const final;
+
+    const std::string& get() final;
+
+    void set(const std::string& value) final;
+
+    size_t budget() const;
+
+   private:
+    std::string _value;
+    std::atomic<size_t> _budget;
+  };
+
+  std::shared_ptr<MemoryBudgetSetting> _memory_budget_setting;
+};
+
+}  // namespace hyrise
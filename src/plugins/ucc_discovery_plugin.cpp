@@ -168,6 +168,9 @@ void UccDiscoveryPlugin::_validate_ucc_candidates(const UccCandidates& ucc_candi
 
   Hyrise::get().default_lqp_cache->clear();
   Hyrise::get().default_pqp_cache->clear();
+  if (Hyrise::get().prepared_pqp_cache) {
+    Hyrise::get().prepared_pqp_cache->clear();
+  }
 }
 
 template <typename ColumnDataType>
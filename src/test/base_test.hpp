@@ -106,6 +106,8 @@ const SegmentEncodingSpec all_segment_encoding_specs[]{
     SegmentEncodingSpec{EncodingType::FixedStringDictionary, VectorCompressionType::BitPacking},
     SegmentEncodingSpec{EncodingType::FrameOfReference},
     SegmentEncodingSpec{EncodingType::LZ4},
+    SegmentEncodingSpec{EncodingType::ALP},
+    SegmentEncodingSpec{EncodingType::FSST},
     SegmentEncodingSpec{EncodingType::RunLength}};
 
 template <typename EnumType>
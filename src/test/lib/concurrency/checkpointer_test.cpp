@@ -0,0 +1,199 @@
+#include <filesystem>
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+#include "concurrency/checkpointer.hpp"
+#include "concurrency/log_recovery.hpp"
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/write_ahead_log.hpp"
+#include "hyrise.hpp"
+#include "operators/delete.hpp"
+#include "operators/get_table.hpp"
+#include "operators/insert.hpp"
+#include "operators/maintenance/create_table.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/validate.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/table.hpp"
+#include "utils/load_table.hpp"
+
+namespace hyrise {
+
+class CheckpointerTest : public BaseTest {
+ public:
+  void SetUp() override {
+    checkpoint_directory = test_data_path + "checkpointer_test";
+    std::filesystem::remove_all(checkpoint_directory);
+    log_path = checkpoint_directory + "/log";
+
+    column_definitions.emplace_back("a", DataType::Int, false);
+    column_definitions.emplace_back("b", DataType::String, true);
+
+    values = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{2});
+    values->append({1, pmr_string{"one"}});
+    values->append({2, NULL_VALUE});
+    values->append({3, pmr_string{"three"}});
+  }
+
+  void create_table(const std::string& table_name) {
+    const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+    const auto table_wrapper = std::make_shared<TableWrapper>(Table::create_dummy_table(column_definitions));
+    table_wrapper->execute();
+    const auto create_table = std::make_shared<CreateTable>(table_name, false, table_wrapper);
+    create_table->set_transaction_context(transaction_context);
+    create_table->execute();
+    transaction_context->commit();
+  }
+
+  std::shared_ptr<TransactionContext> insert(const std::string& table_name) {
+    const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+    const auto table_wrapper = std::make_shared<TableWrapper>(values);
+    table_wrapper->execute();
+    const auto insert = std::make_shared<Insert>(table_name, table_wrapper);
+    insert->set_transaction_context(transaction_context);
+    insert->execute();
+    return transaction_context;
+  }
+
+  void delete_rows(const std::string& table_name, const int32_t value) {
+    const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+    const auto get_table = std::make_shared<GetTable>(table_name);
+    const auto validate = std::make_shared<Validate>(get_table);
+    const auto table_scan = create_table_scan(validate, ColumnID{0}, PredicateCondition::LessThanEquals, value);
+    const auto delete_operator = std::make_shared<Delete>(table_scan);
+    delete_operator->set_transaction_context(transaction_context);
+    execute_all({get_table, validate, table_scan, delete_operator});
+    transaction_context->commit();
+  }
+
+  std::shared_ptr<const Table> validated_table(const std::string& table_name) {
+    const auto get_table = std::make_shared<GetTable>(table_name);
+    const auto validate = std::make_shared<Validate>(get_table);
+    validate->set_transaction_context(Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::Yes));
+    execute_all({get_table, validate});
+    return validate->get_output();
+  }
+
+  std::string checkpoint_directory;
+  std::string log_path;
+  TableColumnDefinitions column_definitions;
+  std::shared_ptr<Table> values;
+};
+
+TEST_F(CheckpointerTest, LoadEncodedChunks) {
+  const auto table = load_table("resources/test_data/tbl/int_float.tbl", ChunkOffset{2});
+  ChunkEncoder::encode_chunks(table, {ChunkID{0}}, SegmentEncodingSpec{EncodingType::Dictionary});
+  Hyrise::get().storage_manager.add_table("t", table);
+
+  const auto commit_id = Checkpointer{checkpoint_directory}.checkpoint();
+  EXPECT_EQ(commit_id, Hyrise::get().transaction_manager.last_commit_id());
+
+  Hyrise::reset();
+  EXPECT_EQ(Checkpointer{checkpoint_directory}.load(), commit_id);
+  EXPECT_EQ(Hyrise::get().transaction_manager.last_commit_id(), commit_id);
+
+  const auto recovered_table = Hyrise::get().storage_manager.get_table("t");
+  EXPECT_TABLE_EQ_ORDERED(recovered_table, table);
+  ASSERT_EQ(recovered_table->chunk_count(), 2);
+  const auto chunk = recovered_table->get_chunk(ChunkID{0});
+  EXPECT_FALSE(chunk->is_mutable());
+  EXPECT_TRUE(std::dynamic_pointer_cast<const DictionarySegment<int32_t>>(chunk->get_segment(ColumnID{0})));
+  EXPECT_TABLE_EQ_ORDERED(validated_table("t"), table);
+}
+
+TEST_F(CheckpointerTest, OnlyRewriteChangedChunks) {
+  const auto table = load_table("resources/test_data/tbl/int_float.tbl", ChunkOffset{2});
+  Hyrise::get().storage_manager.add_table("t", table);
+  const auto table_directory = std::filesystem::path{checkpoint_directory} / "tables" / "0";
+
+  auto checkpointer = Checkpointer{checkpoint_directory};
+  checkpointer.checkpoint();
+  checkpointer.checkpoint();
+  EXPECT_TRUE(std::filesystem::exists(table_directory / "0_1.bin"));
+  EXPECT_TRUE(std::filesystem::exists(table_directory / "1_1.bin"));
+  EXPECT_FALSE(std::filesystem::exists(table_directory / "0_2.bin"));
+
+  // Only the data of the encoded chunk is written again. The previous file is removed.
+  ChunkEncoder::encode_chunks(table, {ChunkID{1}}, SegmentEncodingSpec{EncodingType::Dictionary});
+  checkpointer.checkpoint();
+  EXPECT_TRUE(std::filesystem::exists(table_directory / "0_1.bin"));
+  EXPECT_TRUE(std::filesystem::exists(table_directory / "1_3.bin"));
+  EXPECT_TRUE(std::filesystem::exists(table_directory / "1_1.mvcc"));
+  EXPECT_FALSE(std::filesystem::exists(table_directory / "1_1.bin"));
+
+  // Dropped tables are removed from the checkpoint.
+  Hyrise::get().storage_manager.drop_table("t");
+  checkpointer.checkpoint();
+  EXPECT_FALSE(std::filesystem::exists(table_directory));
+}
+
+TEST_F(CheckpointerTest, RecoverLogTail) {
+  Hyrise::get().write_ahead_log = std::make_shared<WriteAheadLog>(log_path);
+  create_table("t");
+  insert("t")->commit();
+
+  // The Insert commits after the checkpoint has been taken. Its rows are not part of the checkpoint.
+  auto checkpoint_commit_id = CommitID{0};
+  {
+    const auto pending_transaction_context = insert("t");
+    checkpoint_commit_id = Checkpointer{checkpoint_directory}.checkpoint();
+    pending_transaction_context->commit();
+  }
+
+  insert("t")->commit();
+  delete_rows("t", 2);
+  const auto last_commit_id = Hyrise::get().transaction_manager.last_commit_id();
+  EXPECT_EQ(last_commit_id, checkpoint_commit_id + 3);
+
+  // Without the log, the checkpoint holds the first Insert only.
+  Hyrise::reset();
+  EXPECT_EQ(Checkpointer{checkpoint_directory}.load(), checkpoint_commit_id);
+  EXPECT_EQ(Hyrise::get().storage_manager.get_table("t")->row_count(), 6);
+  EXPECT_EQ(validated_table("t")->row_count(), 3);
+
+  Hyrise::reset();
+  Checkpointer{checkpoint_directory}.load();
+  EXPECT_EQ(LogRecovery::recover(log_path), last_commit_id);
+
+  const auto expected_table = std::make_shared<Table>(column_definitions, TableType::Data);
+  expected_table->append({3, pmr_string{"three"}});
+  expected_table->append({3, pmr_string{"three"}});
+  expected_table->append({3, pmr_string{"three"}});
+  EXPECT_TABLE_EQ_UNORDERED(validated_table("t"), expected_table);
+  EXPECT_EQ(Hyrise::get().storage_manager.get_table("t")->row_count(), 9);
+}
+
+TEST_F(CheckpointerTest, RemoveLogSegmentsCoveredByCheckpoint) {
+  Hyrise::get().write_ahead_log = std::make_shared<WriteAheadLog>(log_path);
+  auto checkpointer = Checkpointer{checkpoint_directory};
+  create_table("t");
+  create_table("u");
+  insert("t")->commit();
+
+  // The checkpoint covers all entries, so the rotated segment is removed.
+  checkpointer.checkpoint();
+  ASSERT_EQ(WriteAheadLog::segments(log_path).size(), 1);
+  EXPECT_EQ(std::filesystem::file_size(log_path), 0);
+
+  // The DropTable entry carries the checkpoint commit ID. It might not be reflected by the checkpoint and is kept.
+  insert("t")->commit();
+  Hyrise::get().storage_manager.drop_table("u");
+  Hyrise::get().write_ahead_log->log_drop_table("u");
+  checkpointer.checkpoint();
+  EXPECT_EQ(WriteAheadLog::segments(log_path).size(), 2);
+
+  insert("t")->commit();
+  const auto last_commit_id = Hyrise::get().transaction_manager.last_commit_id();
+  checkpointer.checkpoint();
+  EXPECT_EQ(WriteAheadLog::segments(log_path).size(), 1);
+
+  Hyrise::reset();
+  Checkpointer{checkpoint_directory}.load();
+  EXPECT_EQ(LogRecovery::recover(log_path), last_commit_id);
+  EXPECT_FALSE(Hyrise::get().storage_manager.has_table("u"));
+  EXPECT_EQ(validated_table("t")->row_count(), 9);
+}
+
+}  // namespace hyrise
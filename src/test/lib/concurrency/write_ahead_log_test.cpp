@@ -0,0 +1,275 @@
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "base_test.hpp"
+#include "concurrency/log_entry.hpp"
+#include "concurrency/log_recovery.hpp"
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/write_ahead_log.hpp"
+#include "hyrise.hpp"
+#include "operators/delete.hpp"
+#include "operators/get_table.hpp"
+#include "operators/insert.hpp"
+#include "operators/maintenance/create_table.hpp"
+#include "operators/maintenance/drop_table.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/validate.hpp"
+#include "storage/table.hpp"
+
+namespace hyrise {
+
+class WriteAheadLogTest : public BaseTest {
+ public:
+  void SetUp() override {
+    log_path = test_data_path + "write_ahead_log_test.log";
+    for (const auto& segment_path : WriteAheadLog::segments(log_path)) {
+      std::filesystem::remove(segment_path);
+    }
+
+    column_definitions.emplace_back("a", DataType::Int, false);
+    column_definitions.emplace_back("b", DataType::String, true);
+
+    values = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{2});
+    values->append({1, pmr_string{"one"}});
+    values->append({2, NULL_VALUE});
+    values->append({3, pmr_string{"three"}});
+
+    Hyrise::get().write_ahead_log = std::make_shared<WriteAheadLog>(log_path);
+  }
+
+  void create_table(const std::string& table_name) {
+    const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+    const auto table_wrapper = std::make_shared<TableWrapper>(Table::create_dummy_table(column_definitions));
+    table_wrapper->execute();
+    const auto create_table = std::make_shared<CreateTable>(table_name, false, table_wrapper);
+    create_table->set_transaction_context(transaction_context);
+    create_table->execute();
+    transaction_context->commit();
+  }
+
+  std::shared_ptr<TransactionContext> insert(const std::string& table_name, const AutoCommit auto_commit) {
+    const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(auto_commit);
+    const auto table_wrapper = std::make_shared<TableWrapper>(values);
+    table_wrapper->execute();
+    const auto insert = std::make_shared<Insert>(table_name, table_wrapper);
+    insert->set_transaction_context(transaction_context);
+    insert->execute();
+    return transaction_context;
+  }
+
+  // Deletes all rows of the given table with a value less than or equal to the given value in column a.
+  void delete_rows(const std::string& table_name, const int32_t value) {
+    const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+    const auto get_table = std::make_shared<GetTable>(table_name);
+    const auto validate = std::make_shared<Validate>(get_table);
+    const auto table_scan = create_table_scan(validate, ColumnID{0}, PredicateCondition::LessThanEquals, value);
+    const auto delete_operator = std::make_shared<Delete>(table_scan);
+    delete_operator->set_transaction_context(transaction_context);
+    execute_all({get_table, validate, table_scan, delete_operator});
+    transaction_context->commit();
+  }
+
+  // Simulates a restart: all in-memory state is lost and the log is replayed.
+  CommitID restart_and_recover() {
+    Hyrise::reset();
+    return LogRecovery::recover(log_path);
+  }
+
+  std::string log_path;
+  TableColumnDefinitions column_definitions;
+  std::shared_ptr<Table> values;
+};
+
+TEST_F(WriteAheadLogTest, CommitIsVisibleAfterEntryIsPersisted) {
+  // The table is created within a transaction and logged as part of its commit.
+  create_table("t");
+  const auto& write_ahead_log = Hyrise::get().write_ahead_log;
+  EXPECT_EQ(write_ahead_log->persisted_entry_count(), 1);
+
+  const auto transaction_context = insert("t", AutoCommit::No);
+  transaction_context->commit();
+
+  EXPECT_EQ(transaction_context->phase(), TransactionPhase::Committed);
+  EXPECT_EQ(Hyrise::get().transaction_manager.last_commit_id(), transaction_context->commit_id());
+  EXPECT_EQ(write_ahead_log->persisted_entry_count(), 2);
+  EXPECT_EQ(write_ahead_log->persisted_bytes(), std::filesystem::file_size(log_path));
+}
+
+TEST_F(WriteAheadLogTest, ConcurrentEntriesShareFlushes) {
+  // Entries that arrive within the group commit window are persisted with a single fdatasync.
+  const auto group_commit_log_path = test_data_path + "group_commit_test.log";
+  for (const auto& segment_path : WriteAheadLog::segments(group_commit_log_path)) {
+    std::filesystem::remove(segment_path);
+  }
+  const auto write_ahead_log = std::make_unique<WriteAheadLog>(group_commit_log_path, std::chrono::milliseconds{1});
+  constexpr auto THREAD_COUNT = 8;
+  constexpr auto ENTRIES_PER_THREAD = 100;
+
+  auto persisted_count = std::atomic<uint32_t>{0};
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_id = 0; thread_id < THREAD_COUNT; ++thread_id) {
+    threads.emplace_back([&]() {
+      for (auto entry_id = 0; entry_id < ENTRIES_PER_THREAD; ++entry_id) {
+        auto entry = LogEntryWriter{LogEntryType::DropTable, CommitID{1}};
+        entry.write_string("t");
+        write_ahead_log->append(entry.finish(), [&]() {
+          ++persisted_count;
+        });
+      }
+    });
+  }
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  while (persisted_count < THREAD_COUNT * ENTRIES_PER_THREAD) {
+    std::this_thread::yield();
+  }
+
+  EXPECT_EQ(write_ahead_log->persisted_entry_count(), THREAD_COUNT * ENTRIES_PER_THREAD);
+  EXPECT_LT(write_ahead_log->flush_count(), THREAD_COUNT * ENTRIES_PER_THREAD);
+}
+
+TEST_F(WriteAheadLogTest, RecoverInsertsAndDeletes) {
+  create_table("t");
+  insert("t", AutoCommit::No)->commit();
+  insert("t", AutoCommit::No)->rollback(RollbackReason::User);
+  insert("t", AutoCommit::No)->commit();
+  delete_rows("t", 2);
+
+  const auto last_commit_id = Hyrise::get().transaction_manager.last_commit_id();
+  const auto table = Hyrise::get().storage_manager.get_table("t");
+  const auto chunk_count = table->chunk_count();
+
+  EXPECT_EQ(restart_and_recover(), last_commit_id);
+  EXPECT_EQ(Hyrise::get().transaction_manager.last_commit_id(), last_commit_id);
+
+  const auto recovered_table = Hyrise::get().storage_manager.get_table("t");
+  EXPECT_EQ(recovered_table->column_definitions(), column_definitions);
+  EXPECT_EQ(recovered_table->chunk_count(), chunk_count);
+  EXPECT_EQ(recovered_table->row_count(), 9);
+
+  // The rows of the rolled back Insert are invalidated, deleted rows keep their commit IDs.
+  const auto& mvcc_data = recovered_table->get_chunk(ChunkID{0})->mvcc_data();
+  EXPECT_EQ(mvcc_data->get_begin_cid(ChunkOffset{0}), CommitID{3});
+  EXPECT_EQ(mvcc_data->get_end_cid(ChunkOffset{0}), last_commit_id);
+  EXPECT_EQ(mvcc_data->get_begin_cid(ChunkOffset{2}), CommitID{3});
+  EXPECT_EQ(mvcc_data->get_end_cid(ChunkOffset{2}), MvccData::MAX_COMMIT_ID);
+  EXPECT_EQ(mvcc_data->get_begin_cid(ChunkOffset{3}), CommitID{0});
+  EXPECT_EQ(mvcc_data->get_end_cid(ChunkOffset{3}), CommitID{0});
+  EXPECT_EQ(recovered_table->get_chunk(ChunkID{0})->invalid_row_count(), 7);
+
+  const auto expected_table = std::make_shared<Table>(column_definitions, TableType::Data);
+  expected_table->append({3, pmr_string{"three"}});
+  expected_table->append({3, pmr_string{"three"}});
+
+  {
+    const auto get_table = std::make_shared<GetTable>("t");
+    const auto validate = std::make_shared<Validate>(get_table);
+    const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::Yes);
+    validate->set_transaction_context(transaction_context);
+    execute_all({get_table, validate});
+    EXPECT_TABLE_EQ_UNORDERED(validate->get_output(), expected_table);
+  }
+
+  // New transactions continue after the recovered ones.
+  Hyrise::get().write_ahead_log = std::make_shared<WriteAheadLog>(log_path);
+  {
+    const auto transaction_context = insert("t", AutoCommit::No);
+    transaction_context->commit();
+    EXPECT_EQ(transaction_context->commit_id(), last_commit_id + 1);
+    EXPECT_EQ(recovered_table->row_count(), 12);
+  }
+
+  EXPECT_EQ(restart_and_recover(), last_commit_id + 1);
+  EXPECT_EQ(Hyrise::get().storage_manager.get_table("t")->row_count(), 12);
+}
+
+TEST_F(WriteAheadLogTest, RecoverDroppedTables) {
+  create_table("t");
+  create_table("u");
+  insert("t", AutoCommit::No)->commit();
+  insert("u", AutoCommit::No)->commit();
+
+  const auto drop_table = std::make_shared<DropTable>("t", false);
+  drop_table->execute();
+
+  restart_and_recover();
+  EXPECT_FALSE(Hyrise::get().storage_manager.has_table("t"));
+  ASSERT_TRUE(Hyrise::get().storage_manager.has_table("u"));
+  EXPECT_EQ(Hyrise::get().storage_manager.get_table("u")->row_count(), 3);
+}
+
+TEST_F(WriteAheadLogTest, RecoveryIgnoresTornTail) {
+  create_table("t");
+  insert("t", AutoCommit::No)->commit();
+  const auto persisted_bytes = Hyrise::get().write_ahead_log->persisted_bytes();
+  insert("t", AutoCommit::No)->commit();
+  Hyrise::get().write_ahead_log = nullptr;
+
+  // Simulate a crash during the write of the last entry.
+  std::filesystem::resize_file(log_path, persisted_bytes + 5);
+
+  EXPECT_EQ(restart_and_recover(), CommitID{3});
+  EXPECT_EQ(Hyrise::get().storage_manager.get_table("t")->row_count(), 3);
+}
+
+TEST_F(WriteAheadLogTest, RecoverRotatedSegments) {
+  create_table("t");
+  insert("t", AutoCommit::No)->commit();
+  const auto& write_ahead_log = Hyrise::get().write_ahead_log;
+  write_ahead_log->rotate();
+  insert("t", AutoCommit::No)->commit();
+  const auto drop_table = std::make_shared<DropTable>("t", false);
+  drop_table->execute();
+
+  // The first segment holds the commits 1 and 2. The second one holds commit 3 and the DropTable entry, which is only
+  // covered by checkpoints after commit 3.
+  write_ahead_log->rotate();
+  ASSERT_EQ(WriteAheadLog::segments(log_path).size(), 3);
+  EXPECT_EQ(WriteAheadLog::segments(log_path)[0], std::filesystem::path{log_path + ".0.2"});
+  EXPECT_EQ(WriteAheadLog::segments(log_path)[1], std::filesystem::path{log_path + ".1.4"});
+  EXPECT_EQ(std::filesystem::file_size(log_path), 0);
+
+  // Rotating an empty segment does nothing.
+  write_ahead_log->rotate();
+  EXPECT_EQ(WriteAheadLog::segments(log_path).size(), 3);
+
+  Hyrise::get().write_ahead_log = nullptr;
+  EXPECT_EQ(restart_and_recover(), CommitID{3});
+  EXPECT_FALSE(Hyrise::get().storage_manager.has_table("t"));
+
+  // Segments are removed once a checkpoint covers all of their entries.
+  Hyrise::get().write_ahead_log = std::make_shared<WriteAheadLog>(log_path);
+  Hyrise::get().write_ahead_log->remove_segments(CommitID{3});
+  ASSERT_EQ(WriteAheadLog::segments(log_path).size(), 2);
+  EXPECT_EQ(WriteAheadLog::segments(log_path)[0], std::filesystem::path{log_path + ".1.4"});
+}
+
+TEST_F(WriteAheadLogTest, RecoveryStopsAtMissingCommitID) {
+  create_table("t");
+  Hyrise::get().write_ahead_log = nullptr;
+
+  // The transaction with commit ID 4 has been persisted, but the one with commit ID 3 has not.
+  const auto table = Hyrise::get().storage_manager.get_table("t");
+  auto entry = LogEntryWriter{LogEntryType::Commit, CommitID{4}};
+  table->append({1, pmr_string{"one"}});
+  entry.add_insert("t", *table, ChunkID{0}, ChunkOffset{0}, ChunkOffset{1});
+  const auto serialized_entry = entry.finish();
+  {
+    auto file = std::ofstream{log_path, std::ios::binary | std::ios::app};
+    file.write(serialized_entry.data(), static_cast<std::streamsize>(serialized_entry.size()));
+  }
+
+  EXPECT_EQ(restart_and_recover(), CommitID{2});
+  ASSERT_TRUE(Hyrise::get().storage_manager.has_table("t"));
+  EXPECT_EQ(Hyrise::get().storage_manager.get_table("t")->row_count(), 0);
+}
+
+}  // namespace hyrise
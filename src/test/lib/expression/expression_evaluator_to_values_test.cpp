@@ -840,12 +840,30 @@ TEST_F(ExpressionEvaluatorToValuesTest, ExtractSeries) {
   EXPECT_THROW(test_expression<int32_t>(table_a, *extract_(DatetimeComponent::Day, s1), {}), std::logic_error);
 }
 
+TEST_F(ExpressionEvaluatorToValuesTest, ExtractDateColumn) {
+  // Values of DataType::Date are stored as the number of days since 1970-01-01.
+  const auto table_int_date = load_table("resources/test_data/tbl/int_date.tbl");
+  const auto date_column = PQPColumnExpression::from_table(*table_int_date, "b");
+
+  EXPECT_TRUE(test_expression<int32_t>(table_int_date, *extract_(DatetimeComponent::Year, date_column),
+                                       {1970, 2000, std::nullopt, 1969}));
+  EXPECT_TRUE(test_expression<int32_t>(table_int_date, *extract_(DatetimeComponent::Month, date_column),
+                                       {1, 2, std::nullopt, 12}));
+  EXPECT_TRUE(test_expression<int32_t>(table_int_date, *extract_(DatetimeComponent::Day, date_column),
+                                       {1, 29, std::nullopt, 31}));
+  EXPECT_TRUE(test_expression<double>(table_int_date, *extract_(DatetimeComponent::Second, date_column),
+                                      {0, 0, std::nullopt, 0}));
+}
+
 TEST_F(ExpressionEvaluatorToValuesTest, CastLiterals) {
   EXPECT_TRUE(test_expression<int32_t>(*cast_(5.5, DataType::Int), {5}));
   EXPECT_TRUE(test_expression<float>(*cast_(5.5, DataType::Float), {5.5f}));
   EXPECT_TRUE(test_expression<float>(*cast_(5, DataType::Float), {5.0f}));
   EXPECT_TRUE(test_expression<pmr_string>(*cast_(5.5, DataType::String), {"5.5"}));
   EXPECT_TRUE(test_expression<int32_t>(*cast_(null_(), DataType::Int), {std::nullopt}));
+  // Dates are stored as the number of days since 1970-01-01.
+  EXPECT_TRUE(test_expression<int32_t>(*cast_("2000-02-29", DataType::Date), {11'016}));
+  EXPECT_THROW(test_expression<int32_t>(*cast_("2000-02-30", DataType::Date), {}), std::logic_error);
 
   // Ensure requested data type is cast data type
   EXPECT_THROW(test_expression<int32_t>(*cast_("1.2", DataType::Float), {}), std::logic_error);
@@ -231,6 +231,15 @@ TEST_F(ExpressionUtilsTest, GetValueOrParameter) {
     const auto actual_value = expression_get_value_or_parameter(*cast_column);
     EXPECT_EQ(actual_value, std::nullopt);
   }
+  {
+    // Dates are the number of days since 1970-01-01.
+    const auto cast_as_date = cast_(value_(pmr_string{"2000-01-01"}), DataType::Date);
+    const auto invalid_date = cast_(value_(pmr_string{"2000-02-30"}), DataType::Date);
+    const auto actual_value = expression_get_value_or_parameter(*cast_as_date);
+    EXPECT_NE(actual_value, std::nullopt);
+    EXPECT_EQ(*actual_value, AllTypeVariant{int32_t{10'957}});
+    EXPECT_THROW(expression_get_value_or_parameter(*invalid_date), std::logic_error);
+  }
 }
 
 TEST_F(ExpressionUtilsTest, FindExpressionIDx) {
@@ -1,3 +1,4 @@
+#include <filesystem>
 #include <memory>
 #include <string>
 #include <vector>
@@ -5,8 +6,10 @@
 #include "base_test.hpp"
 #include "hyrise.hpp"
 #include "import_export/binary/binary_parser.hpp"
+#include "import_export/binary/binary_writer.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/encoding_type.hpp"
+#include "utils/load_table.hpp"
 
 namespace hyrise {
 
@@ -361,6 +364,61 @@ TEST_F(BinaryParserTest, FileDoesNotExist) {
   EXPECT_THROW(BinaryParser::parse("not_existing_file"), std::exception);
 }
 
+TEST_F(BinaryParserTest, TruncatedFile) {
+  const auto filename = test_data_path + "binary_parser_truncated.bin";
+  const auto table = load_table("resources/test_data/tbl/int_float.tbl", ChunkOffset{2});
+  BinaryWriter::write(*table, filename);
+  std::filesystem::resize_file(filename, std::filesystem::file_size(filename) - 1);
+
+  EXPECT_THROW(BinaryParser::parse(filename), std::exception);
+}
+
+TEST_F(BinaryParserTest, LargeSegmentsAliasMappedFile) {
+  // The values, dictionaries, and attribute vectors of these segments are large enough to alias the mapped file. They
+  // must stay valid after the file has been parsed.
+  const auto row_count = ChunkOffset{10'000};
+  auto table = std::make_shared<Table>(
+      TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Double, false}, {"c", DataType::Int, false}},
+      TableType::Data, row_count);
+  for (auto row = int32_t{0}; row < static_cast<int32_t>(row_count); ++row) {
+    table->append({row, row * 0.5, row % 7});
+  }
+  table->last_chunk()->set_immutable();
+  ChunkEncoder::encode_all_chunks(table, ChunkEncodingSpec{
+                                             {EncodingType::Dictionary, VectorCompressionType::FixedWidthInteger},
+                                             SegmentEncodingSpec{EncodingType::Unencoded},
+                                             {EncodingType::Dictionary, VectorCompressionType::BitPacking}});
+
+  const auto filename = test_data_path + "binary_parser_large_segments.bin";
+  BinaryWriter::write(*table, filename);
+  const auto parsed_table = BinaryParser::parse(filename);
+  std::filesystem::remove(filename);
+
+  EXPECT_TABLE_EQ_ORDERED(parsed_table, table);
+}
+
+TEST_F(BinaryParserTest, RewriteFileOfLoadedTable) {
+  // Rewriting the file must not affect a table that aliases the mapping of the previous file.
+  const auto row_count = ChunkOffset{10'000};
+  auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data, row_count);
+  for (auto row = int32_t{0}; row < static_cast<int32_t>(row_count); ++row) {
+    table->append({row});
+  }
+  table->last_chunk()->set_immutable();
+
+  const auto filename = test_data_path + "binary_parser_rewrite.bin";
+  BinaryWriter::write(*table, filename);
+  const auto parsed_table = BinaryParser::parse(filename);
+
+  const auto empty_table =
+      std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data, row_count);
+  BinaryWriter::write(*empty_table, filename);
+  EXPECT_EQ(BinaryParser::parse(filename)->row_count(), 0);
+  std::filesystem::remove(filename);
+
+  EXPECT_TABLE_EQ_ORDERED(parsed_table, table);
+}
+
 TEST_F(BinaryParserTest, TwoColumnsNoValues) {
   TableColumnDefinitions column_definitions;
   column_definitions.emplace_back("FirstColumn", DataType::Int, false);
@@ -162,6 +162,19 @@ TEST_F(CsvParserTest, ImportNumericNullValues) {
   EXPECT_TABLE_EQ_ORDERED(table, expected_table);
 }
 
+TEST_F(CsvParserTest, ImportDateValues) {
+  const auto table = CsvParser::parse("resources/test_data/csv/int_date.csv");
+  EXPECT_EQ(table->column_data_type(ColumnID{1}), DataType::Date);
+
+  // Dates are stored as the number of days since 1970-01-01.
+  const auto expected_table = load_table("resources/test_data/tbl/int_date.tbl", ChunkOffset{4});
+  EXPECT_TABLE_EQ_ORDERED(table, expected_table);
+  EXPECT_EQ(table->get_value<int32_t>(ColumnID{1}, 0), 0);
+  EXPECT_EQ(table->get_value<int32_t>(ColumnID{1}, 1), 11'016);
+  EXPECT_FALSE(table->get_value<int32_t>(ColumnID{1}, 2));
+  EXPECT_EQ(table->get_value<int32_t>(ColumnID{1}, 3), -1);
+}
+
 TEST_F(CsvParserTest, ImportStringNullValues) {
   auto table = CsvParser::parse("resources/test_data/csv/string_with_null.csv");
 
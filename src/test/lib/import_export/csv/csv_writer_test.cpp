@@ -6,6 +6,7 @@
 
 #include "base_test.hpp"
 #include "import_export/csv/csv_meta.hpp"
+#include "import_export/csv/csv_parser.hpp"
 #include "import_export/csv/csv_writer.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
@@ -198,6 +199,20 @@ TEST_F(CsvWriterTest, ExportNumericNullValues) {
                            "1234,457.7\n"));
 }
 
+TEST_F(CsvWriterTest, ExportDateValues) {
+  const auto new_table = load_table("resources/test_data/tbl/int_date.tbl", ChunkOffset{4});
+  CsvWriter::write(*new_table, test_filename);
+
+  EXPECT_TRUE(file_exists(test_filename));
+  EXPECT_TRUE(file_exists(test_meta_filename));
+  EXPECT_TRUE(compare_file(test_filename,
+                           "1,1970-01-01\n"
+                           "2,2000-02-29\n"
+                           "3,\n"
+                           "4,1969-12-31\n"));
+  EXPECT_TABLE_EQ_ORDERED(CsvParser::parse(test_filename), new_table);
+}
+
 TEST_F(CsvWriterTest, ExportStringNullValues) {
   auto new_table = load_table("resources/test_data/tbl/string_with_null.tbl", ChunkOffset{4});
   CsvWriter::write(*new_table, test_filename);
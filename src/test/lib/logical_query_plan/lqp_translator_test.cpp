@@ -46,8 +46,10 @@
 #include "operators/sort.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "operators/top_k.hpp"
 #include "operators/union_all.hpp"
 #include "operators/union_positions.hpp"
+#include "operators/window.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/index/group_key/group_key_index.hpp"
 #include "storage/prepared_plan.hpp"
@@ -342,6 +344,35 @@ TEST_F(LQPTranslatorTest, Sort) {
   ASSERT_TRUE(get_table);
 }
 
+TEST_F(LQPTranslatorTest, SortTopK) {
+  /**
+   * Build LQP and translate to PQP.
+   *
+   * LQP resembles:
+   *   SELECT * FROM int_float ORDER BY b DESC LIMIT 10
+   */
+  const auto sort_node = SortNode::make(expression_vector(int_float_b), std::vector<SortMode>{SortMode::Descending},
+                                        size_t{10}, int_float_node);
+  const auto lqp = LimitNode::make(value_(static_cast<int64_t>(10)), sort_node);
+  const auto pqp = LQPTranslator{}.translate_node(lqp);
+
+  /**
+   * Check PQP.
+   */
+  const auto limit = std::dynamic_pointer_cast<const Limit>(pqp);
+  ASSERT_TRUE(limit);
+
+  const auto top_k = std::dynamic_pointer_cast<const TopK>(limit->left_input());
+  ASSERT_TRUE(top_k);
+  EXPECT_EQ(top_k->k(), 10);
+  ASSERT_EQ(top_k->sort_definitions().size(), 1);
+  EXPECT_EQ(top_k->sort_definitions().at(0).column, ColumnID{1});
+  EXPECT_EQ(top_k->sort_definitions().at(0).sort_mode, SortMode::Descending);
+
+  const auto get_table = std::dynamic_pointer_cast<const GetTable>(top_k->left_input());
+  ASSERT_TRUE(get_table);
+}
+
 TEST_F(LQPTranslatorTest, LimitLiteral) {
   /**
    * Build LQP and translate to PQP.
@@ -649,6 +680,11 @@ TEST_F(LQPTranslatorTest, JoinNodeToJoinHash) {
   EXPECT_EQ(join_op->primary_predicate().column_ids, ColumnIDPair(ColumnID{1}, ColumnID{1}));
   EXPECT_EQ(join_op->primary_predicate().predicate_condition, PredicateCondition::Equals);
   EXPECT_EQ(join_op->mode(), JoinMode::Inner);
+
+  // The left input has fewer rows and is published as runtime join filter, also by copies of the PQP.
+  EXPECT_TRUE(join_op->runtime_join_filter_from_left_input());
+  const auto copied_join_op = std::static_pointer_cast<JoinHash>(join_op->deep_copy());
+  EXPECT_TRUE(copied_join_op->runtime_join_filter_from_left_input());
 }
 
 TEST_F(LQPTranslatorTest, JoinNodeToJoinSortMerge) {
@@ -1198,11 +1234,56 @@ TEST_F(LQPTranslatorTest, TranslatePrunableSubqueries) {
 TEST_F(LQPTranslatorTest, WindowNode) {
   auto frame = FrameDescription{FrameType::Range, FrameBound{0, FrameBoundType::Preceding, true},
                                 FrameBound{0, FrameBoundType::CurrentRow, false}};
-  const auto window_function =
-      rank_(window_(expression_vector(), expression_vector(), std::vector<SortMode>{}, std::move(frame)));
+  const auto window_function = sum_(int_float_b, window_(expression_vector(int_float_a), expression_vector(),
+                                                         std::vector<SortMode>{}, std::move(frame)));
   const auto lqp = WindowNode::make(window_function, int_float_node);
 
-  EXPECT_THROW(LQPTranslator{}.translate_node(lqp), InvalidInputException);
+  const auto pqp = LQPTranslator{}.translate_node(lqp);
+  const auto window = std::dynamic_pointer_cast<const Window>(pqp);
+  ASSERT_TRUE(window);
+  EXPECT_EQ(window->partition_by_column_ids(), std::vector<ColumnID>{ColumnID{0}});
+  EXPECT_TRUE(window->order_by_definitions().empty());
+  EXPECT_EQ(window->window_function_expression()->window_function, WindowFunction::Sum);
+  EXPECT_EQ(*window->window_function_expression()->argument(), *pqp_column_(ColumnID{1}, DataType::Float, false, "b"));
+  EXPECT_TRUE(std::dynamic_pointer_cast<const GetTable>(pqp->left_input()));
+}
+
+TEST_F(LQPTranslatorTest, WindowNodeCountStar) {
+  auto frame = FrameDescription{FrameType::Rows, FrameBound{0, FrameBoundType::Preceding, true},
+                                FrameBound{0, FrameBoundType::CurrentRow, false}};
+  const auto window = window_(expression_vector(), expression_vector(int_float_a),
+                              std::vector<SortMode>{SortMode::Ascending}, std::move(frame));
+  const auto lqp =
+      WindowNode::make(std::make_shared<WindowFunctionExpression>(
+                           WindowFunction::Count, lqp_column_(int_float_node, INVALID_COLUMN_ID), window),
+                       int_float_node);
+
+  const auto pqp = std::dynamic_pointer_cast<const Window>(LQPTranslator{}.translate_node(lqp));
+  ASSERT_TRUE(pqp);
+  const auto& window_function = *pqp->window_function_expression();
+  EXPECT_EQ(window_function.window_function, WindowFunction::Count);
+  EXPECT_EQ(window_function.argument()->as_column_name(), "*");
+  EXPECT_TRUE(window_function.window());
+  EXPECT_EQ(pqp->order_by_definitions(), std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}}});
+}
+
+TEST_F(LQPTranslatorTest, WindowNodeUnsupported) {
+  auto range_frame = FrameDescription{FrameType::Range, FrameBound{1, FrameBoundType::Preceding, false},
+                                      FrameBound{0, FrameBoundType::CurrentRow, false}};
+  const auto range_lqp = WindowNode::make(
+      sum_(int_float_b, window_(expression_vector(), expression_vector(int_float_a),
+                                std::vector<SortMode>{SortMode::Ascending}, std::move(range_frame))),
+      int_float_node);
+  EXPECT_THROW(LQPTranslator{}.translate_node(range_lqp), InvalidInputException);
+
+  auto frame = FrameDescription{FrameType::Rows, FrameBound{0, FrameBoundType::Preceding, true},
+                                FrameBound{0, FrameBoundType::CurrentRow, false}};
+  const auto standard_deviation_lqp = WindowNode::make(
+      std::make_shared<WindowFunctionExpression>(
+          WindowFunction::StandardDeviationSample, int_float_b,
+          window_(expression_vector(), expression_vector(), std::vector<SortMode>{}, std::move(frame))),
+      int_float_node);
+  EXPECT_THROW(LQPTranslator{}.translate_node(standard_deviation_lqp), InvalidInputException);
 }
 
 }  // namespace hyrise
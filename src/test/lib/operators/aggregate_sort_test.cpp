@@ -17,6 +17,7 @@
 #include "operators/sort.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/segment_iterate.hpp"
 #include "storage/table.hpp"
@@ -208,4 +209,117 @@ TEST_F(AggregateSortTest, AggregateOnPresortedValueClustered) {
   test_clustered_table_input(to_simple_reference_table(table_sorted_value_clustered));
 }
 
+TEST_F(AggregateSortTest, SortedInputWithEmptyAndRemovedChunks) {
+  // Empty and physically deleted chunks of a sorted input neither prevent skipping the sort nor end up in the groups.
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Int, false}};
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data);
+  const auto expected_input = std::make_shared<Table>(column_definitions, TableType::Data);
+  const auto chunk_values = std::vector<std::vector<int32_t>>{{}, {1, 1, 2}, {}, {2, 3}, {}};
+  for (const auto& values : chunk_values) {
+    auto a_values = pmr_vector<int32_t>(values.begin(), values.end());
+    auto b_values = pmr_vector<int32_t>(values.begin(), values.end());
+    table->append_chunk(Segments{std::make_shared<ValueSegment<int32_t>>(std::move(a_values)),
+                                 std::make_shared<ValueSegment<int32_t>>(std::move(b_values))});
+    table->last_chunk()->set_individually_sorted_by(SortColumnDefinition(ColumnID{0}, SortMode::Ascending));
+    for (const auto value : values) {
+      expected_input->append({value, value});
+    }
+  }
+  table->remove_chunk(ChunkID{0});
+  table->remove_chunk(ChunkID{2});
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  const auto expected_table_wrapper = std::make_shared<TableWrapper>(expected_input);
+  expected_table_wrapper->execute();
+
+  const auto b = pqp_column_(ColumnID{1}, DataType::Int, false, "b");
+  const auto aggregates = std::vector<std::shared_ptr<WindowFunctionExpression>>{
+      sum_(b), std::make_shared<WindowFunctionExpression>(WindowFunction::Count,
+                                                          pqp_column_(INVALID_COLUMN_ID, DataType::Long, false, "*"))};
+
+  for (const auto& groupby_column_ids : {std::vector<ColumnID>{}, std::vector<ColumnID>{ColumnID{0}}}) {
+    const auto expected_aggregate =
+        std::make_shared<AggregateHash>(expected_table_wrapper, aggregates, groupby_column_ids);
+    expected_aggregate->execute();
+
+    const auto aggregate = std::make_shared<AggregateSort>(table_wrapper, aggregates, groupby_column_ids);
+    aggregate->execute();
+    EXPECT_TABLE_EQ_UNORDERED(aggregate->get_output(), expected_aggregate->get_output());
+  }
+}
+
+TEST_F(AggregateSortTest, ParallelAggregationOfSortedChunks) {
+  // The table is sorted by column a, so grouping by a neither requires a sort nor a chunk-wise sort. Groups straddle
+  // the chunk boundaries. Large inputs are aggregated in chunk ranges in parallel if a multi-threaded scheduler is
+  // used.
+  const auto chunk_size = ChunkOffset{10'000};
+  const auto column_definitions = TableColumnDefinitions{
+      {"a", DataType::Int, true}, {"b", DataType::Long, true}, {"c", DataType::String, false}};
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, chunk_size);
+  const auto row_count = AggregateSort::PARALLEL_AGGREGATION_ROW_THRESHOLD + 2 * chunk_size;
+  for (auto begin = size_t{0}; begin < row_count; begin += chunk_size) {
+    auto a_values = pmr_vector<int32_t>{};
+    auto a_nulls = pmr_vector<bool>{};
+    auto b_values = pmr_vector<int64_t>{};
+    auto b_nulls = pmr_vector<bool>{};
+    auto c_values = pmr_vector<pmr_string>{};
+    for (auto row = begin; row < begin + chunk_size; ++row) {
+      a_values.emplace_back(static_cast<int32_t>(row / 7'000));
+      a_nulls.emplace_back(row < 500);
+      b_values.emplace_back(static_cast<int64_t>(row % 13));
+      b_nulls.emplace_back(row % 11 == 0);
+      c_values.emplace_back(std::to_string(row % 3));
+    }
+    table->append_chunk(Segments{std::make_shared<ValueSegment<int32_t>>(std::move(a_values), std::move(a_nulls)),
+                                 std::make_shared<ValueSegment<int64_t>>(std::move(b_values), std::move(b_nulls)),
+                                 std::make_shared<ValueSegment<pmr_string>>(std::move(c_values))});
+    table->last_chunk()->set_individually_sorted_by(SortColumnDefinition(ColumnID{0}, SortMode::Ascending));
+  }
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->never_clear_output();
+  table_wrapper->execute();
+
+  const auto b = pqp_column_(ColumnID{1}, DataType::Long, true, "b");
+  const auto c = pqp_column_(ColumnID{2}, DataType::String, false, "c");
+  const auto aggregates = std::vector<std::shared_ptr<WindowFunctionExpression>>{
+      min_(b),
+      max_(c),
+      sum_(b),
+      avg_(b),
+      count_(b),
+      count_distinct_(c),
+      standard_deviation_sample_(b),
+      std::make_shared<WindowFunctionExpression>(WindowFunction::Count,
+                                                 pqp_column_(INVALID_COLUMN_ID, DataType::Long, false, "*"))};
+
+  // Grouping by a and c requires sorting the input.
+  const auto groupby_column_id_lists = std::vector<std::vector<ColumnID>>{{ColumnID{0}}, {ColumnID{0}, ColumnID{2}}};
+  auto expected_results = std::vector<std::shared_ptr<const Table>>{};
+  for (const auto& groupby_column_ids : groupby_column_id_lists) {
+    const auto aggregate = std::make_shared<AggregateHash>(table_wrapper, aggregates, groupby_column_ids);
+    aggregate->execute();
+    expected_results.emplace_back(aggregate->get_output());
+
+    const auto single_threaded_aggregate =
+        std::make_shared<AggregateSort>(table_wrapper, aggregates, groupby_column_ids);
+    single_threaded_aggregate->execute();
+    EXPECT_TABLE_EQ_UNORDERED(single_threaded_aggregate->get_output(), expected_results.back());
+  }
+
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  const auto groupby_column_id_list_count = groupby_column_id_lists.size();
+  for (auto list_idx = size_t{0}; list_idx < groupby_column_id_list_count; ++list_idx) {
+    const auto& groupby_column_ids = groupby_column_id_lists[list_idx];
+    const auto aggregate = std::make_shared<AggregateSort>(table_wrapper, aggregates, groupby_column_ids);
+    aggregate->execute();
+    EXPECT_TABLE_EQ_UNORDERED(aggregate->get_output(), expected_results[list_idx]);
+  }
+
+  Hyrise::get().scheduler()->finish();
+}
+
 }  // namespace hyrise
@@ -17,6 +17,7 @@
 #include "operators/sort.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/segment_iterate.hpp"
 #include "storage/table.hpp"
@@ -33,6 +34,82 @@ TEST_F(OperatorsAggregateHashTest, EmptyHash) {
   EXPECT_EQ(std::hash<AggregateKeySmallVector>()(AggregateKeySmallVector{}), 0);
 }
 
+TEST_F(OperatorsAggregateHashTest, ParallelAggregation) {
+  // Large inputs are aggregated in parallel if a multi-threaded scheduler is used. Compare the results to the results
+  // of the single-threaded aggregation.
+  const auto chunk_size = ChunkOffset{10'000};
+  const auto column_definitions = TableColumnDefinitions{
+      {"a", DataType::Int, false}, {"b", DataType::Long, true}, {"c", DataType::String, false}};
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, chunk_size);
+  const auto row_count = AggregateHash::PARALLEL_AGGREGATION_ROW_THRESHOLD + 2 * chunk_size;
+  for (auto begin = size_t{0}; begin < row_count; begin += chunk_size) {
+    auto a_values = pmr_vector<int32_t>{};
+    auto b_values = pmr_vector<int64_t>{};
+    auto b_nulls = pmr_vector<bool>{};
+    auto c_values = pmr_vector<pmr_string>{};
+    for (auto row = begin; row < begin + chunk_size; ++row) {
+      // Spread the group keys so that the immediate key shortcut is not used.
+      a_values.emplace_back(static_cast<int32_t>(row % 30'000) * 1'000);
+      b_values.emplace_back(static_cast<int64_t>(row % 7));
+      b_nulls.emplace_back(row % 11 == 0);
+      c_values.emplace_back(std::to_string(row % 3));
+    }
+    table->append_chunk(Segments{std::make_shared<ValueSegment<int32_t>>(std::move(a_values)),
+                                 std::make_shared<ValueSegment<int64_t>>(std::move(b_values), std::move(b_nulls)),
+                                 std::make_shared<ValueSegment<pmr_string>>(std::move(c_values))});
+  }
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->never_clear_output();
+  table_wrapper->execute();
+
+  const auto b = pqp_column_(ColumnID{1}, DataType::Long, true, "b");
+  const auto c = pqp_column_(ColumnID{2}, DataType::String, false, "c");
+  const auto aggregates = std::vector<std::shared_ptr<WindowFunctionExpression>>{
+      min_(b),
+      max_(c),
+      sum_(b),
+      avg_(b),
+      count_(b),
+      count_distinct_(b),
+      standard_deviation_sample_(b),
+      std::make_shared<WindowFunctionExpression>(WindowFunction::Count,
+                                                 pqp_column_(INVALID_COLUMN_ID, DataType::Long, false, "*"))};
+
+  const auto groupby_column_id_lists = std::vector<std::vector<ColumnID>>{
+      {ColumnID{0}}, {ColumnID{0}, ColumnID{2}}, {ColumnID{0}, ColumnID{1}, ColumnID{2}}};
+  auto expected_results = std::vector<std::shared_ptr<const Table>>{};
+  auto expected_distinct_results = std::vector<std::shared_ptr<const Table>>{};
+  for (const auto& groupby_column_ids : groupby_column_id_lists) {
+    const auto aggregate = std::make_shared<AggregateHash>(table_wrapper, aggregates, groupby_column_ids);
+    aggregate->execute();
+    expected_results.emplace_back(aggregate->get_output());
+
+    const auto distinct = std::make_shared<AggregateHash>(
+        table_wrapper, std::vector<std::shared_ptr<WindowFunctionExpression>>{}, groupby_column_ids);
+    distinct->execute();
+    expected_distinct_results.emplace_back(distinct->get_output());
+  }
+
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  const auto groupby_column_id_list_count = groupby_column_id_lists.size();
+  for (auto list_idx = size_t{0}; list_idx < groupby_column_id_list_count; ++list_idx) {
+    const auto& groupby_column_ids = groupby_column_id_lists[list_idx];
+    const auto aggregate = std::make_shared<AggregateHash>(table_wrapper, aggregates, groupby_column_ids);
+    aggregate->execute();
+    EXPECT_TABLE_EQ_UNORDERED(aggregate->get_output(), expected_results[list_idx]);
+
+    const auto distinct = std::make_shared<AggregateHash>(
+        table_wrapper, std::vector<std::shared_ptr<WindowFunctionExpression>>{}, groupby_column_ids);
+    distinct->execute();
+    EXPECT_TABLE_EQ_UNORDERED(distinct->get_output(), expected_distinct_results[list_idx]);
+  }
+
+  Hyrise::get().scheduler()->finish();
+}
+
 template <typename T>
 void test_output(const std::shared_ptr<AbstractOperator> in,
                  const std::vector<std::pair<ColumnID, WindowFunction>>& aggregate_definitions,
@@ -434,6 +434,86 @@ TEST_F(OperatorsGetTableTest, DynamicSubqueryPruningSubqueryNotExecuted) {
   EXPECT_THROW(get_table->execute(), std::logic_error);
 }
 
+TEST_F(OperatorsGetTableTest, RuntimeJoinFilter) {
+  // Prune chunks whose join column cannot contain any value of the hash join's build input.
+  const auto build_table = Table::create_dummy_table({{"x", DataType::Int, true}, {"y", DataType::Float, false}});
+  build_table->append({9, 10.5f});
+  build_table->append({NULL_VALUE, 11.5f});
+  const auto table_wrapper = std::make_shared<TableWrapper>(build_table);
+
+  const auto get_table = std::make_shared<GetTable>("int_int_float", std::vector<ChunkID>{}, std::vector{ColumnID{1}});
+  get_table->set_runtime_join_filter(table_wrapper, ColumnID{0}, ColumnID{0});
+  EXPECT_EQ(get_table->runtime_join_filter_input(), table_wrapper);
+
+  execute_all({table_wrapper, get_table});
+  const auto output_table = get_table->get_output();
+  EXPECT_EQ(output_table->chunk_count(), 2);
+  EXPECT_EQ(output_table->row_count(), 2);
+  EXPECT_EQ(get_table->description(DescriptionMode::SingleLine),
+            "GetTable (int_int_float) pruned: 2/4 chunk(s) (0 static, 2 dynamic), 1/3 column(s)");
+
+  // Output column 1 is the stored column c.
+  const auto get_table_c =
+      std::make_shared<GetTable>("int_int_float", std::vector<ChunkID>{}, std::vector{ColumnID{1}});
+  get_table_c->set_runtime_join_filter(table_wrapper, ColumnID{1}, ColumnID{1});
+  get_table_c->execute();
+  EXPECT_EQ(get_table_c->get_output()->chunk_count(), 3);
+
+  // Columns of different data types are not filtered.
+  const auto get_table_b = std::make_shared<GetTable>("int_int_float");
+  get_table_b->set_runtime_join_filter(table_wrapper, ColumnID{1}, ColumnID{1});
+  get_table_b->execute();
+  EXPECT_EQ(get_table_b->get_output()->chunk_count(), 4);
+}
+
+TEST_F(OperatorsGetTableTest, RuntimeJoinFilterWithoutBuildValues) {
+  // No row can find a join partner if the build input has no non-NULL values.
+  const auto build_table = Table::create_dummy_table({{"x", DataType::Int, true}});
+  build_table->append({NULL_VALUE});
+  const auto table_wrapper = std::make_shared<TableWrapper>(build_table);
+  const auto get_table = std::make_shared<GetTable>("int_int_float");
+  get_table->set_runtime_join_filter(table_wrapper, ColumnID{0}, ColumnID{1});
+
+  // The build input has to be executed first.
+  EXPECT_THROW(get_table->execute(), std::logic_error);
+
+  const auto get_table_2 = std::make_shared<GetTable>("int_int_float");
+  get_table_2->set_runtime_join_filter(table_wrapper, ColumnID{0}, ColumnID{1});
+  execute_all({table_wrapper, get_table_2});
+  EXPECT_EQ(get_table_2->get_output()->chunk_count(), 0);
+}
+
+TEST_F(OperatorsGetTableTest, RuntimeJoinFilterWithSharedDictionary) {
+  // The chunks share their dictionary. Its entries within the build input's range are only checked once.
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data,
+                                             ChunkOffset{2}, UseMvcc::Yes);
+  for (const auto value : {1, 7, 3, 5}) {
+    table->append({value});
+  }
+  table->last_chunk()->set_immutable();
+  ChunkEncoder::encode_with_global_dictionary({{table, ColumnID{0}}});
+  Hyrise::get().storage_manager.add_table("shared_dictionary", table);
+
+  // 4 is within the value range of both chunks, but not part of the dictionary.
+  const auto build_table = Table::create_dummy_table({{"x", DataType::Int, false}});
+  build_table->append({4});
+  const auto table_wrapper = std::make_shared<TableWrapper>(build_table);
+  const auto get_table = std::make_shared<GetTable>("shared_dictionary");
+  get_table->set_runtime_join_filter(table_wrapper, ColumnID{0}, ColumnID{0});
+  execute_all({table_wrapper, get_table});
+  EXPECT_EQ(get_table->get_output()->chunk_count(), 0);
+
+  // 3 is part of the dictionary, so neither chunk is pruned by the dictionary. The first chunk does not contain 3, but
+  // the chunk-level filter cannot tell.
+  const auto build_table_2 = Table::create_dummy_table({{"x", DataType::Int, false}});
+  build_table_2->append({3});
+  const auto table_wrapper_2 = std::make_shared<TableWrapper>(build_table_2);
+  const auto get_table_2 = std::make_shared<GetTable>("shared_dictionary");
+  get_table_2->set_runtime_join_filter(table_wrapper_2, ColumnID{0}, ColumnID{0});
+  execute_all({table_wrapper_2, get_table_2});
+  EXPECT_EQ(get_table_2->get_output()->chunk_count(), 2);
+}
+
 TEST_F(OperatorsGetTableTest, ImmutableChunks) {
   // Insert one tuple into int_int_float to create a mutable chunk.
   const auto& table = Hyrise::get().storage_manager.get_table("int_int_float");
@@ -280,6 +280,44 @@ TEST_F(JoinHashStepsTest, RadixClusteringOfNulls) {
   }
 }
 
+TEST_F(JoinHashStepsTest, TwoPassRadixClustering) {
+  // Fan-outs above MAX_RADIX_BITS_PER_PASS bits are partitioned in two passes. The resulting partitions have to be the
+  // same as for a single pass: each value is stored in the partition given by the lowest radix bits of its hash.
+  const auto radix_bit_count = JoinHash::MAX_RADIX_BITS_PER_PASS + 2;
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, true}}, TableType::Data,
+                                             ChunkOffset{1'000});
+  for (auto value = int32_t{1}; value <= 10'000; ++value) {
+    table->append({value % 7 == 0 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{value}});
+  }
+
+  std::vector<std::vector<size_t>> histograms;
+  BloomFilter bloom_filter;  // Ignored in this test
+  const auto materialized = materialize_input<int, int, true>(table, ColumnID{0}, histograms, radix_bit_count,
+                                                              bloom_filter);
+  ASSERT_EQ(histograms.front().size(), size_t{1} << JoinHash::MAX_RADIX_BITS_PER_PASS);
+
+  const auto radix_cluster_result = partition_by_radix<int, int, true>(materialized, histograms, radix_bit_count);
+  ASSERT_EQ(radix_cluster_result.size(), size_t{1} << radix_bit_count);
+
+  const auto hash_function = std::hash<int>{};
+  auto element_count = size_t{0};
+  auto null_count = size_t{0};
+  for (auto partition_idx = size_t{0}; partition_idx < radix_cluster_result.size(); ++partition_idx) {
+    const auto& partition = radix_cluster_result[partition_idx];
+    ASSERT_EQ(partition.null_values.size(), partition.elements.size());
+    for (auto element_idx = size_t{0}; element_idx < partition.elements.size(); ++element_idx) {
+      const auto value = partition.elements[element_idx].value;
+      EXPECT_EQ(hash_function(value) & ((size_t{1} << radix_bit_count) - 1), partition_idx);
+      // NULLs are materialized as zeros.
+      EXPECT_EQ(partition.null_values[element_idx], value == 0);
+      null_count += partition.null_values[element_idx];
+    }
+    element_count += partition.elements.size();
+  }
+  EXPECT_EQ(element_count, 10'000);
+  EXPECT_EQ(null_count, 1'428);
+}
+
 TEST_F(JoinHashStepsTest, BuildRespectsBloomFilter) {
   std::vector<std::vector<size_t>> histograms;  // Ignored in this test
   BloomFilter output_bloom_filter;              // Ignored in this test
@@ -115,6 +115,11 @@ TEST_F(OperatorsJoinHashTest, RadixBitCalculation) {
   EXPECT_EQ(JoinHash::calculate_radix_bits(0, 0), 0);
   EXPECT_EQ(JoinHash::calculate_radix_bits(1, 1), 0);
   EXPECT_GT(JoinHash::calculate_radix_bits(std::numeric_limits<size_t>::max(), std::numeric_limits<size_t>::max()), 0);
+
+  // Joins of very large tables are partitioned in two passes.
+  EXPECT_GT(JoinHash::calculate_radix_bits(10'000'000'000, 20'000'000'000), JoinHash::MAX_RADIX_BITS_PER_PASS);
+  EXPECT_EQ(JoinHash::calculate_radix_bits(std::numeric_limits<size_t>::max(), std::numeric_limits<size_t>::max()),
+            JoinHash::MAX_RADIX_BITS);
 }
 
 }  // namespace hyrise
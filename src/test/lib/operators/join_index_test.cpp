@@ -10,6 +10,7 @@
 #include "operators/join_verification.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/index/group_key/group_key_index.hpp"
 #include "storage/table.hpp"
@@ -273,4 +274,31 @@ TEST_F(OperatorsJoinIndexTest, RightJoinPruneInputIsRefIndexInputIsDataIndexSide
                    1, true);
 }
 
+TEST_F(OperatorsJoinIndexTest, ParallelProbing) {
+  // With a multi-threaded scheduler, data joins are probed in parallel if all chunks of the index side are indexed and
+  // the index side's matches do not have to be tracked.
+  const auto probe_input = load_table_with_index("resources/test_data/tbl/int_float_null_2.tbl", ChunkOffset{3});
+  const auto index_input = load_table_with_index("resources/test_data/tbl/int_float_null_1.tbl", ChunkOffset{2});
+  probe_input->execute();
+  index_input->execute();
+  auto probe_scan = create_table_scan(probe_input, ColumnID{1}, PredicateCondition::GreaterThanEquals, 0);
+  probe_scan->execute();
+
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  const auto predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals};
+  for (const auto mode : {JoinMode::Inner, JoinMode::Left, JoinMode::Semi, JoinMode::AntiNullAsTrue,
+                          JoinMode::AntiNullAsFalse}) {
+    test_join_output(probe_input, index_input, predicate, mode, 1);
+    test_join_output(probe_scan, index_input, predicate, mode, 1);
+  }
+  for (const auto mode : {JoinMode::Inner, JoinMode::Right}) {
+    test_join_output(index_input, probe_input, predicate, mode, 1, true, IndexSide::Left);
+    test_join_output(index_input, probe_scan, predicate, mode, 1, true, IndexSide::Left);
+  }
+
+  Hyrise::get().scheduler()->finish();
+}
+
 }  // namespace hyrise
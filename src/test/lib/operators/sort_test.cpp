@@ -1,3 +1,6 @@
+#include <limits>
+#include <memory>
+
 #include "base_test.hpp"
 #include "operators/join_hash.hpp"
 #include "operators/sort.hpp"
@@ -234,4 +237,67 @@ TEST_F(SortTest, InputReferencesDifferentColumns) {
   EXPECT_EQ(sort.get_output()->type(), TableType::Data);
 }
 
+TEST_F(SortTest, StringsSharingPrefix) {
+  // Strings that share the prefix stored in the normalized key are compared in full before the next sort column.
+  const auto column_definitions =
+      TableColumnDefinitions{{"a", DataType::String, true}, {"b", DataType::Int, false}, {"c", DataType::Double, true}};
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{3});
+  table->append({pmr_string{"prefix_prefix_b"}, 1, 1.5});
+  table->append({NULL_VALUE, 2, 0.0});
+  table->append({pmr_string{"prefix_prefix_a"}, 2, NULL_VALUE});
+  table->append({pmr_string{"prefix_prefix"}, 3, -0.0});
+  table->append({pmr_string{"prefix_prefix_b"}, 0, -2.5});
+  table->append({NULL_VALUE, 1, -1.0});
+  table->append({pmr_string{"prefix_prefix_a"}, 2, -1.0});
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto sort = Sort{table_wrapper,
+                   {SortColumnDefinition{ColumnID{0}, SortMode::Descending},
+                    SortColumnDefinition{ColumnID{1}, SortMode::Ascending},
+                    SortColumnDefinition{ColumnID{2}, SortMode::Ascending}}};
+  sort.execute();
+
+  const auto expected_table = std::make_shared<Table>(column_definitions, TableType::Data);
+  expected_table->append({NULL_VALUE, 1, -1.0});
+  expected_table->append({NULL_VALUE, 2, 0.0});
+  expected_table->append({pmr_string{"prefix_prefix_b"}, 0, -2.5});
+  expected_table->append({pmr_string{"prefix_prefix_b"}, 1, 1.5});
+  expected_table->append({pmr_string{"prefix_prefix_a"}, 2, NULL_VALUE});
+  expected_table->append({pmr_string{"prefix_prefix_a"}, 2, -1.0});
+  expected_table->append({pmr_string{"prefix_prefix"}, 3, -0.0});
+  EXPECT_TABLE_EQ_ORDERED(sort.get_output(), expected_table);
+}
+
+TEST_F(SortTest, MergeSortedRuns) {
+  // Large inputs are sorted in runs that are merged afterwards. Rows with equal values keep their order.
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Long, false}};
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data);
+  const auto row_count = int64_t{200'000};
+  for (auto row = int64_t{0}; row < row_count; ++row) {
+    table->append({static_cast<int32_t>((row * 7919) % 1000) - 500, row});
+  }
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto sort = Sort{table_wrapper, {SortColumnDefinition{ColumnID{0}, SortMode::Descending}}};
+  sort.execute();
+
+  const auto& result = sort.get_output();
+  ASSERT_EQ(result->row_count(), row_count);
+  auto previous_a = std::numeric_limits<int32_t>::max();
+  auto previous_b = int64_t{-1};
+  for (auto row = size_t{0}; row < static_cast<size_t>(row_count); ++row) {
+    const auto a = result->get_value<int32_t>(ColumnID{0}, row);
+    const auto b = result->get_value<int64_t>(ColumnID{1}, row);
+    ASSERT_TRUE(a && b);
+    ASSERT_LE(*a, previous_a);
+    if (*a == previous_a) {
+      ASSERT_GT(*b, previous_b);
+    }
+    previous_a = *a;
+    previous_b = *b;
+  }
+}
+
 }  // namespace hyrise
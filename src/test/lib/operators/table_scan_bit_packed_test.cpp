@@ -0,0 +1,108 @@
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_scan/bit_packed_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/table.hpp"
+#include "storage/vector_compression/bitpacking/bitpacking_vector.hpp"
+#include "storage/vector_compression/vector_compression.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+class OperatorsTableScanBitPackedTest : public BaseTest {
+ public:
+  static std::vector<ChunkOffset> matching_offsets(const std::vector<uint64_t>& bitmap) {
+    auto matches = std::vector<ChunkOffset>{};
+    append_bitmap_matches(bitmap, matches);
+    return matches;
+  }
+};
+
+TEST_F(OperatorsTableScanBitPackedTest, ScanAllBitWidths) {
+  // 1'000 value IDs fill 15 blocks of 64 value IDs and leave a remainder of 40 value IDs for the scalar fallback.
+  const auto size = size_t{1'000};
+
+  for (auto bit_width = uint32_t{1}; bit_width <= 32; ++bit_width) {
+    const auto max_value_id = static_cast<uint32_t>((uint64_t{1} << bit_width) - 1);
+    auto value_ids = pmr_vector<uint32_t>(size);
+    for (auto index = size_t{0}; index < size; ++index) {
+      value_ids[index] = static_cast<uint32_t>((index * 2'654'435'761u) & max_value_id);
+    }
+    value_ids.back() = max_value_id;
+
+    const auto compressed_vector = compress_vector(value_ids, VectorCompressionType::BitPacking, {}, {max_value_id});
+    const auto& bit_packing_vector = dynamic_cast<const BitPackingVector&>(*compressed_vector);
+    ASSERT_EQ(bit_packing_vector.data().bits(), bit_width);
+
+    const auto lower_bound = max_value_id / 4;
+    const auto upper_bound = max_value_id / 2 + 1;
+    const auto null_value_id = max_value_id;
+
+    for (const auto invert : {false, true}) {
+      auto expected_offsets = std::vector<ChunkOffset>{};
+      for (auto index = size_t{0}; index < size; ++index) {
+        const auto value_id = value_ids[index];
+        if (((value_id >= lower_bound && value_id < upper_bound) != invert) && value_id != null_value_id) {
+          expected_offsets.emplace_back(static_cast<ChunkOffset::base_type>(index));
+        }
+      }
+
+      const auto bitmap = scan_bit_packed_vector(bit_packing_vector, ValueID{lower_bound}, ValueID{upper_bound},
+                                                 invert, ValueID{null_value_id});
+      EXPECT_EQ(bitmap.size(), size_t{16});
+      EXPECT_EQ(matching_offsets(bitmap), expected_offsets) << "bit width: " << bit_width << ", invert: " << invert;
+    }
+  }
+}
+
+TEST_F(OperatorsTableScanBitPackedTest, AppendToExistingMatches) {
+  auto matches = std::vector<ChunkOffset>{ChunkOffset{7}};
+  append_bitmap_matches({uint64_t{0b101}, uint64_t{0}, uint64_t{1} << 63}, matches);
+
+  const auto expected_matches =
+      std::vector<ChunkOffset>{ChunkOffset{7}, ChunkOffset{0}, ChunkOffset{2}, ChunkOffset{191}};
+  EXPECT_EQ(matches, expected_matches);
+}
+
+TEST_F(OperatorsTableScanBitPackedTest, MatchesUnencodedScan) {
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, true}};
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{300});
+  const auto encoded_table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{300});
+  for (auto row = int32_t{0}; row < 1'000; ++row) {
+    const auto value = row % 10 == 0 ? NULL_VALUE : AllTypeVariant{(row * 7) % 37};
+    table->append({value});
+    encoded_table->append({value});
+  }
+  encoded_table->last_chunk()->set_immutable();
+  ChunkEncoder::encode_all_chunks(encoded_table,
+                                  SegmentEncodingSpec{EncodingType::Dictionary, VectorCompressionType::BitPacking});
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  const auto encoded_table_wrapper = std::make_shared<TableWrapper>(encoded_table);
+  execute_all({table_wrapper, encoded_table_wrapper});
+
+  for (const auto predicate_condition :
+       {PredicateCondition::Equals, PredicateCondition::NotEquals, PredicateCondition::LessThan,
+        PredicateCondition::LessThanEquals, PredicateCondition::GreaterThan, PredicateCondition::GreaterThanEquals}) {
+    const auto scan = create_table_scan(table_wrapper, ColumnID{0}, predicate_condition, 20);
+    const auto encoded_scan = create_table_scan(encoded_table_wrapper, ColumnID{0}, predicate_condition, 20);
+    execute_all({scan, encoded_scan});
+    EXPECT_TABLE_EQ_ORDERED(encoded_scan->get_output(), scan->get_output());
+  }
+
+  for (const auto predicate_condition :
+       {PredicateCondition::BetweenInclusive, PredicateCondition::BetweenLowerExclusive,
+        PredicateCondition::BetweenUpperExclusive, PredicateCondition::BetweenExclusive}) {
+    const auto scan = create_between_table_scan(table_wrapper, ColumnID{0}, 5, 20, predicate_condition);
+    const auto encoded_scan = create_between_table_scan(encoded_table_wrapper, ColumnID{0}, 5, 20, predicate_condition);
+    execute_all({scan, encoded_scan});
+    EXPECT_TABLE_EQ_ORDERED(encoded_scan->get_output(), scan->get_output());
+  }
+}
+
+}  // namespace hyrise
@@ -169,9 +169,8 @@ TEST_P(OperatorsTableScanSortedSegmentSearchTest, ScanSortedSegment) {
             ? SortedSegmentSearch(input_begin, input_end, _sorted_by, _nullable, _predicate_condition, _search_value,
                                   *_second_search_value)
             : SortedSegmentSearch(input_begin, input_end, _sorted_by, _nullable, _predicate_condition, _search_value);
-    auto matches = RowIDPosList{};
-    const auto initial_chunk_id = ChunkID{0};
-    sorted_segment_search.scan_sorted_segment(initial_chunk_id, matches, nullptr);
+    auto matches = std::vector<ChunkOffset>{};
+    sorted_segment_search.scan_sorted_segment(matches, nullptr);
 
     if (matches.empty()) {
       EXPECT_TRUE(sorted_segment_search.no_rows_matching);
@@ -187,8 +186,7 @@ TEST_P(OperatorsTableScanSortedSegmentSearchTest, ScanSortedSegment) {
     ASSERT_EQ(matches.size(), _expected.size());
 
     for (auto index = size_t{0}; index < _expected.size(); ++index) {
-      const auto& [chunk_id, chunk_offset] = matches[index];
-      EXPECT_EQ(chunk_id, initial_chunk_id);
+      const auto chunk_offset = matches[index];
       EXPECT_FALSE(_segment->is_null(chunk_offset)) << "row " << index << " is null";
       EXPECT_EQ(_segment->get(chunk_offset), _expected[index]) << "row " << index << " is invalid";
     }
@@ -357,6 +357,34 @@ TEST_P(OperatorsTableScanTest, BetweenScanWithSubquery) {
   EXPECT_TABLE_EQ_UNORDERED(scan->get_output(), expected_result);
 }
 
+TEST_P(OperatorsTableScanTest, ScanDateColumn) {
+  // Dates are stored as the number of days since 1970-01-01, so that range predicates on them are integer scans.
+  const auto table_wrapper = load_and_encode_table("resources/test_data/tbl/int_date.tbl");
+  const auto column_b = pqp_column_(ColumnID{1}, DataType::Date, true, "b");
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Date, true}};
+
+  {
+    const auto scan = std::make_shared<TableScan>(table_wrapper, greater_than_equals_(column_b, 0));
+    EXPECT_TRUE(dynamic_cast<ColumnVsValueTableScanImpl*>(scan->create_impl().get()));
+    scan->execute();
+
+    const auto expected_result = std::make_shared<Table>(column_definitions, TableType::Data);
+    expected_result->append({1, 0});
+    expected_result->append({2, 11'016});
+    EXPECT_TABLE_EQ_UNORDERED(scan->get_output(), expected_result);
+  }
+  {
+    const auto scan = std::make_shared<TableScan>(table_wrapper, between_inclusive_(column_b, -1, 0));
+    EXPECT_TRUE(dynamic_cast<ColumnBetweenTableScanImpl*>(scan->create_impl().get()));
+    scan->execute();
+
+    const auto expected_result = std::make_shared<Table>(column_definitions, TableType::Data);
+    expected_result->append({1, 0});
+    expected_result->append({4, -1});
+    EXPECT_TABLE_EQ_UNORDERED(scan->get_output(), expected_result);
+  }
+}
+
 TEST_P(OperatorsTableScanTest, SingleScanWithEmptySubquery) {
   const auto expected_result = Table::create_dummy_table(get_int_float_op()->table->column_definitions());
   const auto dummy_table = Table::create_dummy_table({{"dummy", DataType::Int, false}});
@@ -1301,6 +1329,81 @@ TEST_P(OperatorsTableScanTest, SortedFlagMultipleChunksReferenced) {
   ASSERT_TRUE(chunk_sorted_by.empty());
 }
 
+TEST_P(OperatorsTableScanTest, ScanSkipsBlocksUsingZoneMaps) {
+  // A single chunk with four blocks (see segment_zone_map.hpp). The values are ordered except for a single outlier in
+  // the first block. Only the third block contains NULLs.
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, true}}, TableType::Data,
+                                             ChunkOffset{10'000});
+  for (auto row = int32_t{0}; row < 6'244; ++row) {
+    if (row >= 4'096 && row < 6'144 && row % 7 == 0) {
+      table->append({NULL_VALUE});
+    } else {
+      table->append({row == 5 ? 1'000'000 : row / 10});
+    }
+  }
+  table->last_chunk()->set_immutable();
+
+  // Bit-packed attribute vectors of dictionary segments are scanned by a separate kernel (see bit_packed_scan.hpp).
+  const auto encoding_spec = _encoding_type == EncodingType::Dictionary
+                                 ? SegmentEncodingSpec{EncodingType::Dictionary, VectorCompressionType::BitPacking}
+                                 : SegmentEncodingSpec{_encoding_type};
+  ChunkEncoder::encode_all_chunks(table, encoding_spec);
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->never_clear_output();
+  table_wrapper->execute();
+  const auto column_a = get_column_expression(table_wrapper, ColumnID{0});
+
+  const auto expect_scan = [&](const auto& predicate, const size_t expected_row_count,
+                               const size_t expected_skipped_blocks) {
+    const auto table_scan = std::make_shared<TableScan>(table_wrapper, predicate);
+    table_scan->execute();
+    EXPECT_EQ(table_scan->get_output()->row_count(), expected_row_count);
+
+    const auto& performance_data = dynamic_cast<TableScan::PerformanceData&>(*table_scan->performance_data);
+    EXPECT_EQ(performance_data.num_blocks_skipped,
+              _encoding_type == EncodingType::Unencoded ? 0 : expected_skipped_blocks);
+  };
+
+  // The outlier prevents skipping the first block, but the remaining blocks are still skipped.
+  expect_scan(equals_(column_a, 300), 10, 2);
+  expect_scan(between_inclusive_(column_a, 500, 509), 86, 2);
+  expect_scan(is_null_(column_a), 292, 3);
+  expect_scan(greater_than_(column_a, 1'000'000), 0, 4);
+}
+
+TEST_P(OperatorsTableScanTest, ScanSkipsChunksUsingBloomFilters) {
+  // Three chunks with interleaved values, so that the value ranges of all chunks overlap. Chunk k contains the values
+  // k, k + 3, k + 6, ..., k + 57.
+  const auto table =
+      std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data, ChunkOffset{20});
+  for (auto row = int32_t{0}; row < 60; ++row) {
+    table->append({(row % 20) * 3 + row / 20});
+  }
+  table->last_chunk()->set_immutable();
+  ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{_encoding_type});
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->never_clear_output();
+  table_wrapper->execute();
+  const auto column_a = get_column_expression(table_wrapper, ColumnID{0});
+
+  // The Bloom filters of the pruning statistics exclude the first and the last chunk, both for data and for reference
+  // segments.
+  const auto reference_scan = std::make_shared<TableScan>(table_wrapper, greater_than_equals_(column_a, 0));
+  reference_scan->never_clear_output();
+  reference_scan->execute();
+
+  for (const auto& input : std::vector<std::shared_ptr<const AbstractOperator>>{table_wrapper, reference_scan}) {
+    const auto table_scan = std::make_shared<TableScan>(input, equals_(column_a, 31));
+    table_scan->execute();
+    EXPECT_EQ(table_scan->get_output()->row_count(), 1);
+
+    const auto& performance_data = dynamic_cast<TableScan::PerformanceData&>(*table_scan->performance_data);
+    EXPECT_EQ(performance_data.num_chunks_with_early_out, 2ul);
+  }
+}
+
 TEST_P(OperatorsTableScanTest, DeepCopyRetainsExcludedChunks) {
   const auto table_scan =
       create_table_scan(get_int_float_op(), ColumnID{0}, PredicateCondition::GreaterThanEquals, 1234);
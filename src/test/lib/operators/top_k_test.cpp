@@ -0,0 +1,139 @@
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "expression/expression_functional.hpp"
+#include "operators/limit.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/top_k.hpp"
+#include "statistics/generate_pruning_statistics.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+using namespace expression_functional;  // NOLINT(build/namespaces)
+
+class TopKTest : public BaseTest {
+ public:
+  static void SetUpTestCase() {
+    input_table = load_table("resources/test_data/tbl/sort/input.tbl", ChunkOffset{7});
+    input_table_wrapper = std::make_shared<TableWrapper>(input_table);
+    input_table_wrapper->never_clear_output();
+    input_table_wrapper->execute();
+  }
+
+  // Compares the output of the TopK operator with the output of a Sort followed by a Limit.
+  static void expect_equal_to_sort_and_limit(const std::shared_ptr<AbstractOperator>& input,
+                                             const std::vector<SortColumnDefinition>& sort_definitions,
+                                             const size_t k) {
+    const auto top_k = std::make_shared<TopK>(input, sort_definitions, k);
+    top_k->execute();
+
+    const auto sort = std::make_shared<Sort>(input, sort_definitions);
+    const auto limit = std::make_shared<Limit>(sort, value_(static_cast<int64_t>(k)));
+    sort->execute();
+    limit->execute();
+
+    EXPECT_TABLE_EQ_ORDERED(top_k->get_output(), limit->get_output());
+  }
+
+  static inline std::shared_ptr<Table> input_table;
+  static inline std::shared_ptr<AbstractOperator> input_table_wrapper;
+};
+
+TEST_F(TopKTest, OperatorName) {
+  const auto top_k = std::make_shared<TopK>(input_table_wrapper, std::vector{SortColumnDefinition{ColumnID{0}}}, 3);
+  EXPECT_EQ(top_k->name(), "TopK");
+  EXPECT_EQ(top_k->k(), 3);
+}
+
+TEST_F(TopKTest, EqualToSortAndLimit) {
+  const auto sort_definitions = std::vector<std::vector<SortColumnDefinition>>{
+      {SortColumnDefinition{ColumnID{0}, SortMode::Ascending}},
+      {SortColumnDefinition{ColumnID{0}, SortMode::Descending}},
+      {SortColumnDefinition{ColumnID{1}, SortMode::Ascending}},
+      {SortColumnDefinition{ColumnID{1}, SortMode::Descending}, SortColumnDefinition{ColumnID{2}}},
+      {SortColumnDefinition{ColumnID{2}, SortMode::Descending}, SortColumnDefinition{ColumnID{0}}}};
+
+  for (const auto& definitions : sort_definitions) {
+    for (const auto k : {size_t{1}, size_t{5}, size_t{7}, size_t{20}, size_t{100}}) {
+      expect_equal_to_sort_and_limit(input_table_wrapper, definitions, k);
+    }
+  }
+}
+
+TEST_F(TopKTest, ReferenceInput) {
+  const auto table_scan = create_table_scan(input_table_wrapper, ColumnID{0}, PredicateCondition::GreaterThan, 10);
+  table_scan->execute();
+
+  expect_equal_to_sort_and_limit(table_scan, {SortColumnDefinition{ColumnID{1}, SortMode::Descending}}, 10);
+}
+
+TEST_F(TopKTest, EmptyResult) {
+  const auto top_k = std::make_shared<TopK>(input_table_wrapper, std::vector{SortColumnDefinition{ColumnID{0}}}, 0);
+  top_k->execute();
+  EXPECT_EQ(top_k->get_output()->row_count(), 0);
+  EXPECT_EQ(top_k->get_output()->column_definitions(), input_table->column_definitions());
+
+  const auto table_scan = create_table_scan(input_table_wrapper, ColumnID{0}, PredicateCondition::LessThan, 0);
+  table_scan->execute();
+  expect_equal_to_sort_and_limit(table_scan, {SortColumnDefinition{ColumnID{0}}}, 10);
+}
+
+TEST_F(TopKTest, MergeCandidatesOfMultipleJobs) {
+  // Chunks are bundled into jobs of at least Chunk::DEFAULT_SIZE rows. Their candidates are merged afterwards.
+  const auto column_definitions =
+      TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::String, true}, {"c", DataType::Long, false}};
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{10'000});
+  for (auto row = int64_t{0}; row < 150'000; ++row) {
+    const auto b =
+        row % 11 == 0 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{pmr_string{"value_" + std::to_string(row % 97)}};
+    table->append({static_cast<int32_t>((row * 7919) % 1000), b, row});
+  }
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  expect_equal_to_sort_and_limit(table_wrapper, {SortColumnDefinition{ColumnID{0}, SortMode::Descending}}, 500);
+  expect_equal_to_sort_and_limit(
+      table_wrapper,
+      {SortColumnDefinition{ColumnID{1}, SortMode::Descending}, SortColumnDefinition{ColumnID{0}, SortMode::Ascending}},
+      1'000);
+}
+
+TEST_F(TopKTest, PruneChunks) {
+  // The values of column a increase with every chunk. Once the first chunk has been processed, the remaining chunks
+  // cannot contain any of the first five rows.
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Int, true}};
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{10});
+  for (auto value = int32_t{0}; value < 100; ++value) {
+    table->append({value, value % 3 == 0 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{value}});
+  }
+  table->last_chunk()->set_immutable();
+  generate_chunk_pruning_statistics(table);
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto top_k = std::make_shared<TopK>(table_wrapper, std::vector{SortColumnDefinition{ColumnID{0}}}, 5);
+  top_k->execute();
+  EXPECT_EQ(top_k->get_output()->row_count(), 5);
+  EXPECT_EQ(dynamic_cast<const TopK::PerformanceData&>(*top_k->performance_data).num_chunks_pruned, 9);
+
+  // The statistics of the referenced chunks are used for ReferenceSegments that reference a single chunk.
+  const auto table_scan = create_table_scan(table_wrapper, ColumnID{0}, PredicateCondition::GreaterThanEquals, 0);
+  table_scan->execute();
+  const auto reference_top_k =
+      std::make_shared<TopK>(table_scan, std::vector{SortColumnDefinition{ColumnID{0}}}, 5);
+  reference_top_k->execute();
+  EXPECT_EQ(reference_top_k->get_output()->get_value<int32_t>(ColumnID{0}, 0), 0);
+  EXPECT_EQ(reference_top_k->get_output()->get_value<int32_t>(ColumnID{0}, 4), 4);
+  EXPECT_EQ(dynamic_cast<const TopK::PerformanceData&>(*reference_top_k->performance_data).num_chunks_pruned, 9);
+
+  // Chunks are not pruned if the first sort column is nullable, as NULLs are not covered by the pruning statistics.
+  expect_equal_to_sort_and_limit(table_wrapper, {SortColumnDefinition{ColumnID{1}}}, 5);
+}
+
+}  // namespace hyrise
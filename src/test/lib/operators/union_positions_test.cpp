@@ -10,6 +10,7 @@
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
 #include "operators/union_positions.hpp"
+#include "storage/pos_lists/compressed_pos_list.hpp"
 #include "storage/reference_segment.hpp"
 
 namespace hyrise {
@@ -154,6 +155,41 @@ TEST_F(UnionPositionsTest, SelfUnionOverlappingRangesMultipleSegments) {
                             load_table("resources/test_data/tbl/int_float4_overlapping_ranges.tbl"));
 }
 
+TEST_F(UnionPositionsTest, UniteCompressedPosLists) {
+  /**
+   * Both scans emit sorted PosLists that reference a single chunk each. They are united per referenced chunk without
+   * building and sorting ReferenceMatrices. The output is sorted by RowID, just as the result of the general case.
+   */
+  auto get_table_op = std::make_shared<GetTable>("10_ints");
+  auto table_scan_a_op = std::make_shared<TableScan>(get_table_op, less_than_(_int_column_0_non_nullable, 20));
+  auto table_scan_b_op = std::make_shared<TableScan>(get_table_op, greater_than_(_int_column_0_non_nullable, 100));
+  auto union_unique_op = std::make_shared<UnionPositions>(table_scan_a_op, table_scan_b_op);
+
+  execute_all({get_table_op, table_scan_a_op, table_scan_b_op, union_unique_op});
+
+  const auto& output = union_unique_op->get_output();
+  const auto expected_row_count = table_scan_a_op->get_output()->row_count() +
+                                  table_scan_b_op->get_output()->row_count();
+  EXPECT_EQ(output->row_count(), expected_row_count);
+
+  auto previous_row_id = RowID{ChunkID{0}, ChunkOffset{0}};
+  for (auto chunk_id = ChunkID{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+    const auto chunk = output->get_chunk(chunk_id);
+    const auto& pos_list = static_cast<const ReferenceSegment&>(*chunk->get_segment(ColumnID{0})).pos_list();
+    EXPECT_TRUE(std::dynamic_pointer_cast<const CompressedPosList>(pos_list));
+    for (auto offset = ChunkOffset{0}; offset < pos_list->size(); ++offset) {
+      const auto row_id = (*pos_list)[offset];
+      EXPECT_FALSE(row_id < previous_row_id);
+      previous_row_id = row_id;
+    }
+  }
+
+  // Unlike the separate scans, the union does not contain duplicates.
+  auto self_union_op = std::make_shared<UnionPositions>(union_unique_op, union_unique_op);
+  self_union_op->execute();
+  EXPECT_EQ(self_union_op->get_output()->row_count(), expected_row_count);
+}
+
 TEST_F(UnionPositionsTest, MultipleReferencedTables) {
   /**
    * Join int_float4 and int_int on their respective "a" column. Scan the result once for int_int.b >= 2 and for
@@ -0,0 +1,204 @@
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "base_test.hpp"
+#include "expression/expression_functional.hpp"
+#include "expression/window_expression.hpp"
+#include "expression/window_function_expression.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/window.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+using namespace expression_functional;  // NOLINT(build/namespaces)
+
+class OperatorsWindowTest : public BaseTest {
+ public:
+  void SetUp() override {
+    // Partition a = 1, ordered by b: rows 0, 2, 3, 5 (rows 2 and 3 are peers). Partition a = 2: rows 1, 4.
+    input_table = std::make_shared<Table>(
+        TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Int, false}, {"c", DataType::Int, true}},
+        TableType::Data, ChunkOffset{2});
+    input_table->append({1, 1, 10});
+    input_table->append({2, 1, 5});
+    input_table->append({1, 2, NULL_VALUE});
+    input_table->append({1, 2, 30});
+    input_table->append({2, 3, 7});
+    input_table->append({1, 4, 20});
+
+    table_wrapper = std::make_shared<TableWrapper>(input_table);
+    table_wrapper->never_clear_output();
+    table_wrapper->execute();
+
+    a = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+    b = pqp_column_(ColumnID{1}, DataType::Int, false, "b");
+    c = pqp_column_(ColumnID{2}, DataType::Int, true, "c");
+  }
+
+  static FrameDescription frame(const FrameType type, const FrameBound& start, const FrameBound& end) {
+    return FrameDescription{type, start, end};
+  }
+
+  // RANGE BETWEEN UNBOUNDED PRECEDING AND CURRENT ROW, the default frame if ORDER BY is given.
+  static FrameDescription default_frame() {
+    return frame(FrameType::Range, FrameBound{0, FrameBoundType::Preceding, true},
+                 FrameBound{0, FrameBoundType::CurrentRow, false});
+  }
+
+  std::shared_ptr<WindowFunctionExpression> window_function(const WindowFunction function,
+                                                            const std::shared_ptr<AbstractExpression>& argument,
+                                                            const FrameDescription& frame_description,
+                                                            const SortMode sort_mode = SortMode::Ascending) const {
+    auto window =
+        window_(expression_vector(a), expression_vector(b), std::vector<SortMode>{sort_mode}, frame_description);
+    return std::make_shared<WindowFunctionExpression>(function, argument, window);
+  }
+
+  // Executes the Window operator and compares the appended column with the expected values, which are given in the
+  // order of the input rows.
+  void expect_results(const std::shared_ptr<AbstractOperator>& input,
+                      const std::shared_ptr<WindowFunctionExpression>& expression,
+                      const std::vector<AllTypeVariant>& expected_values) {
+    const auto window = std::make_shared<Window>(input, expression);
+    window->execute();
+    const auto& output = window->get_output();
+    EXPECT_EQ(output->type(), input->get_output()->type());
+
+    const auto expected_table = std::make_shared<Table>(output->column_definitions(), TableType::Data);
+    const auto rows = input->get_output()->get_rows();
+    ASSERT_EQ(rows.size(), expected_values.size());
+    for (auto row_idx = size_t{0}; row_idx < rows.size(); ++row_idx) {
+      auto row = rows[row_idx];
+      row.emplace_back(expected_values[row_idx]);
+      expected_table->append(row);
+    }
+
+    EXPECT_TABLE_EQ_ORDERED(output, expected_table);
+  }
+
+  void expect_results(const std::shared_ptr<WindowFunctionExpression>& expression,
+                      const std::vector<AllTypeVariant>& expected_values) {
+    expect_results(table_wrapper, expression, expected_values);
+  }
+
+  std::shared_ptr<Table> input_table;
+  std::shared_ptr<TableWrapper> table_wrapper;
+  std::shared_ptr<PQPColumnExpression> a, b, c;
+};
+
+TEST_F(OperatorsWindowTest, OperatorName) {
+  const auto window =
+      std::make_shared<Window>(table_wrapper, window_function(WindowFunction::Rank, nullptr, default_frame()));
+  EXPECT_EQ(window->name(), "Window");
+  EXPECT_EQ(window->partition_by_column_ids(), std::vector<ColumnID>{ColumnID{0}});
+  EXPECT_EQ(window->order_by_definitions(), std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{1}}});
+}
+
+TEST_F(OperatorsWindowTest, RankingFunctions) {
+  expect_results(window_function(WindowFunction::RowNumber, nullptr, default_frame()),
+                 {int64_t{1}, int64_t{1}, int64_t{2}, int64_t{3}, int64_t{2}, int64_t{4}});
+  expect_results(window_function(WindowFunction::Rank, nullptr, default_frame()),
+                 {int64_t{1}, int64_t{1}, int64_t{2}, int64_t{2}, int64_t{2}, int64_t{4}});
+  expect_results(window_function(WindowFunction::DenseRank, nullptr, default_frame()),
+                 {int64_t{1}, int64_t{1}, int64_t{2}, int64_t{2}, int64_t{2}, int64_t{3}});
+  expect_results(window_function(WindowFunction::PercentRank, nullptr, default_frame()),
+                 {0.0, 0.0, 1.0 / 3.0, 1.0 / 3.0, 1.0, 1.0});
+  expect_results(window_function(WindowFunction::CumeDist, nullptr, default_frame()),
+                 {0.25, 0.5, 0.75, 0.75, 1.0, 1.0});
+
+  // Peers keep their input order.
+  expect_results(window_function(WindowFunction::RowNumber, nullptr, default_frame(), SortMode::Descending),
+                 {int64_t{4}, int64_t{2}, int64_t{2}, int64_t{3}, int64_t{1}, int64_t{1}});
+}
+
+TEST_F(OperatorsWindowTest, DefaultFrame) {
+  // Peers share their frame.
+  expect_results(window_function(WindowFunction::Sum, c, default_frame()),
+                 {int64_t{10}, int64_t{5}, int64_t{40}, int64_t{40}, int64_t{12}, int64_t{60}});
+}
+
+TEST_F(OperatorsWindowTest, RowsFrames) {
+  const auto one_preceding = FrameBound{1, FrameBoundType::Preceding, false};
+  const auto two_preceding = FrameBound{2, FrameBoundType::Preceding, false};
+  const auto current_row = FrameBound{0, FrameBoundType::CurrentRow, false};
+  const auto one_following = FrameBound{1, FrameBoundType::Following, false};
+  const auto around = frame(FrameType::Rows, one_preceding, one_following);
+
+  expect_results(window_function(WindowFunction::Sum, c, frame(FrameType::Rows, one_preceding, current_row)),
+                 {int64_t{10}, int64_t{5}, int64_t{10}, int64_t{30}, int64_t{12}, int64_t{50}});
+  expect_results(window_function(WindowFunction::Min, c, around), {10, 5, 10, 20, 5, 20});
+  expect_results(window_function(WindowFunction::Max, c, around), {10, 7, 30, 30, 7, 30});
+  expect_results(window_function(WindowFunction::Count, c, around),
+                 {int64_t{1}, int64_t{2}, int64_t{2}, int64_t{2}, int64_t{2}, int64_t{2}});
+  expect_results(window_function(WindowFunction::Count, pqp_column_(INVALID_COLUMN_ID, DataType::Long, false, "*"),
+                                 around),
+                 {int64_t{2}, int64_t{2}, int64_t{3}, int64_t{3}, int64_t{2}, int64_t{2}});
+
+  // The first rows of the partitions have empty frames.
+  expect_results(window_function(WindowFunction::Sum, c, frame(FrameType::Rows, two_preceding, one_preceding)),
+                 {NULL_VALUE, NULL_VALUE, int64_t{10}, int64_t{10}, int64_t{5}, int64_t{30}});
+
+  // Frames whose start lies after their end are empty.
+  const auto backwards = frame(FrameType::Rows, one_preceding, two_preceding);
+  expect_results(window_function(WindowFunction::Sum, c, backwards),
+                 {NULL_VALUE, NULL_VALUE, NULL_VALUE, NULL_VALUE, NULL_VALUE, NULL_VALUE});
+  expect_results(window_function(WindowFunction::Count, c, backwards),
+                 {int64_t{0}, int64_t{0}, int64_t{0}, int64_t{0}, int64_t{0}, int64_t{0}});
+  expect_results(window_function(WindowFunction::Max, c, frame(FrameType::Rows, one_following, current_row)),
+                 {NULL_VALUE, NULL_VALUE, NULL_VALUE, NULL_VALUE, NULL_VALUE, NULL_VALUE});
+}
+
+TEST_F(OperatorsWindowTest, GroupsFrames) {
+  const auto groups_frame = frame(FrameType::Groups, FrameBound{1, FrameBoundType::Preceding, false},
+                                  FrameBound{0, FrameBoundType::CurrentRow, false});
+  expect_results(window_function(WindowFunction::Avg, c, groups_frame), {10.0, 5.0, 20.0, 20.0, 6.0, 25.0});
+}
+
+TEST_F(OperatorsWindowTest, ReferenceInput) {
+  const auto table_scan = create_table_scan(table_wrapper, ColumnID{0}, PredicateCondition::GreaterThan, 0);
+  table_scan->execute();
+
+  expect_results(table_scan, window_function(WindowFunction::Sum, c, default_frame()),
+                 {int64_t{10}, int64_t{5}, int64_t{40}, int64_t{40}, int64_t{12}, int64_t{60}});
+}
+
+TEST_F(OperatorsWindowTest, ManyPartitions) {
+  // Enough rows to be distributed to multiple hash partitions.
+  const auto row_count = int32_t{100'000};
+  const auto partition_count = int32_t{100};
+  const auto table = std::make_shared<Table>(
+      TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Int, false}, {"c", DataType::Int, true}},
+      TableType::Data, ChunkOffset{10'000});
+  for (auto row = int32_t{0}; row < row_count; ++row) {
+    table->append({row % partition_count, row, row});
+  }
+  const auto input = std::make_shared<TableWrapper>(table);
+  input->execute();
+
+  const auto rows_frame = frame(FrameType::Rows, FrameBound{2, FrameBoundType::Preceding, false},
+                                FrameBound{0, FrameBoundType::CurrentRow, false});
+  const auto row_number =
+      std::make_shared<Window>(input, window_function(WindowFunction::RowNumber, nullptr, default_frame()));
+  const auto sum = std::make_shared<Window>(row_number, window_function(WindowFunction::Sum, c, rows_frame));
+  row_number->execute();
+  sum->execute();
+
+  const auto output_rows = sum->get_output()->get_rows();
+  ASSERT_EQ(output_rows.size(), row_count);
+  for (auto row = int32_t{0}; row < row_count; ++row) {
+    auto expected_sum = int64_t{0};
+    for (auto preceding_row = row; preceding_row >= 0 && preceding_row >= row - 2 * partition_count;
+         preceding_row -= partition_count) {
+      expected_sum += preceding_row;
+    }
+
+    ASSERT_EQ(boost::get<int64_t>(output_rows[row][3]), row / partition_count + 1);
+    ASSERT_EQ(boost::get<int64_t>(output_rows[row][4]), expected_sum);
+  }
+}
+
+}  // namespace hyrise
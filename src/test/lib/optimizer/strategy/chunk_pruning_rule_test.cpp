@@ -331,6 +331,44 @@ TEST_F(ChunkPruningRuleTest, FixedStringPruningTest) {
   EXPECT_EQ(stored_table_node->pruned_chunk_ids(), expected_chunk_ids);
 }
 
+TEST_F(ChunkPruningRuleTest, BloomFilterPruningTest) {
+  const auto stored_table_node = StoredTableNode::make("string_compressed");
+
+  // "xyz" lies within the value ranges of both chunks, but only the Bloom filters show that neither contains it.
+  _lqp = PredicateNode::make(equals_(lqp_column_(stored_table_node, ColumnID{0}), "xyz"));
+  _lqp->set_left_input(stored_table_node);
+
+  _apply_rule(_rule, _lqp);
+
+  const auto expected_chunk_ids = std::vector<ChunkID>{ChunkID{0}, ChunkID{1}};
+  EXPECT_EQ(stored_table_node->pruned_chunk_ids(), expected_chunk_ids);
+}
+
+TEST_F(ChunkPruningRuleTest, InListPruningTest) {
+  const auto stored_table_node = StoredTableNode::make("compressed");
+  const auto a = lqp_column_(stored_table_node, ColumnID{0});
+
+  // Only the second chunk contains 12.
+  _lqp = PredicateNode::make(in_(a, list_(12, 100)), stored_table_node);
+  _apply_rule(_rule, _lqp);
+  EXPECT_EQ(stored_table_node->pruned_chunk_ids(), std::vector<ChunkID>{ChunkID{0}});
+  ASSERT_TRUE(stored_table_node->table_statistics);
+  EXPECT_FLOAT_EQ(stored_table_node->table_statistics->row_count, 2.0f);
+
+  // NOT IN and lists that contain non-literal values cannot be used for pruning.
+  const auto stored_table_node_2 = StoredTableNode::make("compressed");
+  _lqp = PredicateNode::make(not_in_(lqp_column_(stored_table_node_2, ColumnID{0}), list_(12, 100)),
+                             stored_table_node_2);
+  _apply_rule(_rule, _lqp);
+  EXPECT_TRUE(stored_table_node_2->pruned_chunk_ids().empty());
+
+  const auto stored_table_node_3 = StoredTableNode::make("compressed");
+  const auto a_3 = lqp_column_(stored_table_node_3, ColumnID{0});
+  _lqp = PredicateNode::make(in_(a_3, list_(100, add_(a_3, 1))), stored_table_node_3);
+  _apply_rule(_rule, _lqp);
+  EXPECT_TRUE(stored_table_node_3->pruned_chunk_ids().empty());
+}
+
 TEST_F(ChunkPruningRuleTest, PrunePastNonFilteringNodes) {
   const auto stored_table_node = StoredTableNode::make("compressed");
 
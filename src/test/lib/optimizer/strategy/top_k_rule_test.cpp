@@ -0,0 +1,108 @@
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/limit_node.hpp"
+#include "logical_query_plan/mock_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
+#include "logical_query_plan/sort_node.hpp"
+#include "logical_query_plan/union_node.hpp"
+#include "optimizer/strategy/top_k_rule.hpp"
+#include "strategy_base_test.hpp"
+
+namespace hyrise {
+
+using namespace expression_functional;  // NOLINT(build/namespaces)
+
+class TopKRuleTest : public StrategyBaseTest {
+ public:
+  void SetUp() override {
+    node = MockNode::make(MockNode::ColumnDefinitions{{DataType::Int, "a"}, {DataType::String, "b"}});
+    a = node->get_column("a");
+    b = node->get_column("b");
+
+    sort_node = SortNode::make(expression_vector(a, b), sort_modes, node);
+    rule = std::make_shared<TopKRule>();
+  }
+
+  std::shared_ptr<MockNode> node;
+  std::shared_ptr<LQPColumnExpression> a, b;
+  std::shared_ptr<SortNode> sort_node;
+  std::shared_ptr<TopKRule> rule;
+  const std::vector<SortMode> sort_modes{SortMode::Descending, SortMode::Ascending};
+};
+
+TEST_F(TopKRuleTest, MarkSortBelowLimit) {
+  _lqp = LimitNode::make(value_(int64_t{10}), sort_node);
+  _apply_rule(rule, _lqp);
+
+  // The SortNode is replaced by a marked copy.
+  const auto marked_sort_node = std::dynamic_pointer_cast<SortNode>(_lqp->left_input());
+  ASSERT_TRUE(marked_sort_node);
+  ASSERT_TRUE(marked_sort_node->top_k);
+  EXPECT_EQ(*marked_sort_node->top_k, 10);
+  EXPECT_FALSE(sort_node->top_k);
+
+  const auto expected_lqp =
+      LimitNode::make(value_(int64_t{10}), SortNode::make(expression_vector(a, b), sort_modes, size_t{10}, node));
+  EXPECT_LQP_EQ(_lqp, expected_lqp);
+
+  // The marked SortNode is not equal to an unmarked one.
+  const auto unmarked_sort_node = SortNode::make(expression_vector(a, b), sort_modes, node);
+  EXPECT_NE(*marked_sort_node, *unmarked_sort_node);
+  EXPECT_EQ(*marked_sort_node, *marked_sort_node->deep_copy());
+}
+
+TEST_F(TopKRuleTest, MarkSortWithIntegerLimit) {
+  _lqp = ProjectionNode::make(expression_vector(a), LimitNode::make(value_(0), sort_node));
+  _apply_rule(rule, _lqp);
+
+  const auto marked_sort_node = std::dynamic_pointer_cast<SortNode>(_lqp->left_input()->left_input());
+  ASSERT_TRUE(marked_sort_node);
+  ASSERT_TRUE(marked_sort_node->top_k);
+  EXPECT_EQ(*marked_sort_node->top_k, 0);
+}
+
+TEST_F(TopKRuleTest, NoConstantRowCount) {
+  _lqp = LimitNode::make(placeholder_(ParameterID{0}), sort_node);
+  _apply_rule(rule, _lqp);
+  EXPECT_EQ(_lqp->left_input(), sort_node);
+  EXPECT_FALSE(sort_node->top_k);
+
+  _lqp = LimitNode::make(value_(int64_t{TopKRule::MAX_TOP_K + 1}), sort_node);
+  _apply_rule(rule, _lqp);
+  EXPECT_EQ(_lqp->left_input(), sort_node);
+  EXPECT_FALSE(sort_node->top_k);
+}
+
+TEST_F(TopKRuleTest, NoSortBelowLimit) {
+  // clang-format off
+  _lqp =
+  LimitNode::make(value_(int64_t{10}),
+    ProjectionNode::make(expression_vector(a, b),
+      sort_node));
+  // clang-format on
+
+  _apply_rule(rule, _lqp);
+  EXPECT_EQ(_lqp->left_input()->left_input(), sort_node);
+  EXPECT_FALSE(sort_node->top_k);
+}
+
+TEST_F(TopKRuleTest, SortWithMultipleOutputs) {
+  // The entire sorted input is required by the second output of the SortNode.
+  // clang-format off
+  _lqp =
+  UnionNode::make(SetOperationMode::All,
+    LimitNode::make(value_(int64_t{10}),
+      sort_node),
+    sort_node);
+  // clang-format on
+
+  _apply_rule(rule, _lqp);
+  EXPECT_EQ(_lqp->right_input(), sort_node);
+  EXPECT_FALSE(sort_node->top_k);
+}
+
+}  // namespace hyrise
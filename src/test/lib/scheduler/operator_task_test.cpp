@@ -317,6 +317,50 @@ TEST_F(OperatorTaskTest, PrunableSubqueriesWithCycles) {
   }
 }
 
+TEST_F(OperatorTaskTest, LinkRuntimeJoinFilters) {
+  // The task of a hash join's build input becomes a predecessor of the GetTable task on the probe side. Thus, the
+  // GetTable operator can use the build input as a runtime join filter.
+  const auto get_table_a = std::make_shared<GetTable>("table_a");
+  const auto get_table_b = std::make_shared<GetTable>("table_b");
+  const auto table_scan =
+      std::make_shared<TableScan>(get_table_b, greater_than_(pqp_column_(ColumnID{0}, DataType::Int, false, "a"), 0));
+  const auto join = std::make_shared<JoinHash>(
+      table_scan, get_table_a, JoinMode::Semi,
+      OperatorJoinPredicate{ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals});
+
+  const auto& [tasks, _] = OperatorTask::make_tasks_from_operator(join);
+  ASSERT_EQ(tasks.size(), 4);
+  EXPECT_EQ(get_table_b->runtime_join_filter_input(), get_table_a);
+  EXPECT_FALSE(get_table_a->runtime_join_filter_input());
+
+  const auto& get_table_a_successors = get_table_a->get_or_create_operator_task()->successors();
+  ASSERT_EQ(get_table_a_successors.size(), 2);
+  EXPECT_EQ(get_table_a_successors.front(), join->get_or_create_operator_task());
+  EXPECT_EQ(get_table_a_successors.back(), get_table_b->get_or_create_operator_task());
+
+  for (const auto& task : tasks) {
+    EXPECT_NO_THROW(task->schedule());
+    // We don't have to wait here, because we are running the task tests without a scheduler.
+  }
+  EXPECT_EQ(join->get_output()->row_count(), 3);
+}
+
+TEST_F(OperatorTaskTest, RuntimeJoinFiltersRequireSingleConsumer) {
+  // Pruning chunks of a GetTable operator with further consumers would change the input of these consumers.
+  const auto get_table_a = std::make_shared<GetTable>("table_a");
+  const auto get_table_b = std::make_shared<GetTable>("table_b");
+  const auto join = std::make_shared<JoinHash>(
+      get_table_b, get_table_a, JoinMode::Semi,
+      OperatorJoinPredicate{ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals});
+  const auto table_scan =
+      std::make_shared<TableScan>(get_table_b, less_than_(pqp_column_(ColumnID{0}, DataType::Int, false, "a"), 0));
+  const auto union_positions = std::make_shared<UnionPositions>(join, table_scan);
+
+  OperatorTask::make_tasks_from_operator(union_positions);
+  EXPECT_FALSE(get_table_b->runtime_join_filter_input());
+  EXPECT_EQ(get_table_a->get_or_create_operator_task()->successors(), TaskVector{join->get_or_create_operator_task()});
+}
+
 TEST_F(OperatorTaskTest, SkipOperatorTask) {
   const auto table = std::make_shared<GetTable>("table_a");
   table->execute();
@@ -129,8 +129,19 @@ TEST_F(PostgresProtocolHandlerTest, SendValuesAsStrings) {
   const std::string value1 = "some";
   const std::string value2 = "string";
 
-  _protocol_handler->send_data_row({value1, value2, std::nullopt},
-                                   static_cast<uint32_t>(value1.size() + value2.size()));
+  // Each value is preceded by its length in network byte order. NULL values have a length of -1.
+  auto serialized_values = std::string{};
+  const auto append_length = [&](const int32_t length) {
+    const auto network_length = htonl(static_cast<uint32_t>(length));
+    serialized_values.append(reinterpret_cast<const char*>(&network_length), sizeof(uint32_t));
+  };
+  append_length(static_cast<int32_t>(value1.size()));
+  serialized_values += value1;
+  append_length(static_cast<int32_t>(value2.size()));
+  serialized_values += value2;
+  append_length(-1);
+
+  _protocol_handler->send_serialized_data_row(3, serialized_values);
   _protocol_handler->force_flush();
   const std::string file_content = _mocked_socket->read();
 
@@ -224,7 +235,7 @@ TEST_F(PostgresProtocolHandlerTest, ReadBindPacket) {
   const std::string portal = "test_portal";
   const std::string statement_name = "test_statement";
 
-  _mocked_socket->write(std::string{'\0', '\0', '\0', '\x31'});
+  _mocked_socket->write(std::string{'\0', '\0', '\0', '\x33'});
   _mocked_socket->write(portal);
   _mocked_socket->write(std::string{"\0", 1});
   _mocked_socket->write(statement_name);
@@ -239,15 +250,19 @@ TEST_F(PostgresProtocolHandlerTest, ReadBindPacket) {
   _mocked_socket->write(std::string{'\0', '\0', '\0', '\x04'});
   // Set parameter to value "test"
   _mocked_socket->write("test");
-  // Assuming one result column
-  _mocked_socket->write(std::string{'\0', '\x01'});
-  // Also format code 0: text format
+  // Assuming two result columns
+  _mocked_socket->write(std::string{'\0', '\x02'});
+  // Format code 0: text format
   _mocked_socket->write(std::string{"\0", 2});
+  // Format code 1: binary format
+  _mocked_socket->write(std::string{'\0', '\x01'});
 
   const auto& statement_information = _protocol_handler->read_bind_packet();
   EXPECT_EQ(statement_information.portal, portal);
   EXPECT_EQ(statement_information.statement_name, statement_name);
   EXPECT_EQ(statement_information.parameters, std::vector<AllTypeVariant>{"test"});
+  const auto expected_result_formats = std::vector<ResultFormat>{ResultFormat::Text, ResultFormat::Binary};
+  EXPECT_EQ(statement_information.result_formats, expected_result_formats);
 }
 
 TEST_F(PostgresProtocolHandlerTest, ReadExecutePacket) {
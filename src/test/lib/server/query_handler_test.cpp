@@ -1,6 +1,7 @@
 #include "base_test.hpp"
 #include "operators/get_table.hpp"
 #include "server/query_handler.hpp"
+#include "sql/sql_plan_cache.hpp"
 
 namespace hyrise {
 
@@ -60,6 +61,69 @@ TEST_F(QueryHandlerTest, ExecutePreparedStatement) {
   EXPECT_EQ(result_table->column_count(), 2u);
 }
 
+TEST_F(QueryHandlerTest, BindCachedPreparedPlan) {
+  Hyrise::get().prepared_pqp_cache = std::make_shared<SQLPhysicalPlanCache>();
+
+  // Statements that only differ in their whitespace share the cached plan, even if prepared under different names.
+  const auto cache_key = QueryHandler::setup_prepared_plan("first_statement", "SELECT * FROM table_a WHERE a > ?");
+  const auto other_cache_key =
+      QueryHandler::setup_prepared_plan("second_statement", "SELECT *\n  FROM table_a\n  WHERE a > ?");
+  ASSERT_TRUE(cache_key);
+  EXPECT_EQ(cache_key, other_cache_key);
+
+  const auto execute = [&](const std::string& statement_name, const AllTypeVariant& parameter) {
+    const auto pqp = QueryHandler::bind_prepared_plan(PreparedStatementDetails{statement_name, "", {parameter}},
+                                                      other_cache_key);
+    pqp->set_transaction_context_recursively(
+        Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::Yes));
+    return QueryHandler::execute_prepared_plan(pqp)->row_count();
+  };
+
+  EXPECT_EQ(execute("first_statement", 123), 2);
+  EXPECT_EQ(Hyrise::get().prepared_pqp_cache->size(), 1);
+
+  // The cached plan is reused with different values.
+  EXPECT_EQ(execute("second_statement", 1234), 1);
+  EXPECT_EQ(execute("first_statement", 12345), 0);
+  EXPECT_EQ(Hyrise::get().prepared_pqp_cache->size(), 1);
+
+  // Parameters of other data types lead to a separate plan. Clients send parameters in text format.
+  EXPECT_EQ(execute("first_statement", pmr_string{"123"}), 2);
+  EXPECT_EQ(Hyrise::get().prepared_pqp_cache->size(), 2);
+}
+
+TEST_F(QueryHandlerTest, ReusePreparedPlansUntilTablesChange) {
+  Hyrise::get().prepared_plan_cache = std::make_shared<SQLPreparedPlanCache>();
+  Hyrise::get().prepared_pqp_cache = std::make_shared<SQLPhysicalPlanCache>();
+
+  // The statement is parsed and translated only once.
+  const auto cache_key = QueryHandler::setup_prepared_plan("first_statement", "SELECT * FROM table_a WHERE a > ?");
+  const auto other_cache_key =
+      QueryHandler::setup_prepared_plan("second_statement", "SELECT * FROM  table_a WHERE a > ?");
+  ASSERT_TRUE(cache_key);
+  EXPECT_EQ(cache_key, other_cache_key);
+  EXPECT_EQ(Hyrise::get().prepared_plan_cache->size(), 1);
+  EXPECT_EQ(Hyrise::get().storage_manager.get_prepared_plan("first_statement"),
+            Hyrise::get().storage_manager.get_prepared_plan("second_statement"));
+
+  QueryHandler::bind_prepared_plan(PreparedStatementDetails{"first_statement", "", {123}}, cache_key);
+  EXPECT_EQ(Hyrise::get().prepared_pqp_cache->size(), 1);
+
+  // Cached plans might refer to tables or views that are replaced. Thus, adding or dropping them clears the caches.
+  Hyrise::get().storage_manager.add_table("table_b", load_table("resources/test_data/tbl/int_float.tbl"));
+  EXPECT_EQ(Hyrise::get().prepared_plan_cache->size(), 0);
+  EXPECT_EQ(Hyrise::get().prepared_pqp_cache->size(), 0);
+
+  QueryHandler::setup_prepared_plan("third_statement", "SELECT * FROM table_a WHERE a > ?");
+  QueryHandler::bind_prepared_plan(PreparedStatementDetails{"third_statement", "", {123}}, cache_key);
+  EXPECT_EQ(Hyrise::get().prepared_plan_cache->size(), 1);
+  EXPECT_EQ(Hyrise::get().prepared_pqp_cache->size(), 1);
+
+  Hyrise::get().storage_manager.drop_table("table_b");
+  EXPECT_EQ(Hyrise::get().prepared_plan_cache->size(), 0);
+  EXPECT_EQ(Hyrise::get().prepared_pqp_cache->size(), 0);
+}
+
 TEST_F(QueryHandlerTest, CorrectlyInvalidateStatements) {
   QueryHandler::setup_prepared_plan("", "SELECT * FROM table_a WHERE a > ?");
   const auto old_plan = Hyrise::get().storage_manager.get_prepared_plan("");
@@ -60,4 +60,17 @@ TEST_F(ReadBufferTest, ReadLargeString) {
   EXPECT_EQ(_read_buffer->get_string(), original_content);
 }
 
+TEST_F(ReadBufferTest, ReadReceivedData) {
+  // Data that has already been received is read before the network device, even if it exceeds the buffer's capacity.
+  const auto received_content = std::string(SERVER_BUFFER_SIZE + 2u, 'a') + std::string{"\0", 1};
+  _read_buffer->add_received_data(received_content);
+  _mocked_socket->write("b");
+  EXPECT_EQ(_read_buffer->received_data_size(), received_content.size());
+
+  EXPECT_EQ(_read_buffer->get_value<char>(), 'a');
+  EXPECT_EQ(_read_buffer->get_string(), received_content.substr(1, SERVER_BUFFER_SIZE + 1u));
+  EXPECT_EQ(_read_buffer->size() + _read_buffer->received_data_size(), 0);
+  EXPECT_EQ(_read_buffer->get_value<char>(), 'b');
+}
+
 }  // namespace hyrise
@@ -1,3 +1,9 @@
+#include <bit>
+#include <cstdint>
+#include <string>
+
+#include <boost/endian/conversion.hpp>
+
 #include "base_test.hpp"
 #include "mock_socket.hpp"
 #include "server/postgres_protocol_handler.hpp"
@@ -42,6 +48,91 @@ TEST_F(ResultSerializerTest, QueryResponse) {
   EXPECT_EQ(std::count(file_content.begin(), file_content.end(), 'D'), _test_table->row_count());
 }
 
+TEST_F(ResultSerializerTest, BinaryQueryResponse) {
+  ResultSerializer::send_table_description(_test_table, _protocol_handler, {ResultFormat::Binary});
+  _protocol_handler->force_flush();
+  const auto description = _mocked_socket->read();
+  // The format code is the last field of each column description.
+  EXPECT_EQ(NetworkConversionHelper::get_small_int(description.cend() - sizeof(int16_t)),
+            static_cast<uint16_t>(ResultFormat::Binary));
+
+  ResultSerializer::send_query_response(_test_table, _protocol_handler, {ResultFormat::Binary});
+  _protocol_handler->force_flush();
+  const auto file_content = _mocked_socket->read().substr(description.size());
+
+  const auto read_value = [&](auto& position, auto value) {
+    std::copy_n(file_content.cbegin() + position, sizeof(value), reinterpret_cast<char*>(&value));
+    position += sizeof(value);
+    return boost::endian::big_to_native(value);
+  };
+
+  // First row: all columns hold 100.
+  EXPECT_EQ(static_cast<PostgresMessageType>(file_content.front()), PostgresMessageType::DataRow);
+  auto position = sizeof(PostgresMessageType);
+  const auto message_length = read_value(position, uint32_t{0});
+  EXPECT_EQ(read_value(position, uint16_t{0}), _test_table->column_count());
+  for (auto column_index = 0; column_index < 2; ++column_index) {
+    EXPECT_EQ(read_value(position, int32_t{0}), 4);
+    EXPECT_EQ(read_value(position, int32_t{0}), 100);
+  }
+  for (auto column_index = 0; column_index < 2; ++column_index) {
+    EXPECT_EQ(read_value(position, int32_t{0}), 8);
+    EXPECT_EQ(read_value(position, int64_t{0}), 100);
+  }
+  for (auto column_index = 0; column_index < 2; ++column_index) {
+    EXPECT_EQ(read_value(position, int32_t{0}), 4);
+    EXPECT_EQ(std::bit_cast<float>(read_value(position, uint32_t{0})), 100.0f);
+  }
+  for (auto column_index = 0; column_index < 2; ++column_index) {
+    EXPECT_EQ(read_value(position, int32_t{0}), 8);
+    EXPECT_EQ(std::bit_cast<double>(read_value(position, uint64_t{0})), 100.0);
+  }
+  for (auto column_index = 0; column_index < 2; ++column_index) {
+    EXPECT_EQ(read_value(position, int32_t{0}), 3);
+    EXPECT_EQ(file_content.substr(position, 3), "100");
+    position += 3;
+  }
+  EXPECT_EQ(position, message_length + sizeof(PostgresMessageType));
+
+  // Fifth row: every second column is NULL.
+  for (auto row_index = 1; row_index < 4; ++row_index) {
+    position += sizeof(PostgresMessageType);
+    position += read_value(position, uint32_t{0}) - sizeof(uint32_t);
+  }
+  position += sizeof(PostgresMessageType) + sizeof(uint32_t) + sizeof(uint16_t);
+  EXPECT_EQ(read_value(position, int32_t{0}), 4);
+  EXPECT_EQ(read_value(position, int32_t{0}), 104);
+  EXPECT_EQ(read_value(position, int32_t{0}), -1);
+}
+
+TEST_F(ResultSerializerTest, DateQueryResponse) {
+  // Dates are sent as ISO 8601 strings in text format and as the number of days since 2000-01-01 in binary format.
+  const auto table = load_table("resources/test_data/tbl/int_date.tbl");
+  ResultSerializer::send_query_response(table, _protocol_handler);
+  _protocol_handler->force_flush();
+  const auto text_content = _mocked_socket->read();
+  EXPECT_NE(text_content.find("1970-01-01"), std::string::npos);
+  EXPECT_NE(text_content.find("2000-02-29"), std::string::npos);
+  EXPECT_NE(text_content.find("1969-12-31"), std::string::npos);
+
+  ResultSerializer::send_query_response(table, _protocol_handler, {ResultFormat::Binary});
+  _protocol_handler->force_flush();
+  const auto file_content = _mocked_socket->read().substr(text_content.size());
+
+  const auto read_value = [&](auto& position, auto value) {
+    std::copy_n(file_content.cbegin() + position, sizeof(value), reinterpret_cast<char*>(&value));
+    position += sizeof(value);
+    return boost::endian::big_to_native(value);
+  };
+
+  // First row: 1, 1970-01-01.
+  auto position = sizeof(PostgresMessageType) + sizeof(uint32_t) + sizeof(uint16_t);
+  EXPECT_EQ(read_value(position, int32_t{0}), 4);
+  EXPECT_EQ(read_value(position, int32_t{0}), 1);
+  EXPECT_EQ(read_value(position, int32_t{0}), 4);
+  EXPECT_EQ(read_value(position, int32_t{0}), -10'957);
+}
+
 TEST_F(ResultSerializerTest, CommandCompleteMessage) {
   EXPECT_EQ(ResultSerializer::build_command_complete_message(OperatorType::Insert, 1), "INSERT 0 1");
   EXPECT_EQ(ResultSerializer::build_command_complete_message(OperatorType::Update, 1), "UPDATE -1");
@@ -1,6 +1,8 @@
 #include <fstream>
 #include <future>
+#include <memory>
 #include <thread>
+#include <vector>
 
 // GCC in release mode finds potentially uninitialized memory in pqxx. Looking at param.hxx, this appears to be a false
 // positive.
@@ -71,6 +73,8 @@ TEST_F(ServerTestRunner, TestCacheAndSchedulerInitialization) {
   EXPECT_NE(std::dynamic_pointer_cast<NodeQueueScheduler>(Hyrise::get().scheduler()), nullptr);
   EXPECT_NE(Hyrise::get().default_lqp_cache, nullptr);
   EXPECT_NE(Hyrise::get().default_pqp_cache, nullptr);
+  EXPECT_NE(Hyrise::get().prepared_plan_cache, nullptr);
+  EXPECT_NE(Hyrise::get().prepared_pqp_cache, nullptr);
 }
 
 TEST_F(ServerTestRunner, TestSimpleSelect) {
@@ -351,6 +355,19 @@ TEST_F(ServerTestRunner, TestPreparedStatement) {
   EXPECT_EQ(result3.size(), 2u);
 }
 
+TEST_F(ServerTestRunner, TestPreparedStatementAcrossConnections) {
+  // The second connection binds the physical plan that has been cached for the first connection.
+  for (const auto param : {1234u, 123u}) {
+    auto connection = pqxx::connection{_connection_string};
+    auto transaction = pqxx::nontransaction{connection};
+    connection.prepare("statement", "SELECT * FROM table_a WHERE a > ?");
+
+    const auto result = transaction.exec_prepared("statement", param);
+    EXPECT_EQ(result.size(), param == 1234u ? 1u : 2u);
+    EXPECT_EQ(Hyrise::get().prepared_pqp_cache->size(), 1);
+  }
+}
+
 TEST_F(ServerTestRunner, TestUnnamedPreparedStatement) {
   auto connection = pqxx::connection{_connection_string};
   auto transaction = pqxx::nontransaction{connection};
@@ -420,6 +437,24 @@ TEST_F(ServerTestRunner, TestParallelConnections) {
   }
 }
 
+TEST_F(ServerTestRunner, TestManyIdleConnections) {
+  // Sessions do not occupy a thread while they wait for requests. Thus, far more connections than I/O threads and
+  // scheduler workers can be open at the same time and be served in any order.
+  const auto num_connections = size_t{200};
+  auto connections = std::vector<std::unique_ptr<pqxx::connection>>{};
+  connections.reserve(num_connections);
+  for (auto connection_id = size_t{0}; connection_id < num_connections; ++connection_id) {
+    connections.emplace_back(std::make_unique<pqxx::connection>(_connection_string));
+  }
+
+  const auto expected_num_rows = _table_a->row_count();
+  for (auto connection_id = num_connections; connection_id > 0; --connection_id) {
+    auto transaction = pqxx::nontransaction{*connections[connection_id - 1]};
+    const auto result = transaction.exec("SELECT * FROM table_a;");
+    EXPECT_EQ(result.size(), expected_num_rows);
+  }
+}
+
 TEST_F(ServerTestRunner, TestTransactionConflicts) {
   // Similar to TestParallelConnections, but this time we modify the table, expecting some conflicts on the way
   // Also similar to StressTest.TestTransactionConflicts, only that we go through the server
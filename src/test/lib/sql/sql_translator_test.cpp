@@ -2485,7 +2485,7 @@ TEST_F(SQLTranslatorTest, CreateTable) {
                              {"a_decimal", DataType::Float, true},   {"a_real", DataType::Float, true},
                              {"a_float", DataType::Float, true},     {"a_double", DataType::Double, true},
                              {"a_varchar", DataType::String, false}, {"a_char_varying", DataType::String, true},
-                             {"a_date", DataType::String, true},     {"a_time", DataType::String, true},
+                             {"a_date", DataType::Date, true},       {"a_time", DataType::String, true},
                              {"a_datetime", DataType::String, true}};
 
   const auto static_table_node = StaticTableNode::make(Table::create_dummy_table(column_definitions));
@@ -2519,7 +2519,7 @@ TEST_F(SQLTranslatorTest, CreateTableIfNotExists) {
                              {"a_long", DataType::Long, true},           {"a_decimal", DataType::Float, true},
                              {"a_real", DataType::Float, true},          {"a_float", DataType::Float, true},
                              {"a_double", DataType::Double, true},       {"a_varchar", DataType::String, false},
-                             {"a_char_varying", DataType::String, true}, {"a_date", DataType::String, true},
+                             {"a_char_varying", DataType::String, true}, {"a_date", DataType::Date, true},
                              {"a_time", DataType::String, true},         {"a_datetime", DataType::String, true}};
 
   const auto static_table_node = StaticTableNode::make(Table::create_dummy_table(column_definitions));
@@ -3181,17 +3181,75 @@ TEST_F(SQLTranslatorTest, ImportStatement) {
 TEST_F(SQLTranslatorTest, DateLiteral) {
   EXPECT_THROW(sql_to_lqp_helper("SELECT DATE '2001-01-35';"), InvalidInputException);
 
-  const auto value_expression = expression_vector(value_(pmr_string{"2000-01-31"}));
+  // Dates are the number of days since 1970-01-01.
+  const auto date_expression = expression_vector(cast_(value_(10'987), DataType::Date));
   // clang-format off
   const auto expected_lqp =
-  AliasNode::make(value_expression, std::vector<std::string>{"2000-01-31"},
-    ProjectionNode::make(value_expression,
+  AliasNode::make(date_expression, std::vector<std::string>{"2000-01-31"},
+    ProjectionNode::make(date_expression,
       DummyTableNode::make()));
   // clang-format on
   const auto [actual_lqp, translation_info] = sql_to_lqp_helper("SELECT DATE '2000-01-31';");
   EXPECT_LQP_EQ(actual_lqp, expected_lqp);
 }
 
+TEST_F(SQLTranslatorTest, DateColumnPredicates) {
+  Hyrise::get().storage_manager.add_table("int_date", load_table("resources/test_data/tbl/int_date.tbl"));
+  const auto stored_table_node_int_date = StoredTableNode::make("int_date");
+  const auto int_date_b = stored_table_node_int_date->get_column("b");
+
+  // Date literals that are compared with Date columns are replaced with the number of days since 1970-01-01.
+  {
+    const auto [actual_lqp, translation_info] = sql_to_lqp_helper("SELECT * FROM int_date WHERE b < '2000-02-29'");
+    const auto expected_lqp = PredicateNode::make(less_than_(int_date_b, 11'016), stored_table_node_int_date);
+    EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+  }
+  {
+    const auto [actual_lqp, translation_info] =
+        sql_to_lqp_helper("SELECT * FROM int_date WHERE DATE '1970-01-01' = b");
+    const auto expected_lqp = PredicateNode::make(equals_(0, int_date_b), stored_table_node_int_date);
+    EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+  }
+  {
+    const auto [actual_lqp, translation_info] =
+        sql_to_lqp_helper("SELECT * FROM int_date WHERE b BETWEEN '1969-12-31' AND CAST('2000-02-29' AS DATE)");
+    const auto expected_lqp =
+        PredicateNode::make(between_inclusive_(int_date_b, -1, 11'016), stored_table_node_int_date);
+    EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+  }
+  {
+    const auto [actual_lqp, translation_info] =
+        sql_to_lqp_helper("SELECT * FROM int_date WHERE b IN ('1970-01-01', '2000-02-29')");
+    const auto expected_lqp = PredicateNode::make(in_(int_date_b, list_(0, 11'016)), stored_table_node_int_date);
+    EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+  }
+  {
+    const auto [actual_lqp, translation_info] =
+        sql_to_lqp_helper("SELECT * FROM int_date WHERE b < DATE '2000-01-31' + INTERVAL '29' DAY");
+    const auto expected_lqp = PredicateNode::make(less_than_(int_date_b, 11'016), stored_table_node_int_date);
+    EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+  }
+
+  // Parameters of prepared statements are cast as Date.
+  {
+    const auto [actual_lqp, translation_info] = sql_to_lqp_helper("SELECT * FROM int_date WHERE b < ?");
+    const auto expected_lqp = PredicateNode::make(
+        less_than_(int_date_b, cast_(placeholder_(ParameterID{0}), DataType::Date)), stored_table_node_int_date);
+    EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+  }
+
+  // Dates that are compared with String columns are replaced with strings.
+  {
+    const auto [actual_lqp, translation_info] =
+        sql_to_lqp_helper("SELECT * FROM int_string WHERE b >= CAST('2000-02-29' AS DATE)");
+    const auto expected_lqp =
+        PredicateNode::make(greater_than_equals_(int_string_b, "2000-02-29"), stored_table_node_int_string);
+    EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+  }
+
+  EXPECT_THROW(sql_to_lqp_helper("SELECT * FROM int_date WHERE b = '2000-02-30'"), InvalidInputException);
+}
+
 TEST_F(SQLTranslatorTest, IntervalLiteral) {
   // Though most of these queries are valid SQL, we want to ensure to reject expressions Hyrise cannot handle
   EXPECT_THROW(sql_to_lqp_helper("SELECT INTERVAL '3' day from int_string;"), InvalidInputException);
@@ -3226,8 +3284,6 @@ TEST_F(SQLTranslatorTest, CastStatement) {
   EXPECT_THROW(sql_to_lqp_helper("SELECT CAST('abc' AS DATE)"), InvalidInputException);
   EXPECT_THROW(sql_to_lqp_helper("SELECT CAST(1 AS DATE)"), InvalidInputException);
   EXPECT_THROW(sql_to_lqp_helper("SELECT CAST(a AS DATE) FROM int_string"), InvalidInputException);
-  // We do not have a real Date data type, so we cannot pass this cast anywhere else.
-  EXPECT_THROW(sql_to_lqp_helper("SELECT CAST(b AS DATE) FROM int_string"), InvalidInputException);
   EXPECT_THROW(sql_to_lqp_helper("SELECT CAST('2000-01-01 00:00:x' AS DATETIME)"), InvalidInputException);
   EXPECT_THROW(sql_to_lqp_helper("SELECT CAST('10-01-01 00:00:00' AS DATETIME)"), InvalidInputException);
   EXPECT_THROW(sql_to_lqp_helper("SELECT CAST('not_a_datetime' AS DATETIME)"), InvalidInputException);
@@ -3255,18 +3311,29 @@ TEST_F(SQLTranslatorTest, CastStatement) {
     EXPECT_LQP_EQ(actual_lqp, expected_lqp);
   }
   {
-    // Dates need to be translated to a value expression, as we do not have a Date DataType
-    const auto value_expression = expression_vector(value_(pmr_string{"2000-01-01"}));
+    // Date literals are translated to the number of days since 1970-01-01.
+    const auto cast_expression = expression_vector(cast_(value_(10'957), DataType::Date));
     // clang-format off
     const auto expected_lqp =
-    ProjectionNode::make(value_expression,
+    ProjectionNode::make(cast_expression,
       DummyTableNode::make());
     // clang-format on
     const auto [actual_lqp, translation_info] = sql_to_lqp_helper("SELECT CAST('2000-01-01' as DATE);");
     EXPECT_LQP_EQ(actual_lqp, expected_lqp);
   }
   {
-    // Date times need to be translated to a value expression, as we do not have a DateTime DataType
+    // Other strings are converted when the cast is evaluated.
+    const auto cast_expression = expression_vector(cast_(int_string_b, DataType::Date));
+    // clang-format off
+    const auto expected_lqp =
+    ProjectionNode::make(cast_expression,
+      stored_table_node_int_string);
+    // clang-format on
+    const auto [actual_lqp, translation_info] = sql_to_lqp_helper("SELECT CAST(b AS DATE) FROM int_string");
+    EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+  }
+  {
+    // Timestamps are stored as strings, so date times are translated to a value expression.
     const auto value_expression = expression_vector(value_(pmr_string{"2000-01-02 02:02:01"}));
     // clang-format off
     const auto expected_lqp =
@@ -0,0 +1,105 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+#include "base_test.hpp"
+#include "statistics/statistics_objects/split_block_bloom_filter.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+template <typename T>
+class SplitBlockBloomFilterTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // The dictionary contains all multiples of three below 3'000.
+    for (auto index = int64_t{0}; index < 1'000; ++index) {
+      _values.emplace_back(_value(index * 3));
+    }
+    std::sort(_values.begin(), _values.end());
+  }
+
+  static T _value(const int64_t value) {
+    if constexpr (std::is_same_v<T, pmr_string>) {
+      return pmr_string{"value_" + std::to_string(value)};
+    } else {
+      return static_cast<T>(value);
+    }
+  }
+
+  pmr_vector<T> _values;
+};
+
+using SplitBlockBloomFilterTypes = ::testing::Types<int32_t, int64_t, float, double, pmr_string>;
+TYPED_TEST_SUITE(SplitBlockBloomFilterTest, SplitBlockBloomFilterTypes, );  // NOLINT(whitespace/parens)
+
+TYPED_TEST(SplitBlockBloomFilterTest, EmptyDictionary) {
+  EXPECT_FALSE(SplitBlockBloomFilter<TypeParam>::build_filter(pmr_vector<TypeParam>{}));
+}
+
+TYPED_TEST(SplitBlockBloomFilterTest, NoFalseNegatives) {
+  const auto filter = SplitBlockBloomFilter<TypeParam>::build_filter(this->_values);
+  ASSERT_TRUE(filter);
+
+  // 1'000 values with ten bits each fit into 40 blocks of 256 bits.
+  EXPECT_EQ(filter->blocks.size(), 40);
+  EXPECT_EQ(filter->memory_usage(), sizeof(SplitBlockBloomFilter<TypeParam>) + 40 * 32);
+
+  for (const auto& value : this->_values) {
+    EXPECT_TRUE(filter->may_contain(value));
+    EXPECT_FALSE(filter->does_not_contain(PredicateCondition::Equals, value));
+  }
+}
+
+TYPED_TEST(SplitBlockBloomFilterTest, FalsePositiveRate) {
+  const auto filter = SplitBlockBloomFilter<TypeParam>::build_filter(this->_values);
+
+  // Values that are no multiples of three are not part of the dictionary. With ten bits per value, the false positive
+  // rate of a split block Bloom filter is slightly above 1%.
+  auto false_positive_count = size_t{0};
+  for (auto index = int64_t{0}; index < 10'000; ++index) {
+    if (filter->may_contain(this->_value(index * 3 + 1))) {
+      ++false_positive_count;
+    }
+  }
+  EXPECT_LT(false_positive_count, 300);
+
+  // More bits per value reduce the false positive rate.
+  const auto larger_filter = SplitBlockBloomFilter<TypeParam>::build_filter(this->_values, 20);
+  auto larger_false_positive_count = size_t{0};
+  for (auto index = int64_t{0}; index < 10'000; ++index) {
+    if (larger_filter->may_contain(this->_value(index * 3 + 1))) {
+      ++larger_false_positive_count;
+    }
+  }
+  EXPECT_LT(larger_false_positive_count, false_positive_count);
+}
+
+TYPED_TEST(SplitBlockBloomFilterTest, OnlyEqualityPredicates) {
+  const auto filter = SplitBlockBloomFilter<TypeParam>::build_filter(this->_values);
+  const auto absent_value = this->_value(4);
+  ASSERT_FALSE(filter->may_contain(absent_value));
+
+  EXPECT_TRUE(filter->does_not_contain(PredicateCondition::Equals, absent_value));
+  EXPECT_FALSE(filter->does_not_contain(PredicateCondition::NotEquals, absent_value));
+  EXPECT_FALSE(filter->does_not_contain(PredicateCondition::LessThan, absent_value));
+  EXPECT_FALSE(filter->does_not_contain(PredicateCondition::GreaterThanEquals, absent_value));
+  EXPECT_FALSE(
+      filter->does_not_contain(PredicateCondition::BetweenInclusive, absent_value, AllTypeVariant{absent_value}));
+  EXPECT_FALSE(filter->does_not_contain(PredicateCondition::Equals, NULL_VALUE));
+}
+
+TYPED_TEST(SplitBlockBloomFilterTest, SlicedAndScaled) {
+  const auto filter = std::shared_ptr<SplitBlockBloomFilter<TypeParam>>{
+      SplitBlockBloomFilter<TypeParam>::build_filter(this->_values)};
+
+  EXPECT_EQ(filter->scaled(0.5f), filter);
+  EXPECT_EQ(filter->sliced(PredicateCondition::Equals, this->_value(3)), filter);
+  EXPECT_EQ(filter->sliced(PredicateCondition::GreaterThan, this->_value(4)), filter);
+  EXPECT_FALSE(filter->sliced(PredicateCondition::Equals, this->_value(4)));
+}
+
+}  // namespace hyrise
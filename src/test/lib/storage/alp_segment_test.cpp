@@ -0,0 +1,216 @@
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <numbers>
+#include <optional>
+#include <vector>
+
+#include "base_test.hpp"
+#include "import_export/binary/binary_parser.hpp"
+#include "import_export/binary/binary_writer.hpp"
+#include "storage/alp_segment.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/create_iterable_from_segment.hpp"
+#include "storage/pos_lists/row_id_pos_list.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+template <typename T>
+class StorageALPSegmentTest : public BaseTest {
+ protected:
+  static std::shared_ptr<ALPSegment<T>> encode(const std::vector<std::optional<T>>& values) {
+    const auto value_segment = std::make_shared<ValueSegment<T>>(true);
+    for (const auto& value : values) {
+      value_segment->append(value ? AllTypeVariant{*value} : NULL_VALUE);
+    }
+
+    const auto encoded_segment =
+        ChunkEncoder::encode_segment(value_segment, data_type_from_type<T>(), SegmentEncodingSpec{EncodingType::ALP});
+    return std::dynamic_pointer_cast<ALPSegment<T>>(encoded_segment);
+  }
+
+  // Compares the bit patterns so that NaN and -0.0 are covered as well.
+  static void expect_bitwise_equal(const std::optional<T>& expected, const std::optional<T>& actual) {
+    ASSERT_EQ(expected.has_value(), actual.has_value());
+    if (expected) {
+      EXPECT_EQ(std::memcmp(&*expected, &*actual, sizeof(T)), 0) << *expected << " vs. " << *actual;
+    }
+  }
+
+  static void expect_segment_equals(const ALPSegment<T>& segment, const std::vector<std::optional<T>>& values) {
+    ASSERT_EQ(segment.size(), values.size());
+
+    // Sequential access
+    auto chunk_offset = ChunkOffset{0};
+    create_iterable_from_segment<T, false>(segment).for_each([&](const auto& position) {
+      ASSERT_EQ(position.chunk_offset(), chunk_offset);
+      expect_bitwise_equal(values[chunk_offset],
+                           position.is_null() ? std::nullopt : std::optional<T>{position.value()});
+      ++chunk_offset;
+    });
+    EXPECT_EQ(chunk_offset, values.size());
+
+    // Point access, reading every third value in reverse order
+    const auto position_filter = std::make_shared<RowIDPosList>();
+    for (auto offset = static_cast<int64_t>(values.size()) - 1; offset >= 0; offset -= 3) {
+      position_filter->emplace_back(ChunkID{0}, ChunkOffset{static_cast<ChunkOffset::base_type>(offset)});
+    }
+    position_filter->guarantee_single_chunk();
+    auto position_filter_index = size_t{0};
+    create_iterable_from_segment<T, false>(segment).for_each(position_filter, [&](const auto& position) {
+      const auto referenced_chunk_offset = (*position_filter)[position_filter_index].chunk_offset;
+      expect_bitwise_equal(values[referenced_chunk_offset],
+                           position.is_null() ? std::nullopt : std::optional<T>{position.value()});
+      ++position_filter_index;
+    });
+    EXPECT_EQ(position_filter_index, position_filter->size());
+
+    // Single-value access
+    for (auto offset = ChunkOffset{0}; offset < values.size(); ++offset) {
+      expect_bitwise_equal(values[offset], segment.get_typed_value(offset));
+    }
+  }
+};
+
+using ALPDataTypes = ::testing::Types<float, double>;
+TYPED_TEST_SUITE(StorageALPSegmentTest, ALPDataTypes, );  // NOLINT(whitespace/parens)
+
+TYPED_TEST(StorageALPSegmentTest, EncodeDecimals) {
+  auto values = std::vector<std::optional<TypeParam>>{};
+  for (auto index = int32_t{-500}; index < 500; ++index) {
+    values.emplace_back(static_cast<TypeParam>(index) / TypeParam{100});
+  }
+
+  const auto segment = this->encode(values);
+  ASSERT_TRUE(segment);
+  EXPECT_EQ(segment->encoding_type(), EncodingType::ALP);
+  EXPECT_EQ(segment->compressed_vector_type(), CompressedVectorType::BitPacking);
+  EXPECT_FALSE(segment->null_values());
+  EXPECT_TRUE(segment->exception_values().empty());
+  ASSERT_EQ(segment->exponents().size(), 1);
+  // Depending on the precision of TypeParam, the values are scaled with, e.g., 10^2 or 10^14 * 10^-12.
+  EXPECT_EQ(segment->exponents()[0] - segment->factors()[0], 2);
+  EXPECT_EQ(segment->block_minima()[0], -500);
+
+  this->expect_segment_equals(*segment, values);
+}
+
+TYPED_TEST(StorageALPSegmentTest, EncodeExceptions) {
+  using Limits = std::numeric_limits<TypeParam>;
+  const auto values = std::vector<std::optional<TypeParam>>{
+      TypeParam{1.5},      Limits::quiet_NaN(),    TypeParam{2.25},  Limits::infinity(),
+      -Limits::infinity(), TypeParam{-0.0},        TypeParam{0.0},   std::numbers::pi_v<TypeParam>,
+      Limits::max(),       Limits::denorm_min(),   TypeParam{-3.75}, Limits::lowest()};
+
+  const auto segment = this->encode(values);
+  ASSERT_TRUE(segment);
+  EXPECT_EQ(segment->exception_positions().size(), segment->exception_values().size());
+  EXPECT_GE(segment->exception_values().size(), 7);
+
+  this->expect_segment_equals(*segment, values);
+}
+
+TYPED_TEST(StorageALPSegmentTest, EncodeNullValues) {
+  const auto values = std::vector<std::optional<TypeParam>>{
+      std::nullopt, TypeParam{0.5}, std::nullopt, std::numeric_limits<TypeParam>::quiet_NaN(), TypeParam{-7.125}};
+
+  const auto segment = this->encode(values);
+  ASSERT_TRUE(segment);
+  ASSERT_TRUE(segment->null_values());
+  EXPECT_EQ(*segment->null_values(), (pmr_vector<bool>{true, false, true, false, false}));
+
+  this->expect_segment_equals(*segment, values);
+
+  const auto all_null_values = std::vector<std::optional<TypeParam>>(3, std::nullopt);
+  const auto all_null_segment = this->encode(all_null_values);
+  ASSERT_TRUE(all_null_segment);
+  EXPECT_TRUE(all_null_segment->exception_values().empty());
+  this->expect_segment_equals(*all_null_segment, all_null_values);
+}
+
+TYPED_TEST(StorageALPSegmentTest, EncodeMultipleBlocks) {
+  // The first block holds values with two decimal places, the second one alternates between small and huge integers
+  // (which cannot be encoded with the parameters chosen for the small ones), and the third one holds values with a
+  // single decimal place and a few NULLs.
+  constexpr auto block_size = size_t{ALPSegment<TypeParam>::block_size};
+  auto values = std::vector<std::optional<TypeParam>>{};
+  for (auto index = size_t{0}; index < block_size; ++index) {
+    values.emplace_back(static_cast<TypeParam>(index % 1'000) / TypeParam{100} + TypeParam{10});
+  }
+  for (auto index = size_t{0}; index < block_size; ++index) {
+    values.emplace_back(index % 2 == 0 ? TypeParam{0} : TypeParam{1e15});
+  }
+  for (auto index = size_t{0}; index < block_size / 2; ++index) {
+    values.emplace_back(index % 10 == 0 ? std::nullopt
+                                        : std::optional<TypeParam>{static_cast<TypeParam>(index) / TypeParam{10}});
+  }
+
+  const auto segment = this->encode(values);
+  ASSERT_TRUE(segment);
+  ASSERT_EQ(segment->block_minima().size(), 3);
+  const auto& exception_positions = segment->exception_positions();
+  const auto second_block_exception_count =
+      std::count_if(exception_positions.cbegin(), exception_positions.cend(), [&](const auto chunk_offset) {
+        return chunk_offset >= block_size && chunk_offset < 2 * block_size;
+      });
+  EXPECT_EQ(second_block_exception_count, block_size / 2);
+
+  this->expect_segment_equals(*segment, values);
+
+  // Decompressing a block writes all values of that block.
+  auto block = std::vector<TypeParam>(block_size);
+  segment->decompress_block(0, block.data());
+  for (auto index = size_t{0}; index < block_size; ++index) {
+    EXPECT_EQ(block[index], *values[index]);
+  }
+}
+
+TYPED_TEST(StorageALPSegmentTest, CopyUsingAllocator) {
+  const auto values = std::vector<std::optional<TypeParam>>{
+      TypeParam{1.25}, std::nullopt, std::numeric_limits<TypeParam>::infinity(), TypeParam{4.5}};
+  const auto segment = this->encode(values);
+  ASSERT_TRUE(segment);
+
+  const auto copied_segment =
+      std::dynamic_pointer_cast<ALPSegment<TypeParam>>(segment->copy_using_allocator(PolymorphicAllocator<size_t>{}));
+  ASSERT_TRUE(copied_segment);
+  this->expect_segment_equals(*copied_segment, values);
+  EXPECT_GT(copied_segment->memory_usage(MemoryUsageCalculationMode::Full), sizeof(ALPSegment<TypeParam>));
+}
+
+TYPED_TEST(StorageALPSegmentTest, BinaryExportImport) {
+  const auto column_definitions = TableColumnDefinitions{{"a", data_type_from_type<TypeParam>(), true}};
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{3'000});
+  for (auto index = int32_t{0}; index < 5'000; ++index) {
+    if (index % 17 == 0) {
+      table->append({NULL_VALUE});
+    } else if (index % 13 == 0) {
+      // Stored as exception
+      table->append({static_cast<TypeParam>(index) * TypeParam{1e20}});
+    } else {
+      table->append({static_cast<TypeParam>(index) / TypeParam{8}});
+    }
+  }
+  table->last_chunk()->set_immutable();
+  ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{EncodingType::ALP});
+
+  const auto filename = test_data_path + "alp_segment_export.bin";
+  BinaryWriter::write(*table, filename);
+  const auto imported_table = BinaryParser::parse(filename);
+
+  ASSERT_EQ(imported_table->chunk_count(), 2);
+  for (auto chunk_id = ChunkID{0}; chunk_id < imported_table->chunk_count(); ++chunk_id) {
+    const auto segment = imported_table->get_chunk(chunk_id)->get_segment(ColumnID{0});
+    EXPECT_TRUE(std::dynamic_pointer_cast<const ALPSegment<TypeParam>>(segment));
+  }
+  EXPECT_TABLE_EQ_ORDERED(imported_table, table);
+
+  std::remove(filename.c_str());
+}
+
+}  // namespace hyrise
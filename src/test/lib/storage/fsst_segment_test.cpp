@@ -0,0 +1,270 @@
+#include <cstdio>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "base_test.hpp"
+#include "import_export/binary/binary_parser.hpp"
+#include "import_export/binary/binary_writer.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/create_iterable_from_segment.hpp"
+#include "storage/fsst_segment.hpp"
+#include "storage/fsst_segment/fsst_symbol_table.hpp"
+#include "storage/pos_lists/row_id_pos_list.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+class StorageFSSTSegmentTest : public BaseTest {
+ protected:
+  static std::vector<std::optional<pmr_string>> urls(const size_t count) {
+    auto values = std::vector<std::optional<pmr_string>>{};
+    for (auto index = size_t{0}; index < count; ++index) {
+      if (index % 11 == 0) {
+        values.emplace_back(std::nullopt);
+      } else if (index % 13 == 0) {
+        values.emplace_back("");
+      } else {
+        values.emplace_back("https://www.example.com/products/" + pmr_string{std::to_string(index % 97)} +
+                            "?ref=newsletter&page=" + pmr_string{std::to_string(index)});
+      }
+    }
+    return values;
+  }
+
+  static std::shared_ptr<FSSTSegment<pmr_string>> encode(const std::vector<std::optional<pmr_string>>& values) {
+    const auto value_segment = std::make_shared<ValueSegment<pmr_string>>(true);
+    for (const auto& value : values) {
+      value_segment->append(value ? AllTypeVariant{*value} : NULL_VALUE);
+    }
+
+    const auto encoded_segment =
+        ChunkEncoder::encode_segment(value_segment, DataType::String, SegmentEncodingSpec{EncodingType::FSST});
+    return std::dynamic_pointer_cast<FSSTSegment<pmr_string>>(encoded_segment);
+  }
+
+  static void expect_segment_equals(const FSSTSegment<pmr_string>& segment,
+                                    const std::vector<std::optional<pmr_string>>& values) {
+    ASSERT_EQ(segment.size(), values.size());
+
+    // Sequential access
+    auto chunk_offset = ChunkOffset{0};
+    create_iterable_from_segment<pmr_string, false>(segment).for_each([&](const auto& position) {
+      ASSERT_EQ(position.chunk_offset(), chunk_offset);
+      EXPECT_EQ(values[chunk_offset], position.is_null() ? std::nullopt : std::optional{position.value()});
+      ++chunk_offset;
+    });
+    EXPECT_EQ(chunk_offset, values.size());
+
+    // Point access, reading every third value in reverse order
+    const auto position_filter = std::make_shared<RowIDPosList>();
+    for (auto offset = static_cast<int64_t>(values.size()) - 1; offset >= 0; offset -= 3) {
+      position_filter->emplace_back(ChunkID{0}, ChunkOffset{static_cast<ChunkOffset::base_type>(offset)});
+    }
+    position_filter->guarantee_single_chunk();
+    auto position_filter_index = size_t{0};
+    create_iterable_from_segment<pmr_string, false>(segment).for_each(position_filter, [&](const auto& position) {
+      const auto referenced_chunk_offset = (*position_filter)[position_filter_index].chunk_offset;
+      EXPECT_EQ(values[referenced_chunk_offset],
+                position.is_null() ? std::nullopt : std::optional{position.value()});
+      ++position_filter_index;
+    });
+    EXPECT_EQ(position_filter_index, position_filter->size());
+
+    // Single-value access
+    for (auto offset = ChunkOffset{0}; offset < values.size(); ++offset) {
+      EXPECT_EQ(values[offset], segment.get_typed_value(offset));
+    }
+  }
+};
+
+TEST_F(StorageFSSTSegmentTest, SymbolTableCompressAndDecompress) {
+  const auto sample = std::vector<std::string_view>{"hello world", "hello there", "yellow hello", "world wide web"};
+  const auto symbol_table = FSSTSymbolTable::build(sample, PolymorphicAllocator<size_t>{});
+  EXPECT_FALSE(symbol_table.symbols().empty());
+  EXPECT_LE(symbol_table.symbols().size(), FSSTSymbolTable::max_symbol_count);
+
+  // Values that do not occur in the sample, including bytes that are not covered by any symbol, are escaped.
+  using namespace std::string_view_literals;  // NOLINT(build/namespaces)
+  for (const auto value : {"hello world"sv, ""sv, "hello wor"sv, "\xFF\xFE zzz \0 hello"sv, "qqqqqqqqqqqqqqqqqqqq"sv}) {
+    auto codes = std::string{};
+    symbol_table.compress(value, codes);
+    EXPECT_EQ(symbol_table.decompress(codes), value);
+  }
+
+  auto hello_world_codes = std::string{};
+  symbol_table.compress("hello world", hello_world_codes);
+  EXPECT_LT(hello_world_codes.size(), std::string_view{"hello world"}.size());
+
+  // Compression is deterministic, so equal values have equal codes and different values have different codes.
+  auto other_codes = std::string{};
+  symbol_table.compress("hello world", other_codes);
+  EXPECT_EQ(hello_world_codes, other_codes);
+  other_codes.clear();
+  symbol_table.compress("hello worle", other_codes);
+  EXPECT_NE(hello_world_codes, other_codes);
+
+  EXPECT_TRUE(symbol_table.starts_with(hello_world_codes, ""));
+  EXPECT_TRUE(symbol_table.starts_with(hello_world_codes, "h"));
+  EXPECT_TRUE(symbol_table.starts_with(hello_world_codes, "hello w"));
+  EXPECT_TRUE(symbol_table.starts_with(hello_world_codes, "hello world"));
+  EXPECT_FALSE(symbol_table.starts_with(hello_world_codes, "hello world!"));
+  EXPECT_FALSE(symbol_table.starts_with(hello_world_codes, "hello x"));
+  EXPECT_FALSE(symbol_table.starts_with(hello_world_codes, "world"));
+}
+
+TEST_F(StorageFSSTSegmentTest, SymbolTableOrder) {
+  // The constructor orders the symbols by their first byte and by descending length.
+  auto symbols = pmr_vector<uint64_t>{uint64_t{'b'}, uint64_t{'a'}, uint64_t{'a'} | (uint64_t{'b'} << 8)};
+  auto symbol_lengths = pmr_vector<uint8_t>{1, 1, 2};
+  const auto symbol_table = FSSTSymbolTable{std::move(symbols), std::move(symbol_lengths)};
+  EXPECT_EQ(symbol_table.symbols(), (pmr_vector<uint64_t>{uint64_t{'a'} | (uint64_t{'b'} << 8), 'a', 'b'}));
+  EXPECT_EQ(symbol_table.symbol_lengths(), (pmr_vector<uint8_t>{2, 1, 1}));
+
+  // The longest matching symbol wins.
+  auto codes = std::string{};
+  symbol_table.compress("abac", codes);
+  EXPECT_EQ(codes, (std::string{'\0', '\1', static_cast<char>(FSSTSymbolTable::escape_code), 'c'}));
+}
+
+TEST_F(StorageFSSTSegmentTest, EncodeValues) {
+  const auto values = urls(2'000);
+  const auto segment = encode(values);
+  ASSERT_TRUE(segment);
+  EXPECT_EQ(segment->encoding_type(), EncodingType::FSST);
+  EXPECT_EQ(segment->compressed_vector_type(), CompressedVectorType::BitPacking);
+  ASSERT_TRUE(segment->null_values());
+  EXPECT_TRUE((*segment->null_values())[0]);
+  EXPECT_FALSE((*segment->null_values())[1]);
+
+  // The URLs share most of their characters, so they should be compressed well.
+  auto uncompressed_size = size_t{0};
+  for (const auto& value : values) {
+    uncompressed_size += value ? value->size() : 0;
+  }
+  EXPECT_LT(segment->compressed_values().size() * 2, uncompressed_size);
+
+  expect_segment_equals(*segment, values);
+  EXPECT_EQ(segment->compressed_value(ChunkOffset{0}), std::string_view{});
+  EXPECT_EQ((*segment)[ChunkOffset{1}], AllTypeVariant{*values[1]});
+  EXPECT_TRUE(variant_is_null((*segment)[ChunkOffset{0}]));
+}
+
+TEST_F(StorageFSSTSegmentTest, EncodeEdgeCases) {
+  const auto empty_segment = encode({});
+  ASSERT_TRUE(empty_segment);
+  EXPECT_EQ(empty_segment->size(), 0);
+  EXPECT_TRUE(empty_segment->symbol_table().symbols().empty());
+
+  const auto null_values = std::vector<std::optional<pmr_string>>(3, std::nullopt);
+  const auto null_segment = encode(null_values);
+  ASSERT_TRUE(null_segment);
+  EXPECT_TRUE(null_segment->compressed_values().empty());
+  expect_segment_equals(*null_segment, null_values);
+
+  const auto special_values = std::vector<std::optional<pmr_string>>{
+      pmr_string{"a\0b", 3}, "", pmr_string(300, 'x'), "\xF0\x9F\x98\x80 emoji", std::nullopt, "abcdefghijklmnop"};
+  const auto special_segment = encode(special_values);
+  ASSERT_TRUE(special_segment);
+  expect_segment_equals(*special_segment, special_values);
+}
+
+TEST_F(StorageFSSTSegmentTest, CopyUsingAllocator) {
+  const auto values = urls(100);
+  const auto segment = encode(values);
+  ASSERT_TRUE(segment);
+
+  const auto copied_segment =
+      std::dynamic_pointer_cast<FSSTSegment<pmr_string>>(segment->copy_using_allocator(PolymorphicAllocator<size_t>{}));
+  ASSERT_TRUE(copied_segment);
+  expect_segment_equals(*copied_segment, values);
+  EXPECT_EQ(copied_segment->symbol_table().symbols(), segment->symbol_table().symbols());
+  EXPECT_GT(copied_segment->memory_usage(MemoryUsageCalculationMode::Full), segment->compressed_values().size());
+}
+
+TEST_F(StorageFSSTSegmentTest, ScanCompressedValues) {
+  const auto create_table = [](const std::optional<SegmentEncodingSpec>& encoding_spec) {
+    const auto column_definitions = TableColumnDefinitions{{"a", DataType::String, true}};
+    const auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{700});
+    for (const auto& value : urls(2'000)) {
+      table->append({value ? AllTypeVariant{*value} : NULL_VALUE});
+    }
+    table->last_chunk()->set_immutable();
+    if (encoding_spec) {
+      ChunkEncoder::encode_all_chunks(table, *encoding_spec);
+    }
+
+    const auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->never_clear_output();
+    table_wrapper->execute();
+    return table_wrapper;
+  };
+
+  const auto table_wrapper = create_table(std::nullopt);
+  const auto encoded_table_wrapper = create_table(SegmentEncodingSpec{EncodingType::FSST});
+
+  const auto equal_value = pmr_string{"https://www.example.com/products/5?ref=newsletter&page=5"};
+  const auto predicates = std::vector<std::pair<PredicateCondition, pmr_string>>{
+      {PredicateCondition::Equals, equal_value},
+      {PredicateCondition::Equals, pmr_string{""}},
+      {PredicateCondition::Equals, pmr_string{"does not exist"}},
+      {PredicateCondition::NotEquals, equal_value},
+      {PredicateCondition::Like, equal_value},
+      {PredicateCondition::Like, pmr_string{"https://www.example.com/products/4%"}},
+      {PredicateCondition::Like, pmr_string{"%"}},
+      {PredicateCondition::NotLike, pmr_string{"https://www.example.com/products/4%"}},
+      {PredicateCondition::NotLike, pmr_string{""}},
+      {PredicateCondition::Like, pmr_string{"%page=1_"}}};
+
+  for (const auto& [predicate_condition, value] : predicates) {
+    SCOPED_TRACE(value);
+    const auto expected_scan = create_table_scan(table_wrapper, ColumnID{0}, predicate_condition, value);
+    expected_scan->execute();
+    const auto scan = create_table_scan(encoded_table_wrapper, ColumnID{0}, predicate_condition, value);
+    scan->execute();
+    EXPECT_TABLE_EQ_UNORDERED(scan->get_output(), expected_scan->get_output());
+
+    // The second scan receives reference segments, so that the FSST segments are scanned with a position filter.
+    const auto expected_filtered_scan =
+        create_table_scan(expected_scan, ColumnID{0}, PredicateCondition::NotEquals, pmr_string{"x"});
+    expected_filtered_scan->execute();
+    const auto pre_filter = create_table_scan(encoded_table_wrapper, ColumnID{0}, PredicateCondition::NotEquals,
+                                              pmr_string{"x"});
+    pre_filter->execute();
+    const auto filtered_scan = create_table_scan(pre_filter, ColumnID{0}, predicate_condition, value);
+    filtered_scan->execute();
+    EXPECT_TABLE_EQ_UNORDERED(filtered_scan->get_output(), expected_filtered_scan->get_output());
+  }
+}
+
+TEST_F(StorageFSSTSegmentTest, BinaryExportImport) {
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::String, true}};
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{1'500});
+  for (const auto& value : urls(2'000)) {
+    table->append({value ? AllTypeVariant{*value} : NULL_VALUE});
+  }
+  table->last_chunk()->set_immutable();
+  ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{EncodingType::FSST});
+
+  const auto filename = test_data_path + "fsst_segment_export.bin";
+  BinaryWriter::write(*table, filename);
+  const auto imported_table = BinaryParser::parse(filename);
+
+  ASSERT_EQ(imported_table->chunk_count(), 2);
+  for (auto chunk_id = ChunkID{0}; chunk_id < imported_table->chunk_count(); ++chunk_id) {
+    const auto segment = imported_table->get_chunk(chunk_id)->get_segment(ColumnID{0});
+    EXPECT_TRUE(std::dynamic_pointer_cast<const FSSTSegment<pmr_string>>(segment));
+  }
+  EXPECT_TABLE_EQ_ORDERED(imported_table, table);
+
+  std::remove(filename.c_str());
+}
+
+}  // namespace hyrise
@@ -0,0 +1,199 @@
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "base_test.hpp"
+#include "operators/aggregate_hash.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/global_dictionary_utils.hpp"
+
+namespace hyrise {
+
+class GlobalDictionaryUtilsTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // A fact table whose string column references the string column of a dimension table.
+    for (const auto use_global_dictionary : {true, false}) {
+      auto fact_table = std::make_shared<Table>(
+          TableColumnDefinitions{{"key", DataType::String, true}, {"a", DataType::Int, false}}, TableType::Data,
+          ChunkOffset{3});
+      auto dimension_table = std::make_shared<Table>(
+          TableColumnDefinitions{{"key", DataType::String, false}, {"b", DataType::Int, false}}, TableType::Data,
+          ChunkOffset{2});
+
+      const auto keys = std::vector<AllTypeVariant>{"delta", "alpha", NULL_VALUE, "charlie", "alpha", "echo",
+                                                    "delta", "delta", "foxtrot", NULL_VALUE, "charlie"};
+      for (auto index = size_t{0}; index < keys.size(); ++index) {
+        fact_table->append({keys[index], static_cast<int32_t>(index)});
+      }
+      auto index = int32_t{0};
+      for (const auto* const key : {"alpha", "bravo", "charlie", "delta", "echo"}) {
+        dimension_table->append({pmr_string{key}, index++});
+      }
+      fact_table->last_chunk()->set_immutable();
+      dimension_table->last_chunk()->set_immutable();
+
+      if (use_global_dictionary) {
+        ChunkEncoder::encode_with_global_dictionary({{fact_table, ColumnID{0}}, {dimension_table, ColumnID{0}}});
+        _fact_table = fact_table;
+        _dimension_table = dimension_table;
+      } else {
+        ChunkEncoder::encode_all_chunks(fact_table, SegmentEncodingSpec{EncodingType::Dictionary});
+        ChunkEncoder::encode_all_chunks(dimension_table, SegmentEncodingSpec{EncodingType::Dictionary});
+        _local_fact_table = fact_table;
+        _local_dimension_table = dimension_table;
+      }
+    }
+  }
+
+  static std::shared_ptr<TableWrapper> _wrap(const std::shared_ptr<const Table>& table) {
+    const auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->never_clear_output();
+    table_wrapper->execute();
+    return table_wrapper;
+  }
+
+  // Sorting by the second column returns a reference table whose chunks reference multiple chunks.
+  static std::shared_ptr<AbstractOperator> _shuffled(const std::shared_ptr<const Table>& table) {
+    const auto sort = std::make_shared<Sort>(
+        _wrap(table), std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{1}, SortMode::Descending}});
+    sort->never_clear_output();
+    sort->execute();
+    return sort;
+  }
+
+  std::shared_ptr<Table> _fact_table, _dimension_table, _local_fact_table, _local_dimension_table;
+};
+
+TEST_F(GlobalDictionaryUtilsTest, EncodeWithGlobalDictionary) {
+  const auto dictionary = global_dictionary<pmr_string>(*_fact_table, ColumnID{0});
+  ASSERT_TRUE(dictionary);
+  EXPECT_EQ(*dictionary, (pmr_vector<pmr_string>{"alpha", "bravo", "charlie", "delta", "echo", "foxtrot"}));
+  EXPECT_EQ(global_dictionary<pmr_string>(*_dimension_table, ColumnID{0}), dictionary);
+
+  // The pruning statistics and the zone maps only cover the values of the respective chunk.
+  const auto& segment = static_cast<const DictionarySegment<pmr_string>&>(
+      *_fact_table->get_chunk(ChunkID{0})->get_segment(ColumnID{0}));
+  EXPECT_EQ(segment.null_value_id(), ValueID{6});
+  EXPECT_TRUE(_fact_table->get_chunk(ChunkID{0})->pruning_statistics());
+  EXPECT_TRUE(segment.zone_map());
+
+  // Each segment reports its own distinct values and a share of the dictionary's memory. Copies own their dictionary.
+  EXPECT_TRUE(segment.shares_dictionary());
+  EXPECT_EQ(segment.unique_values_count(), 2);
+  const auto copy = std::static_pointer_cast<const DictionarySegment<pmr_string>>(segment.copy_using_allocator({}));
+  EXPECT_FALSE(copy->shares_dictionary());
+  EXPECT_EQ(copy->unique_values_count(), 2);
+  EXPECT_LT(segment.memory_usage(MemoryUsageCalculationMode::Full),
+            copy->memory_usage(MemoryUsageCalculationMode::Full));
+
+  // Only columns whose segments all share the dictionary have a global dictionary.
+  EXPECT_FALSE(global_dictionary<pmr_string>(*_local_fact_table, ColumnID{0}));
+  EXPECT_FALSE(global_dictionary<int32_t>(*_fact_table, ColumnID{1}));
+
+  _fact_table->append({"golf", 11});
+  EXPECT_FALSE(global_dictionary<pmr_string>(*_fact_table, ColumnID{0}));
+}
+
+TEST_F(GlobalDictionaryUtilsTest, ForEachGlobalValueID) {
+  // Data tables, reference tables that reference a single chunk per chunk, and reference tables that reference
+  // multiple chunks per chunk.
+  const auto table_scan = std::make_shared<TableScan>(
+      _wrap(_fact_table), greater_than_equals_(pqp_column_(ColumnID{1}, DataType::Int, false, "a"), 0));
+  table_scan->execute();
+
+  for (const auto& table : {std::shared_ptr<const Table>{_fact_table}, table_scan->get_output(),
+                            _shuffled(_fact_table)->get_output()}) {
+    const auto dictionary = global_dictionary<pmr_string>(*table, ColumnID{0});
+    ASSERT_TRUE(dictionary);
+
+    auto value_ids = std::vector<std::optional<ValueID>>{};
+    auto expected_value_ids = std::vector<std::optional<ValueID>>{};
+    const auto chunk_count = table->chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto& segment = *table->get_chunk(chunk_id)->get_segment(ColumnID{0});
+      auto chunk_offset = ChunkOffset{0};
+      for_each_global_value_id(segment, [&](const auto& position) {
+        EXPECT_EQ(position.chunk_offset(), chunk_offset);
+        value_ids.emplace_back(position.is_null() ? std::nullopt : std::optional<ValueID>{position.value()});
+        ++chunk_offset;
+      });
+      EXPECT_EQ(chunk_offset, segment.size());
+
+      for (auto offset = ChunkOffset{0}; offset < segment.size(); ++offset) {
+        const auto value = segment[offset];
+        if (variant_is_null(value)) {
+          expected_value_ids.emplace_back(std::nullopt);
+        } else {
+          const auto iter = std::lower_bound(dictionary->cbegin(), dictionary->cend(), boost::get<pmr_string>(value));
+          expected_value_ids.emplace_back(ValueID{static_cast<ValueID::base_type>(iter - dictionary->cbegin())});
+        }
+      }
+    }
+    EXPECT_EQ(value_ids, expected_value_ids);
+  }
+}
+
+TEST_F(GlobalDictionaryUtilsTest, OperatorsOnValueIDs) {
+  // The operators use the value IDs of the global dictionary, but yield the same results as for chunk-local
+  // dictionaries.
+  for (const auto shuffle : {false, true}) {
+    const auto input = [&](const std::shared_ptr<const Table>& table) -> std::shared_ptr<AbstractOperator> {
+      return shuffle ? _shuffled(table) : _wrap(table);
+    };
+
+    for (const auto join_mode : {JoinMode::Inner, JoinMode::Left, JoinMode::Semi, JoinMode::AntiNullAsTrue}) {
+      const auto predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals};
+      const auto join = std::make_shared<JoinHash>(input(_fact_table), input(_dimension_table), join_mode, predicate);
+      const auto local_join =
+          std::make_shared<JoinHash>(input(_local_fact_table), input(_local_dimension_table), join_mode, predicate);
+      join->execute();
+      local_join->execute();
+      EXPECT_TABLE_EQ_UNORDERED(join->get_output(), local_join->get_output());
+    }
+
+    const auto aggregates = std::vector<std::shared_ptr<WindowFunctionExpression>>{
+        count_(pqp_column_(INVALID_COLUMN_ID, DataType::Long, false, "*")),
+        sum_(pqp_column_(ColumnID{1}, DataType::Int, false, "a"))};
+    for (const auto& group_by_column_ids :
+         std::vector<std::vector<ColumnID>>{{ColumnID{0}}, {ColumnID{0}, ColumnID{1}}}) {
+      const auto aggregate = std::make_shared<AggregateHash>(input(_fact_table), aggregates, group_by_column_ids);
+      const auto local_aggregate =
+          std::make_shared<AggregateHash>(input(_local_fact_table), aggregates, group_by_column_ids);
+      aggregate->execute();
+      local_aggregate->execute();
+      EXPECT_TABLE_EQ_UNORDERED(aggregate->get_output(), local_aggregate->get_output());
+    }
+
+    // LIKE scans find the matches in the shared dictionary only once, but yield the same results. Scans for equality
+    // must not assume that a segment with a single distinct value only contains the value of the shared dictionary.
+    const auto key = pqp_column_(ColumnID{0}, DataType::String, true, "key");
+    for (const auto& predicate : {like_(key, "%a%"), not_like_(key, "%a%"), equals_(key, "alpha"),
+                                  not_equals_(key, "charlie")}) {
+      const auto table_scan = std::make_shared<TableScan>(input(_fact_table), predicate);
+      const auto local_table_scan = std::make_shared<TableScan>(input(_local_fact_table), predicate);
+      table_scan->execute();
+      local_table_scan->execute();
+      EXPECT_TABLE_EQ_UNORDERED(table_scan->get_output(), local_table_scan->get_output());
+    }
+
+    for (const auto sort_mode : {SortMode::Ascending, SortMode::Descending}) {
+      const auto sort_definitions = std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}, sort_mode},
+                                                                      SortColumnDefinition{ColumnID{1}}};
+      const auto sort = std::make_shared<Sort>(input(_fact_table), sort_definitions);
+      const auto local_sort = std::make_shared<Sort>(input(_local_fact_table), sort_definitions);
+      sort->execute();
+      local_sort->execute();
+      EXPECT_TABLE_EQ_ORDERED(sort->get_output(), local_sort->get_output());
+    }
+  }
+}
+
+}  // namespace hyrise
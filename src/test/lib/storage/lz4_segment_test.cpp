@@ -1,6 +1,10 @@
+#include <algorithm>
+#include <atomic>
 #include <memory>
 #include <string>
+#include <thread>
 #include <utility>
+#include <vector>
 
 #include "all_type_variant.hpp"
 #include "base_test.hpp"
@@ -342,4 +346,37 @@ TEST_F(StorageLZ4SegmentTest, CompressDictionaryIntSegment) {
   EXPECT_EQ(decompressed_data[20124], 40248);
 }
 
+TEST_F(StorageLZ4SegmentTest, ConcurrentPointAccessesUsingBlockCache) {
+  const auto num_rows = size_t{100'000 / 4};
+  for (auto index = size_t{0}; index < num_rows; ++index) {
+    vs_int->append(static_cast<int>(index * 2));
+  }
+  auto lz4_segment = compress(vs_int, DataType::Int);
+  ASSERT_GT(lz4_segment->lz4_blocks().size(), LZ4Segment<int>::block_cache_capacity);
+
+  // Alternate between more blocks than the cache can hold from multiple threads. Every thread starts at a different
+  // block so that cache hits, misses, and evictions interleave.
+  const auto thread_count = size_t{8};
+  const auto values_per_block = LZ4Encoder::_block_size / sizeof(int);
+  auto threads = std::vector<std::thread>{};
+  auto mismatches = std::atomic<size_t>{0};
+  for (auto thread_id = size_t{0}; thread_id < thread_count; ++thread_id) {
+    threads.emplace_back([&, thread_id]() {
+      for (auto index = size_t{0}; index < 1'000; ++index) {
+        const auto block_index = (thread_id + index) % lz4_segment->lz4_blocks().size();
+        const auto chunk_offset = static_cast<ChunkOffset::base_type>(
+            std::min(block_index * values_per_block + (index % values_per_block), num_rows - 1));
+        const auto value = lz4_segment->get_typed_value(ChunkOffset{chunk_offset});
+        if (!value || *value != static_cast<int>(chunk_offset * 2)) {
+          ++mismatches;
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(mismatches, 0);
+}
+
 }  // namespace hyrise
@@ -0,0 +1,152 @@
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+#include "base_test.hpp"
+#include "operators/get_table.hpp"
+#include "operators/table_scan.hpp"
+#include "storage/pos_lists/compressed_pos_list.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_iterate.hpp"
+
+namespace hyrise {
+
+class CompressedPosListTest : public BaseTest {
+ protected:
+  static std::vector<ChunkOffset> _offsets(const std::vector<ChunkOffset::base_type>& values) {
+    auto offsets = std::vector<ChunkOffset>{};
+    for (const auto value : values) {
+      offsets.emplace_back(value);
+    }
+    return offsets;
+  }
+
+  static std::vector<ChunkOffset> _offsets(const CompressedPosList& pos_list) {
+    auto offsets = std::vector<ChunkOffset>{};
+    for (const auto row_id : pos_list) {
+      EXPECT_EQ(row_id.chunk_id, pos_list.common_chunk_id());
+      offsets.emplace_back(row_id.chunk_offset);
+    }
+    return offsets;
+  }
+
+  // Stored as a bitmap.
+  static std::vector<ChunkOffset> _every_second_offset() {
+    auto offsets = std::vector<ChunkOffset>{};
+    for (auto offset = ChunkOffset{0}; offset < 2'000; offset += 2) {
+      offsets.emplace_back(offset);
+    }
+    return offsets;
+  }
+
+  // Stored as a single run.
+  static std::vector<ChunkOffset> _run() {
+    auto offsets = std::vector<ChunkOffset>(1'000);
+    std::iota(offsets.begin(), offsets.end(), ChunkOffset{3'000});
+    return offsets;
+  }
+};
+
+TEST_F(CompressedPosListTest, ChoosesSmallestRepresentation) {
+  const auto empty_pos_list = CompressedPosList{ChunkID{0}, {}};
+  EXPECT_TRUE(empty_pos_list.empty());
+  EXPECT_EQ(empty_pos_list.size(), 0);
+  EXPECT_EQ(empty_pos_list.begin(), empty_pos_list.end());
+
+  const auto array_pos_list = CompressedPosList{ChunkID{0}, _offsets({5, 1'000, 50'000})};
+  EXPECT_EQ(array_pos_list.representation(), CompressedPosList::Representation::Array);
+
+  const auto runs_pos_list = CompressedPosList{ChunkID{0}, _run()};
+  EXPECT_EQ(runs_pos_list.representation(), CompressedPosList::Representation::Runs);
+  EXPECT_EQ(runs_pos_list.size(), 1'000);
+  EXPECT_LT(runs_pos_list.memory_usage(MemoryUsageCalculationMode::Full), sizeof(CompressedPosList) + 100);
+
+  const auto bitmap_pos_list = CompressedPosList{ChunkID{0}, _every_second_offset()};
+  EXPECT_EQ(bitmap_pos_list.representation(), CompressedPosList::Representation::Bitmap);
+  EXPECT_EQ(bitmap_pos_list.size(), 1'000);
+
+  // A RowIDPosList would require eight bytes per position, an array of offsets four bytes.
+  EXPECT_LT(bitmap_pos_list.memory_usage(MemoryUsageCalculationMode::Full), sizeof(CompressedPosList) + 1'000);
+}
+
+TEST_F(CompressedPosListTest, AccessPositions) {
+  auto mixed_offsets = _every_second_offset();
+  const auto run = _run();
+  mixed_offsets.insert(mixed_offsets.end(), run.begin(), run.end());
+  mixed_offsets.emplace_back(60'000);
+
+  for (const auto& offsets : {_offsets({5, 1'000, 50'000}), _run(), _every_second_offset(), mixed_offsets}) {
+    const auto pos_list = CompressedPosList{ChunkID{7}, offsets};
+    EXPECT_TRUE(pos_list.references_single_chunk());
+    EXPECT_EQ(pos_list.common_chunk_id(), ChunkID{7});
+    ASSERT_EQ(pos_list.size(), offsets.size());
+    EXPECT_EQ(_offsets(pos_list), offsets);
+
+    for (auto index = size_t{0}; index < offsets.size(); index += 7) {
+      EXPECT_EQ(pos_list[index], (RowID{ChunkID{7}, offsets[index]}));
+      EXPECT_EQ(*(pos_list.begin() + index), (RowID{ChunkID{7}, offsets[index]}));
+    }
+
+    // Iterate backwards, as done by, e.g., std::prev.
+    auto iter = pos_list.end();
+    for (auto index = offsets.size(); index > 0; --index) {
+      --iter;
+      EXPECT_EQ(iter->chunk_offset, offsets[index - 1]);
+    }
+    EXPECT_EQ(pos_list.end() - pos_list.begin(), offsets.size());
+  }
+}
+
+TEST_F(CompressedPosListTest, Unite) {
+  const auto bitmap_pos_list = CompressedPosList{ChunkID{2}, _every_second_offset()};
+  const auto array_pos_list = CompressedPosList{ChunkID{2}, _offsets({1, 2, 3, 4, 1'998, 50'000})};
+
+  const auto united_pos_list = CompressedPosList::unite(bitmap_pos_list, array_pos_list);
+  EXPECT_EQ(united_pos_list->common_chunk_id(), ChunkID{2});
+  EXPECT_EQ(united_pos_list->size(), 1'003);
+  EXPECT_EQ((*united_pos_list)[1], (RowID{ChunkID{2}, ChunkOffset{1}}));
+  EXPECT_EQ((*united_pos_list)[1'002], (RowID{ChunkID{2}, ChunkOffset{50'000}}));
+
+  const auto runs_pos_list = CompressedPosList{ChunkID{2}, _run()};
+  EXPECT_EQ(CompressedPosList::unite(runs_pos_list, runs_pos_list)->representation(),
+            CompressedPosList::Representation::Runs);
+
+  if constexpr (HYRISE_DEBUG) {
+    EXPECT_THROW(CompressedPosList(ChunkID{0}, _offsets({3, 2})), std::logic_error);
+    EXPECT_THROW(CompressedPosList::unite(bitmap_pos_list, CompressedPosList{ChunkID{3}, {}}), std::logic_error);
+  }
+}
+
+TEST_F(CompressedPosListTest, TableScanOutput) {
+  const auto table = load_table("resources/test_data/tbl/int_float.tbl", ChunkOffset{2});
+  Hyrise::get().storage_manager.add_table("int_float", table);
+
+  const auto get_table = std::make_shared<GetTable>("int_float");
+  const auto column = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+  const auto table_scan = std::make_shared<TableScan>(get_table, greater_than_(column, 123));
+  execute_all({get_table, table_scan});
+
+  const auto& output = table_scan->get_output();
+  ASSERT_GT(output->chunk_count(), 0);
+  for (auto chunk_id = ChunkID{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+    const auto segment = output->get_chunk(chunk_id)->get_segment(ColumnID{0});
+    const auto& pos_list = static_cast<const ReferenceSegment&>(*segment).pos_list();
+    if (pos_list->size() < table->get_chunk(pos_list->common_chunk_id())->size()) {
+      EXPECT_TRUE(std::dynamic_pointer_cast<const CompressedPosList>(pos_list));
+    }
+  }
+
+  // Segments referenced by CompressedPosLists are iterated like any other ReferenceSegment.
+  auto values = std::vector<int32_t>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+    segment_iterate<int32_t>(*output->get_chunk(chunk_id)->get_segment(ColumnID{0}), [&](const auto& position) {
+      values.emplace_back(position.value());
+    });
+  }
+  std::sort(values.begin(), values.end());
+  EXPECT_EQ(values, (std::vector<int32_t>{1234, 12345}));
+}
+
+}  // namespace hyrise
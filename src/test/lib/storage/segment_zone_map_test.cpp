@@ -0,0 +1,136 @@
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+#include "storage/abstract_encoded_segment.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/encoding_type.hpp"
+#include "storage/segment_zone_map.hpp"
+#include "storage/value_segment.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+class SegmentZoneMapTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Three blocks: the values of the first block are 0..2047, except for the outlier 1'000'000 at offset 5. The second
+    // block contains 5'000..7'047, and the third (partial) block only contains NULLs.
+    auto values = pmr_vector<int32_t>(BLOCK_SIZE * 2 + 100);
+    auto null_values = pmr_vector<bool>(values.size(), false);
+    for (auto offset = size_t{0}; offset < BLOCK_SIZE; ++offset) {
+      values[offset] = static_cast<int32_t>(offset);
+      values[BLOCK_SIZE + offset] = static_cast<int32_t>(5'000 + offset);
+    }
+    values[5] = 1'000'000;
+    for (auto offset = BLOCK_SIZE * 2; offset < values.size(); ++offset) {
+      null_values[offset] = true;
+    }
+    // A single NULL in the first block.
+    null_values[7] = true;
+
+    _value_segment = std::make_shared<ValueSegment<int32_t>>(std::move(values), std::move(null_values));
+  }
+
+  std::shared_ptr<const BaseSegmentZoneMap> _encode_and_get_zone_map(const SegmentEncodingSpec& encoding_spec) {
+    const auto encoded_segment = std::dynamic_pointer_cast<AbstractEncodedSegment>(
+        ChunkEncoder::encode_segment(_value_segment, DataType::Int, encoding_spec));
+    EXPECT_TRUE(encoded_segment);
+    return encoded_segment->zone_map();
+  }
+
+  static inline const auto BLOCK_SIZE = size_t{BaseSegmentZoneMap::BLOCK_SIZE};
+  std::shared_ptr<ValueSegment<int32_t>> _value_segment;
+};
+
+TEST_F(SegmentZoneMapTest, BuildZoneMap) {
+  const auto zone_map = std::dynamic_pointer_cast<SegmentZoneMap<int32_t>>(build_segment_zone_map(*_value_segment));
+  ASSERT_TRUE(zone_map);
+
+  EXPECT_EQ(zone_map->segment_size(), _value_segment->size());
+  ASSERT_EQ(zone_map->block_count(), 3);
+  EXPECT_EQ(zone_map->block_range(1), (ChunkOffsetRange{ChunkOffset{2048}, ChunkOffset{4096}}));
+  EXPECT_EQ(zone_map->block_range(2), (ChunkOffsetRange{ChunkOffset{4096}, ChunkOffset{4196}}));
+
+  EXPECT_EQ(zone_map->minimum(0), 0);
+  EXPECT_EQ(zone_map->maximum(0), 1'000'000);
+  EXPECT_EQ(zone_map->minimum(1), 5'000);
+  EXPECT_EQ(zone_map->maximum(1), 7'047);
+
+  EXPECT_EQ(zone_map->null_count(0), 1);
+  EXPECT_EQ(zone_map->null_count(1), 0);
+  EXPECT_EQ(zone_map->null_count(2), 100);
+
+  EXPECT_GT(zone_map->memory_usage(), 3 * (2 * sizeof(int32_t) + sizeof(ChunkOffset)));
+}
+
+TEST_F(SegmentZoneMapTest, QualifyingRanges) {
+  const auto zone_map = build_segment_zone_map(*_value_segment);
+  const auto first_block = ChunkOffsetRange{ChunkOffset{0}, ChunkOffset{2048}};
+  const auto first_two_blocks = ChunkOffsetRange{ChunkOffset{0}, ChunkOffset{4096}};
+  const auto third_block = ChunkOffsetRange{ChunkOffset{4096}, ChunkOffset{4196}};
+  using Ranges = std::vector<ChunkOffsetRange>;
+
+  // The outlier keeps the first block, but only the first block.
+  EXPECT_EQ(zone_map->qualifying_ranges(PredicateCondition::Equals, 3'000), Ranges{first_block});
+  EXPECT_EQ(zone_map->qualifying_ranges(PredicateCondition::Equals, 6'000), Ranges{first_two_blocks});
+  EXPECT_EQ(zone_map->qualifying_ranges(PredicateCondition::Equals, 2'000'000), Ranges{});
+  EXPECT_EQ(zone_map->qualifying_ranges(PredicateCondition::LessThan, 5'000), Ranges{first_block});
+  EXPECT_EQ(zone_map->qualifying_ranges(PredicateCondition::GreaterThan, 7'047), Ranges{first_block});
+  EXPECT_EQ(zone_map->qualifying_ranges(PredicateCondition::NotEquals, 5), Ranges{first_two_blocks});
+  EXPECT_EQ(zone_map->qualifying_ranges(PredicateCondition::BetweenInclusive, 4'000, AllTypeVariant{4'999}),
+            Ranges{first_block});
+  EXPECT_EQ(zone_map->qualifying_ranges(PredicateCondition::BetweenExclusive, 1'000'000, AllTypeVariant{2'000'000}),
+            Ranges{});
+
+  // Comparisons with NULL never match.
+  EXPECT_EQ(zone_map->qualifying_ranges(PredicateCondition::Equals, NULL_VALUE), Ranges{});
+
+  // Blocks without NULLs are skipped for IS NULL, blocks with only NULLs are skipped for IS NOT NULL.
+  EXPECT_EQ(zone_map->qualifying_ranges(PredicateCondition::IsNull, NULL_VALUE), (Ranges{first_block, third_block}));
+  EXPECT_EQ(zone_map->qualifying_ranges(PredicateCondition::IsNotNull, NULL_VALUE), Ranges{first_two_blocks});
+
+  // Predicates that cannot be evaluated on the zone map keep all blocks except for those that only contain NULLs.
+  EXPECT_EQ(zone_map->qualifying_ranges(PredicateCondition::Like, 5), Ranges{first_two_blocks});
+}
+
+TEST_F(SegmentZoneMapTest, StringsAndFloats) {
+  const auto string_segment = std::make_shared<ValueSegment<pmr_string>>(
+      pmr_vector<pmr_string>{"apple", "banana", "cherry"}, pmr_vector<bool>{false, true, false});
+  const auto string_zone_map =
+      std::dynamic_pointer_cast<SegmentZoneMap<pmr_string>>(build_segment_zone_map(*string_segment));
+  ASSERT_TRUE(string_zone_map);
+  EXPECT_EQ(string_zone_map->minimum(0), "apple");
+  EXPECT_EQ(string_zone_map->maximum(0), "cherry");
+  EXPECT_EQ(string_zone_map->null_count(0), 1);
+  EXPECT_TRUE(string_zone_map->qualifying_ranges(PredicateCondition::Like, pmr_string{"dat%"}).empty());
+  EXPECT_EQ(string_zone_map->qualifying_ranges(PredicateCondition::Like, pmr_string{"ban%"}).size(), 1);
+
+  // NaNs cannot be ordered, so that blocks containing them are never skipped.
+  const auto float_segment = std::make_shared<ValueSegment<float>>(
+      pmr_vector<float>{1.0f, std::numeric_limits<float>::quiet_NaN(), 2.0f});
+  const auto float_zone_map = build_segment_zone_map(*float_segment);
+  EXPECT_EQ(float_zone_map->qualifying_ranges(PredicateCondition::NotEquals, 1.5f).size(), 1);
+  EXPECT_EQ(float_zone_map->qualifying_ranges(PredicateCondition::GreaterThan, 3.0f).size(), 1);
+}
+
+TEST_F(SegmentZoneMapTest, EncodersBuildZoneMaps) {
+  for (const auto encoding_type : {EncodingType::Dictionary, EncodingType::RunLength, EncodingType::FrameOfReference,
+                                   EncodingType::LZ4}) {
+    const auto zone_map = _encode_and_get_zone_map(SegmentEncodingSpec{encoding_type});
+    ASSERT_TRUE(zone_map);
+    EXPECT_EQ(zone_map->block_count(), 3);
+    EXPECT_EQ(zone_map->null_count(2), 100);
+  }
+
+  const auto encoded_segment = std::dynamic_pointer_cast<AbstractEncodedSegment>(
+      ChunkEncoder::encode_segment(_value_segment, DataType::Int, SegmentEncodingSpec{EncodingType::Dictionary}));
+  const auto copied_segment =
+      std::dynamic_pointer_cast<AbstractEncodedSegment>(encoded_segment->copy_using_allocator({}));
+  EXPECT_EQ(copied_segment->zone_map(), encoded_segment->zone_map());
+}
+
+}  // namespace hyrise
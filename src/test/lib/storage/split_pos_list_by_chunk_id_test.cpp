@@ -0,0 +1,45 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+#include "storage/pos_lists/compressed_pos_list.hpp"
+#include "storage/pos_lists/row_id_pos_list.hpp"
+#include "storage/split_pos_list_by_chunk_id.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+class SplitPosListByChunkIDTest : public BaseTest {};
+
+TEST_F(SplitPosListByChunkIDTest, SplitPosList) {
+  const auto pos_list = std::make_shared<RowIDPosList>(RowIDPosList{
+      RowID{ChunkID{2}, ChunkOffset{1}}, RowID{ChunkID{0}, ChunkOffset{4}}, NULL_ROW_ID,
+      RowID{ChunkID{2}, ChunkOffset{3}}, RowID{ChunkID{0}, ChunkOffset{2}}, RowID{ChunkID{2}, ChunkOffset{7}}});
+
+  const auto pos_lists_by_chunk_id = split_pos_list_by_chunk_id(pos_list, 3);
+  ASSERT_EQ(pos_lists_by_chunk_id.size(), 3);
+
+  // The entries of chunk 0 are not sorted and are kept in a RowIDPosList.
+  const auto& chunk_0 = pos_lists_by_chunk_id[0];
+  ASSERT_TRUE(std::dynamic_pointer_cast<const RowIDPosList>(chunk_0.row_ids));
+  EXPECT_TRUE(chunk_0.row_ids->references_single_chunk());
+  EXPECT_EQ(*std::dynamic_pointer_cast<const RowIDPosList>(chunk_0.row_ids),
+            (RowIDPosList{RowID{ChunkID{0}, ChunkOffset{4}}, RowID{ChunkID{0}, ChunkOffset{2}}}));
+  EXPECT_EQ(chunk_0.original_positions, (std::vector<ChunkOffset>{ChunkOffset{1}, ChunkOffset{4}}));
+
+  EXPECT_FALSE(pos_lists_by_chunk_id[1].row_ids);
+  EXPECT_TRUE(pos_lists_by_chunk_id[1].original_positions.empty());
+
+  // The entries of chunk 2 are sorted and are compressed.
+  const auto& chunk_2 = pos_lists_by_chunk_id[2];
+  ASSERT_TRUE(std::dynamic_pointer_cast<const CompressedPosList>(chunk_2.row_ids));
+  EXPECT_EQ(chunk_2.row_ids->common_chunk_id(), ChunkID{2});
+  ASSERT_EQ(chunk_2.row_ids->size(), 3);
+  EXPECT_EQ((*chunk_2.row_ids)[0], (RowID{ChunkID{2}, ChunkOffset{1}}));
+  EXPECT_EQ((*chunk_2.row_ids)[1], (RowID{ChunkID{2}, ChunkOffset{3}}));
+  EXPECT_EQ((*chunk_2.row_ids)[2], (RowID{ChunkID{2}, ChunkOffset{7}}));
+  EXPECT_EQ(chunk_2.original_positions,
+            (std::vector<ChunkOffset>{ChunkOffset{0}, ChunkOffset{3}, ChunkOffset{5}}));
+}
+
+}  // namespace hyrise
@@ -81,6 +81,30 @@ TEST_F(DateTimeUtilsTest, StringToDateTime) {
   EXPECT_EQ(timestamp_with_overflow->time_of_day().seconds(), 1);
 }
 
+TEST_F(DateTimeUtilsTest, FixedWidthParsingMatchesBoost) {
+  // Dates and timestamps in fixed-width format are parsed without Boost. Compare the results to Boost's parsing.
+  for (auto date = boost::gregorian::date{1999, 1, 1}; date <= boost::gregorian::date{2001, 1, 1};
+       date += boost::gregorian::days{1}) {
+    const auto date_string = date_to_string(date);
+    EXPECT_EQ(string_to_timestamp(date_string), boost::posix_time::ptime{date});
+
+    const auto timestamp_string = date_string + " 23:59:59";
+    EXPECT_EQ(string_to_timestamp(timestamp_string), boost::posix_time::time_from_string(timestamp_string));
+  }
+
+  EXPECT_EQ(string_to_timestamp("1399-12-31"), std::nullopt);
+  EXPECT_EQ(string_to_timestamp("1399-12-31 00:00:00"), std::nullopt);
+  EXPECT_EQ(string_to_timestamp("2000-00-01"), std::nullopt);
+  EXPECT_EQ(string_to_timestamp("2000-02-30 00:00:00"), std::nullopt);
+  EXPECT_EQ(*string_to_timestamp("1400-01-01"), (boost::posix_time::ptime{boost::gregorian::date{1400, 1, 1}}));
+  EXPECT_EQ(*string_to_timestamp("9999-12-31 00:00:00"),
+            (boost::posix_time::ptime{boost::gregorian::date{9999, 12, 31}}));
+
+  // Other formats are still parsed by Boost.
+  EXPECT_EQ(*string_to_timestamp("2000-1-01 00:00:00"), *string_to_timestamp("2000-01-01"));
+  EXPECT_EQ(*string_to_timestamp("2000-01-01 23:59:59.000"), *string_to_timestamp("2000-01-01 23:59:59"));
+}
+
 TEST_F(DateTimeUtilsTest, DateInterval) {
   const auto date = boost::gregorian::date{2000, 1, 31};
   const auto leap_year_date = boost::gregorian::date{2000, 2, 29};
@@ -100,6 +124,21 @@ TEST_F(DateTimeUtilsTest, DateToString) {
   EXPECT_EQ(date_to_string(date), "2000-01-31");
 }
 
+TEST_F(DateTimeUtilsTest, DateDays) {
+  EXPECT_EQ(date_string_to_days("1970-01-01"), 0);
+  EXPECT_EQ(date_string_to_days("1969-12-31"), -1);
+  EXPECT_EQ(date_string_to_days("2000-02-29"), 11016);
+  EXPECT_EQ(date_string_to_days("2001-02-29"), std::nullopt);
+  EXPECT_EQ(date_string_to_days("2000-01-01 00:00:00"), std::nullopt);
+  EXPECT_EQ(date_string_to_days("foo"), std::nullopt);
+
+  EXPECT_EQ(days_to_date(11016), (boost::gregorian::date{2000, 2, 29}));
+  EXPECT_EQ(days_to_date_string(-1), "1969-12-31");
+  for (const auto days : {-1000, 0, 11016, 20000}) {
+    EXPECT_EQ(date_string_to_days(days_to_date_string(days)), days);
+  }
+}
+
 TEST_F(DateTimeUtilsTest, TimestampToString) {
   const auto date = boost::gregorian::date{2000, 1, 31};
   const auto time_without_microseconds = boost::posix_time::time_duration{1, 1, 1, 0};
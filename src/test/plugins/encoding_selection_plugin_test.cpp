@@ -0,0 +1,202 @@
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../../plugins/encoding_selection_plugin.hpp"
+#include "base_test.hpp"
+#include "lib/utils/plugin_test_utils.hpp"
+#include "storage/segment_access_counter.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "storage/table.hpp"
+#include "storage/table_column_definition.hpp"
+#include "utils/invalid_input_exception.hpp"
+#include "utils/plugin_manager.hpp"
+
+namespace hyrise {
+
+class EncodingSelectionPluginTest : public BaseTest {
+ public:
+  void SetUp() override {
+    _table = _create_table();
+    _table->last_chunk()->set_immutable();
+    Hyrise::get().storage_manager.add_table(_table_name, _table);
+  }
+
+ protected:
+  static size_t _select_and_apply_encodings(EncodingSelectionPlugin& plugin) {
+    return plugin._select_and_apply_encodings();
+  }
+
+  static void _set_memory_budget(EncodingSelectionPlugin& plugin, const std::string& value) {
+    plugin._memory_budget_setting->set(value);
+  }
+
+  // Column a holds unique integers, for which FrameOfReference is the smallest encoding. Column s holds four distinct
+  // strings, for which Dictionary with bit-packing is the smallest encoding.
+  static std::shared_ptr<Table> _create_table(const ChunkOffset row_count = ChunkOffset{1000}) {
+    auto table = std::make_shared<Table>(
+        TableColumnDefinitions{{"a", DataType::Int, false}, {"s", DataType::String, false}}, TableType::Data,
+        ChunkOffset{1000});
+    for (auto row = int32_t{0}; row < static_cast<int32_t>(row_count); ++row) {
+      table->append({row * 1000, pmr_string{"value_" + std::to_string(row % 4)}});
+    }
+    return table;
+  }
+
+  SegmentEncodingSpec _encoding_spec(const ColumnID column_id) const {
+    return get_segment_encoding_spec(_table->get_chunk(ChunkID{0})->get_segment(column_id));
+  }
+
+  void _access(const ColumnID column_id, const uint64_t count) {
+    _table->get_chunk(ChunkID{0})->get_segment(column_id)->access_counter[SegmentAccessCounter::AccessType::Random] +=
+        count;
+  }
+
+  const std::string _table_name{"encodingSelectionTestTable"};
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(EncodingSelectionPluginTest, LoadUnloadPlugin) {
+  auto& plugin_manager = Hyrise::get().plugin_manager;
+  EXPECT_NO_THROW(plugin_manager.load_plugin(build_dylib_path("libhyriseEncodingSelectionPlugin")));
+  EXPECT_TRUE(Hyrise::get().settings_manager.has_setting("EncodingSelectionPlugin.MemoryBudget"));
+  EXPECT_NO_THROW(plugin_manager.unload_plugin("hyriseEncodingSelectionPlugin"));
+  EXPECT_FALSE(Hyrise::get().settings_manager.has_setting("EncodingSelectionPlugin.MemoryBudget"));
+}
+
+TEST_F(EncodingSelectionPluginTest, DescriptionAndProvidedFunction) {
+  auto plugin = EncodingSelectionPlugin{};
+  EXPECT_EQ(plugin.description(), "Workload-driven encoding selection plugin");
+  const auto& provided_functions = plugin.provided_user_executable_functions();
+  ASSERT_EQ(provided_functions.size(), 1);
+  EXPECT_EQ(provided_functions.front().first, "SelectEncodings");
+}
+
+TEST_F(EncodingSelectionPluginTest, EncodingSpecs) {
+  const auto fast_spec = SegmentEncodingSpec{EncodingType::Dictionary, VectorCompressionType::FixedWidthInteger};
+  const auto dictionary_spec = SegmentEncodingSpec{EncodingType::Dictionary, VectorCompressionType::BitPacking};
+  for (const auto data_type : {DataType::Int, DataType::Long, DataType::Float, DataType::Double, DataType::String}) {
+    const auto compact_spec = EncodingSelectionPlugin::compact_encoding_spec(data_type);
+    EXPECT_TRUE(encoding_supports_data_type(compact_spec.encoding_type, data_type));
+    EXPECT_EQ(compact_spec.vector_compression_type, VectorCompressionType::BitPacking);
+    EXPECT_EQ(EncodingSelectionPlugin::fast_encoding_spec(data_type), fast_spec);
+    EXPECT_EQ(EncodingSelectionPlugin::candidate_encoding_specs(data_type),
+              (std::vector<SegmentEncodingSpec>{compact_spec, dictionary_spec, fast_spec}));
+  }
+
+  EXPECT_EQ(EncodingSelectionPlugin::compact_encoding_spec(DataType::Int).encoding_type,
+            EncodingType::FrameOfReference);
+  EXPECT_EQ(EncodingSelectionPlugin::compact_encoding_spec(DataType::Double).encoding_type, EncodingType::ALP);
+  EXPECT_EQ(EncodingSelectionPlugin::compact_encoding_spec(DataType::String).encoding_type, EncodingType::FSST);
+}
+
+TEST_F(EncodingSelectionPluginTest, WeightedAccessCount) {
+  auto access_counter = SegmentAccessCounter{};
+  access_counter[SegmentAccessCounter::AccessType::Sequential] += 5;
+  access_counter[SegmentAccessCounter::AccessType::Random] += 2;
+  EXPECT_EQ(EncodingSelectionPlugin::weighted_access_count(access_counter),
+            5 + (2 * EncodingSelectionPlugin::RANDOM_ACCESS_WEIGHT));
+}
+
+TEST_F(EncodingSelectionPluginTest, FirstRunOnlyObserves) {
+  auto plugin = EncodingSelectionPlugin{};
+  _access(ColumnID{1}, 100);
+
+  // Accesses from before the first run do not count, and no segment is re-encoded.
+  EXPECT_EQ(_select_and_apply_encodings(plugin), 0);
+  EXPECT_EQ(_encoding_spec(ColumnID{0}), SegmentEncodingSpec{EncodingType::Unencoded});
+  EXPECT_EQ(_encoding_spec(ColumnID{1}), SegmentEncodingSpec{EncodingType::Unencoded});
+
+  EXPECT_EQ(_select_and_apply_encodings(plugin), 2);
+  EXPECT_EQ(_encoding_spec(ColumnID{0}), EncodingSelectionPlugin::compact_encoding_spec(DataType::Int));
+  EXPECT_EQ(_encoding_spec(ColumnID{1}),
+            (SegmentEncodingSpec{EncodingType::Dictionary, VectorCompressionType::BitPacking}));
+}
+
+TEST_F(EncodingSelectionPluginTest, SelectEncodingsByAccesses) {
+  auto plugin = EncodingSelectionPlugin{};
+  const auto expected_table = _create_table();
+  _select_and_apply_encodings(plugin);
+
+  // Column s is accessed, column a is not. Low-cardinality strings are smaller with Dictionary encoding than with FSST.
+  _access(ColumnID{1}, 1);
+  EXPECT_EQ(_select_and_apply_encodings(plugin), 2);
+  EXPECT_EQ(_encoding_spec(ColumnID{0}), EncodingSelectionPlugin::compact_encoding_spec(DataType::Int));
+  EXPECT_EQ(_encoding_spec(ColumnID{1}), EncodingSelectionPlugin::fast_encoding_spec(DataType::String));
+  EXPECT_TABLE_EQ_ORDERED(_table, expected_table);
+
+  // Access counters are kept when re-encoding.
+  EXPECT_EQ(
+      _table->get_chunk(ChunkID{0})->get_segment(ColumnID{1})->access_counter[SegmentAccessCounter::AccessType::Random],
+      1);
+
+  // Without new accesses, the access score decays. The segment keeps the fast encoding until the score drops below
+  // KEEP_ACCESS_SCORE. Accesses caused by the plugin itself (i.e., when encoding the segments) are not counted.
+  auto access_score = static_cast<double>(EncodingSelectionPlugin::RANDOM_ACCESS_WEIGHT);
+  while (access_score * EncodingSelectionPlugin::ACCESS_SCORE_DECAY >= EncodingSelectionPlugin::KEEP_ACCESS_SCORE) {
+    EXPECT_EQ(_select_and_apply_encodings(plugin), 0);
+    access_score *= EncodingSelectionPlugin::ACCESS_SCORE_DECAY;
+  }
+
+  EXPECT_EQ(_select_and_apply_encodings(plugin), 1);
+  EXPECT_EQ(_encoding_spec(ColumnID{1}),
+            (SegmentEncodingSpec{EncodingType::Dictionary, VectorCompressionType::BitPacking}));
+  EXPECT_TABLE_EQ_ORDERED(_table, expected_table);
+  EXPECT_EQ(_select_and_apply_encodings(plugin), 0);
+}
+
+TEST_F(EncodingSelectionPluginTest, KeepSimilarlySizedEncodings) {
+  auto plugin = EncodingSelectionPlugin{};
+
+  // The values span almost the entire positive integer range, so that FrameOfReference needs 31 bits per value and
+  // does not save MIN_SIZE_REDUCTION compared to the unencoded segment. Dictionary encodings are even larger.
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data,
+                                             ChunkOffset{1000});
+  for (auto row = int32_t{0}; row < 1000; ++row) {
+    table->append({row * 2'000'000});
+  }
+  table->last_chunk()->set_immutable();
+  Hyrise::get().storage_manager.add_table("similarSizeTable", table);
+
+  _select_and_apply_encodings(plugin);
+  _select_and_apply_encodings(plugin);
+  EXPECT_EQ(get_segment_encoding_spec(table->get_chunk(ChunkID{0})->get_segment(ColumnID{0})),
+            SegmentEncodingSpec{EncodingType::Unencoded});
+  EXPECT_EQ(_encoding_spec(ColumnID{0}), EncodingSelectionPlugin::compact_encoding_spec(DataType::Int));
+}
+
+TEST_F(EncodingSelectionPluginTest, MemoryBudget) {
+  auto plugin = EncodingSelectionPlugin{};
+  _set_memory_budget(plugin, "0");
+  _select_and_apply_encodings(plugin);
+
+  // For unique integers, the dictionary encoding is larger than the frame-of-reference encoding. Even though the
+  // segment is accessed, the budget does not allow the larger encoding.
+  _access(ColumnID{0}, 100);
+  _select_and_apply_encodings(plugin);
+  EXPECT_EQ(_encoding_spec(ColumnID{0}), EncodingSelectionPlugin::compact_encoding_spec(DataType::Int));
+
+  _set_memory_budget(plugin, "1000000000");
+  _access(ColumnID{0}, 100);
+  _select_and_apply_encodings(plugin);
+  EXPECT_EQ(_encoding_spec(ColumnID{0}), EncodingSelectionPlugin::fast_encoding_spec(DataType::Int));
+
+  EXPECT_THROW(_set_memory_budget(plugin, "-1"), InvalidInputException);
+  EXPECT_THROW(_set_memory_budget(plugin, ""), InvalidInputException);
+}
+
+TEST_F(EncodingSelectionPluginTest, SkipMutableChunks) {
+  auto plugin = EncodingSelectionPlugin{};
+  const auto table = _create_table(ChunkOffset{1500});
+  Hyrise::get().storage_manager.add_table("mutableTable", table);
+
+  _select_and_apply_encodings(plugin);
+  _select_and_apply_encodings(plugin);
+  EXPECT_EQ(get_segment_encoding_spec(table->get_chunk(ChunkID{0})->get_segment(ColumnID{0})),
+            EncodingSelectionPlugin::compact_encoding_spec(DataType::Int));
+  EXPECT_EQ(get_segment_encoding_spec(table->get_chunk(ChunkID{1})->get_segment(ColumnID{0})),
+            SegmentEncodingSpec{EncodingType::Unencoded});
+}
+
+}  // namespace hyrise